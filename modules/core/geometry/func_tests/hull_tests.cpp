@@ -0,0 +1,216 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/geometry/include/hull.hpp"
+
+namespace {
+
+using ppc::core::geometry::Point;
+using ppc::core::geometry::PointSet;
+
+template <typename T, typename Coordinate>
+PointSet<T> random_points(size_t n, Coordinate coordinate, unsigned seed) {
+  std::mt19937 gen(seed);
+  PointSet<T> points;
+  for (size_t i = 0; i < n; i++) {
+    const T x = coordinate(gen);
+    points.push_back(x, coordinate(gen));
+  }
+  return points;
+}
+
+// Reference: one monotone chain over all the points.
+template <typename T>
+std::vector<Point<T>> reference(const PointSet<T>& points) {
+  std::vector<Point<T>> sorted;
+  for (size_t i = 0; i < points.size(); i++) sorted.push_back(points[i]);
+  std::sort(sorted.begin(), sorted.end());
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+  if (sorted.size() <= 1) return sorted;
+  std::vector<Point<T>> hull;
+  for (int pass = 0; pass < 2; pass++) {
+    const size_t base = hull.size();
+    for (const auto& p : sorted) {
+      while (hull.size() >= base + 2 && cross(hull[hull.size() - 2], hull.back(), p) <= 0) hull.pop_back();
+      hull.push_back(p);
+    }
+    hull.pop_back();
+    std::reverse(sorted.begin(), sorted.end());
+  }
+  return hull;
+}
+
+}  // namespace
+
+TEST(hull_tests, matches_monotone_chain_on_grids) {
+  // small grids put many points on every edge and column; the large sizes
+  // are split into runs over threads
+  for (size_t n : {size_t{0}, size_t{1}, size_t{2}, size_t{3}, size_t{50}, size_t{5000}, size_t{300000}}) {
+    for (int range : {3, 100, 1000000}) {
+      const auto points = random_points<int>(n, std::uniform_int_distribution<int>(-range, range), n + range);
+      EXPECT_EQ(ppc::core::geometry::convex_hull(points), reference(points)) << n << " " << range;
+    }
+  }
+}
+
+TEST(hull_tests, matches_monotone_chain_on_doubles_and_narrow_types) {
+  const auto disc = random_points<double>(200000, std::normal_distribution<double>(0.0, 1.0), 5);
+  EXPECT_EQ(ppc::core::geometry::convex_hull(disc), reference(disc));
+  // int8_t coordinates whose products only fit a wider type
+  const auto bytes = random_points<signed char>(100000, std::uniform_int_distribution<int>(-128, 127), 9);
+  EXPECT_EQ(ppc::core::geometry::convex_hull(bytes), reference(bytes));
+}
+
+TEST(hull_tests, merges_runs_along_bridges) {
+  // two parabolas facing away from each other put nearly every point on the
+  // hull, so the candidates are many and split into runs; the third point
+  // of each column lies just inside
+  const long long n = 60000;
+  const long long lift = 2 * n * n + 1;
+  std::vector<Point<long long>> shuffled;
+  for (long long x = -n; x <= n; x++) {
+    shuffled.insert(shuffled.end(), {{x, -x * x}, {x, x * x - lift}, {x, x * x - lift + 1}});
+  }
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(3));
+  PointSet<long long> points;
+  for (const auto& p : shuffled) points.push_back(p.x, p.y);
+  const auto hull = ppc::core::geometry::convex_hull(points);
+  EXPECT_EQ(hull.size(), static_cast<size_t>(4 * n + 2));
+  EXPECT_EQ(hull, reference(points));
+}
+
+TEST(hull_tests, keeps_only_corners_of_degenerate_sets) {
+  PointSet<int> line;
+  for (int i = 0; i < 7; i++) line.push_back(2 * i - 6, i - 3);
+  EXPECT_EQ(ppc::core::geometry::convex_hull(line), (std::vector<Point<int>>{{-6, -3}, {6, 3}}));
+
+  PointSet<int> column;
+  for (int i = 5; i >= 0; i--) column.push_back(1, i);
+  EXPECT_EQ(ppc::core::geometry::convex_hull(column), (std::vector<Point<int>>{{1, 0}, {1, 5}}));
+
+  PointSet<int> repeated;
+  for (int i = 0; i < 4; i++) repeated.push_back(7, 7);
+  EXPECT_EQ(ppc::core::geometry::convex_hull(repeated), (std::vector<Point<int>>{{7, 7}}));
+
+  // a 3 x 3 grid: only the corners of the square are left
+  PointSet<int> grid;
+  for (int x = 0; x < 3; x++) {
+    for (int y = 0; y < 3; y++) grid.push_back(x, y);
+  }
+  EXPECT_EQ(ppc::core::geometry::convex_hull(grid), (std::vector<Point<int>>{{0, 0}, {2, 0}, {2, 2}, {0, 2}}));
+}
+
+TEST(hull_tests, boundary_keeps_every_point_on_an_edge) {
+  // small grids put many points on the edges, and repeat them
+  for (size_t n : {size_t{3}, size_t{50}, size_t{5000}, size_t{300000}}) {
+    for (int range : {3, 20}) {
+      const auto points = random_points<int>(n, std::uniform_int_distribution<int>(-range, range), n * range);
+      const auto corners = ppc::core::geometry::convex_hull(points);
+      std::vector<Point<int>> expected;
+      for (size_t i = 0; i < points.size(); i++) {
+        const Point<int> p = points[i];
+        for (size_t k = 0; k < corners.size(); k++) {
+          const Point<int> a = corners[k];
+          const Point<int> b = corners[(k + 1) % corners.size()];
+          const bool between = std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+                               std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+          if (between && cross(a, b, p) == 0) {
+            expected.push_back(p);
+            break;
+          }
+        }
+      }
+      auto boundary = ppc::core::geometry::convex_hull(points, ppc::core::geometry::HullPoints::kBoundary);
+      // the distinct points come in the order of the corners
+      auto distinct = boundary;
+      distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+      std::vector<Point<int>> passed;
+      std::copy_if(distinct.begin(), distinct.end(), std::back_inserter(passed), [&](const Point<int>& p) {
+        return std::find(corners.begin(), corners.end(), p) != corners.end();
+      });
+      EXPECT_EQ(passed, corners) << n << " " << range;
+      std::sort(boundary.begin(), boundary.end());
+      std::sort(expected.begin(), expected.end());
+      EXPECT_EQ(boundary, expected) << n << " " << range;
+    }
+  }
+}
+
+TEST(hull_tests, boundary_walks_each_edge_in_order) {
+  // a triangle whose edges hold every integer point, listed backwards and
+  // with its first corner repeated
+  PointSet<int> triangle;
+  for (int i = 4; i >= 0; i--) triangle.push_back(i, 4 - i);
+  for (int i = 3; i > 0; i--) triangle.push_back(i, 0);
+  for (int i = 3; i > 0; i--) triangle.push_back(0, i);
+  triangle.push_back(0, 0);
+  triangle.push_back(1, 1);
+  triangle.push_back(0, 0);
+  EXPECT_EQ(ppc::core::geometry::convex_hull(triangle, ppc::core::geometry::HullPoints::kBoundary),
+            (std::vector<Point<int>>{{0, 0}, {0, 0}, {1, 0}, {2, 0}, {3, 0}, {4, 0}, {3, 1}, {2, 2}, {1, 3}, {0, 4},
+                                     {0, 3}, {0, 2}, {0, 1}}));
+}
+
+TEST(hull_tests, chan_hull_matches_convex_hull) {
+  for (size_t n : {size_t{0}, size_t{1}, size_t{2}, size_t{3}, size_t{50}, size_t{5000}, size_t{300000}}) {
+    for (int range : {3, 100, 1000000}) {
+      const auto points = random_points<int>(n, std::uniform_int_distribution<int>(-range, range), n + range);
+      EXPECT_EQ(ppc::core::geometry::chan_hull(points), ppc::core::geometry::convex_hull(points)) << n << " " << range;
+    }
+  }
+  // every point but the inner column is a vertex, so the wrapping needs
+  // the last round, whose group holds them all
+  const long long n = 20000;
+  const long long lift = 2 * n * n + 1;
+  PointSet<long long> parabolas;
+  for (long long x = -n; x <= n; x++) {
+    parabolas.push_back(x, -x * x);
+    parabolas.push_back(x, x * x - lift);
+    parabolas.push_back(x, x * x - lift + 1);
+  }
+  const auto hull = ppc::core::geometry::chan_hull(parabolas);
+  EXPECT_EQ(hull.size(), static_cast<size_t>(4 * n + 2));
+  EXPECT_EQ(hull, reference(parabolas));
+}
+
+TEST(hull_tests, tangent_is_the_next_wrapping_vertex) {
+  // a regular-ish 12-gon, wrapped from points all around it and from its
+  // own vertices
+  PointSet<int> ring;
+  const std::vector<std::pair<int, int>> corners = {{-2, -5}, {2, -5}, {4, -4}, {5, -2}, {5, 2},   {4, 4},
+                                                     {2, 5},   {-2, 5}, {-4, 4}, {-5, 2}, {-5, -2}, {-4, -4}};
+  for (const auto& [x, y] : corners) ring.push_back(x, y);
+  const auto polygon = ppc::core::geometry::convex_hull(ring);
+  ASSERT_EQ(polygon.size(), size_t{12});
+  const auto top = static_cast<size_t>(std::max_element(polygon.begin(), polygon.end()) - polygon.begin());
+  for (int x = -12; x <= 12; x++) {
+    for (int y = -12; y <= 12; y++) {
+      const Point<int> from{x, y};
+      const bool vertex = std::find(polygon.begin(), polygon.end(), from) != polygon.end();
+      if (!vertex && std::max(std::abs(x), std::abs(y)) <= 5) continue;
+      size_t best = 0;
+      for (size_t i = 1; i < polygon.size(); i++) {
+        if (ppc::core::geometry::detail::wraps_before(from, polygon[i], polygon[best])) best = i;
+      }
+      EXPECT_EQ(ppc::core::geometry::detail::tangent(polygon, top, from), best) << x << " " << y;
+    }
+  }
+}
+
+TEST(hull_tests, start_at_keeps_the_orientation) {
+  const std::vector<double> xy = {0, 0, 2, 0, 1, 1, 2, 2, 0, 2};
+  auto hull = ppc::core::geometry::convex_hull(ppc::core::geometry::from_interleaved(xy.data(), 5));
+  ASSERT_EQ(hull, (std::vector<Point<double>>{{0, 0}, {2, 0}, {2, 2}, {0, 2}}));
+  // lowest point first, the rightmost of those on a tie
+  ppc::core::geometry::start_at(hull, [](const Point<double>& a, const Point<double>& b) {
+    return a.y < b.y || (a.y == b.y && a.x > b.x);
+  });
+  EXPECT_EQ(hull, (std::vector<Point<double>>{{2, 0}, {2, 2}, {0, 2}, {0, 0}}));
+}
@@ -0,0 +1,571 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GEOMETRY_INCLUDE_HULL_HPP_
+#define MODULES_CORE_GEOMETRY_INCLUDE_HULL_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstdlib>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/quicksort.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::geometry {
+
+// A point, ordered by x and then y.
+template <typename T>
+struct Point {
+  T x;
+  T y;
+
+  auto operator<=>(const Point&) const = default;
+};
+
+// Points as two flat coordinate arrays, so that the passes over every input
+// point stream through plain arrays instead of one object per point.
+template <typename T>
+struct PointSet {
+  std::vector<T> x;
+  std::vector<T> y;
+
+  [[nodiscard]] size_t size() const { return x.size(); }
+  [[nodiscard]] Point<T> operator[](size_t i) const { return {x[i], y[i]}; }
+  void reserve(size_t n) {
+    x.reserve(n);
+    y.reserve(n);
+  }
+  void push_back(T px, T py) {
+    x.push_back(px);
+    y.push_back(py);
+  }
+};
+
+// PointSet of n points stored as x0, y0, x1, y1, ...
+template <typename T>
+PointSet<T> from_interleaved(const T* xy, size_t n) {
+  PointSet<T> points;
+  points.x.resize(n);
+  points.y.resize(n);
+  for (size_t i = 0; i < n; i++) {
+    points.x[i] = xy[2 * i];
+    points.y[i] = xy[2 * i + 1];
+  }
+  return points;
+}
+
+namespace detail {
+
+// Per thread; below it the hull is built on one thread.
+constexpr size_t kHullMinPerThread = size_t{1} << 15;
+
+inline int hull_threads(size_t n) {
+#ifdef _OPENMP
+  const size_t useful = std::max<size_t>(1, n / kHullMinPerThread);
+  return static_cast<int>(std::min<size_t>(omp_get_max_threads(), useful));
+#else
+  (void)n;
+  return 1;
+#endif
+}
+
+// Integer coordinates are multiplied in long long, so cross products of
+// narrow types cannot overflow.
+template <typename T>
+using Wide = std::conditional_t<std::is_integral_v<T>, long long, T>;
+
+}  // namespace detail
+
+// Twice the signed area of the triangle o, a, b: positive if o -> a -> b
+// turns counter-clockwise, zero if the points are collinear.
+template <typename T>
+detail::Wide<T> cross(const Point<T>& o, const Point<T>& a, const Point<T>& b) {
+  using W = detail::Wide<T>;
+  return (W(a.x) - W(o.x)) * (W(b.y) - W(o.y)) - (W(a.y) - W(o.y)) * (W(b.x) - W(o.x));
+}
+
+namespace detail {
+
+// The eight directions of the Akl-Toussaint octagon in counter-clockwise
+// order, starting downwards.
+constexpr int kDirections = 8;
+constexpr std::array<std::pair<int, int>, kDirections> kDirection = {
+    {{0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}}};
+
+// The point furthest in each direction, ties going to the lexicographically
+// smallest, so that every thread and rank picks the same one.
+template <typename T>
+struct Extremes {
+  bool empty = true;
+  std::array<Point<T>, kDirections> point{};
+
+  void add(const Point<T>& p) {
+    if (empty) {
+      point.fill(p);
+      empty = false;
+      return;
+    }
+    for (int d = 0; d < kDirections; d++) {
+      const auto [dx, dy] = kDirection[d];
+      const auto score = [&](const Point<T>& q) { return Wide<T>(dx) * q.x + Wide<T>(dy) * q.y; };
+      if (score(p) > score(point[d]) || (score(p) == score(point[d]) && p < point[d])) point[d] = p;
+    }
+  }
+
+  void add(const Extremes& other) {
+    if (other.empty) return;
+    for (const auto& p : other.point) add(p);
+  }
+};
+
+template <typename T>
+Extremes<T> find_extremes(const PointSet<T>& points) {
+  const auto n = static_cast<long long>(points.size());
+  const int threads = hull_threads(points.size());
+  std::vector<Extremes<T>> part(threads);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (int t = 0; t < threads; t++) {
+    const long long first = n * t / threads;
+    const long long last = n * (t + 1) / threads;
+    if (first == last) continue;
+    // the range of x, y, x + y and x - y in one branch-free pass, which
+    // gives the best score in every direction, then the smallest point that
+    // reaches it
+    Wide<T> lo_x = points.x[first];
+    Wide<T> hi_x = lo_x;
+    Wide<T> lo_y = points.y[first];
+    Wide<T> hi_y = lo_y;
+    Wide<T> lo_sum = lo_x + lo_y;
+    Wide<T> hi_sum = lo_sum;
+    Wide<T> lo_diff = lo_x - lo_y;
+    Wide<T> hi_diff = lo_diff;
+    for (long long i = first + 1; i < last; i++) {
+      const Wide<T> x = points.x[i];
+      const Wide<T> y = points.y[i];
+      lo_x = std::min(lo_x, x);
+      hi_x = std::max(hi_x, x);
+      lo_y = std::min(lo_y, y);
+      hi_y = std::max(hi_y, y);
+      lo_sum = std::min(lo_sum, x + y);
+      hi_sum = std::max(hi_sum, x + y);
+      lo_diff = std::min(lo_diff, x - y);
+      hi_diff = std::max(hi_diff, x - y);
+    }
+    std::array<long long, kDirections> at;
+    at.fill(-1);
+    const auto reach = [&](int d, long long i) {
+      if (at[d] < 0 || points[i] < points[at[d]]) at[d] = i;
+    };
+    for (long long i = first; i < last; i++) {
+      const Wide<T> x = points.x[i];
+      const Wide<T> y = points.y[i];
+      if (x != lo_x && x != hi_x && y != lo_y && y != hi_y && x + y != lo_sum && x + y != hi_sum &&
+          x - y != lo_diff && x - y != hi_diff) {
+        continue;
+      }
+      if (y == lo_y) reach(0, i);
+      if (x - y == hi_diff) reach(1, i);
+      if (x == hi_x) reach(2, i);
+      if (x + y == hi_sum) reach(3, i);
+      if (y == hi_y) reach(4, i);
+      if (x - y == lo_diff) reach(5, i);
+      if (x == lo_x) reach(6, i);
+      if (x + y == lo_sum) reach(7, i);
+    }
+    for (int d = 0; d < kDirections; d++) part[t].add(points[at[d]]);
+  }
+  for (int t = 1; t < threads; t++) part[0].add(part[t]);
+  return part[0];
+}
+
+// The octagon spanned by the extremes, repeated corners dropped. Empty if
+// it is not a proper convex polygon, which leaves nothing to discard.
+template <typename T>
+std::vector<Point<T>> octagon(const Extremes<T>& extremes) {
+  std::vector<Point<T>> corners;
+  if (extremes.empty) return corners;
+  for (const auto& p : extremes.point) {
+    if (corners.empty() || !(p == corners.back())) corners.push_back(p);
+  }
+  while (corners.size() > 1 && corners.back() == corners.front()) corners.pop_back();
+  if (corners.size() < 3) return {};
+  // rounding of floating point scores could pick a corner off the hull
+  for (size_t i = 0; i < corners.size(); i++) {
+    const size_t j = (i + 1) % corners.size();
+    if (cross(corners[i], corners[j], corners[(j + 1) % corners.size()]) < 0) return {};
+  }
+  return corners;
+}
+
+// The points that are not strictly inside the octagon, gathered per thread.
+// Only those can be hull vertices, and for most inputs that is a small
+// fraction of them.
+template <typename T>
+std::vector<Point<T>> filter(const PointSet<T>& points, const std::vector<Point<T>>& octagon) {
+  // cross() against each edge with the edge vectors taken out of the loop,
+  // in the same arithmetic, so the test is exact for every point it is for
+  struct Edge {
+    Point<T> from;
+    Wide<T> dx;
+    Wide<T> dy;
+  };
+  std::vector<Edge> edges;
+  for (size_t i = 0; i < octagon.size(); i++) {
+    const Point<T>& a = octagon[i];
+    const Point<T>& b = octagon[(i + 1) % octagon.size()];
+    edges.push_back({a, Wide<T>(b.x) - Wide<T>(a.x), Wide<T>(b.y) - Wide<T>(a.y)});
+  }
+  const auto inside = [&](T x, T y) {
+    if (edges.empty()) return false;
+    for (const Edge& e : edges) {
+      if (e.dx * (Wide<T>(y) - Wide<T>(e.from.y)) - e.dy * (Wide<T>(x) - Wide<T>(e.from.x)) <= 0) return false;
+    }
+    return true;
+  };
+  const auto n = static_cast<long long>(points.size());
+  const int threads = hull_threads(points.size());
+  std::vector<std::vector<Point<T>>> part(threads);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (int t = 0; t < threads; t++) {
+    for (long long i = n * t / threads; i < n * (t + 1) / threads; i++) {
+      if (!inside(points.x[i], points.y[i])) part[t].push_back(points[i]);
+    }
+  }
+  for (int t = 1; t < threads; t++) part[0].insert(part[0].end(), part[t].begin(), part[t].end());
+  return std::move(part[0]);
+}
+
+// A hull as Andrew's monotone chains: lower runs from the smallest to the
+// largest point and upper back again, both holding the two ends.
+template <typename T>
+struct Chains {
+  std::vector<Point<T>> lower;
+  std::vector<Point<T>> upper;
+};
+
+// Monotone chain over sorted, distinct points; collinear points are dropped.
+template <typename T>
+Chains<T> monotone_chain(const Point<T>* first, const Point<T>* last) {
+  Chains<T> hull;
+  const auto add = [](std::vector<Point<T>>& chain, const Point<T>& p) {
+    while (chain.size() >= 2 && cross(chain[chain.size() - 2], chain.back(), p) <= 0) chain.pop_back();
+    chain.push_back(p);
+  };
+  for (const Point<T>* p = first; p != last; p++) add(hull.lower, *p);
+  for (const Point<T>* p = last; p != first;) add(hull.upper, *--p);
+  return hull;
+}
+
+// Hull of two hulls whose points are split by a vertical line, left wholly
+// before right. The bridges are found by walking inwards along both chains
+// until no step improves them, so the merge costs O(h) however many points
+// the hulls were built from.
+template <typename T>
+Chains<T> merge_separated(const Chains<T>& left, const Chains<T>& right) {
+  Chains<T> hull;
+  const auto& a = left.lower;
+  const auto& b = right.lower;
+  size_t i = a.size() - 1;
+  size_t j = 0;
+  for (bool moved = true; moved;) {
+    moved = false;
+    for (; i > 0 && cross(a[i - 1], a[i], b[j]) <= 0; i--) moved = true;
+    for (; j + 1 < b.size() && cross(a[i], b[j], b[j + 1]) <= 0; j++) moved = true;
+  }
+  hull.lower.assign(a.begin(), a.begin() + static_cast<ptrdiff_t>(i) + 1);
+  hull.lower.insert(hull.lower.end(), b.begin() + static_cast<ptrdiff_t>(j), b.end());
+
+  const auto& c = right.upper;
+  const auto& d = left.upper;
+  i = c.size() - 1;
+  j = 0;
+  for (bool moved = true; moved;) {
+    moved = false;
+    for (; i > 0 && cross(c[i - 1], c[i], d[j]) <= 0; i--) moved = true;
+    for (; j + 1 < d.size() && cross(c[i], d[j], d[j + 1]) <= 0; j++) moved = true;
+  }
+  hull.upper.assign(c.begin(), c.begin() + static_cast<ptrdiff_t>(i) + 1);
+  hull.upper.insert(hull.upper.end(), d.begin() + static_cast<ptrdiff_t>(j), d.end());
+  return hull;
+}
+
+// The chains as one counter-clockwise polygon from the smallest point.
+template <typename T>
+std::vector<Point<T>> polygon(const Chains<T>& hull) {
+  if (hull.lower.size() <= 1) return hull.lower;
+  std::vector<Point<T>> vertices(hull.lower.begin(), hull.lower.end() - 1);
+  vertices.insert(vertices.end(), hull.upper.begin(), hull.upper.end() - 1);
+  return vertices;
+}
+
+// Hull of the points outside the octagon: they are sorted, split into one
+// run of whole x columns per thread, each run gets its own monotone chain
+// and neighbouring runs are merged pairwise up a tree.
+template <typename T>
+Chains<T> hull_chains(std::vector<Point<T>> candidates) {
+  sort::quicksort(candidates);
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+  if (candidates.empty()) return {};
+  const size_t n = candidates.size();
+  const int threads = hull_threads(n);
+  std::vector<size_t> bounds = {0};
+  for (int t = 1; t < threads; t++) {
+    size_t b = std::max(bounds.back(), n * t / threads);
+    while (b > 0 && b < n && candidates[b].x == candidates[b - 1].x) b++;
+    if (b > bounds.back() && b < n) bounds.push_back(b);
+  }
+  bounds.push_back(n);
+  const int runs = static_cast<int>(bounds.size()) - 1;
+  std::vector<Chains<T>> part(runs);
+#pragma omp parallel for num_threads(runs) schedule(static) if (runs > 1)
+  for (int r = 0; r < runs; r++) {
+    part[r] = monotone_chain(candidates.data() + bounds[r], candidates.data() + bounds[r + 1]);
+  }
+  for (int step = 1; step < runs; step *= 2) {
+#pragma omp parallel for num_threads(runs) schedule(static) if (runs > 2 * step)
+    for (int r = 0; r < runs - step; r += 2 * step) part[r] = merge_separated(part[r], part[r + step]);
+  }
+  return std::move(part[0]);
+}
+
+// Where a point lies on the boundary of a hull polygon from polygon(): the
+// edge it is on, counted from the one starting at the smallest corner, and
+// how far along it. A corner starts its edge rather than ending one.
+template <typename T>
+struct BoundaryKey {
+  size_t edge;
+  Wide<T> along;
+  Point<T> point;
+
+  bool operator<(const BoundaryKey& other) const {
+    return edge < other.edge || (edge == other.edge && along < other.along);
+  }
+};
+
+// Finds p on the boundary of corners, whose largest corner is corners[top]:
+// both ends in x are checked for a vertical edge and everything between is
+// found on the lower or upper chain by binary search. False if p is not on
+// the boundary.
+template <typename T>
+bool locate(const std::vector<Point<T>>& corners, size_t top, const Point<T>& p, BoundaryKey<T>& key) {
+  const size_t h = corners.size();
+  const Point<T>& lo = corners[0];
+  const Point<T>& hi = corners[top];
+  const auto at = [&](size_t edge) {
+    const Point<T>& from = corners[edge];
+    key = {edge, std::abs(Wide<T>(p.x) - Wide<T>(from.x)) + std::abs(Wide<T>(p.y) - Wide<T>(from.y)), p};
+    return true;
+  };
+  if (p.x < lo.x || p.x > hi.x) return false;
+  if (p == lo) return at(0);
+  if (p.x == lo.x) return h > 1 && corners[h - 1].x == lo.x && p.y > lo.y && p.y <= corners[h - 1].y && at(h - 1);
+  if (p == hi) return at(top);
+  if (p.x == hi.x) return corners[top - 1].x == hi.x && p.y >= corners[top - 1].y && at(top - 1);
+  // the lower chain runs up in x over corners[0..top], the upper one back
+  // down over corners[top..h) and on to corners[0]
+  const auto lower = std::partition_point(corners.begin(), corners.begin() + static_cast<ptrdiff_t>(top) + 1,
+                                          [&](const Point<T>& c) { return c.x <= p.x; });
+  const auto i = static_cast<size_t>(lower - corners.begin()) - 1;
+  if (cross(corners[i], corners[i + 1], p) == 0) return at(i);
+  const auto upper = std::partition_point(corners.begin() + static_cast<ptrdiff_t>(top), corners.end(),
+                                          [&](const Point<T>& c) { return c.x >= p.x; });
+  const auto j = static_cast<size_t>(upper - corners.begin()) - 1;
+  return cross(corners[j], corners[(j + 1) % h], p) == 0 && at(j);
+}
+
+// The candidates that lie on the boundary of the polygon corners, repeats
+// included, in counter-clockwise order from its smallest corner.
+template <typename T>
+std::vector<Point<T>> boundary(const std::vector<Point<T>>& corners, const std::vector<Point<T>>& candidates) {
+  if (corners.empty()) return {};
+  const auto top = static_cast<size_t>(std::max_element(corners.begin(), corners.end()) - corners.begin());
+  const auto n = static_cast<long long>(candidates.size());
+  const int threads = hull_threads(candidates.size());
+  std::vector<std::vector<BoundaryKey<T>>> part(threads);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (int t = 0; t < threads; t++) {
+    BoundaryKey<T> key;
+    for (long long i = n * t / threads; i < n * (t + 1) / threads; i++) {
+      if (locate(corners, top, candidates[i], key)) part[t].push_back(key);
+    }
+  }
+  for (int t = 1; t < threads; t++) part[0].insert(part[0].end(), part[t].begin(), part[t].end());
+  sort::quicksort(part[0]);
+  std::vector<Point<T>> points(part[0].size());
+  for (size_t i = 0; i < points.size(); i++) points[i] = part[0][i].point;
+  return points;
+}
+
+// True if wrapping the hull from `from` should go on to a rather than b: a
+// lies further clockwise, or as far and further out. `from` itself is never
+// chosen over another point. Every candidate lies within the angle < 180
+// degrees the hull has at `from`, so this orders them.
+template <typename T>
+bool wraps_before(const Point<T>& from, const Point<T>& a, const Point<T>& b) {
+  if (a == from) return false;
+  if (b == from) return true;
+  const Wide<T> turn = cross(from, b, a);
+  if (turn != 0) return turn < 0;
+  const auto far = [&](const Point<T>& q) {
+    return std::abs(Wide<T>(q.x) - Wide<T>(from.x)) + std::abs(Wide<T>(q.y) - Wide<T>(from.y));
+  };
+  return far(a) > far(b);
+}
+
+// The vertex of a polygon from polygon(), whose largest vertex is
+// polygon[top], that wrapping from `from` goes on to: the one every vertex
+// lies left of or on the line to. `from` is a vertex of the hull of a set
+// holding the polygon, so it lies outside it or is one of its vertices, and
+// then the answer is the next one.
+//
+// Seen from outside, the vertices rise counter-clockwise from that one to
+// the opposite tangent and fall back again, so it is found by binary search
+// over the edges as in Chan's algorithm.
+template <typename T>
+size_t tangent(const std::vector<Point<T>>& polygon, size_t top, const Point<T>& from) {
+  const size_t k = polygon.size();
+  if (k <= 3) {
+    size_t best = 0;
+    for (size_t i = 1; i < k; i++) {
+      if (wraps_before(from, polygon[i], polygon[best])) best = i;
+    }
+    return best;
+  }
+  const auto rise_end = polygon.begin() + static_cast<ptrdiff_t>(top) + 1;
+  const auto lower = std::lower_bound(polygon.begin(), rise_end, from);
+  if (lower != rise_end && *lower == from) return static_cast<size_t>(lower - polygon.begin() + 1) % k;
+  const auto upper = std::lower_bound(polygon.begin() + static_cast<ptrdiff_t>(top), polygon.end(), from,
+                                      std::greater<Point<T>>());
+  if (upper != polygon.end() && *upper == from) return static_cast<size_t>(upper - polygon.begin() + 1) % k;
+
+  const auto vertex = [&](size_t i) -> const Point<T>& { return polygon[i % k]; };
+  // an edge rises if its end lies further counter-clockwise; one that stays
+  // on the line from `from` only does so at the tangents and counts as falling
+  const auto rises = [&](size_t i) { return cross(from, vertex(i), vertex(i + 1)) > 0; };
+  const auto lowest = [&](size_t i) { return !rises(i + k - 1) && rises(i); };
+  if (lowest(0)) return 0;
+  // the answer lies in (a, b], and a is not it
+  size_t a = 0;
+  size_t b = k;
+  while (b - a > 1) {
+    const size_t c = (a + b) / 2;
+    if (lowest(c)) return c;
+    const bool up_a = rises(a);
+    const bool up_c = rises(c);
+    const bool same_run = up_a ? cross(from, vertex(a), vertex(c)) > 0 : cross(from, vertex(a), vertex(c)) <= 0;
+    if (up_a != up_c ? up_a : same_run) {
+      a = c;
+    } else {
+      b = c;
+    }
+  }
+  return b % k;
+}
+
+// Hulls of the candidates taken m at a time, as polygons with the index of
+// their largest vertex.
+template <typename T>
+void group_hulls(const std::vector<Point<T>>& candidates, size_t m, std::vector<std::vector<Point<T>>>& hulls,
+                 std::vector<size_t>& tops) {
+  const auto groups = static_cast<long long>((candidates.size() + m - 1) / m);
+  hulls.assign(groups, {});
+  tops.assign(groups, 0);
+  const int threads = hull_threads(candidates.size());
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long g = 0; g < groups; g++) {
+    const size_t from = static_cast<size_t>(g) * m;
+    std::vector<Point<T>> group(candidates.begin() + static_cast<ptrdiff_t>(from),
+                                candidates.begin() + static_cast<ptrdiff_t>(std::min(from + m, candidates.size())));
+    std::sort(group.begin(), group.end());
+    group.erase(std::unique(group.begin(), group.end()), group.end());
+    hulls[g] = polygon(monotone_chain(group.data(), group.data() + group.size()));
+    tops[g] = static_cast<size_t>(std::max_element(hulls[g].begin(), hulls[g].end()) - hulls[g].begin());
+  }
+}
+
+// One round of Chan's algorithm: wraps the hull from start through groups of
+// m candidates for at most m steps. Empty if the hull has more vertices.
+template <typename T>
+std::vector<Point<T>> wrap_groups(const std::vector<Point<T>>& candidates, const Point<T>& start, size_t m) {
+  std::vector<std::vector<Point<T>>> hulls;
+  std::vector<size_t> tops;
+  group_hulls(candidates, m, hulls, tops);
+  std::vector<Point<T>> hull = {start};
+  for (size_t step = 0; step < m; step++) {
+    const Point<T> from = hull.back();
+    Point<T> next = from;
+    for (size_t g = 0; g < hulls.size(); g++) {
+      const Point<T>& q = hulls[g][tangent(hulls[g], tops[g], from)];
+      if (wraps_before(from, q, next)) next = q;
+    }
+    if (next == from || next == start) return hull;
+    hull.push_back(next);
+  }
+  return {};
+}
+
+}  // namespace detail
+
+// Which points of the input make up a hull: only its corners, or every
+// input point on its boundary - the corners, the points on its edges and
+// any repeats of them - in the order the boundary passes them.
+enum class HullPoints { kCorners, kBoundary };
+
+// Convex hull of the points as a counter-clockwise polygon that starts at
+// the smallest point (least x, then least y). With kCorners, the default,
+// points on an edge and repeated points are dropped, so one or two distinct
+// points are their own hull; kBoundary keeps them.
+//
+// The points are first checked against the octagon of their extremes in
+// eight directions (Akl-Toussaint), which throws out everything strictly
+// inside it in one parallel pass over the coordinate arrays. The rest are
+// sorted and split into runs by x, each thread builds the hull of its run
+// and the run hulls are merged pairwise along their bridges, so the whole
+// is O(n) plus the sort of the survivors. kBoundary then looks up each
+// survivor on the hull by binary search.
+template <typename T>
+std::vector<Point<T>> convex_hull(const PointSet<T>& points, HullPoints which = HullPoints::kCorners) {
+  auto candidates = detail::filter(points, detail::octagon(detail::find_extremes(points)));
+  if (which == HullPoints::kCorners) return detail::polygon(detail::hull_chains(std::move(candidates)));
+  return detail::boundary(detail::polygon(detail::hull_chains(candidates)), candidates);
+}
+
+// The same hull as convex_hull() with kCorners, by Chan's output-sensitive
+// algorithm. After the octagon filter the candidates are split into groups
+// of m, whose hulls are built on the threads, and the hull is wrapped as in
+// Jarvis' march, each step taking the tangent to every group hull by binary
+// search. That costs O(n log m) for up to m steps, and m is squared from 4
+// until the wrap closes, so the whole is O(n log h) for h hull vertices
+// however many of the points lie on a circle.
+template <typename T>
+std::vector<Point<T>> chan_hull(const PointSet<T>& points) {
+  const auto candidates = detail::filter(points, detail::octagon(detail::find_extremes(points)));
+  if (candidates.empty()) return {};
+  const Point<T> start = *std::min_element(candidates.begin(), candidates.end());
+  for (size_t m = 4;; m = m * m) {
+    m = std::min(m, candidates.size());
+    auto hull = detail::wrap_groups(candidates, start, m);
+    if (!hull.empty()) return hull;
+  }
+}
+
+// Rotates a hull from convex_hull() to start at its vertex that is least by
+// comp, keeping the orientation; for the tasks that number hulls from
+// another corner.
+template <typename T, typename Compare>
+void start_at(std::vector<Point<T>>& hull, Compare comp) {
+  std::rotate(hull.begin(), std::min_element(hull.begin(), hull.end(), comp), hull.end());
+}
+
+}  // namespace ppc::core::geometry
+
+#endif  // MODULES_CORE_GEOMETRY_INCLUDE_HULL_HPP_
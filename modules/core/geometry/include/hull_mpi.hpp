@@ -0,0 +1,173 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GEOMETRY_INCLUDE_HULL_MPI_HPP_
+#define MODULES_CORE_GEOMETRY_INCLUDE_HULL_MPI_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/serialization/vector.hpp>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "core/geometry/include/hull.hpp"
+#include "core/sort/include/distribute_mpi.hpp"
+
+namespace ppc::core::geometry {
+
+namespace detail {
+
+// Points travel as flat x0, y0, x1, y1, ... arrays.
+template <typename T>
+std::vector<T> flatten(const std::vector<Point<T>>& points) {
+  std::vector<T> xy;
+  xy.reserve(2 * points.size());
+  for (const auto& p : points) xy.insert(xy.end(), {p.x, p.y});
+  return xy;
+}
+
+template <typename T>
+std::vector<Point<T>> unflatten(const std::vector<T>& xy) {
+  std::vector<Point<T>> points(xy.size() / 2);
+  for (size_t i = 0; i < points.size(); i++) points[i] = {xy[2 * i], xy[2 * i + 1]};
+  return points;
+}
+
+// Vertices of a convex_hull() polygon in sorted order: its lower chain
+// runs up to the largest vertex and the rest is the upper chain, which runs
+// back down, so the two only need merging.
+template <typename T>
+std::vector<Point<T>> sorted_vertices(const std::vector<Point<T>>& polygon) {
+  std::vector<Point<T>> sorted(polygon.size());
+  if (polygon.empty()) return sorted;
+  const auto top = std::max_element(polygon.begin(), polygon.end());
+  std::merge(polygon.begin(), top + 1, polygon.rbegin(), std::make_reverse_iterator(top + 1), sorted.begin());
+  return sorted;
+}
+
+// The local points outside the octagon of the extremes of every rank.
+template <typename T>
+std::vector<Point<T>> filter_global(const boost::mpi::communicator& world, const PointSet<T>& local) {
+  const Extremes<T> mine = find_extremes(local);
+  std::vector<T> packed;
+  for (const auto& p : mine.point) {
+    if (!mine.empty) packed.insert(packed.end(), {p.x, p.y});
+  }
+  std::vector<std::vector<T>> all;
+  boost::mpi::all_gather(world, packed, all);
+  Extremes<T> global;
+  for (const auto& part : all) {
+    for (const auto& p : unflatten(part)) global.add(p);
+  }
+  return filter(local, octagon(global));
+}
+
+}  // namespace detail
+
+// Even block distribution of the points held on root, as
+// sort::scatter_even() does for each coordinate array.
+template <typename T>
+PointSet<T> scatter_points(const boost::mpi::communicator& world, const PointSet<T>& all, int root = 0) {
+  return {sort::scatter_even(world, all.x, root), sort::scatter_even(world, all.y, root)};
+}
+
+// convex_hull() of the points all ranks hold together, on rank 0; other
+// ranks get an empty vector.
+//
+// The ranks first agree on one Akl-Toussaint octagon from the extremes of
+// every rank, so each of them throws out the points inside the global
+// octagon rather than just its own, and builds the hull of what is left on
+// its threads. The hulls then go up a binary tree of ranks, each merge
+// taking only the vertices of two hulls. Slices of the input overlap in
+// space, so unlike the thread runs their hulls are not split by a line and
+// are merged by one monotone chain over both vertex lists instead of along
+// bridges. The chains of a hull keep its vertices sorted, so that is still
+// linear in the vertices. For kBoundary the corners are then broadcast and
+// every rank sends only its own points that lie on the boundary.
+template <typename T>
+std::vector<Point<T>> convex_hull(const boost::mpi::communicator& world, const PointSet<T>& local,
+                                  HullPoints which = HullPoints::kCorners) {
+  const auto candidates = detail::filter_global(world, local);
+  std::vector<Point<T>> hull = detail::polygon(detail::hull_chains(candidates));
+
+  const int rank = world.rank();
+  for (int step = 1; step < world.size(); step *= 2) {
+    if (rank % (2 * step) == step) {
+      world.send(rank - step, 0, detail::flatten(hull));
+      hull.clear();
+      break;
+    }
+    if (rank + step >= world.size()) continue;
+    std::vector<T> theirs;
+    world.recv(rank + step, 0, theirs);
+    const auto a = detail::sorted_vertices(hull);
+    const auto b = detail::sorted_vertices(detail::unflatten(theirs));
+    std::vector<Point<T>> both(a.size() + b.size());
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), both.begin());
+    both.erase(std::unique(both.begin(), both.end()), both.end());
+    hull = detail::polygon(detail::monotone_chain(both.data(), both.data() + both.size()));
+  }
+  if (which == HullPoints::kCorners) return hull;
+
+  std::vector<T> corners = detail::flatten(hull);
+  boost::mpi::broadcast(world, corners, 0);
+  const auto on_boundary = detail::flatten(detail::boundary(detail::unflatten(corners), candidates));
+  std::vector<std::vector<T>> parts;
+  boost::mpi::gather(world, on_boundary, parts, 0);
+  if (rank != 0) return {};
+  std::vector<Point<T>> points;
+  for (const auto& part : parts) {
+    const auto some = detail::unflatten(part);
+    points.insert(points.end(), some.begin(), some.end());
+  }
+  return detail::boundary(hull, points);
+}
+
+// chan_hull() of the points all ranks hold together, on every rank.
+//
+// After the same octagon filter as convex_hull() each rank builds the hull
+// of its own candidates on its threads, which serves as its group in Chan's
+// algorithm, and the wrapping runs on all ranks in lockstep: at each step
+// every rank finds the tangent to its hull by binary search and one small
+// collective of a single point per rank picks the next vertex on all of
+// them alike. The traffic per step does not grow with the points, and no
+// rank ever waits on a root to decide.
+template <typename T>
+std::vector<Point<T>> chan_hull(const boost::mpi::communicator& world, const PointSet<T>& local) {
+  const auto candidates = detail::filter_global(world, local);
+  const auto group = detail::polygon(detail::hull_chains(candidates));
+  const auto top = static_cast<size_t>(std::max_element(group.begin(), group.end()) - group.begin());
+
+  // every rank offers one point as {x, y, 1}, or {0, 0, 0} for none, and
+  // the best of all offers is taken
+  std::vector<T> offers(3 * static_cast<size_t>(world.size()));
+  const auto best = [&](const Point<T>& offer, bool offered, auto better) {
+    const T mine[3] = {offer.x, offer.y, T(offered ? 1 : 0)};
+    boost::mpi::all_gather(world, mine, 3, offers.data());
+    std::vector<Point<T>> chosen;
+    for (size_t r = 0; r < offers.size(); r += 3) {
+      const Point<T> p{offers[r], offers[r + 1]};
+      if (offers[r + 2] != T(0) && (chosen.empty() || better(p, chosen[0]))) chosen.assign(1, p);
+    }
+    return chosen;
+  };
+  const auto start = best(group.empty() ? Point<T>{} : group[0], !group.empty(), std::less<Point<T>>());
+  if (start.empty()) return {};
+
+  std::vector<Point<T>> hull = start;
+  while (true) {
+    const Point<T> from = hull.back();
+    const Point<T> q = group.empty() ? from : group[detail::tangent(group, top, from)];
+    const auto next = best(q, !(q == from), [&](const Point<T>& a, const Point<T>& b) {
+      return detail::wraps_before(from, a, b);
+    });
+    if (next.empty() || next[0] == hull.front()) return hull;
+    hull.push_back(next[0]);
+  }
+}
+
+}  // namespace ppc::core::geometry
+
+#endif  // MODULES_CORE_GEOMETRY_INCLUDE_HULL_MPI_HPP_
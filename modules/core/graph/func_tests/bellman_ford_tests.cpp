@@ -0,0 +1,90 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "core/graph/include/bellman_ford.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+// n vertices with degree edges each to random heads. Weights are w(u, v) +
+// p(u) - p(v) for w >= 0 and a random potential p, so they take both signs
+// but every cycle weighs the sum of its w and none is negative.
+ppc::core::sparse::CSR<int> random_graph(int n, int degree, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> head(0, n - 1);
+  std::uniform_int_distribution<int> weight(0, 20);
+  std::uniform_int_distribution<int> potential(-50, 50);
+  std::vector<int> p(n);
+  for (auto& x : p) x = potential(gen);
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = n;
+  for (int v = 0; v < n; v++) {
+    for (int k = 0; k < degree; k++) {
+      const int u = head(gen);
+      g.col_idx.push_back(u);
+      g.values.push_back(weight(gen) + p[v] - p[u]);
+    }
+    g.row_ptr.push_back(static_cast<int>(g.col_idx.size()));
+  }
+  return g;
+}
+
+// Reference distances: V - 1 rounds over every edge.
+std::vector<int> reference(const ppc::core::sparse::CSR<int>& g, int source) {
+  const int inf = ppc::core::graph::unreachable<int>();
+  std::vector<int> dist(g.rows, inf);
+  dist[source] = 0;
+  for (int round = 1; round < g.rows; round++) {
+    for (int v = 0; v < g.rows; v++) {
+      if (dist[v] == inf) continue;
+      for (int e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+        if (dist[v] + g.values[e] < dist[g.col_idx[e]]) dist[g.col_idx[e]] = dist[v] + g.values[e];
+      }
+    }
+  }
+  return dist;
+}
+
+}  // namespace
+
+TEST(bellman_ford_tests, negative_weights_match_reference) {
+  for (int degree : {1, 2, 5}) {
+    const auto g = random_graph(500, degree, degree);
+    std::vector<int> dist;
+    ASSERT_TRUE(ppc::core::graph::bellman_ford(g.view(), 0, dist));
+    EXPECT_EQ(dist, reference(g, 0));
+  }
+}
+
+TEST(bellman_ford_tests, detects_reachable_negative_cycle_only) {
+  // 0 -> 1 -> 2 -> 1 weighs 0 round the cycle, 3 -> 4 -> 3 weighs -4
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = 5;
+  g.row_ptr = {0, 1, 2, 3, 4, 5};
+  g.col_idx = {1, 2, 1, 4, 3};
+  g.values = {4, 2, -2, -5, 1};
+  const int inf = ppc::core::graph::unreachable<int>();
+  std::vector<int> dist;
+  ASSERT_TRUE(ppc::core::graph::bellman_ford(g.view(), 0, dist));
+  EXPECT_EQ(dist, (std::vector<int>{0, 4, 6, inf, inf}));
+  EXPECT_FALSE(ppc::core::graph::bellman_ford(g.view(), 3, dist));
+
+  g.values[2] = -3;
+  EXPECT_FALSE(ppc::core::graph::bellman_ford(g.view(), 0, dist));
+}
+
+TEST(bellman_ford_tests, single_vertex_and_self_loop) {
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = 1;
+  g.row_ptr = {0, 1};
+  g.col_idx = {0};
+  g.values = {0};
+  std::vector<int> dist;
+  ASSERT_TRUE(ppc::core::graph::bellman_ford(g.view(), 0, dist));
+  EXPECT_EQ(dist, std::vector<int>{0});
+  g.values = {-1};
+  EXPECT_FALSE(ppc::core::graph::bellman_ford(g.view(), 0, dist));
+}
@@ -0,0 +1,62 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/bfs.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+TEST(bfs_tests, direction_optimizing_matches_fifo_search) {
+  // the grid and the geometric graph stay top-down for their long tails,
+  // R-MAT goes bottom-up in the middle
+  for (const auto& graph : ppc::core::graph::benchmark_graphs<int>(15, 8, 1, 1, 3)) {
+    const auto g = graph.csr();
+    for (int source : {0, 12345}) {
+      const auto expected = ppc::core::graph::bfs_levels(g.view(), source);
+      EXPECT_EQ(ppc::core::graph::bfs(g.view(), source), expected) << graph.name << " " << source;
+      // bottom-up from the first step on, bottom-up early and top-down again
+      // soon, and bottom-up only late
+      for (ppc::core::graph::BfsTuning tuning : {ppc::core::graph::BfsTuning{1LL << 40, 1LL << 40},
+                                                 ppc::core::graph::BfsTuning{1LL << 40, 1},
+                                                 ppc::core::graph::BfsTuning{1, 1LL << 40}}) {
+        EXPECT_EQ(ppc::core::graph::bfs(g.view(), source, tuning), expected) << graph.name << " " << tuning.alpha;
+      }
+    }
+  }
+}
+
+TEST(bfs_tests, separate_in_edges_of_a_directed_graph) {
+  // 0 -> 1 -> 2 -> 3 and 4 -> 0; 4 is out of reach
+  ppc::core::sparse::CSR<int> out;
+  out.rows = out.cols = 5;
+  out.row_ptr = {0, 1, 2, 3, 3, 4};
+  out.col_idx = {1, 2, 3, 0};
+  out.values = {1, 1, 1, 1};
+  ppc::core::sparse::CSR<int> in;
+  in.rows = in.cols = 5;
+  in.row_ptr = {0, 1, 2, 3, 4, 4};
+  in.col_idx = {4, 0, 1, 2};
+  in.values = {1, 1, 1, 1};
+  const std::vector<int> expected = {0, 1, 2, 3, ppc::core::graph::kUnreached};
+  EXPECT_EQ(ppc::core::graph::bfs_levels(out.view(), 0), expected);
+  // bottom-up all the way, so only the in-edges are searched
+  EXPECT_EQ(ppc::core::graph::bfs(out.view(), in.view(), 0, {1LL << 40, 1LL << 40}), expected);
+}
+
+TEST(bfs_tests, traversed_edges_and_teps) {
+  // 0 - 1 - 2 and 3 - 4: from 0 the search traverses four of the six edges
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = 5;
+  g.row_ptr = {0, 1, 3, 4, 5, 6};
+  g.col_idx = {1, 0, 2, 1, 4, 3};
+  g.values = {1, 1, 1, 1, 1, 1};
+  const auto levels = ppc::core::graph::bfs(g.view(), 0);
+  EXPECT_EQ(ppc::core::graph::traversed_edges(g.view(), levels, ppc::core::graph::kUnreached), 4);
+  EXPECT_DOUBLE_EQ(ppc::core::graph::teps(4, 0.5), 8.0);
+  EXPECT_DOUBLE_EQ(ppc::core::graph::teps(4, 0.0), 0.0);
+  std::ostringstream report;
+  ppc::core::graph::print_teps(report, "bfs", "tiny", 4, 0.5);
+  EXPECT_EQ(report.str(), "bfs tiny: 8.000e+00 TEPS (4 edges in 0.500000 s)\n");
+}
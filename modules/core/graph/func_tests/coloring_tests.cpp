@@ -0,0 +1,89 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/coloring.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+// The greedy coloring in priority order that Jones-Plassmann amounts to.
+std::vector<int> greedy(const ppc::core::sparse::CSR<int>& g, std::uint64_t seed) {
+  std::vector<int> order(g.rows);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [seed](int u, int v) { return ppc::core::graph::detail::goes_before(seed, u, v); });
+  std::vector<int> color(g.rows, ppc::core::graph::kUncolored);
+  for (int v : order) {
+    std::vector<char> taken(g.row_ptr[v + 1] - g.row_ptr[v] + 1, 0);
+    for (int e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+      const int c = color[g.col_idx[e]];
+      if (c >= 0 && c < static_cast<int>(taken.size())) taken[c] = 1;
+    }
+    color[v] = static_cast<int>(std::find(taken.begin(), taken.end(), 0) - taken.begin());
+  }
+  return color;
+}
+
+}  // namespace
+
+TEST(coloring_tests, jones_plassmann_is_greedy_in_priority_order) {
+  for (const auto& graph : ppc::core::graph::benchmark_graphs<int>(13, 8, 1, 1, 5)) {
+    const auto g = graph.csr();
+    const auto colors = ppc::core::graph::jones_plassmann(g.view(), 7);
+    EXPECT_TRUE(ppc::core::graph::proper_coloring(g.view(), colors)) << graph.name;
+    EXPECT_EQ(colors, greedy(g, 7)) << graph.name;
+#ifdef _OPENMP
+    const int saved = omp_get_max_threads();
+    omp_set_num_threads(3);
+#endif
+    EXPECT_EQ(ppc::core::graph::jones_plassmann(g.view(), 7), colors) << graph.name;
+#ifdef _OPENMP
+    omp_set_num_threads(saved);
+#endif
+    EXPECT_NE(ppc::core::graph::jones_plassmann(g.view(), 8), colors) << graph.name;
+  }
+}
+
+TEST(coloring_tests, cliques_self_loops_and_isolated_vertices) {
+  // a triangle 0 1 2 with a self-loop on 0, the edge 3 - 4 and 5 alone
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = 6;
+  g.row_ptr = {0, 3, 5, 7, 8, 9, 9};
+  g.col_idx = {0, 1, 2, 0, 2, 0, 1, 4, 3};
+  g.values.assign(9, 1);
+  const auto colors = ppc::core::graph::jones_plassmann(g.view());
+  EXPECT_TRUE(ppc::core::graph::proper_coloring(g.view(), colors));
+  EXPECT_EQ(*std::max_element(colors.begin(), colors.begin() + 3), 2);
+  EXPECT_EQ(colors[5], 0);
+
+  auto clash = colors;
+  clash[4] = clash[3];
+  EXPECT_FALSE(ppc::core::graph::proper_coloring(g.view(), clash));
+}
+
+TEST(coloring_tests, symmetric_wants_every_edge_both_ways) {
+  const std::vector<int> row_ptr = {0, 2, 4, 6, 6};
+  const std::vector<int> col_idx = {2, 1, 0, 2, 1, 0};
+  EXPECT_TRUE(ppc::core::graph::symmetric(4, row_ptr.data(), col_idx.data()));
+
+  // 0 -> 1 alone, and 0 -> 1 twice but 1 -> 0 once
+  const std::vector<int> one_way_ptr = {0, 1, 1};
+  const std::vector<int> one_way_idx = {1};
+  EXPECT_FALSE(ppc::core::graph::symmetric(2, one_way_ptr.data(), one_way_idx.data()));
+  const std::vector<int> twice_ptr = {0, 2, 3, 3};
+  const std::vector<int> twice_idx = {1, 1, 0};
+  EXPECT_FALSE(ppc::core::graph::symmetric(3, twice_ptr.data(), twice_idx.data()));
+  for (const auto& graph : ppc::core::graph::benchmark_graphs<int>(10, 4, 1, 1, 3)) {
+    const auto g = graph.csr();
+    EXPECT_TRUE(ppc::core::graph::symmetric(g.rows, g.row_ptr.data(), g.col_idx.data())) << graph.name;
+  }
+}
@@ -0,0 +1,120 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/generators.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+using Edge = ppc::core::graph::Edge<int>;
+
+bool same(const Edge& a, const Edge& b) {
+  return std::tie(a.source, a.target, a.weight) == std::tie(b.source, b.target, b.weight);
+}
+
+bool same_lists(const std::vector<Edge>& a, const std::vector<Edge>& b) {
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(), same);
+}
+
+// Every edge is followed by its reverse with the same weight, inside
+// [0, vertices) and [lo, hi].
+void expect_undirected(const std::vector<Edge>& edges, int vertices, int lo, int hi) {
+  ASSERT_EQ(edges.size() % 2, 0U);
+  for (size_t e = 0; e < edges.size(); e += 2) {
+    const Edge& a = edges[e];
+    const Edge& b = edges[e + 1];
+    ASSERT_TRUE(a.source == b.target && a.target == b.source && a.weight == b.weight) << e;
+    ASSERT_TRUE(a.source >= 0 && a.source < vertices && a.target >= 0 && a.target < vertices) << e;
+    ASSERT_TRUE(a.weight >= lo && a.weight <= hi) << e;
+  }
+}
+
+}  // namespace
+
+TEST(generators_tests, rmat_is_skewed_and_independent_of_threads) {
+  const int scale = 14;
+  const auto edges = ppc::core::graph::rmat_edges<int>(scale, 8, 1, 100, 42);
+  EXPECT_EQ(edges.size(), size_t{2 * 8} << scale);
+  expect_undirected(edges, 1 << scale, 1, 100);
+  // power law: the busiest vertex has far more than the average 16 edges
+  std::vector<int> degree(1 << scale, 0);
+  for (const auto& e : edges) degree[e.source]++;
+  EXPECT_GT(*std::max_element(degree.begin(), degree.end()), 40 * 16);
+#ifdef _OPENMP
+  const int saved = omp_get_max_threads();
+  omp_set_num_threads(3);
+#endif
+  const auto again = ppc::core::graph::rmat_edges<int>(scale, 8, 1, 100, 42);
+#ifdef _OPENMP
+  omp_set_num_threads(saved);
+#endif
+  EXPECT_TRUE(same_lists(edges, again));
+  EXPECT_FALSE(same_lists(edges, ppc::core::graph::rmat_edges<int>(scale, 8, 1, 100, 43)));
+}
+
+TEST(generators_tests, grid_links_horizontal_and_vertical_neighbours) {
+  const int rows = 37;
+  const int cols = 53;
+  const auto edges = ppc::core::graph::grid_edges<int>(rows, cols, 0, 9, 7);
+  EXPECT_EQ(edges.size(), static_cast<size_t>(2 * ((rows - 1) * cols + rows * (cols - 1))));
+  expect_undirected(edges, rows * cols, 0, 9);
+  for (const auto& e : edges) {
+    const int dr = e.source / cols - e.target / cols;
+    const int dc = e.source % cols - e.target % cols;
+    ASSERT_EQ(std::abs(dr) + std::abs(dc), 1) << e.source << " " << e.target;
+  }
+  EXPECT_TRUE(ppc::core::graph::grid_edges<int>(0, 5, 0, 9, 7).empty());
+  EXPECT_TRUE(ppc::core::graph::grid_edges<int>(1, 1, 0, 9, 7).empty());
+}
+
+TEST(generators_tests, geometric_matches_all_pairs) {
+  for (int n : {1, 2, 300, 3000}) {
+    const double radius = ppc::core::graph::geometric_radius(n, 8.0);
+    const auto edges = ppc::core::graph::geometric_edges<int>(n, radius, 1, 5, n);
+    expect_undirected(edges, n, 1, 5);
+    // the points are drawn from the same streams as the generator's
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    for (int i = 0; i < n; i++) {
+      auto gen = ppc::core::graph::detail::stream(n, i);
+      x[i] = gen.uniform();
+      y[i] = gen.uniform();
+    }
+    std::vector<std::pair<int, int>> expected;
+    for (int i = 0; i < n; i++) {
+      for (int j = i + 1; j < n; j++) {
+        const double dx = x[i] - x[j];
+        const double dy = y[i] - y[j];
+        if (dx * dx + dy * dy < radius * radius) expected.emplace_back(i, j);
+      }
+    }
+    std::vector<std::pair<int, int>> pairs;
+    for (size_t e = 0; e < edges.size(); e += 2) pairs.emplace_back(edges[e].source, edges[e].target);
+    std::sort(pairs.begin(), pairs.end());
+    EXPECT_EQ(pairs, expected) << n;
+  }
+}
+
+TEST(generators_tests, benchmark_graphs_have_the_requested_size) {
+  const auto graphs = ppc::core::graph::benchmark_graphs<double>(10, 4, 0.5, 2.0, 1);
+  ASSERT_EQ(graphs.size(), 3U);
+  for (const auto& graph : graphs) {
+    EXPECT_EQ(graph.vertices, 1024) << graph.name;
+    const auto g = graph.csr();
+    EXPECT_EQ(g.rows, 1024) << graph.name;
+    EXPECT_EQ(g.row_ptr.back(), static_cast<int>(graph.edges.size())) << graph.name;
+  }
+  EXPECT_EQ(graphs[0].edges.size(), 8U * 1024);
+  // the geometric graph is aimed at the same average degree
+  EXPECT_NEAR(static_cast<double>(graphs[2].edges.size()) / 1024, 8.0, 1.5);
+}
@@ -0,0 +1,107 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "core/graph/include/loader.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+using Edge = ppc::core::graph::Edge<int>;
+
+std::vector<Edge> random_edges(int vertices, size_t count, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> vertex(0, vertices - 1);
+  std::uniform_int_distribution<int> weight(-9, 9);
+  std::vector<Edge> edges(count);
+  for (auto& e : edges) e = {vertex(gen), vertex(gen), weight(gen)};
+  return edges;
+}
+
+// Reference: the edges sorted by source, target and weight, parallel edges kept.
+ppc::core::sparse::CSR<int> reference(int vertices, std::vector<Edge> edges) {
+  std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+    return std::tie(a.source, a.target, a.weight) < std::tie(b.source, b.target, b.weight);
+  });
+  ppc::core::sparse::CSR<int> m;
+  m.rows = m.cols = vertices;
+  m.row_ptr.assign(vertices + 1, 0);
+  for (const auto& e : edges) {
+    m.row_ptr[e.source + 1]++;
+    m.col_idx.push_back(e.target);
+    m.values.push_back(e.weight);
+  }
+  for (int i = 0; i < vertices; i++) m.row_ptr[i + 1] += m.row_ptr[i];
+  return m;
+}
+
+std::string temp_path(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / ("ppc_loader_tests_" + name)).string();
+}
+
+}  // namespace
+
+TEST(loader_tests, csr_from_edges_matches_reference) {
+  // sizes on both sides of the threshold for going parallel
+  for (size_t count : {size_t{0}, size_t{100}, size_t{300000}}) {
+    const int vertices = 5000;
+    const auto edges = random_edges(vertices, count, static_cast<unsigned>(count));
+    ppc::core::sparse::CSR<int> m;
+    ASSERT_TRUE(ppc::core::graph::csr_from_edges(vertices, edges.data(), edges.size(), m));
+    EXPECT_EQ(m, reference(vertices, edges)) << count;
+  }
+}
+
+TEST(loader_tests, build_csr_takes_a_row_range_and_rejects_strays) {
+  const std::vector<Edge> edges = {{12, 3, 1}, {10, 0, 2}, {12, 1, 3}};
+  ppc::core::sparse::CSR<int> block;
+  ASSERT_TRUE(ppc::core::graph::build_csr(3, 20, 10, edges.data(), edges.size(), block));
+  EXPECT_EQ(block.row_ptr, (std::vector<int>{0, 1, 1, 3}));
+  EXPECT_EQ(block.col_idx, (std::vector<int>{0, 1, 3}));
+  EXPECT_EQ(block.values, (std::vector<int>{2, 3, 1}));
+
+  EXPECT_FALSE(ppc::core::graph::build_csr(2, 20, 10, edges.data(), edges.size(), block));
+  EXPECT_FALSE(ppc::core::graph::build_csr(3, 3, 10, edges.data(), edges.size(), block));
+  // a failed build leaves the output alone
+  EXPECT_EQ(block.rows, 3);
+}
+
+TEST(loader_tests, csr_from_dense_matches_sparse_from_dense) {
+  const int vertices = 300;
+  std::vector<int> matrix(vertices * vertices, 0);
+  for (const auto& e : random_edges(vertices, 5000, 7)) matrix[e.source * vertices + e.target] = e.weight;
+  EXPECT_EQ(ppc::core::graph::csr_from_dense(matrix.data(), vertices),
+            ppc::core::sparse::from_dense(matrix.data(), vertices, vertices));
+}
+
+TEST(loader_tests, edge_file_round_trip) {
+  const std::string path = temp_path("round_trip");
+  const int vertices = 1000;
+  const auto edges = random_edges(vertices, 20000, 3);
+  ASSERT_TRUE(ppc::core::graph::write_edge_file(path, vertices, edges.data(), edges.size()));
+
+  ppc::core::graph::EdgeFile<int, int> file;
+  ASSERT_TRUE(file.open(path));
+  EXPECT_EQ(file.vertices(), vertices);
+  ASSERT_EQ(file.size(), edges.size());
+  EXPECT_EQ(file.edges()[123].target, edges[123].target);
+  file.close();
+
+  ppc::core::sparse::CSR<int> m;
+  ASSERT_TRUE(ppc::core::graph::load_edge_file(path, m));
+  EXPECT_EQ(m, reference(vertices, edges));
+
+  // records of another type, a truncated file and no file at all
+  ppc::core::sparse::CSR<double> wrong_type;
+  EXPECT_FALSE(ppc::core::graph::load_edge_file(path, wrong_type));
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+  EXPECT_FALSE(file.open(path));
+  std::filesystem::remove(path);
+  EXPECT_FALSE(ppc::core::graph::load_edge_file(path, m));
+}
@@ -0,0 +1,106 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/mst.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+using Edge = ppc::core::graph::Edge<int>;
+
+bool edge_less(const Edge& a, const Edge& b) {
+  return std::tie(a.source, a.target, a.weight) < std::tie(b.source, b.target, b.weight);
+}
+
+bool same_edge(const Edge& a, const Edge& b) {
+  return std::tie(a.source, a.target, a.weight) == std::tie(b.source, b.target, b.weight);
+}
+
+// Kruskal's algorithm over the same order of edges, sorted by end points.
+ppc::core::graph::SpanningForest<int> kruskal(const ppc::core::sparse::CSR<int>& g) {
+  std::vector<Edge> edges;
+  for (int v = 0; v < g.rows; v++) {
+    for (int e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+      const int u = g.col_idx[e];
+      if (u != v) edges.push_back({std::min(u, v), std::max(u, v), g.values[e]});
+    }
+  }
+  std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+    return std::tie(a.weight, a.source, a.target) < std::tie(b.weight, b.source, b.target);
+  });
+  std::vector<int> parent(g.rows);
+  std::iota(parent.begin(), parent.end(), 0);
+  const auto root = [&](int x) {
+    while (parent[x] != x) x = parent[x] = parent[parent[x]];
+    return x;
+  };
+  ppc::core::graph::SpanningForest<int> forest;
+  for (const auto& e : edges) {
+    const int a = root(e.source);
+    const int b = root(e.target);
+    if (a == b) continue;
+    parent[a] = b;
+    forest.weight += e.weight;
+    forest.edges.push_back(e);
+  }
+  std::sort(forest.edges.begin(), forest.edges.end(), edge_less);
+  return forest;
+}
+
+void expect_same_forest(ppc::core::graph::SpanningForest<int> actual,
+                        const ppc::core::graph::SpanningForest<int>& expected) {
+  EXPECT_EQ(actual.weight, expected.weight);
+  std::sort(actual.edges.begin(), actual.edges.end(), edge_less);
+  EXPECT_TRUE(std::equal(actual.edges.begin(), actual.edges.end(), expected.edges.begin(), expected.edges.end(),
+                         same_edge));
+}
+
+}  // namespace
+
+TEST(mst_tests, boruvka_matches_kruskal_on_benchmark_graphs) {
+  // few distinct weights, so most of the choices are ties
+  for (const auto& graph : ppc::core::graph::benchmark_graphs<int>(12, 4, 1, 5, 9)) {
+    const auto g = graph.csr();
+    const auto expected = kruskal(g);
+    expect_same_forest(ppc::core::graph::boruvka(g.view()), expected);
+#ifdef _OPENMP
+    const int saved = omp_get_max_threads();
+    omp_set_num_threads(3);
+#endif
+    expect_same_forest(ppc::core::graph::boruvka(g.view()), expected);
+#ifdef _OPENMP
+    omp_set_num_threads(saved);
+#endif
+  }
+}
+
+TEST(mst_tests, edges_stored_once_and_components) {
+  // 0 - 1 - 2 stored one way each, 3 - 4 both ways with a parallel edge, 5
+  // alone with a self-loop, and a negative weight
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = 6;
+  g.row_ptr = {0, 2, 3, 3, 5, 7, 8};
+  g.col_idx = {1, 2, 2, 4, 4, 3, 3, 5};
+  g.values = {4, 9, -1, 7, 2, 2, 7, 0};
+  const auto forest = ppc::core::graph::boruvka(g.view());
+  EXPECT_EQ(forest.weight, 5);
+  auto edges = forest.edges;
+  std::sort(edges.begin(), edges.end(), edge_less);
+  const std::vector<Edge> expected = {{0, 1, 4}, {1, 2, -1}, {3, 4, 2}};
+  EXPECT_TRUE(std::equal(edges.begin(), edges.end(), expected.begin(), expected.end(), same_edge));
+
+  ppc::core::sparse::CSR<int> lonely;
+  lonely.rows = lonely.cols = 1;
+  lonely.row_ptr = {0, 0};
+  EXPECT_TRUE(ppc::core::graph::boruvka(lonely.view()).edges.empty());
+}
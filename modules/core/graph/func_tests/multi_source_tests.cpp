@@ -0,0 +1,75 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "core/graph/include/bellman_ford.hpp"
+#include "core/graph/include/multi_source.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+// n vertices with degree edges each to random heads, weights w(u, v) + p(u)
+// - p(v) for w >= 0 and a random potential p: both signs, no negative cycle.
+ppc::core::sparse::CSR<int> random_graph(int n, int degree, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> head(0, n - 1);
+  std::uniform_int_distribution<int> weight(0, 20);
+  std::uniform_int_distribution<int> potential(-50, 50);
+  std::vector<int> p(n);
+  for (auto& x : p) x = potential(gen);
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = n;
+  for (int v = 0; v < n; v++) {
+    for (int k = 0; k < degree; k++) {
+      const int u = head(gen);
+      g.col_idx.push_back(u);
+      g.values.push_back(weight(gen) + p[v] - p[u]);
+    }
+    g.row_ptr.push_back(static_cast<int>(g.col_idx.size()));
+  }
+  return g;
+}
+
+}  // namespace
+
+TEST(multi_source_tests, every_lane_matches_bellman_ford) {
+  for (int degree : {1, 2, 5}) {
+    const auto g = random_graph(500, degree, degree + 10);
+    // a repeated source gets a lane of its own
+    const std::vector<int> sources = {0, 499, 250, 0, 7};
+    std::vector<int> dist;
+    ASSERT_TRUE(ppc::core::graph::multi_source_paths(g.view(), sources, dist));
+    ASSERT_EQ(dist.size(), sources.size() * 500);
+    const auto rows = ppc::core::graph::by_source(dist, sources.size());
+    for (size_t k = 0; k < sources.size(); k++) {
+      std::vector<int> expected;
+      ASSERT_TRUE(ppc::core::graph::bellman_ford(g.view(), sources[k], expected));
+      const std::vector<int> lane(rows.begin() + k * 500, rows.begin() + (k + 1) * 500);
+      EXPECT_EQ(lane, expected) << degree << " " << k;
+    }
+  }
+}
+
+TEST(multi_source_tests, negative_cycle_in_any_lane_fails_the_batch) {
+  // 0 -> 1 -> 2 -> 1 weighs 0 round the cycle, 3 -> 4 -> 3 weighs -4
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = 5;
+  g.row_ptr = {0, 1, 2, 3, 4, 5};
+  g.col_idx = {1, 2, 1, 4, 3};
+  g.values = {4, 2, -2, -5, 1};
+  const int inf = ppc::core::graph::unreachable<int>();
+  std::vector<int> dist;
+  ASSERT_TRUE(ppc::core::graph::multi_source_paths(g.view(), std::vector<int>{0, 2}, dist));
+  EXPECT_EQ(dist, (std::vector<int>{0, inf, 4, -2, 6, 0, inf, inf, inf, inf}));
+  EXPECT_FALSE(ppc::core::graph::multi_source_paths(g.view(), std::vector<int>{0, 3}, dist));
+}
+
+TEST(multi_source_tests, by_source_transposes_lanes) {
+  // three vertices, two lanes
+  const std::vector<int> dist = {1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(ppc::core::graph::by_source(dist, 2), (std::vector<int>{1, 3, 5, 2, 4, 6}));
+  EXPECT_EQ(ppc::core::graph::by_source(dist, 1), dist);
+  EXPECT_TRUE(ppc::core::graph::by_source(std::vector<int>{}, 0).empty());
+}
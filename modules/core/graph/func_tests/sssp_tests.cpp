@@ -0,0 +1,114 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "core/graph/include/sssp.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+// n vertices, each with degree edges to random heads, weights in [0, max_weight).
+ppc::core::sparse::CSR<double> random_graph(int n, int degree, double max_weight, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> head(0, n - 1);
+  std::uniform_real_distribution<double> weight(0.0, max_weight);
+  ppc::core::sparse::CSR<double> g;
+  g.rows = n;
+  g.cols = n;
+  for (int v = 0; v < n; v++) {
+    for (int k = 0; k < degree; k++) {
+      g.col_idx.push_back(head(gen));
+      g.values.push_back(weight(gen));
+    }
+    g.row_ptr.push_back(static_cast<int>(g.col_idx.size()));
+  }
+  return g;
+}
+
+// Reference distances: Bellman-Ford relaxation until nothing changes.
+std::vector<double> reference(const ppc::core::sparse::CSR<double>& g, int source) {
+  std::vector<double> dist(g.rows, ppc::core::graph::unreachable<double>());
+  dist[source] = 0.0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (int v = 0; v < g.rows; v++) {
+      for (int e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+        if (dist[v] + g.values[e] < dist[g.col_idx[e]]) {
+          dist[g.col_idx[e]] = dist[v] + g.values[e];
+          changed = true;
+        }
+      }
+    }
+  }
+  return dist;
+}
+
+}  // namespace
+
+TEST(sssp_tests, dijkstra_and_delta_stepping_match_reference) {
+  for (int degree : {1, 3, 8}) {
+    const auto g = random_graph(2000, degree, 10.0, degree);
+    const auto expected = reference(g, 0);
+    EXPECT_EQ(ppc::core::graph::dijkstra(g.view(), 0), expected);
+    for (double delta : {0.0, 0.05, 1.0, 100.0}) {
+      EXPECT_EQ(ppc::core::graph::delta_stepping(g.view(), 0, delta), expected) << "delta " << delta;
+    }
+  }
+}
+
+TEST(sssp_tests, zero_weights_and_unreachable_vertices) {
+  // 0 -> 1 -> 2 with zero weights, 3 -> 4 out of reach
+  ppc::core::sparse::CSR<double> g;
+  g.rows = g.cols = 5;
+  g.row_ptr = {0, 1, 2, 2, 3, 3};
+  g.col_idx = {1, 2, 4};
+  g.values = {0.0, 0.0, 1.0};
+  const std::vector<double> expected = {0.0, 0.0, 0.0, ppc::core::graph::unreachable<double>(),
+                                        ppc::core::graph::unreachable<double>()};
+  EXPECT_EQ(ppc::core::graph::dijkstra(g.view(), 0), expected);
+  EXPECT_EQ(ppc::core::graph::delta_stepping(g.view(), 0), expected);
+}
+
+TEST(sssp_tests, integer_weights) {
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = 4;
+  g.row_ptr = {0, 2, 3, 4, 4};
+  g.col_idx = {1, 2, 3, 3};
+  g.values = {5, 1, 1, 10};
+  EXPECT_EQ(ppc::core::graph::delta_stepping(g.view(), 0, 2), (std::vector<int>{0, 5, 1, 6}));
+}
+
+TEST(sssp_tests, row_block_and_default_delta) {
+  const auto g = random_graph(100, 4, 8.0, 5);
+  const auto block = ppc::core::graph::row_block(g.view(), 10, 30);
+  EXPECT_EQ(block.rows, 20);
+  EXPECT_EQ(block.row_ptr[0], g.row_ptr[10]);
+  // 4 edges a vertex: about a quarter of the largest weight
+  const double delta = ppc::core::graph::default_delta(block);
+  EXPECT_GT(delta, 1.5);
+  EXPECT_LE(delta, 2.0);
+}
+
+TEST(sssp_tests, default_delta_of_heavy_integer_weights) {
+  // a star of 100000 vertices weighing 10^6 an edge: heaviest * rows is
+  // past the range of int
+  ppc::core::sparse::CSR<int> g;
+  g.rows = g.cols = 100000;
+  g.row_ptr.assign(g.rows + 1, g.rows - 1);
+  g.row_ptr[0] = 0;
+  for (int v = 1; v < g.rows; v++) g.col_idx.push_back(v);
+  g.values.assign(g.col_idx.size(), 1000000);
+  EXPECT_EQ(ppc::core::graph::default_delta(g.view()), 1000010);
+  std::vector<int> expected(g.rows, 1000000);
+  expected[0] = 0;
+  EXPECT_EQ(ppc::core::graph::delta_stepping(g.view(), 0), expected);
+}
+
+TEST(sssp_tests, tiny_delta_is_widened) {
+  // unclamped, 1e-12 would take some 10^13 buckets
+  const auto g = random_graph(2000, 3, 10.0, 3);
+  EXPECT_EQ(ppc::core::graph::delta_stepping(g.view(), 0, 1e-12), reference(g, 0));
+}
+
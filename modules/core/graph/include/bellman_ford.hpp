@@ -0,0 +1,92 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_BELLMAN_FORD_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_BELLMAN_FORD_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "core/graph/include/sssp.hpp"
+
+namespace ppc::core::graph {
+
+namespace detail {
+
+// Vertices whose distance dropped since their edges were last relaxed, each
+// held at most once, handed out in sweeps over ascending ids (Yen's order):
+// a vertex pushed while the sweep has not passed it yet comes out in the
+// same sweep, one it already passed waits for the next. Relaxations thus
+// flow along edges from lower to higher ids within a sweep, and a graph
+// whose edges mostly run that way settles in one, where a plain FIFO can
+// relax the same vertex again for every predecessor that improves late.
+template <typename I>
+class SweepQueue {
+ public:
+  explicit SweepQueue(size_t vertices) : queued_(vertices, 0) {}
+
+  [[nodiscard]] bool empty() const { return current_.empty() && next_.empty(); }
+
+  void push(I v) {
+    if (queued_[v] != 0) return;
+    queued_[v] = 1;
+    (in_sweep_ && v > position_ ? current_ : next_).push(v);
+  }
+
+  I pop() {
+    if (current_.empty()) current_.swap(next_);
+    const I v = current_.top();
+    current_.pop();
+    queued_[v] = 0;
+    in_sweep_ = true;
+    position_ = v;
+    return v;
+  }
+
+ private:
+  using Heap = std::priority_queue<I, std::vector<I>, std::greater<>>;
+
+  std::vector<char> queued_;
+  Heap current_;
+  Heap next_;
+  bool in_sweep_ = false;
+  I position_{};
+};
+
+}  // namespace detail
+
+// Single-source shortest paths from source over weights of any sign, into
+// dist (unreachable vertices get unreachable<W>()). Queue-based Bellman-Ford:
+// only the edges of vertices whose distance dropped are relaxed again, rather
+// than all of them V - 1 times, in the order of SweepQueue. Every distance
+// remembers the number of edges of the path that gave it; a path of V edges
+// repeats a vertex, and it can only have been found shorter the second time
+// round, so reaching one means a negative cycle is reachable from source.
+// Then false is returned and dist is meaningless.
+template <typename W, typename I>
+bool bellman_ford(const GraphView<W, I>& g, I source, std::vector<W>& dist) {
+  const auto vertices = static_cast<size_t>(g.rows);
+  dist.assign(vertices, unreachable<W>());
+  std::vector<I> hops(vertices, 0);
+  detail::SweepQueue<I> queue(vertices);
+  dist[source] = W(0);
+  queue.push(source);
+  while (!queue.empty()) {
+    const I v = queue.pop();
+    for (I e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+      const I u = g.col_idx[e];
+      const W candidate = dist[v] + g.values[e];
+      if (!(candidate < dist[u])) continue;
+      dist[u] = candidate;
+      hops[u] = hops[v] + 1;
+      if (static_cast<size_t>(hops[u]) >= vertices) return false;
+      queue.push(u);
+    }
+  }
+  return true;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_BELLMAN_FORD_HPP_
@@ -0,0 +1,117 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_BELLMAN_FORD_MPI_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_BELLMAN_FORD_MPI_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "core/graph/include/bellman_ford.hpp"
+#include "core/graph/include/graph_mpi.hpp"
+#include "core/graph/include/sssp.hpp"
+
+namespace ppc::core::graph {
+
+namespace detail {
+
+// A candidate distance for target together with the number of edges of the
+// path behind it, which bellman_ford() needs to spot negative cycles.
+template <typename W, typename I>
+struct PathRelaxation {
+  I target;
+  I hops;
+  W distance;
+};
+
+}  // namespace detail
+
+// Distributed bellman_ford(). Rank r owns the vertices [bounds[r],
+// bounds[r + 1]) and passes their rows as local (see row_block() or
+// sparse::scatter_rows()), with global vertex ids in col_idx; it gets back
+// the distances of its own vertices in dist. Each rank runs the queue-based
+// algorithm on its block, relaxing edges between its own vertices on the
+// spot. An edge to another rank's vertex is only followed once the queue is
+// empty, from the final distance of the round, and the best candidate per
+// head is batched for the head's owner; one exchange() then delivers all of
+// them, which refills the queues. A round thus costs what changed, not V,
+// and one all_reduce tells whether any rank still has work or saw a path of
+// V edges. Returns false on every rank if a negative cycle is reachable from
+// source.
+template <typename W, typename I>
+bool bellman_ford(const boost::mpi::communicator& world, const GraphView<W, I>& local, const std::vector<I>& bounds,
+                  I source, std::vector<W>& dist) {
+  const int size = world.size();
+  const I begin = bounds[world.rank()];
+  const I end = bounds[world.rank() + 1];
+  const auto vertices = static_cast<size_t>(bounds[size]);
+  const auto rows = static_cast<size_t>(local.rows);
+  dist.assign(rows, unreachable<W>());
+  std::vector<I> hops(rows, 0);
+  detail::SweepQueue<I> queue(rows);
+  bool cycle = false;
+  const auto relax = [&](I v, W d, I h) {
+    if (!(d < dist[v])) return;
+    dist[v] = d;
+    hops[v] = h;
+    if (static_cast<size_t>(h) >= vertices) {
+      cycle = true;
+    } else {
+      queue.push(v);
+    }
+  };
+  if (source >= begin && source < end) relax(source - begin, W(0), I(0));
+
+  using Message = detail::PathRelaxation<W, I>;
+  std::vector<std::vector<Message>> outbox(size);
+  // vertices with edges to other ranks whose distance dropped this round
+  std::vector<char> pending(rows, 0);
+  std::vector<I> boundary;
+  // outbox slot of each remote head already offered a candidate this round
+  std::unordered_map<I, size_t> slot;
+  while (true) {
+    while (!cycle && !queue.empty()) {
+      const I v = queue.pop();
+      for (I e = local.row_ptr[v]; e < local.row_ptr[v + 1]; e++) {
+        const I head = local.col_idx[e];
+        if (head >= begin && head < end) {
+          relax(head - begin, dist[v] + local.values[e], hops[v] + 1);
+        } else if (pending[v] == 0) {
+          pending[v] = 1;
+          boundary.push_back(v);
+        }
+      }
+    }
+    for (I v : boundary) {
+      pending[v] = 0;
+      if (cycle) continue;
+      for (I e = local.row_ptr[v]; e < local.row_ptr[v + 1]; e++) {
+        const I head = local.col_idx[e];
+        if (head >= begin && head < end) continue;
+        const Message m{head, hops[v] + 1, dist[v] + local.values[e]};
+        auto& box = outbox[vertex_owner(bounds, head)];
+        const auto [it, fresh] = slot.try_emplace(head, box.size());
+        if (fresh) {
+          box.push_back(m);
+        } else if (m.distance < box[it->second].distance) {
+          box[it->second] = m;
+        }
+      }
+    }
+    boundary.clear();
+    slot.clear();
+    for (const Message& m : exchange(world, outbox)) relax(m.target - begin, m.distance, m.hops);
+
+    // 2: a negative cycle somewhere, 1: more work, 0: done
+    const int state = cycle ? 2 : (queue.empty() ? 0 : 1);
+    int global_state = 0;
+    boost::mpi::all_reduce(world, state, global_state, boost::mpi::maximum<int>());
+    if (global_state != 1) return global_state == 0;
+  }
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_BELLMAN_FORD_MPI_HPP_
@@ -0,0 +1,95 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_BENCHMARK_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_BENCHMARK_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/generators.hpp"
+#include "core/graph/include/loader.hpp"
+#include "core/graph/include/sssp.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core::graph {
+
+// One input of the graph benchmarks.
+template <typename W, typename I = int>
+struct BenchmarkGraph {
+  std::string name;
+  I vertices;
+  std::vector<Edge<W, I>> edges;
+
+  [[nodiscard]] sparse::CSR<W, I> csr() const {
+    sparse::CSR<W, I> g;
+    csr_from_edges(vertices, edges.data(), edges.size(), g);
+    return g;
+  }
+};
+
+// The benchmark topologies at about 2^scale vertices and edge_factor edges
+// a vertex each way, weights in [min_weight, max_weight]:
+// - "rmat": Graph 500 R-MAT, power-law degrees and a small diameter, where
+//   a few hubs hold most of the edges;
+// - "grid": a 2D grid, uniform degree four and a diameter of about twice the
+//   square root of the vertices, whatever edge_factor is;
+// - "geometric": a random geometric graph of the same average degree as
+//   R-MAT, even degrees and a large diameter.
+// An algorithm that wins on one of them can lose on another, which is what
+// a single hand-made graph hides.
+template <typename W, typename I = int>
+std::vector<BenchmarkGraph<W, I>> benchmark_graphs(int scale, int edge_factor, W min_weight, W max_weight,
+                                                   std::uint64_t seed) {
+  const auto vertices = static_cast<I>(I(1) << scale);
+  const auto rows = static_cast<I>(I(1) << (scale / 2));
+  std::vector<BenchmarkGraph<W, I>> graphs;
+  graphs.push_back({"rmat", vertices, rmat_edges<W, I>(scale, edge_factor, min_weight, max_weight, seed)});
+  graphs.push_back({"grid", vertices, grid_edges<W, I>(rows, vertices / rows, min_weight, max_weight, seed)});
+  graphs.push_back({"geometric", vertices,
+                    geometric_edges<W, I>(vertices, geometric_radius(vertices, 2.0 * edge_factor), min_weight,
+                                          max_weight, seed)});
+  return graphs;
+}
+
+// Edges a search from one source traverses: the out-edges of the vertices
+// it reached, those whose label is not unreached. Like Graph 500 this counts
+// the edges the search implies rather than those an algorithm happened to
+// look at, so that TEPS compares algorithms by the same work. Unlike Graph
+// 500 it counts directed edges: an undirected graph stored both ways, as the
+// generators build it, counts every edge twice, and its TEPS are twice the
+// Graph 500 figure.
+template <typename W, typename I, typename T>
+long long traversed_edges(const GraphView<W, I>& g, const std::vector<T>& label, T unreached) {
+  long long edges = 0;
+  for (I v = 0; v < g.rows; v++) {
+    if (label[v] != unreached) edges += g.row_ptr[v + 1] - g.row_ptr[v];
+  }
+  return edges;
+}
+
+// Traversed edges per second.
+inline double teps(long long edges, double seconds) {
+  return seconds > 0.0 ? static_cast<double>(edges) / seconds : 0.0;
+}
+
+// One line of a benchmark report: "<what> <graph>: <TEPS> TEPS (<edges>
+// edges in <seconds> s)". Unlike the lines of Perf::print_perf_statistic()
+// it carries no task path, so the perf table scripts leave it alone.
+inline void print_teps(std::ostream& out, const std::string& what, const std::string& graph, long long edges,
+                       double seconds) {
+  const auto flags = out.flags();
+  const auto precision = out.precision();
+  out << what << " " << graph << ": " << std::scientific << std::setprecision(3) << teps(edges, seconds)
+      << " TEPS (" << edges << " edges in " << std::fixed << std::setprecision(6) << seconds << " s)" << std::endl;
+  out.flags(flags);
+  out.precision(precision);
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_BENCHMARK_HPP_
@@ -0,0 +1,192 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_BFS_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_BFS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "core/graph/include/loader.hpp"
+#include "core/graph/include/sssp.hpp"
+
+namespace ppc::core::graph {
+
+// Level of a vertex breadth-first search did not reach.
+constexpr int kUnreached = -1;
+
+// Hop distance of every vertex from source, kUnreached for the vertices out
+// of reach: a plain FIFO search, the oracle bfs() is checked against.
+template <typename W, typename I>
+std::vector<I> bfs_levels(const GraphView<W, I>& g, I source) {
+  std::vector<I> level(static_cast<size_t>(g.rows), I(kUnreached));
+  std::vector<I> queue = {source};
+  level[source] = I(0);
+  for (size_t head = 0; head < queue.size(); head++) {
+    const I v = queue[head];
+    for (I e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+      const I u = g.col_idx[e];
+      if (level[u] != I(kUnreached)) continue;
+      level[u] = level[v] + 1;
+      queue.push_back(u);
+    }
+  }
+  return level;
+}
+
+namespace detail {
+
+// Vertices reached by one step and the out-edges they bring to the next.
+struct BfsStep {
+  long long vertices = 0;
+  long long edges = 0;
+};
+
+template <typename W, typename I>
+I out_degree(const GraphView<W, I>& g, I v) {
+  return g.row_ptr[v + 1] - g.row_ptr[v];
+}
+
+// Top-down step: the out-edges of every frontier vertex claim the heads not
+// reached yet, which become the next frontier. Bands of the frontier go to
+// the threads, each with its part of next, and a head two of them find at
+// once goes to whichever sets its level first; on one thread the levels are
+// plain loads and stores.
+template <typename W, typename I>
+BfsStep top_down(const GraphView<W, I>& out, std::vector<I>& frontier, std::vector<std::vector<I>>& next, I depth,
+                 std::vector<I>& level, int threads) {
+  const auto size = static_cast<long long>(frontier.size());
+  long long vertices = 0;
+  long long edges = 0;
+#pragma omp parallel for num_threads(threads) schedule(static) reduction(+ : vertices, edges) if (threads > 1)
+  for (int t = 0; t < threads; t++) {
+    next[t].clear();
+    for (long long k = size * t / threads; k < size * (t + 1) / threads; k++) {
+      const I v = frontier[k];
+      for (I e = out.row_ptr[v]; e < out.row_ptr[v + 1]; e++) {
+        const I u = out.col_idx[e];
+        if (threads == 1) {
+          if (level[u] != I(kUnreached)) continue;
+          level[u] = depth + 1;
+        } else {
+          // other threads may be claiming u, so even the pre-check is atomic
+          const std::atomic_ref<I> claim(level[u]);
+          if (claim.load(std::memory_order_relaxed) != I(kUnreached)) continue;
+          I unreached = I(kUnreached);
+          if (!claim.compare_exchange_strong(unreached, depth + 1, std::memory_order_relaxed)) continue;
+        }
+        next[t].push_back(u);
+        vertices++;
+        edges += out_degree(out, u);
+      }
+    }
+  }
+  if (threads == 1) {
+    frontier.swap(next[0]);
+  } else {
+    frontier.clear();
+    for (int t = 0; t < threads; t++) frontier.insert(frontier.end(), next[t].begin(), next[t].end());
+  }
+  return {vertices, edges};
+}
+
+// Bottom-up step: every vertex not reached yet looks through its in-edges
+// for a parent in the frontier and stops at the first. Each thread only
+// writes the vertices it owns, so there is nothing to synchronise, and a
+// vertex with a parent skips the rest of its edges, which on a large
+// frontier is most of them.
+template <typename W, typename I>
+BfsStep bottom_up(const GraphView<W, I>& out, const GraphView<W, I>& in, const std::vector<char>& frontier,
+                  std::vector<char>& next, I depth, std::vector<I>& level, int threads) {
+  const auto n = static_cast<long long>(in.rows);
+  long long vertices = 0;
+  long long edges = 0;
+#pragma omp parallel for num_threads(threads) schedule(dynamic, 1024) reduction(+ : vertices, edges) if (threads > 1)
+  for (long long v = 0; v < n; v++) {
+    next[v] = 0;
+    if (level[v] != I(kUnreached)) continue;
+    for (I e = in.row_ptr[v]; e < in.row_ptr[v + 1]; e++) {
+      if (frontier[in.col_idx[e]] == 0) continue;
+      level[v] = depth + 1;
+      next[v] = 1;
+      vertices++;
+      edges += out_degree(out, static_cast<I>(v));
+      break;
+    }
+  }
+  return {vertices, edges};
+}
+
+}  // namespace detail
+
+// Tuning of bfs(), with the values of Beamer, Asanovic and Patterson: the
+// search turns bottom-up once a growing frontier's out-edges exceed 1 /
+// alpha of the edges still unexplored, and back top-down once a shrinking
+// frontier holds less than 1 / beta of the vertices.
+struct BfsTuning {
+  long long alpha = 15;
+  long long beta = 18;
+};
+
+// Direction-optimizing breadth-first search (Beamer, Asanovic and
+// Patterson): the levels bfs_levels() gives, with in the in-edges of the
+// same graph, i.e. its transpose. Small frontiers go top-down, expanding the
+// out-edges of the frontier; the few large middle levels of a low-diameter
+// graph go bottom-up, where each unreached vertex stops at its first parent
+// and most edges are never looked at. A bottom-up step costs a pass over
+// all vertices, so the long tails of grids and meshes, whose frontiers stay
+// small, are never searched bottom-up. Both steps run on the threads, the
+// top-down ones only once the frontier has enough edges to share.
+template <typename W, typename I>
+std::vector<I> bfs(const GraphView<W, I>& out, const GraphView<W, I>& in, I source, BfsTuning tuning = {}) {
+  const I n = out.rows;
+  std::vector<I> level(static_cast<size_t>(n), I(kUnreached));
+  level[source] = I(0);
+  const int threads = detail::load_threads(static_cast<size_t>(n) + (out.row_ptr[n] - out.row_ptr[0]));
+
+  std::vector<I> queue = {source};
+  std::vector<std::vector<I>> next_queue(threads);
+  std::vector<char> frontier;
+  std::vector<char> next;
+  bool bottom_up = false;
+  detail::BfsStep step{1, detail::out_degree(out, source)};
+  long long unexplored = static_cast<long long>(out.row_ptr[n] - out.row_ptr[0]) - step.edges;
+  long long previous = 0;
+  for (I depth = 0; step.vertices > 0; depth++) {
+    const long long reached = step.vertices;
+    if (!bottom_up && reached > previous && step.edges > unexplored / tuning.alpha) {
+      bottom_up = true;
+      frontier.assign(static_cast<size_t>(n), 0);
+      next.assign(static_cast<size_t>(n), 0);
+      for (I v : queue) frontier[v] = 1;
+    } else if (bottom_up && reached < previous && reached * tuning.beta < static_cast<long long>(n)) {
+      bottom_up = false;
+      queue.clear();
+      for (I v = 0; v < n; v++) {
+        if (frontier[v] != 0) queue.push_back(v);
+      }
+    }
+    if (bottom_up) {
+      step = detail::bottom_up(out, in, frontier, next, depth, level, threads);
+      frontier.swap(next);
+    } else {
+      const int step_threads = std::min(threads, detail::load_threads(static_cast<size_t>(step.edges)));
+      step = detail::top_down(out, queue, next_queue, depth, level, step_threads);
+    }
+    unexplored -= step.edges;
+    previous = reached;
+  }
+  return level;
+}
+
+// bfs() of a symmetric graph, such as the generators build, whose out-edges
+// are its in-edges.
+template <typename W, typename I>
+std::vector<I> bfs(const GraphView<W, I>& g, I source, BfsTuning tuning = {}) {
+  return bfs(g, g, source, tuning);
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_BFS_HPP_
@@ -0,0 +1,151 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_COLORING_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_COLORING_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "core/graph/include/generators.hpp"
+#include "core/graph/include/loader.hpp"
+#include "core/graph/include/sssp.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::graph {
+
+// Color of a vertex not colored yet.
+constexpr int kUncolored = -1;
+
+namespace detail {
+
+// Whether u goes before v: Luby's random priorities, drawn from the vertex
+// alone so that any rank can work out any vertex's, ties broken by index.
+inline bool goes_before(std::uint64_t seed, long long u, long long v) {
+  const std::uint64_t pu = stream(seed, static_cast<std::uint64_t>(u)).next();
+  const std::uint64_t pv = stream(seed, static_cast<std::uint64_t>(v)).next();
+  return pu != pv ? pu > pv : u < v;
+}
+
+// Whether vertex v, row row of g, goes before all its uncolored neighbours,
+// color_of(u) giving the color of neighbour u. The scan resumes at edge
+// cursor and stops on the neighbour that holds v back: the neighbours
+// before it are colored or go after v and stay that way, so a hub waiting
+// many rounds reads its row about once in all rather than once a round.
+template <typename W, typename I, typename ColorOf>
+bool first_among_uncolored(const GraphView<W, I>& g, I row, I v, std::uint64_t seed, const ColorOf& color_of,
+                           I& cursor) {
+  for (; cursor < g.row_ptr[row + 1]; cursor++) {
+    const I u = g.col_idx[cursor];
+    if (u != v && color_of(u) == I(kUncolored) && goes_before(seed, u, v)) return false;
+  }
+  return true;
+}
+
+// The smallest color no neighbour of row row of g has; taken is scratch.
+// Among degree + 1 colors one is always free.
+template <typename W, typename I, typename ColorOf>
+I smallest_free(const GraphView<W, I>& g, I row, const ColorOf& color_of, std::vector<char>& taken) {
+  const I degree = g.row_ptr[row + 1] - g.row_ptr[row];
+  taken.assign(static_cast<size_t>(degree) + 1, 0);
+  for (I e = g.row_ptr[row]; e < g.row_ptr[row + 1]; e++) {
+    const I c = color_of(g.col_idx[e]);
+    if (c >= 0 && c <= degree) taken[c] = 1;
+  }
+  return static_cast<I>(std::find(taken.begin(), taken.end(), 0) - taken.begin());
+}
+
+}  // namespace detail
+
+// Whether the well_formed() CSR structure row_ptr / col_idx of a graph of
+// vertices vertices stores every edge both ways, as often one way as the
+// other: each row holds the same heads as the same row of the transpose,
+// which a counting sort builds with its rows in order.
+template <typename I>
+bool symmetric(I vertices, const I* row_ptr, const I* col_idx) {
+  std::vector<I> in_ptr(static_cast<size_t>(vertices) + 1, 0);
+  for (I e = 0; e < row_ptr[vertices]; e++) in_ptr[col_idx[e] + 1]++;
+  for (I v = 0; v < vertices; v++) {
+    in_ptr[v + 1] += in_ptr[v];
+    if (in_ptr[v + 1] - in_ptr[v] != row_ptr[v + 1] - row_ptr[v]) return false;
+  }
+  std::vector<I> sources(static_cast<size_t>(row_ptr[vertices]));
+  std::vector<I> slot(in_ptr.begin(), in_ptr.end() - 1);
+  for (I v = 0; v < vertices; v++) {
+    for (I e = row_ptr[v]; e < row_ptr[v + 1]; e++) sources[slot[col_idx[e]]++] = v;
+  }
+  std::vector<I> heads;
+  for (I v = 0; v < vertices; v++) {
+    heads.assign(col_idx + row_ptr[v], col_idx + row_ptr[v + 1]);
+    std::sort(heads.begin(), heads.end());
+    if (!std::equal(heads.begin(), heads.end(), sources.begin() + in_ptr[v])) return false;
+  }
+  return true;
+}
+
+// Jones-Plassmann coloring of g with Luby's random priorities: colors 0, 1,
+// ... such that no edge joins two vertices of one color. g must be
+// symmetric(), every edge stored both ways. Each round colors at once every
+// uncolored vertex that goes before all its uncolored neighbours, an
+// independent set, with the smallest color its neighbours leave free. That
+// is the greedy coloring in priority order, so the result depends on seed
+// alone and not on threads or ranks, with at most max degree + 1 colors,
+// and random priorities keep the rounds few. Rounds are two passes over the
+// uncolored vertices, one to find the set and one to color it, so no thread
+// reads a color another is writing.
+template <typename W, typename I>
+std::vector<I> jones_plassmann(const GraphView<W, I>& g, std::uint64_t seed = 1) {
+  std::vector<I> color(g.rows, I(kUncolored));
+  const auto color_of = [&color](I u) { return color[u]; };
+  std::vector<I> active(g.rows);
+  std::iota(active.begin(), active.end(), I(0));
+  std::vector<I> cursor(g.row_ptr, g.row_ptr + g.rows);
+  std::vector<char> ready;
+  std::vector<I> rest;
+  while (!active.empty()) {
+    const auto size = static_cast<long long>(active.size());
+    const int threads = detail::load_threads(active.size());
+    ready.assign(active.size(), 0);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+    for (long long i = 0; i < size; i++) {
+      const I v = active[i];
+      ready[i] = detail::first_among_uncolored(g, v, v, seed, color_of, cursor[v]) ? 1 : 0;
+    }
+#pragma omp parallel num_threads(threads) if (threads > 1)
+    {
+      std::vector<char> taken;
+#pragma omp for schedule(static)
+      for (long long i = 0; i < size; i++) {
+        if (ready[i] != 0) color[active[i]] = detail::smallest_free(g, active[i], color_of, taken);
+      }
+    }
+    rest.clear();
+    for (long long i = 0; i < size; i++) {
+      if (ready[i] == 0) rest.push_back(active[i]);
+    }
+    active.swap(rest);
+  }
+  return color;
+}
+
+// Whether colors is a proper coloring of g: every vertex colored, no edge
+// between two vertices of one color; self-loops aside.
+template <typename W, typename I>
+bool proper_coloring(const GraphView<W, I>& g, const std::vector<I>& colors) {
+  for (I v = 0; v < g.rows; v++) {
+    if (colors[v] < 0) return false;
+    for (I e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+      if (g.col_idx[e] != v && colors[g.col_idx[e]] == colors[v]) return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_COLORING_HPP_
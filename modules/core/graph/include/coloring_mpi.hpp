@@ -0,0 +1,100 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_COLORING_MPI_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_COLORING_MPI_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/coloring.hpp"
+#include "core/graph/include/graph_mpi.hpp"
+#include "core/graph/include/sssp.hpp"
+
+namespace ppc::core::graph {
+
+namespace detail {
+
+// The color a vertex got, for the ranks that hold it as a neighbour.
+template <typename I>
+struct Coloring {
+  I vertex;
+  I color;
+};
+
+}  // namespace detail
+
+// Distributed jones_plassmann(), with the rows of each rank as for the
+// distributed bellman_ford(): rank r owns the vertices [bounds[r], bounds[r
+// + 1]) and gets their colors back, the same as jones_plassmann() gives
+// them. Priorities come from the vertex alone, so a rank needs no more of
+// its neighbours on other ranks than their colors: those are kept in a map
+// of ghosts, and a round sends the colors of the boundary vertices it
+// colored to the ranks their neighbours live on, in one exchange(), before
+// one all_reduce of the vertices left. The graph must be symmetric(): a
+// rank finds the ranks to send a color to from its own edges alone.
+template <typename W, typename I>
+std::vector<I> jones_plassmann(const boost::mpi::communicator& world, const GraphView<W, I>& local,
+                               const std::vector<I>& bounds, std::uint64_t seed = 1) {
+  const I begin = bounds[world.rank()];
+  const I end = bounds[world.rank() + 1];
+  std::vector<I> color(local.rows, I(kUncolored));
+  std::unordered_map<I, I> ghost;
+  // ranks to tell of the color of each vertex, row by row
+  std::vector<I> watcher_ptr(local.rows + 1, I(0));
+  std::vector<int> watchers;
+  for (I v = 0; v < local.rows; v++) {
+    const auto first = watchers.size();
+    for (I e = local.row_ptr[v]; e < local.row_ptr[v + 1]; e++) {
+      const I u = local.col_idx[e];
+      if (u >= begin && u < end) continue;
+      ghost.emplace(u, I(kUncolored));
+      watchers.push_back(vertex_owner(bounds, u));
+    }
+    std::sort(watchers.begin() + first, watchers.end());
+    watchers.erase(std::unique(watchers.begin() + first, watchers.end()), watchers.end());
+    watcher_ptr[v + 1] = static_cast<I>(watchers.size());
+  }
+  const auto color_of = [&](I u) { return u >= begin && u < end ? color[u - begin] : ghost.find(u)->second; };
+
+  std::vector<I> active(local.rows);
+  for (I v = 0; v < local.rows; v++) active[v] = v;
+  std::vector<I> cursor(local.row_ptr, local.row_ptr + local.rows);
+  std::vector<char> ready;
+  std::vector<I> rest;
+  std::vector<char> taken;
+  std::vector<std::vector<detail::Coloring<I>>> outbox(world.size());
+  while (true) {
+    ready.assign(active.size(), 0);
+    for (size_t i = 0; i < active.size(); i++) {
+      const I v = active[i];
+      ready[i] = detail::first_among_uncolored(local, v, begin + v, seed, color_of, cursor[v]) ? 1 : 0;
+    }
+    rest.clear();
+    for (size_t i = 0; i < active.size(); i++) {
+      const I v = active[i];
+      if (ready[i] == 0) {
+        rest.push_back(v);
+        continue;
+      }
+      color[v] = detail::smallest_free(local, v, color_of, taken);
+      for (I w = watcher_ptr[v]; w < watcher_ptr[v + 1]; w++) outbox[watchers[w]].push_back({begin + v, color[v]});
+    }
+    active.swap(rest);
+    for (const auto& m : exchange(world, outbox)) ghost[m.vertex] = m.color;
+
+    long long left = 0;
+    boost::mpi::all_reduce(world, static_cast<long long>(active.size()), left, std::plus<>());
+    if (left == 0) return color;
+  }
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_COLORING_MPI_HPP_
@@ -0,0 +1,211 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_GENERATORS_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_GENERATORS_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "core/graph/include/loader.hpp"
+
+namespace ppc::core::graph {
+
+// The generators below build undirected graphs as edge lists holding every
+// edge in both directions with the same weight, ready for csr_from_edges()
+// or write_edge_file(). Every random draw is a pure function of the seed and
+// the position it is drawn for, so the graph is the same whatever the number
+// of threads or ranks that build it, and any rank can build it alone.
+
+namespace detail {
+
+// SplitMix64 (Steele, Lea and Flood): a counter-based stream, cheap enough
+// to start one per edge or per vertex.
+struct SplitMix64 {
+  std::uint64_t state;
+
+  std::uint64_t next() {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  // Uniform in [0, 1).
+  double uniform() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+};
+
+inline SplitMix64 stream(std::uint64_t seed, std::uint64_t position) {
+  SplitMix64 mixer{seed ^ (position * 0xD1B54A32D192ED03ULL)};
+  return SplitMix64{mixer.next()};
+}
+
+// A weight in [lo, hi] for integral W, [lo, hi) for floating-point W.
+template <typename W>
+W draw_weight(SplitMix64& gen, W lo, W hi) {
+  if constexpr (std::is_integral_v<W>) {
+    const auto span = static_cast<double>(hi) - static_cast<double>(lo) + 1.0;
+    return std::min<W>(hi, static_cast<W>(static_cast<double>(lo) + std::floor(gen.uniform() * span)));
+  } else {
+    return lo + static_cast<W>(gen.uniform()) * (hi - lo);
+  }
+}
+
+template <typename W, typename I>
+void put_undirected(Edge<W, I>* out, I u, I v, W weight) {
+  out[0] = {u, v, weight};
+  out[1] = {v, u, weight};
+}
+
+// A fixed bijection of [0, 2^scale) that spreads the R-MAT vertex ids,
+// which otherwise put the heavy vertices at the low ids: two rounds of an
+// odd multiply and an xor-shift, both invertible on scale-bit words.
+inline std::uint64_t scramble(std::uint64_t v, int scale, std::uint64_t seed) {
+  const std::uint64_t mask = scale >= 64 ? ~0ULL : (1ULL << scale) - 1;
+  const int half = std::max(1, scale / 2);
+  v = ((v ^ seed) * 0x9E3779B97F4A7C15ULL) & mask;
+  v ^= v >> half;
+  v = (v * 0xBF58476D1CE4E5B9ULL) & mask;
+  return v ^ (v >> half);
+}
+
+}  // namespace detail
+
+// Quadrant probabilities of R-MAT; d is 1 - a - b - c. The defaults are the
+// Graph 500 Kronecker parameters.
+struct RmatShape {
+  double a = 0.57;
+  double b = 0.19;
+  double c = 0.19;
+};
+
+// R-MAT graph (Chakrabarti, Zhan and Faloutsos) of 2^scale vertices and
+// edge_factor * 2^scale undirected edges, which is the Graph 500 Kronecker
+// generator: each edge picks one quadrant of the adjacency matrix per bit of
+// its endpoints, so degrees follow a power law and a few hubs hold most of
+// the edges. Vertex ids are scrambled, and self-loops and duplicates are kept,
+// as in Graph 500.
+template <typename W, typename I = int>
+std::vector<Edge<W, I>> rmat_edges(int scale, int edge_factor, W min_weight, W max_weight, std::uint64_t seed,
+                                   RmatShape shape = {}) {
+  const auto undirected = static_cast<long long>(edge_factor) << scale;
+  std::vector<Edge<W, I>> edges(2 * static_cast<size_t>(undirected));
+  const double ab = shape.a + shape.b;
+  const double a_in_ab = shape.a / ab;
+  const double c_in_cd = shape.c / (1.0 - ab);
+  const int threads = detail::load_threads(edges.size());
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long e = 0; e < undirected; e++) {
+    auto gen = detail::stream(seed, static_cast<std::uint64_t>(e));
+    std::uint64_t u = 0;
+    std::uint64_t v = 0;
+    for (int bit = 0; bit < scale; bit++) {
+      const bool lower = gen.uniform() >= ab;
+      const bool right = gen.uniform() >= (lower ? c_in_cd : a_in_ab);
+      u = (u << 1) | (lower ? 1 : 0);
+      v = (v << 1) | (right ? 1 : 0);
+    }
+    detail::put_undirected(edges.data() + 2 * e, static_cast<I>(detail::scramble(u, scale, seed)),
+                           static_cast<I>(detail::scramble(v, scale, seed)),
+                           detail::draw_weight(gen, min_weight, max_weight));
+  }
+  return edges;
+}
+
+// rows x cols 2D grid with an edge between vertices r * cols + c that are
+// horizontal or vertical neighbours: every vertex has degree four at most
+// and the diameter is rows + cols - 2, the opposite of R-MAT.
+template <typename W, typename I = int>
+std::vector<Edge<W, I>> grid_edges(I rows, I cols, W min_weight, W max_weight, std::uint64_t seed) {
+  if (rows <= 0 || cols <= 0) return {};
+  // row r holds cols - 1 horizontal edges and, but for the last, cols to
+  // the row below
+  const auto per_row = 2 * static_cast<long long>(cols) - 1;
+  const auto undirected = (static_cast<long long>(rows) - 1) * per_row + cols - 1;
+  std::vector<Edge<W, I>> edges(2 * static_cast<size_t>(undirected));
+  const int threads = detail::load_threads(edges.size());
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long r = 0; r < static_cast<long long>(rows); r++) {
+    auto gen = detail::stream(seed, static_cast<std::uint64_t>(r));
+    Edge<W, I>* out = edges.data() + 2 * r * per_row;
+    const auto first = static_cast<I>(r * cols);
+    for (I c = 0; c + 1 < cols; c++, out += 2) {
+      detail::put_undirected(out, first + c, first + c + 1, detail::draw_weight(gen, min_weight, max_weight));
+    }
+    if (r + 1 == static_cast<long long>(rows)) continue;
+    for (I c = 0; c < cols; c++, out += 2) {
+      detail::put_undirected(out, first + c, first + cols + c, detail::draw_weight(gen, min_weight, max_weight));
+    }
+  }
+  return edges;
+}
+
+// Radius at which a random geometric graph of vertices vertices has about
+// the given average degree.
+inline double geometric_radius(long long vertices, double degree) {
+  return std::sqrt(degree / (3.14159265358979323846 * static_cast<double>(std::max(vertices, 1LL))));
+}
+
+// Random geometric graph: vertices points uniform in the unit square, with
+// an edge between every two closer than radius (see geometric_radius()).
+// Degrees are even and the diameter large, as in road and mesh networks.
+// The points are bucketed into cells at least radius wide, so each is only
+// compared to the points of its own and the eight adjacent cells; bands of
+// vertices are joined on the threads and concatenated in vertex order.
+template <typename W, typename I = int>
+std::vector<Edge<W, I>> geometric_edges(I vertices, double radius, W min_weight, W max_weight,
+                                        std::uint64_t seed) {
+  const auto n = static_cast<long long>(vertices);
+  if (n <= 0) return {};
+  std::vector<double> x(n);
+  std::vector<double> y(n);
+  const int threads = detail::load_threads(static_cast<size_t>(n));
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long i = 0; i < n; i++) {
+    auto gen = detail::stream(seed, static_cast<std::uint64_t>(i));
+    x[i] = gen.uniform();
+    y[i] = gen.uniform();
+  }
+
+  const int side = std::clamp(radius > 0.0 ? static_cast<int>(1.0 / radius) : 1, 1, 1 << 12);
+  const auto cell_of = [side](double coordinate) { return std::min(side - 1, static_cast<int>(coordinate * side)); };
+  std::vector<I> cell_ptr(static_cast<size_t>(side) * side + 1, 0);
+  for (long long i = 0; i < n; i++) cell_ptr[cell_of(y[i]) * side + cell_of(x[i]) + 1]++;
+  for (size_t k = 1; k < cell_ptr.size(); k++) cell_ptr[k] += cell_ptr[k - 1];
+  std::vector<I> next(cell_ptr.begin(), cell_ptr.end() - 1);
+  std::vector<I> in_cell(n);
+  for (long long i = 0; i < n; i++) in_cell[next[cell_of(y[i]) * side + cell_of(x[i])]++] = static_cast<I>(i);
+
+  std::vector<std::vector<Edge<W, I>>> part(threads);
+  const double r2 = radius * radius;
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (int t = 0; t < threads; t++) {
+    Edge<W, I> pair[2];
+    for (long long i = n * t / threads; i < n * (t + 1) / threads; i++) {
+      const int cx = cell_of(x[i]);
+      const int cy = cell_of(y[i]);
+      for (int ny = std::max(cy - 1, 0); ny <= std::min(cy + 1, side - 1); ny++) {
+        for (int nx = std::max(cx - 1, 0); nx <= std::min(cx + 1, side - 1); nx++) {
+          for (I k = cell_ptr[ny * side + nx]; k < cell_ptr[ny * side + nx + 1]; k++) {
+            const I j = in_cell[k];
+            const double dx = x[i] - x[j];
+            const double dy = y[i] - y[j];
+            if (j <= i || dx * dx + dy * dy >= r2) continue;
+            auto gen = detail::stream(seed ^ 0x5851F42D4C957F2DULL, static_cast<std::uint64_t>(i) * n + j);
+            detail::put_undirected(pair, static_cast<I>(i), j, detail::draw_weight(gen, min_weight, max_weight));
+            part[t].insert(part[t].end(), pair, pair + 2);
+          }
+        }
+      }
+    }
+  }
+  for (int t = 1; t < threads; t++) part[0].insert(part[0].end(), part[t].begin(), part[t].end());
+  return std::move(part[0]);
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_GENERATORS_HPP_
@@ -0,0 +1,77 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_GRAPH_MPI_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_GRAPH_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core::graph {
+
+// Rank that owns vertex v when rank r owns [bounds[r], bounds[r + 1]).
+template <typename I>
+int vertex_owner(const std::vector<I>& bounds, I v) {
+  return static_cast<int>(std::upper_bound(bounds.begin() + 1, bounds.end(), v) - bounds.begin()) - 1;
+}
+
+// Sends outbox[r] to rank r, for every r at once, and returns what all ranks
+// sent here in rank order; outbox is left empty for the next batch. One
+// alltoall of the counts and one alltoallv of the raw messages, so a round
+// of relaxations costs two collectives however many edges it crosses.
+template <typename M>
+std::vector<M> exchange(const boost::mpi::communicator& world, std::vector<std::vector<M>>& outbox) {
+  static_assert(std::is_trivially_copyable_v<M>, "messages travel as raw bytes");
+  const int size = world.size();
+  std::vector<int> send_counts(size);
+  std::vector<int> send_displs(size, 0);
+  for (int r = 0; r < size; r++) {
+    send_counts[r] = static_cast<int>(outbox[r].size() * sizeof(M));
+    if (r > 0) send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+  }
+  std::vector<M> send;
+  send.reserve((send_displs[size - 1] + send_counts[size - 1]) / sizeof(M));
+  for (auto& box : outbox) {
+    send.insert(send.end(), box.begin(), box.end());
+    box.clear();
+  }
+  std::vector<int> recv_counts(size);
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, world);
+  std::vector<int> recv_displs(size, 0);
+  for (int r = 1; r < size; r++) recv_displs[r] = recv_displs[r - 1] + recv_counts[r - 1];
+  std::vector<M> recv((recv_displs[size - 1] + recv_counts[size - 1]) / sizeof(M));
+  MPI_Alltoallv(send.data(), send_counts.data(), send_displs.data(), MPI_BYTE, recv.data(), recv_counts.data(),
+                recv_displs.data(), MPI_BYTE, world);
+  return recv;
+}
+
+// Concatenates the per-vertex values of every rank's block on root, where
+// they are indexed by vertex; other ranks get an empty vector. With
+// per_vertex values a vertex, vertex v's are [v * per_vertex, (v + 1) *
+// per_vertex) of local and of the result.
+template <typename T, typename I>
+std::vector<T> gather_blocks(const boost::mpi::communicator& world, const std::vector<T>& local,
+                             const std::vector<I>& bounds, int root = 0, size_t per_vertex = 1) {
+  const int size = world.size();
+  std::vector<int> counts(size);
+  std::vector<int> displs(size);
+  for (int r = 0; r < size; r++) {
+    counts[r] = static_cast<int>((bounds[r + 1] - bounds[r]) * per_vertex);
+    displs[r] = static_cast<int>(bounds[r] * per_vertex);
+  }
+  std::vector<T> all(world.rank() == root ? static_cast<size_t>(bounds[size]) * per_vertex : 0);
+  const MPI_Datatype type = boost::mpi::get_mpi_datatype<T>(T{});
+  MPI_Gatherv(local.data(), static_cast<int>(local.size()), type, all.data(), counts.data(), displs.data(), type, root,
+              world);
+  return all;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_GRAPH_MPI_HPP_
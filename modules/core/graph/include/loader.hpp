@@ -0,0 +1,284 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_LOADER_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_LOADER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/mapped_file.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::graph {
+
+// One weighted directed edge. An edge list is an array of these, which is
+// also the record layout of an edge file.
+template <typename W, typename I = int>
+struct Edge {
+  I source;
+  I target;
+  W weight;
+};
+
+namespace detail {
+
+// Per thread; below it the builders run on one thread.
+constexpr size_t kLoadMinPerThread = size_t{1} << 16;
+
+inline int load_threads(size_t n) {
+#ifdef _OPENMP
+  const size_t useful = std::max<size_t>(1, n / kLoadMinPerThread);
+  return static_cast<int>(std::min<size_t>(omp_get_max_threads(), useful));
+#else
+  (void)n;
+  return 1;
+#endif
+}
+
+}  // namespace detail
+
+// CSR of the rows [first_row, first_row + rows) of a graph from its edges in
+// any order, all of whose sources fall in that range; column ids are kept
+// as they are. A parallel counting sort: degrees are counted with atomic
+// increments, a prefix sum turns them into row_ptr and every edge is
+// dropped into the next free slot of its row. That order depends on the
+// threads, so each row is then sorted by target (and weight, for parallel
+// edges), which makes the result deterministic and rows ordered like the
+// rows of a matrix. Returns false, leaving out alone, if an edge falls
+// outside [first_row, first_row + rows) x [0, cols).
+template <typename W, typename I>
+bool build_csr(I rows, I cols, I first_row, const Edge<W, I>* edges, size_t count, sparse::CSR<W, I>& out) {
+  const auto n = static_cast<long long>(count);
+  const int threads = detail::load_threads(count);
+  bool in_range = true;
+#pragma omp parallel for num_threads(threads) schedule(static) reduction(&& : in_range) if (threads > 1)
+  for (long long e = 0; e < n; e++) {
+    const Edge<W, I>& edge = edges[e];
+    in_range = in_range && edge.source >= first_row && edge.source - first_row < rows && edge.target >= 0 &&
+               edge.target < cols;
+  }
+  if (!in_range) return false;
+
+  std::vector<I> row_ptr(static_cast<size_t>(rows) + 1, 0);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long e = 0; e < n; e++) {
+    std::atomic_ref<I>(row_ptr[edges[e].source - first_row + 1]).fetch_add(1, std::memory_order_relaxed);
+  }
+  for (I i = 0; i < rows; i++) row_ptr[i + 1] += row_ptr[i];
+
+  std::vector<I> next(row_ptr.begin(), row_ptr.end() - 1);
+  std::vector<std::pair<I, W>> slots(count);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long e = 0; e < n; e++) {
+    const Edge<W, I>& edge = edges[e];
+    const I slot = std::atomic_ref<I>(next[edge.source - first_row]).fetch_add(1, std::memory_order_relaxed);
+    slots[slot] = {edge.target, edge.weight};
+  }
+
+  const auto row_count = static_cast<long long>(rows);
+  sparse::CSR<W, I> m;
+  m.rows = rows;
+  m.cols = cols;
+  m.col_idx.resize(count);
+  m.values.resize(count);
+#pragma omp parallel for num_threads(threads) schedule(dynamic, 1024) if (threads > 1)
+  for (long long i = 0; i < row_count; i++) {
+    std::sort(slots.begin() + row_ptr[i], slots.begin() + row_ptr[i + 1]);
+    for (I p = row_ptr[i]; p < row_ptr[i + 1]; p++) {
+      m.col_idx[p] = slots[p].first;
+      m.values[p] = slots[p].second;
+    }
+  }
+  m.row_ptr = std::move(row_ptr);
+  out = std::move(m);
+  return true;
+}
+
+// CSR of a whole graph of vertices vertices from its edge list.
+template <typename W, typename I>
+bool csr_from_edges(I vertices, const Edge<W, I>* edges, size_t count, sparse::CSR<W, I>& out) {
+  return build_csr(vertices, vertices, I(0), edges, count, out);
+}
+
+// CSR of the graph whose row-major vertices x vertices adjacency matrix is
+// matrix, zero meaning no edge: sparse::from_dense() with the rows split
+// over threads, one pass to count each row and one to fill it. Still reads
+// all V^2 entries; graphs of any size should come as edges instead.
+template <typename W, typename I>
+sparse::CSR<W, I> csr_from_dense(const W* matrix, I vertices) {
+  const auto rows = static_cast<long long>(vertices);
+  const size_t v = static_cast<size_t>(vertices);
+  const int threads = detail::load_threads(v * v);
+  sparse::CSR<W, I> m;
+  m.rows = vertices;
+  m.cols = vertices;
+  m.row_ptr.assign(v + 1, 0);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long i = 0; i < rows; i++) {
+    const W* row = matrix + static_cast<size_t>(i) * v;
+    m.row_ptr[i + 1] = static_cast<I>(std::count_if(row, row + v, [](const W& w) { return w != W{}; }));
+  }
+  for (I i = 0; i < vertices; i++) m.row_ptr[i + 1] += m.row_ptr[i];
+  m.col_idx.resize(m.row_ptr[vertices]);
+  m.values.resize(m.row_ptr[vertices]);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long i = 0; i < rows; i++) {
+    const W* row = matrix + static_cast<size_t>(i) * v;
+    I p = m.row_ptr[i];
+    for (I j = 0; j < vertices; j++) {
+      if (row[j] == W{}) continue;
+      m.col_idx[p] = j;
+      m.values[p++] = row[j];
+    }
+  }
+  return m;
+}
+
+// An edge file: an EdgeFileHeader followed by the edges as raw Edge<W, I>
+// records, so a mapped file is an edge list as it stands and any slice of it
+// can be read without parsing the rest.
+struct EdgeFileHeader {
+  char magic[8];
+  std::uint64_t vertices;
+  std::uint64_t edges;
+  std::uint64_t record_size;
+};
+
+inline constexpr char kEdgeFileMagic[8] = {'P', 'P', 'C', 'E', 'D', 'G', 'E', '1'};
+
+template <typename W, typename I>
+bool write_edge_file(const std::string& path, I vertices, const Edge<W, I>* edges, size_t count) {
+  static_assert(std::is_trivially_copyable_v<Edge<W, I>>, "edges are stored as raw records");
+  EdgeFileHeader header{};
+  std::memcpy(header.magic, kEdgeFileMagic, sizeof(header.magic));
+  header.vertices = static_cast<std::uint64_t>(vertices);
+  header.edges = count;
+  header.record_size = sizeof(Edge<W, I>);
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(edges), static_cast<std::streamsize>(count * sizeof(Edge<W, I>)));
+  out.close();
+  return !out.fail();
+}
+
+// Read-only mapping of an edge file written by write_edge_file() with the
+// same W and I. Pages of the edge array are only read in as they are
+// touched, so a rank that needs a slice of the edges reads just that.
+template <typename W, typename I>
+class EdgeFile {
+ public:
+  // Returns false if path cannot be mapped or is not an edge file of
+  // Edge<W, I> records with as many of them as its header says.
+  bool open(const std::string& path) {
+    if (!file_.open(path) || file_.size() < sizeof(EdgeFileHeader)) return fail();
+    std::memcpy(&header_, file_.data(), sizeof(header_));
+    const bool valid = std::memcmp(header_.magic, kEdgeFileMagic, sizeof(header_.magic)) == 0 &&
+                       header_.record_size == sizeof(Edge<W, I>) &&
+                       file_.size() == sizeof(EdgeFileHeader) + header_.edges * sizeof(Edge<W, I>);
+    return valid || fail();
+  }
+
+  void close() { file_.close(); }
+
+  [[nodiscard]] I vertices() const { return static_cast<I>(header_.vertices); }
+  [[nodiscard]] size_t size() const { return static_cast<size_t>(header_.edges); }
+  [[nodiscard]] const Edge<W, I>* edges() const {
+    return reinterpret_cast<const Edge<W, I>*>(file_.data() + sizeof(EdgeFileHeader));
+  }
+
+ private:
+  bool fail() {
+    file_.close();
+    header_ = {};
+    return false;
+  }
+
+  sort::MappedFile file_;
+  EdgeFileHeader header_{};
+};
+
+// CSR of the whole graph in an edge file.
+template <typename W, typename I>
+bool load_edge_file(const std::string& path, sparse::CSR<W, I>& out) {
+  EdgeFile<W, I> file;
+  return file.open(path) && csr_from_edges(file.vertices(), file.edges(), file.size(), out);
+}
+
+// How a task hands a graph of V vertices and E edges over in its inputs.
+enum class GraphFormat : std::uint32_t {
+  // inputs[0]: row-major V x V adjacency matrix, zero meaning no edge
+  kDenseMatrix = 0,
+  // inputs[0]: E Edge<W, I> records in any order
+  kEdgeList = 1,
+  // inputs[0..2]: CSR row_ptr (V + 1), col_idx (E) and values (E)
+  kCSR = 2,
+  // inputs[0]: NUL-terminated path of an edge file (write_edge_file())
+  kEdgeFile = 3,
+};
+
+inline bool known_format(std::uint32_t format) { return format <= static_cast<std::uint32_t>(GraphFormat::kEdgeFile); }
+
+// Number of inputs a format takes.
+inline size_t format_inputs(GraphFormat format) { return format == GraphFormat::kCSR ? 3 : 1; }
+
+// Whether row_ptr (V + 1) and col_idx (E) are the CSR structure of a graph
+// of vertices vertices and edges edges: rows in order from 0 to E and every
+// head a vertex.
+template <typename I>
+bool well_formed(I vertices, const I* row_ptr, const I* col_idx, size_t edges) {
+  bool valid = row_ptr[0] == 0 && static_cast<size_t>(row_ptr[vertices]) == edges;
+  for (I i = 0; valid && i < vertices; i++) valid = row_ptr[i] <= row_ptr[i + 1];
+  for (size_t e = 0; valid && e < edges; e++) valid = col_idx[e] >= 0 && col_idx[e] < vertices;
+  return valid;
+}
+
+// CSR of a graph of vertices vertices and edges edges handed over in inputs
+// as format says; only an edge file brings its own sizes, which must match.
+// Only a dense matrix costs O(V^2): the other formats are read in O(V + E).
+// Returns false on a malformed graph.
+template <typename W, typename I>
+bool load_graph(GraphFormat format, const std::vector<std::uint8_t*>& inputs, I vertices, size_t edges,
+                sparse::CSR<W, I>& out) {
+  if (inputs.size() < format_inputs(format)) return false;
+  switch (format) {
+    case GraphFormat::kDenseMatrix:
+      out = csr_from_dense(reinterpret_cast<const W*>(inputs[0]), vertices);
+      return true;
+    case GraphFormat::kEdgeList:
+      return csr_from_edges(vertices, reinterpret_cast<const Edge<W, I>*>(inputs[0]), edges, out);
+    case GraphFormat::kCSR: {
+      const auto* row_ptr = reinterpret_cast<const I*>(inputs[0]);
+      const auto* col_idx = reinterpret_cast<const I*>(inputs[1]);
+      const auto* values = reinterpret_cast<const W*>(inputs[2]);
+      if (!well_formed(vertices, row_ptr, col_idx, edges)) return false;
+      out.rows = out.cols = vertices;
+      out.row_ptr.assign(row_ptr, row_ptr + vertices + 1);
+      out.col_idx.assign(col_idx, col_idx + edges);
+      out.values.assign(values, values + edges);
+      return true;
+    }
+    case GraphFormat::kEdgeFile: {
+      EdgeFile<W, I> file;
+      return file.open(reinterpret_cast<const char*>(inputs[0])) && file.vertices() == vertices &&
+             file.size() == edges && csr_from_edges(vertices, file.edges(), file.size(), out);
+    }
+  }
+  return false;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_LOADER_HPP_
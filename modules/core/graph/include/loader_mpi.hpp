@@ -0,0 +1,127 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_LOADER_MPI_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_LOADER_MPI_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "core/graph/include/graph_mpi.hpp"
+#include "core/graph/include/loader.hpp"
+#include "core/sparse/include/partition.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core::graph {
+
+// Sends each of the count edges to the rank owner(edge) names, all in one
+// exchange(), and returns the edges every rank sent here.
+template <typename W, typename I, typename Owner>
+std::vector<Edge<W, I>> distribute_edges(const boost::mpi::communicator& world, const Edge<W, I>* edges, size_t count,
+                                         Owner owner) {
+  std::vector<std::vector<Edge<W, I>>> outbox(world.size());
+  for (size_t e = 0; e < count; e++) outbox[owner(edges[e])].push_back(edges[e]);
+  return exchange(world, outbox);
+}
+
+// A grid of rows x cols ranks for 2D partitioned graphs, as square as size
+// allows: rows is the largest divisor of size not above its square root.
+struct GridShape {
+  int rows;
+  int cols;
+};
+
+inline GridShape grid_shape(int size) {
+  int rows = 1;
+  for (int r = 1; r * r <= size; r++) {
+    if (size % r == 0) rows = r;
+  }
+  return {rows, size / rows};
+}
+
+namespace detail {
+
+// Maps path on every rank and hands each its 1 / size share of the edge
+// records, in file order; false on every rank if any rank failed.
+template <typename W, typename I>
+bool open_edge_slice(const boost::mpi::communicator& world, const std::string& path, EdgeFile<W, I>& file,
+                     const Edge<W, I>*& first, size_t& count) {
+  const bool opened = file.open(path);
+  bool all = false;
+  boost::mpi::all_reduce(world, opened, all, std::logical_and<>());
+  if (!all) return false;
+  const size_t begin = file.size() * world.rank() / world.size();
+  const size_t end = file.size() * (world.rank() + 1) / world.size();
+  first = file.edges() + begin;
+  count = end - begin;
+  return true;
+}
+
+}  // namespace detail
+
+// 1D partitioned loading of an edge file that every rank can read. bounds
+// gets the even split of the vertices over the ranks and local the rows
+// [bounds[r], bounds[r + 1]) of rank r, with global column ids, ready for
+// the distributed algorithms. Each rank reads only its slice of the edge
+// records and sends every edge to the owner of its source, so the file is
+// read once in total and no rank ever holds more than its slice and its
+// rows: the whole graph is never in one place. Edges outside the graph go
+// to rank 0, whose build rejects them. Returns false on every rank if the
+// file cannot be read or holds such an edge.
+template <typename W, typename I>
+bool load_rows(const boost::mpi::communicator& world, const std::string& path, std::vector<I>& bounds,
+               sparse::CSR<W, I>& local) {
+  EdgeFile<W, I> file;
+  const Edge<W, I>* first = nullptr;
+  size_t count = 0;
+  if (!detail::open_edge_slice(world, path, file, first, count)) return false;
+  const I vertices = file.vertices();
+  bounds = sparse::even_row_blocks(vertices, world.size());
+  const auto mine = distribute_edges(world, first, count, [&](const Edge<W, I>& e) {
+    return e.source >= 0 && e.source < vertices ? vertex_owner(bounds, e.source) : 0;
+  });
+  file.close();
+  const int rank = world.rank();
+  const bool built =
+      build_csr(bounds[rank + 1] - bounds[rank], vertices, bounds[rank], mine.data(), mine.size(), local);
+  bool all = false;
+  boost::mpi::all_reduce(world, built, all, std::logical_and<>());
+  return all;
+}
+
+// 2D partitioned loading: the ranks form grid (see grid_shape()), the
+// vertices are split evenly into grid.rows row blocks (row_bounds) and
+// grid.cols column blocks (col_bounds), and rank i * grid.cols + j gets the
+// edges from row block i to column block j as the rows of block i, with
+// global column ids. Reading and routing are as in load_rows(). Edges
+// outside the graph are routed to rank 0, whose build rejects them.
+template <typename W, typename I>
+bool load_grid_block(const boost::mpi::communicator& world, const std::string& path, GridShape grid,
+                     std::vector<I>& row_bounds, std::vector<I>& col_bounds, sparse::CSR<W, I>& local) {
+  if (grid.rows * grid.cols != world.size()) return false;
+  EdgeFile<W, I> file;
+  const Edge<W, I>* first = nullptr;
+  size_t count = 0;
+  if (!detail::open_edge_slice(world, path, file, first, count)) return false;
+  const I vertices = file.vertices();
+  row_bounds = sparse::even_row_blocks(vertices, grid.rows);
+  col_bounds = sparse::even_row_blocks(vertices, grid.cols);
+  const auto mine = distribute_edges(world, first, count, [&](const Edge<W, I>& e) {
+    const bool inside = e.source >= 0 && e.source < vertices && e.target >= 0 && e.target < vertices;
+    return inside ? vertex_owner(row_bounds, e.source) * grid.cols + vertex_owner(col_bounds, e.target) : 0;
+  });
+  file.close();
+  const int block_row = world.rank() / grid.cols;
+  const bool built = build_csr(row_bounds[block_row + 1] - row_bounds[block_row], vertices, row_bounds[block_row],
+                               mine.data(), mine.size(), local);
+  bool all = false;
+  boost::mpi::all_reduce(world, built, all, std::logical_and<>());
+  return all;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_LOADER_MPI_HPP_
@@ -0,0 +1,177 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_MST_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_MST_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/loader.hpp"
+#include "core/graph/include/sssp.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::graph {
+
+// A minimum spanning forest: a tree per connected component, its edges as
+// source < target, and their total weight.
+template <typename W, typename I = int>
+struct SpanningForest {
+  W weight{};
+  std::vector<Edge<W, I>> edges;
+};
+
+namespace detail {
+
+// An edge of Boruvka's contracted graph: it joins the current components a
+// and b and stands for the input edge source < target.
+template <typename W, typename I>
+struct Link {
+  I a;
+  I b;
+  I source;
+  I target;
+  W weight;
+};
+
+// The strict order edges are picked in: weight, then end points. Ties
+// broken the same way everywhere make the minimum spanning forest unique,
+// so the lightest edges of all components never close a cycle and every
+// implementation returns the same edges.
+template <typename W, typename I>
+bool lighter(const Link<W, I>& x, const Link<W, I>& y) {
+  return std::tie(x.weight, x.source, x.target) < std::tie(y.weight, y.source, y.target);
+}
+
+// The edges of the rows of g, the first of which is vertex first, as links
+// between one-vertex components; self-loops never join anything and are
+// left out. An edge stored both ways gives two links with the same order.
+template <typename W, typename I>
+std::vector<Link<W, I>> links_of(const GraphView<W, I>& g, I first) {
+  std::vector<Link<W, I>> links;
+  links.reserve(static_cast<size_t>(g.row_ptr[g.rows] - g.row_ptr[0]));
+  for (I v = 0; v < g.rows; v++) {
+    const I u = first + v;
+    for (I e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+      const I t = g.col_idx[e];
+      if (t != u) links.push_back({u, t, std::min(u, t), std::max(u, t), g.values[e]});
+    }
+  }
+  return links;
+}
+
+template <typename I>
+I root_of(std::vector<I>& parent, I x) {
+  while (parent[x] != x) {
+    parent[x] = parent[parent[x]];
+    x = parent[x];
+  }
+  return x;
+}
+
+// One contraction: lightest[c] is the lightest link of component c, with b
+// < 0 if it has none. Joins the components along those links in a
+// union-find, adds the links that joined two trees to forest, and gives
+// every component the index of its merged component in label, merged
+// components numbered in order of their first member. Returns their count.
+template <typename W, typename I>
+I contract(const std::vector<Link<W, I>>& lightest, SpanningForest<W, I>& forest, std::vector<I>& label) {
+  const auto count = static_cast<I>(lightest.size());
+  std::vector<I> parent(count);
+  std::iota(parent.begin(), parent.end(), I(0));
+  for (const auto& l : lightest) {
+    if (l.b < 0) continue;
+    const I x = root_of(parent, l.a);
+    const I y = root_of(parent, l.b);
+    if (x == y) continue;
+    parent[std::max(x, y)] = std::min(x, y);
+    forest.weight += l.weight;
+    forest.edges.push_back({l.source, l.target, l.weight});
+  }
+  label.assign(count, I(0));
+  I merged = 0;
+  for (I c = 0; c < count; c++) {
+    // roots are the smallest members, so every root comes before the rest
+    const I root = root_of(parent, c);
+    label[c] = root == c ? merged++ : label[root];
+  }
+  return merged;
+}
+
+// Relabels the ends of links by label and drops the links that now lie
+// inside one component.
+template <typename W, typename I>
+void relabel(std::vector<Link<W, I>>& links, const std::vector<I>& label) {
+  size_t kept = 0;
+  for (auto l : links) {
+    l.a = label[l.a];
+    l.b = label[l.b];
+    if (l.a != l.b) links[kept++] = l;
+  }
+  links.resize(kept);
+}
+
+}  // namespace detail
+
+// Minimum spanning forest of g by Boruvka's algorithm. Every stored edge
+// counts whichever way it points, so a symmetric graph and one with each
+// edge stored once give the same forest. Each round every component takes
+// its lightest edge, the components those edges join are contracted with a
+// union-find, and the edges left inside a component are dropped, so at
+// least half the components go every round and there are at most log2 V of
+// them. The edges are streamed once a round, a band a thread, into a
+// lightest edge per component of each thread's own, which the threads then
+// merge a band of components each, so rounds need no atomics.
+template <typename W, typename I>
+SpanningForest<W, I> boruvka(const GraphView<W, I>& g) {
+  SpanningForest<W, I> forest;
+  auto links = detail::links_of(g, I(0));
+  I count = g.rows;
+  std::vector<I> best;
+  std::vector<detail::Link<W, I>> lightest;
+  std::vector<I> label;
+  while (!links.empty()) {
+    const auto size = static_cast<long long>(links.size());
+    const auto components = static_cast<size_t>(count);
+    // the threads' arrays together no larger than the links
+    const int threads =
+        std::max(1, static_cast<int>(std::min<size_t>(detail::load_threads(links.size()), links.size() / components)));
+    best.assign(components * threads, I(-1));
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+    for (int t = 0; t < threads; t++) {
+      I* mine = best.data() + components * t;
+      for (long long i = size * t / threads; i < size * (t + 1) / threads; i++) {
+        for (const I c : {links[i].a, links[i].b}) {
+          if (mine[c] < 0 || detail::lighter(links[i], links[mine[c]])) mine[c] = static_cast<I>(i);
+        }
+      }
+    }
+
+    lightest.assign(count, {I(0), I(-1), I(0), I(0), W{}});
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+    for (I c = 0; c < count; c++) {
+      I pick = -1;
+      for (int t = 0; t < threads; t++) {
+        const I i = best[components * t + c];
+        if (i >= 0 && (pick < 0 || detail::lighter(links[i], links[pick]))) pick = i;
+      }
+      if (pick < 0) continue;
+      const auto& l = links[pick];
+      lightest[c] = {c, l.a == c ? l.b : l.a, l.source, l.target, l.weight};
+    }
+
+    count = detail::contract(lightest, forest, label);
+    detail::relabel(links, label);
+  }
+  return forest;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_MST_HPP_
@@ -0,0 +1,144 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_MST_MPI_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_MST_MPI_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/graph_mpi.hpp"
+#include "core/graph/include/mst.hpp"
+#include "core/graph/include/sssp.hpp"
+
+namespace ppc::core::graph {
+
+namespace detail {
+
+// Sends every link to the rank its pair of components hashes to, where only
+// the lightest link per pair is kept. After a contraction the many edges
+// between two merged components collapse into one there, and the links
+// stay spread evenly over the ranks whichever components they join. The
+// links that arrive are bucketed by their smaller component with a counting
+// sort and each bucket keeps a slot per larger component, so the collapse
+// is linear in the links and the components.
+template <typename W, typename I>
+void redistribute(const boost::mpi::communicator& world, std::vector<Link<W, I>>& links, I count) {
+  const int size = world.size();
+  std::vector<std::vector<Link<W, I>>> outbox(size);
+  for (const auto& l : links) {
+    const auto pair = static_cast<unsigned long long>(std::min(l.a, l.b)) * count + std::max(l.a, l.b);
+    outbox[((pair * 0x9E3779B97F4A7C15ULL) >> 32) % size].push_back(l);
+  }
+  const auto received = exchange(world, outbox);
+
+  std::vector<size_t> start(static_cast<size_t>(count) + 1, 0);
+  for (const auto& l : received) start[std::min(l.a, l.b) + 1]++;
+  std::partial_sum(start.begin(), start.end(), start.begin());
+  std::vector<Link<W, I>> sorted(received.size());
+  std::vector<size_t> next(start.begin(), start.end() - 1);
+  for (const auto& l : received) sorted[next[std::min(l.a, l.b)]++] = l;
+
+  constexpr size_t kNone = std::numeric_limits<size_t>::max();
+  std::vector<size_t> slot(count, kNone);
+  links.clear();
+  for (I c = 0; c < count; c++) {
+    for (size_t i = start[c]; i < start[c + 1]; i++) {
+      const auto& l = sorted[i];
+      size_t& s = slot[std::max(l.a, l.b)];
+      if (s == kNone) {
+        s = links.size();
+        links.push_back(l);
+      } else if (lighter(l, links[s])) {
+        links[s] = l;
+      }
+    }
+    for (size_t i = start[c]; i < start[c + 1]; i++) slot[std::max(sorted[i].a, sorted[i].b)] = kNone;
+  }
+}
+
+}  // namespace detail
+
+// Distributed boruvka(). Rank r owns the vertices [bounds[r], bounds[r + 1])
+// and passes their rows as local (see row_block() or sparse::scatter_rows()),
+// with global vertex ids in col_idx; every rank gets the whole forest back.
+// The edges travel as links between components, hashed over the ranks by
+// pair of components (see detail::redistribute()), and every round finds the
+// lightest link of each component with three all_reduces over an array a
+// component long: the lightest weight, the lowest end points of that
+// weight, encoded as source * V + target, and the component at the other
+// end. With that much every rank contracts the same union-find by itself,
+// relabels its links and sends them on; the arrays shrink with the
+// components, by at least half a round.
+template <typename W, typename I>
+SpanningForest<W, I> boruvka(const boost::mpi::communicator& world, const GraphView<W, I>& local,
+                             const std::vector<I>& bounds) {
+  const auto vertices = static_cast<long long>(bounds[world.size()]);
+  SpanningForest<W, I> forest;
+  auto links = detail::links_of(local, bounds[world.rank()]);
+  I count = bounds[world.size()];
+  detail::redistribute(world, links, count);
+
+  const auto key_of = [vertices](const detail::Link<W, I>& l) {
+    return static_cast<long long>(l.source) * vertices + l.target;
+  };
+  std::vector<W> weight;
+  std::vector<W> best_weight;
+  std::vector<long long> key;
+  std::vector<long long> best_key;
+  std::vector<I> partner;
+  std::vector<I> best_partner;
+  std::vector<detail::Link<W, I>> lightest;
+  std::vector<I> label;
+  while (true) {
+    const int n = static_cast<int>(count);
+    weight.assign(count, unreachable<W>());
+    for (const auto& l : links) {
+      weight[l.a] = std::min(weight[l.a], l.weight);
+      weight[l.b] = std::min(weight[l.b], l.weight);
+    }
+    best_weight.resize(count);
+    boost::mpi::all_reduce(world, weight.data(), n, best_weight.data(), boost::mpi::minimum<W>());
+
+    key.assign(count, std::numeric_limits<long long>::max());
+    for (const auto& l : links) {
+      if (l.weight == best_weight[l.a]) key[l.a] = std::min(key[l.a], key_of(l));
+      if (l.weight == best_weight[l.b]) key[l.b] = std::min(key[l.b], key_of(l));
+    }
+    best_key.resize(count);
+    boost::mpi::all_reduce(world, key.data(), n, best_key.data(), boost::mpi::minimum<long long>());
+
+    partner.assign(count, I(-1));
+    for (const auto& l : links) {
+      const long long k = key_of(l);
+      if (l.weight == best_weight[l.a] && k == best_key[l.a]) partner[l.a] = l.b;
+      if (l.weight == best_weight[l.b] && k == best_key[l.b]) partner[l.b] = l.a;
+    }
+    best_partner.resize(count);
+    boost::mpi::all_reduce(world, partner.data(), n, best_partner.data(), boost::mpi::maximum<I>());
+
+    lightest.assign(count, {I(0), I(-1), I(0), I(0), W{}});
+    bool joined = false;
+    for (I c = 0; c < count; c++) {
+      if (best_partner[c] < 0) continue;
+      const auto source = static_cast<I>(best_key[c] / vertices);
+      const auto target = static_cast<I>(best_key[c] % vertices);
+      lightest[c] = {c, best_partner[c], source, target, best_weight[c]};
+      joined = true;
+    }
+    if (!joined) return forest;
+
+    count = detail::contract(lightest, forest, label);
+    detail::relabel(links, label);
+    detail::redistribute(world, links, count);
+  }
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_MST_MPI_HPP_
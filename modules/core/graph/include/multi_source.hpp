@@ -0,0 +1,127 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_MULTI_SOURCE_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_MULTI_SOURCE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "core/graph/include/bellman_ford.hpp"
+#include "core/graph/include/sssp.hpp"
+
+namespace ppc::core::graph {
+
+// Distances from K sources are kept vertex-major: the K distances of vertex
+// v are dist[v * K, (v + 1) * K), one lane per source, so relaxing an edge
+// reads and writes K neighbouring values.
+
+namespace detail {
+
+// Per-lane state of a batched queue-based Bellman-Ford over rows vertices:
+// the distances, the edge count of the path behind each (see
+// bellman_ford()), the distance each lane last had its edges relaxed from,
+// and one SweepQueue of vertices for all lanes. A vertex is queued once
+// however many of its lanes dropped, and only those lanes are relaxed when
+// it comes out.
+template <typename W, typename I>
+class LaneState {
+ public:
+  LaneState(size_t rows, size_t lanes, size_t vertices)
+      : lanes_(lanes),
+        vertices_(vertices),
+        dist_(rows * lanes, unreachable<W>()),
+        hops_(rows * lanes, 0),
+        relaxed_(rows * lanes, unreachable<W>()),
+        queue_(rows) {}
+
+  [[nodiscard]] size_t lanes() const { return lanes_; }
+  [[nodiscard]] bool cycle() const { return cycle_; }
+  [[nodiscard]] bool idle() const { return cycle_ || queue_.empty(); }
+  [[nodiscard]] W distance(I v, size_t k) const { return dist_[index(v, k)]; }
+  [[nodiscard]] I hops(I v, size_t k) const { return hops_[index(v, k)]; }
+  std::vector<W>& distances() { return dist_; }
+
+  // Lowers lane k of v to d over a path of h edges if that is shorter.
+  void relax(I v, size_t k, W d, I h) {
+    const size_t i = index(v, k);
+    if (!(d < dist_[i])) return;
+    dist_[i] = d;
+    hops_[i] = h;
+    if (static_cast<size_t>(h) >= vertices_) {
+      cycle_ = true;
+    } else {
+      queue_.push(v);
+    }
+  }
+
+  I pop() { return queue_.pop(); }
+
+  // The lanes of v that dropped since their edges were last relaxed, into
+  // fresh; they count as relaxed from here on.
+  void take_fresh(I v, std::vector<size_t>& fresh) { take_fresh(v, relaxed_, fresh); }
+
+  // The same against mark, a caller's own per-lane record of the distances
+  // last passed on along some of the edges.
+  void take_fresh(I v, std::vector<W>& mark, std::vector<size_t>& fresh) const {
+    fresh.clear();
+    for (size_t k = 0, i = index(v, 0); k < lanes_; k++, i++) {
+      if (!(dist_[i] < mark[i])) continue;
+      mark[i] = dist_[i];
+      fresh.push_back(k);
+    }
+  }
+
+ private:
+  [[nodiscard]] size_t index(I v, size_t k) const { return static_cast<size_t>(v) * lanes_ + k; }
+
+  size_t lanes_;
+  size_t vertices_;
+  std::vector<W> dist_;
+  std::vector<I> hops_;
+  std::vector<W> relaxed_;
+  SweepQueue<I> queue_;
+  bool cycle_ = false;
+};
+
+}  // namespace detail
+
+// Shortest paths from every vertex of sources at once over weights of any
+// sign, into dist (vertex-major, unreachable<W>() where out of reach). One
+// bellman_ford() whose queue holds a vertex while any of its lanes dropped:
+// a pass over the edges of a vertex relaxes all its fresh lanes together,
+// so K sources cost one traversal of the graph's structure rather than K,
+// and sources near each other share most of the passes. Returns false if a
+// negative cycle is reachable from any source; dist is then meaningless.
+template <typename W, typename I>
+bool multi_source_paths(const GraphView<W, I>& g, const std::vector<I>& sources, std::vector<W>& dist) {
+  const auto vertices = static_cast<size_t>(g.rows);
+  detail::LaneState<W, I> state(vertices, sources.size(), vertices);
+  for (size_t k = 0; k < sources.size(); k++) state.relax(sources[k], k, W(0), I(0));
+  std::vector<size_t> fresh;
+  while (!state.idle()) {
+    const I v = state.pop();
+    state.take_fresh(v, fresh);
+    for (I e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+      const I u = g.col_idx[e];
+      for (size_t k : fresh) state.relax(u, k, state.distance(v, k) + g.values[e], state.hops(v, k) + 1);
+    }
+  }
+  dist.swap(state.distances());
+  return !state.cycle();
+}
+
+// Source-major copy of vertex-major distances: by_source[k * V + v] is the
+// distance of v from source k.
+template <typename W>
+std::vector<W> by_source(const std::vector<W>& dist, size_t lanes) {
+  const size_t vertices = lanes == 0 ? 0 : dist.size() / lanes;
+  std::vector<W> out(dist.size());
+  for (size_t v = 0; v < vertices; v++) {
+    for (size_t k = 0; k < lanes; k++) out[k * vertices + v] = dist[v * lanes + k];
+  }
+  return out;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_MULTI_SOURCE_HPP_
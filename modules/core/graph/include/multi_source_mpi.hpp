@@ -0,0 +1,114 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_MULTI_SOURCE_MPI_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_MULTI_SOURCE_MPI_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "core/graph/include/graph_mpi.hpp"
+#include "core/graph/include/multi_source.hpp"
+#include "core/graph/include/sssp.hpp"
+
+namespace ppc::core::graph {
+
+namespace detail {
+
+// A candidate distance for one lane of target, with the edges of its path.
+template <typename W, typename I>
+struct LaneRelaxation {
+  I target;
+  I lane;
+  I hops;
+  W distance;
+};
+
+}  // namespace detail
+
+// Distributed multi_source_paths(), with the rows of each rank as for the
+// distributed bellman_ford(): rank r owns the vertices [bounds[r], bounds[r
+// + 1]) and gets their lanes back in dist, vertex-major. sources must be the
+// same on every rank. The rounds are those of bellman_ford(), one exchange()
+// and one all_reduce each, but a round carries every lane: a boundary vertex
+// sends only the lanes that dropped since it last sent, the best candidate
+// per head and lane, so K sources share each round's collectives instead of
+// paying K rounds of their own. Returns false on every rank if a negative
+// cycle is reachable from any source.
+template <typename W, typename I>
+bool multi_source_paths(const boost::mpi::communicator& world, const GraphView<W, I>& local,
+                        const std::vector<I>& bounds, const std::vector<I>& sources, std::vector<W>& dist) {
+  const int size = world.size();
+  const I begin = bounds[world.rank()];
+  const I end = bounds[world.rank() + 1];
+  const auto rows = static_cast<size_t>(local.rows);
+  const size_t lanes = sources.size();
+  detail::LaneState<W, I> state(rows, lanes, static_cast<size_t>(bounds[size]));
+  for (size_t k = 0; k < lanes; k++) {
+    if (sources[k] >= begin && sources[k] < end) state.relax(sources[k] - begin, k, W(0), I(0));
+  }
+
+  using Message = detail::LaneRelaxation<W, I>;
+  std::vector<std::vector<Message>> outbox(size);
+  // distance each lane last went out along the edges to other ranks
+  std::vector<W> sent(rows * lanes, unreachable<W>());
+  std::vector<char> pending(rows, 0);
+  std::vector<I> boundary;
+  // outbox slot of each (remote head, lane) already offered a candidate
+  std::unordered_map<long long, size_t> slot;
+  std::vector<size_t> fresh;
+  while (true) {
+    while (!state.idle()) {
+      const I v = state.pop();
+      state.take_fresh(v, fresh);
+      for (I e = local.row_ptr[v]; e < local.row_ptr[v + 1]; e++) {
+        const I head = local.col_idx[e];
+        if (head >= begin && head < end) {
+          for (size_t k : fresh) {
+            state.relax(head - begin, k, state.distance(v, k) + local.values[e], state.hops(v, k) + 1);
+          }
+        } else if (pending[v] == 0) {
+          pending[v] = 1;
+          boundary.push_back(v);
+        }
+      }
+    }
+    for (I v : boundary) {
+      pending[v] = 0;
+      if (state.cycle()) continue;
+      state.take_fresh(v, sent, fresh);
+      for (I e = local.row_ptr[v]; e < local.row_ptr[v + 1]; e++) {
+        const I head = local.col_idx[e];
+        if (head >= begin && head < end) continue;
+        auto& box = outbox[vertex_owner(bounds, head)];
+        for (size_t k : fresh) {
+          const Message m{head, static_cast<I>(k), state.hops(v, k) + 1, state.distance(v, k) + local.values[e]};
+          const auto [it, added] = slot.try_emplace(static_cast<long long>(head) * lanes + k, box.size());
+          if (added) {
+            box.push_back(m);
+          } else if (m.distance < box[it->second].distance) {
+            box[it->second] = m;
+          }
+        }
+      }
+    }
+    boundary.clear();
+    slot.clear();
+    for (const Message& m : exchange(world, outbox)) state.relax(m.target - begin, m.lane, m.distance, m.hops);
+
+    // 2: a negative cycle somewhere, 1: more work, 0: done
+    const int local_state = state.cycle() ? 2 : (state.idle() ? 0 : 1);
+    int global_state = 0;
+    boost::mpi::all_reduce(world, local_state, global_state, boost::mpi::maximum<int>());
+    if (global_state != 1) {
+      dist.swap(state.distances());
+      return global_state == 0;
+    }
+  }
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_MULTI_SOURCE_MPI_HPP_
@@ -0,0 +1,64 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_SESSION_MPI_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_SESSION_MPI_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/graph_mpi.hpp"
+#include "core/graph/include/loader_mpi.hpp"
+#include "core/graph/include/sssp.hpp"
+#include "core/sparse/include/partition.hpp"
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse/include/sparse_mpi.hpp"
+
+namespace ppc::core::graph {
+
+// A graph partitioned once over the ranks and kept there for any number of
+// queries. Every rank holds only the rows of its own block of vertices,
+// split evenly as sparse::even_row_blocks() does; partitioning (scatter()
+// or load()) is the only step that moves the graph, so a task can do it in
+// pre_processing() and answer each run() with the traffic of the algorithm
+// alone, passing local() and bounds() to any of the distributed kernels.
+template <typename W, typename I = int>
+class GraphSession {
+ public:
+  explicit GraphSession(boost::mpi::communicator world) : world_(std::move(world)) {}
+
+  // Partitions the graph whole that root holds; whole is only read there.
+  void scatter(const GraphView<W, I>& whole, int root = 0) {
+    I vertices = world_.rank() == root ? whole.rows : I(0);
+    boost::mpi::broadcast(world_, vertices, root);
+    bounds_ = sparse::even_row_blocks(vertices, world_.size());
+    local_ = sparse::scatter_rows(world_, whole, bounds_, root);
+  }
+
+  // Has every rank read its own rows of an edge file (load_rows()). Returns
+  // false on every rank if that fails.
+  bool load(const std::string& path) { return load_rows(world_, path, bounds_, local_); }
+
+  [[nodiscard]] I vertices() const { return bounds_.empty() ? I(0) : bounds_.back(); }
+  [[nodiscard]] const std::vector<I>& bounds() const { return bounds_; }
+  [[nodiscard]] GraphView<W, I> local() const { return local_.view(); }
+
+  // The per-vertex values of every rank's vertices on root, per_vertex of
+  // them a vertex (see gather_blocks()); other ranks get an empty vector.
+  template <typename T>
+  std::vector<T> gather(const std::vector<T>& values, size_t per_vertex = 1, int root = 0) const {
+    return gather_blocks(world_, values, bounds_, root, per_vertex);
+  }
+
+ private:
+  boost::mpi::communicator world_;
+  std::vector<I> bounds_;
+  sparse::CSR<W, I> local_;
+};
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_SESSION_MPI_HPP_
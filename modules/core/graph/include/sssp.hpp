@@ -0,0 +1,221 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_SSSP_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_SSSP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core::graph {
+
+// A weighted directed graph is its adjacency matrix in CSR: row v lists the
+// heads of the edges leaving v in col_idx and their weights in values. Rows
+// of a vertex block [begin, end) of a graph are a view with row_ptr shifted
+// by begin and the same col_idx and values, since row_ptr indexes those
+// arrays of the whole graph.
+template <typename W, typename I = int>
+using GraphView = ppc::core::sparse::CSRView<W, I>;
+
+template <typename W>
+constexpr W unreachable() {
+  return std::numeric_limits<W>::has_infinity ? std::numeric_limits<W>::infinity() : std::numeric_limits<W>::max();
+}
+
+template <typename W, typename I>
+GraphView<W, I> row_block(const GraphView<W, I>& g, I begin, I end) {
+  return {end - begin, g.cols, g.row_ptr + begin, g.col_idx, g.values};
+}
+
+namespace detail {
+
+template <typename W, typename I>
+W heaviest_weight(const GraphView<W, I>& g) {
+  W heaviest = W(0);
+  for (I e = g.row_ptr[0]; e < g.row_ptr[g.rows]; e++) heaviest = std::max(heaviest, g.values[e]);
+  return heaviest;
+}
+
+// heaviest * vertices / edges, worked out in double since the product
+// overflows an integer W on large graphs; 1 where that comes to 0.
+template <typename W>
+W average_delta(W heaviest, long long vertices, long long edges) {
+  const double delta = static_cast<double>(heaviest) * (static_cast<double>(vertices) / static_cast<double>(edges));
+  const auto width = static_cast<W>(std::min(delta, static_cast<double>(std::numeric_limits<W>::max())));
+  return width > W(0) ? width : W(1);
+}
+
+// Most buckets delta_stepping() keeps at once. A vertex waits at most the
+// heaviest weight past the bucket being emptied, so about heaviest / delta
+// buckets are live, and a narrower delta than heaviest / kMaxBucketSpan is
+// widened to that: a tiny delta would only add empty buckets to step over.
+constexpr size_t kMaxBucketSpan = size_t{1} << 16;
+
+template <typename W>
+W narrowest_delta(W heaviest) {
+  return heaviest / static_cast<W>(kMaxBucketSpan);
+}
+
+}  // namespace detail
+
+// Bucket width for delta_stepping(): the largest weight over the average
+// out-degree (Meyer and Sanders), which keeps the light-edge rounds of a
+// bucket few without letting it fill with vertices that are not final yet.
+// 1 for a graph without edges.
+template <typename W, typename I>
+W default_delta(const GraphView<W, I>& g) {
+  const auto edges = static_cast<long long>(g.row_ptr[g.rows] - g.row_ptr[0]);
+  if (edges == 0) return W(1);
+  return detail::average_delta(detail::heaviest_weight(g), static_cast<long long>(g.rows), edges);
+}
+
+// Single-source shortest paths from source over non-negative weights with a
+// binary heap; unreachable vertices get unreachable<W>().
+template <typename W, typename I>
+std::vector<W> dijkstra(const GraphView<W, I>& g, I source) {
+  std::vector<W> dist(static_cast<size_t>(g.rows), unreachable<W>());
+  using Entry = std::pair<W, I>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+  dist[source] = W(0);
+  queue.emplace(W(0), source);
+  while (!queue.empty()) {
+    const auto [d, v] = queue.top();
+    queue.pop();
+    if (d > dist[v]) continue;
+    for (I e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+      const I u = g.col_idx[e];
+      const W candidate = d + g.values[e];
+      if (candidate < dist[u]) {
+        dist[u] = candidate;
+        queue.emplace(candidate, u);
+      }
+    }
+  }
+  return dist;
+}
+
+namespace detail {
+
+constexpr size_t kNoBucket = std::numeric_limits<size_t>::max();
+
+// Buckets of delta-stepping over the vertices [0, n) one owner keeps: bucket
+// b holds the vertices with a tentative distance in [b delta, (b + 1)
+// delta). A vertex is pushed again on every improvement rather than moved,
+// so entries whose distance left the bucket are stale and skipped on the way
+// out. Buckets behind the current one are released as it advances, so only
+// the buckets from the current one on are stored, not one per delta of the
+// longest distance.
+template <typename W, typename I>
+class DeltaBuckets {
+ public:
+  DeltaBuckets(std::vector<W>& dist, W delta)
+      : dist_(dist), delta_(delta), light_done_(dist.size(), unreachable<W>()) {}
+
+  [[nodiscard]] size_t bucket_of(W d) const { return static_cast<size_t>(d / delta_); }
+  [[nodiscard]] W delta() const { return delta_; }
+
+  // Lowers v to d if that is an improvement. d never falls in a released
+  // bucket: it is a distance of the current bucket plus a weight.
+  void relax(I v, W d) {
+    if (!(d < dist_[v])) return;
+    dist_[v] = d;
+    const size_t b = bucket_of(d) - first_;
+    if (b >= buckets_.size()) buckets_.resize(b + 1);
+    buckets_[b].push_back(v);
+  }
+
+  // First bucket from b on with an entry, or kNoBucket.
+  [[nodiscard]] size_t next_nonempty(size_t b) const {
+    for (b = std::max(b, first_); b - first_ < buckets_.size(); b++) {
+      if (!buckets_[b - first_].empty()) return b;
+    }
+    return kNoBucket;
+  }
+
+  [[nodiscard]] bool empty(size_t b) const {
+    return b < first_ || b - first_ >= buckets_.size() || buckets_[b - first_].empty();
+  }
+
+  // Empties bucket b into frontier: the vertices still in it whose light
+  // edges were not relaxed from their current distance yet, each once.
+  // Those seen for the first time in this bucket are added to settled.
+  void take(size_t b, std::vector<I>& frontier, std::vector<I>& settled) {
+    frontier.clear();
+    if (empty(b)) return;
+    std::vector<I> entries;
+    entries.swap(buckets_[b - first_]);
+    for (I v : entries) {
+      const W d = dist_[v];
+      if (bucket_of(d) != b || light_done_[v] == d) continue;
+      // a vertex relaxed from an earlier bucket is final and not back here
+      if (light_done_[v] == unreachable<W>()) settled.push_back(v);
+      light_done_[v] = d;
+      frontier.push_back(v);
+    }
+  }
+
+  void release_before(size_t b) {
+    for (; first_ < b && !buckets_.empty(); first_++) buckets_.pop_front();
+    first_ = std::max(first_, b);
+  }
+
+ private:
+  std::vector<W>& dist_;
+  W delta_;
+  // distance each vertex last had its light edges relaxed from
+  std::vector<W> light_done_;
+  // buckets first_, first_ + 1, ...
+  std::deque<std::vector<I>> buckets_;
+  size_t first_ = 0;
+};
+
+}  // namespace detail
+
+// Delta-stepping single-source shortest paths (Meyer and Sanders) over
+// non-negative weights. Vertices are kept in buckets of width delta; the
+// lowest nonempty bucket is emptied by relaxing the light edges (weight up
+// to delta) of its vertices, which may refill it, until it stays empty, and
+// then the heavy edges of everything it held are relaxed once. delta <= 0
+// picks default_delta(), and one narrower than the heaviest weight over
+// kMaxBucketSpan is widened to that. A small delta approaches Dijkstra, a large one
+// Bellman-Ford; in between each bucket is a batch of independent
+// relaxations, which is what the distributed version exchanges in bulk.
+template <typename W, typename I>
+std::vector<W> delta_stepping(const GraphView<W, I>& g, I source, W delta = W(0)) {
+  if (!(delta > W(0))) delta = default_delta(g);
+  delta = std::max(delta, detail::narrowest_delta(detail::heaviest_weight(g)));
+  std::vector<W> dist(static_cast<size_t>(g.rows), unreachable<W>());
+  detail::DeltaBuckets<W, I> buckets(dist, delta);
+  buckets.relax(source, W(0));
+  std::vector<I> frontier;
+  std::vector<I> settled;
+  for (size_t b = buckets.next_nonempty(0); b != detail::kNoBucket; b = buckets.next_nonempty(b + 1)) {
+    settled.clear();
+    while (!buckets.empty(b)) {
+      buckets.take(b, frontier, settled);
+      for (I v : frontier) {
+        for (I e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+          if (!(g.values[e] > delta)) buckets.relax(g.col_idx[e], dist[v] + g.values[e]);
+        }
+      }
+    }
+    for (I v : settled) {
+      for (I e = g.row_ptr[v]; e < g.row_ptr[v + 1]; e++) {
+        if (g.values[e] > delta) buckets.relax(g.col_idx[e], dist[v] + g.values[e]);
+      }
+    }
+    buckets.release_before(b + 1);
+  }
+  return dist;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_SSSP_HPP_
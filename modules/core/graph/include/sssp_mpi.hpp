@@ -0,0 +1,110 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_GRAPH_INCLUDE_SSSP_MPI_HPP_
+#define MODULES_CORE_GRAPH_INCLUDE_SSSP_MPI_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "core/graph/include/graph_mpi.hpp"
+#include "core/graph/include/sssp.hpp"
+
+namespace ppc::core::graph {
+
+namespace detail {
+
+template <typename W, typename I>
+struct Relaxation {
+  I target;
+  W distance;
+};
+
+}  // namespace detail
+
+namespace detail {
+
+template <typename W, typename I>
+W heaviest_weight(const boost::mpi::communicator& world, const GraphView<W, I>& local) {
+  W heaviest = W(0);
+  boost::mpi::all_reduce(world, heaviest_weight(local), heaviest, boost::mpi::maximum<W>());
+  return heaviest;
+}
+
+}  // namespace detail
+
+// default_delta() of the whole graph from the blocks of all ranks; a task
+// answering many queries can work it out once and pass it to every run.
+template <typename W, typename I>
+W default_delta(const boost::mpi::communicator& world, const GraphView<W, I>& local, I vertices) {
+  const auto local_edges = static_cast<long long>(local.row_ptr[local.rows] - local.row_ptr[0]);
+  const W heaviest = detail::heaviest_weight(world, local);
+  long long edges = 0;
+  boost::mpi::all_reduce(world, local_edges, edges, std::plus<>());
+  if (edges == 0) return W(1);
+  return detail::average_delta(heaviest, static_cast<long long>(vertices), edges);
+}
+
+// Distributed delta_stepping(). Rank r owns the vertices [bounds[r],
+// bounds[r + 1]) and passes their rows as local (see row_block()), with
+// global vertex ids in col_idx; it gets back the distances of its own
+// vertices. Only owners touch a distance: relaxing an edge is a request
+// (head, candidate distance) batched for the head's owner, and each round of
+// a bucket exchanges all of them at once (exchange()). Per bucket that is
+// one all_reduce to agree on the lowest nonempty bucket, one per light-edge
+// round to see if any rank refilled it, and one exchange per round plus one
+// for the heavy edges, against one collective per settled vertex of a
+// parallel Dijkstra. delta <= 0 picks default_delta() of the whole graph,
+// and a delta too narrow is widened as delta_stepping() does it.
+template <typename W, typename I>
+std::vector<W> delta_stepping(const boost::mpi::communicator& world, const GraphView<W, I>& local,
+                              const std::vector<I>& bounds, I source, W delta = W(0)) {
+  const int size = world.size();
+  const I begin = bounds[world.rank()];
+  if (!(delta > W(0))) delta = default_delta(world, local, bounds[size]);
+  delta = std::max(delta, detail::narrowest_delta(detail::heaviest_weight(world, local)));
+  std::vector<W> dist(static_cast<size_t>(local.rows), unreachable<W>());
+  detail::DeltaBuckets<W, I> buckets(dist, delta);
+  if (source >= begin && source < bounds[world.rank() + 1]) buckets.relax(source - begin, W(0));
+
+  using Message = detail::Relaxation<W, I>;
+  std::vector<std::vector<Message>> outbox(size);
+  const auto post = [&](I v, bool heavy) {
+    for (I e = local.row_ptr[v]; e < local.row_ptr[v + 1]; e++) {
+      if ((local.values[e] > delta) != heavy) continue;
+      const I head = local.col_idx[e];
+      outbox[vertex_owner(bounds, head)].push_back({head, dist[v] + local.values[e]});
+    }
+  };
+  const auto deliver = [&] {
+    for (const Message& m : exchange(world, outbox)) buckets.relax(m.target - begin, m.distance);
+  };
+
+  std::vector<I> frontier;
+  std::vector<I> settled;
+  unsigned long long b = 0;
+  while (true) {
+    const auto next = static_cast<unsigned long long>(buckets.next_nonempty(b));
+    boost::mpi::all_reduce(world, next, b, boost::mpi::minimum<unsigned long long>());
+    if (b == detail::kNoBucket) break;
+    settled.clear();
+    bool refilled = true;
+    while (refilled) {
+      buckets.take(b, frontier, settled);
+      for (I v : frontier) post(v, false);
+      deliver();
+      boost::mpi::all_reduce(world, !buckets.empty(b), refilled, std::logical_or<>());
+    }
+    for (I v : settled) post(v, true);
+    deliver();
+    buckets.release_before(++b);
+  }
+  return dist;
+}
+
+}  // namespace ppc::core::graph
+
+#endif  // MODULES_CORE_GRAPH_INCLUDE_SSSP_MPI_HPP_
@@ -0,0 +1,109 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/image/include/labeling.hpp"
+
+namespace {
+
+using ppc::core::image::Connectivity;
+
+std::vector<int> random_image(int rows, int cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::bernoulli_distribution pixel(density);
+  std::vector<int> image(static_cast<size_t>(rows) * cols);
+  for (auto& p : image) p = pixel(gen) ? 1 : 0;
+  return image;
+}
+
+// Reference: breadth-first flood fill from each unlabeled pixel in raster order.
+std::vector<int> reference(const std::vector<int>& image, int rows, int cols, Connectivity connectivity, int& count) {
+  std::vector<std::pair<int, int>> steps = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
+  if (connectivity != Connectivity::kFour) steps.insert(steps.end(), {{-1, 1}, {1, -1}});
+  if (connectivity == Connectivity::kEight) steps.insert(steps.end(), {{-1, -1}, {1, 1}});
+  std::vector<int> labels(image.size(), 0);
+  count = 0;
+  for (int start = 0; start < rows * cols; start++) {
+    if (image[start] == 0 || labels[start] != 0) continue;
+    labels[start] = ++count;
+    std::queue<int> queue;
+    queue.push(start);
+    while (!queue.empty()) {
+      const int p = queue.front();
+      queue.pop();
+      for (const auto& [dr, dc] : steps) {
+        const int r = p / cols + dr;
+        const int c = p % cols + dc;
+        if (r < 0 || r >= rows || c < 0 || c >= cols) continue;
+        const int q = r * cols + c;
+        if (image[q] == 0 || labels[q] != 0) continue;
+        labels[q] = count;
+        queue.push(q);
+      }
+    }
+  }
+  return labels;
+}
+
+}  // namespace
+
+TEST(labeling_tests, matches_flood_fill) {
+  const auto is_set = [](int p) { return p != 0; };
+  // the large sizes are split into bands over threads
+  for (const auto& [rows, cols] : std::vector<std::pair<int, int>>{{1, 1}, {1, 50}, {50, 1}, {37, 53}, {1000, 700}}) {
+    for (double density : {0.3, 0.6, 0.9}) {
+      const auto image = random_image(rows, cols, density, rows * cols);
+      for (auto connectivity : {Connectivity::kFour, Connectivity::kSix, Connectivity::kEight}) {
+        int expected_count = 0;
+        const auto expected = reference(image, rows, cols, connectivity, expected_count);
+        std::vector<int> labels(image.size(), -1);
+        const int count =
+            ppc::core::image::label_components(image.data(), rows, cols, is_set, connectivity, labels.data());
+        EXPECT_EQ(count, expected_count) << rows << "x" << cols << " " << density;
+        EXPECT_EQ(labels, expected) << rows << "x" << cols << " " << density;
+      }
+    }
+  }
+}
+
+TEST(labeling_tests, connectivity_decides_which_corners_touch) {
+  // 1 0 1
+  // 0 1 0
+  const std::vector<int> image = {1, 0, 1, 0, 1, 0};
+  const auto is_set = [](int p) { return p != 0; };
+  std::vector<int> labels(image.size());
+  EXPECT_EQ(ppc::core::image::label_components(image.data(), 2, 3, is_set, Connectivity::kFour, labels.data()), 3);
+  EXPECT_EQ(labels, (std::vector<int>{1, 0, 2, 0, 3, 0}));
+  // the down-left corner of the right pixel only
+  EXPECT_EQ(ppc::core::image::label_components(image.data(), 2, 3, is_set, Connectivity::kSix, labels.data()), 2);
+  EXPECT_EQ(labels, (std::vector<int>{1, 0, 2, 0, 2, 0}));
+  EXPECT_EQ(ppc::core::image::label_components(image.data(), 2, 3, is_set, Connectivity::kEight, labels.data()), 1);
+  EXPECT_EQ(labels, (std::vector<int>{1, 0, 1, 0, 1, 0}));
+}
+
+TEST(labeling_tests, stats_give_area_and_bounding_box) {
+  // a U shape, whose arms only join at the bottom, and a lone pixel
+  const std::vector<int> image = {1, 0, 1, 0,  //
+                                  1, 0, 1, 0,  //
+                                  1, 1, 1, 0,  //
+                                  0, 0, 0, 1};
+  std::vector<int> labels(image.size());
+  const int count = ppc::core::image::label_components(
+      image.data(), 4, 4, [](int p) { return p == 1; }, Connectivity::kFour, labels.data());
+  ASSERT_EQ(count, 2);
+  const auto stats = ppc::core::image::component_stats(labels.data(), 4, 4, count, 10);
+  EXPECT_EQ(stats[0].area, 7);
+  EXPECT_EQ(stats[0].top, 10);
+  EXPECT_EQ(stats[0].left, 0);
+  EXPECT_EQ(stats[0].bottom, 12);
+  EXPECT_EQ(stats[0].right, 2);
+  EXPECT_EQ(stats[1].area, 1);
+  EXPECT_EQ(stats[1].top, 13);
+  EXPECT_EQ(stats[1].left, 3);
+  EXPECT_EQ(stats[1].bottom, 13);
+  EXPECT_EQ(stats[1].right, 3);
+}
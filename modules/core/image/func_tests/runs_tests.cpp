@@ -0,0 +1,78 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/image/include/runs.hpp"
+
+namespace {
+
+using ppc::core::image::Connectivity;
+using ppc::core::image::Run;
+
+std::vector<int> random_image(int rows, int cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::bernoulli_distribution pixel(density);
+  std::vector<int> image(static_cast<size_t>(rows) * cols);
+  for (auto& p : image) p = pixel(gen) ? 1 : 0;
+  return image;
+}
+
+}  // namespace
+
+TEST(runs_tests, encode_runs_splits_rows_into_runs) {
+  // 1 1 0 1
+  // 0 0 0 0
+  // 0 1 1 1
+  const std::vector<int> image = {1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1};
+  const auto runs = ppc::core::image::encode_runs(image.data(), 3, 4, [](int p) { return p != 0; });
+  ASSERT_EQ(runs.size(), size_t{3});
+  EXPECT_EQ(std::vector<int>({runs[0].row, runs[0].begin, runs[0].end}), std::vector<int>({0, 0, 2}));
+  EXPECT_EQ(std::vector<int>({runs[1].row, runs[1].begin, runs[1].end}), std::vector<int>({0, 3, 4}));
+  EXPECT_EQ(std::vector<int>({runs[2].row, runs[2].begin, runs[2].end}), std::vector<int>({2, 1, 4}));
+}
+
+TEST(runs_tests, label_runs_matches_label_components) {
+  const auto is_set = [](int p) { return p != 0; };
+  for (const auto& [rows, cols] : std::vector<std::pair<int, int>>{{1, 1}, {1, 50}, {50, 1}, {37, 53}, {1000, 700}}) {
+    for (double density : {0.1, 0.5, 0.9}) {
+      const auto image = random_image(rows, cols, density, rows + cols);
+      const auto runs = ppc::core::image::encode_runs(image.data(), rows, cols, is_set);
+      for (auto connectivity : {Connectivity::kFour, Connectivity::kSix, Connectivity::kEight}) {
+        std::vector<int> expected(image.size());
+        const int expected_count =
+            ppc::core::image::label_components(image.data(), rows, cols, is_set, connectivity, expected.data());
+        std::vector<int> run_labels;
+        EXPECT_EQ(ppc::core::image::label_runs(runs, connectivity, run_labels), expected_count);
+        std::vector<int> labels(image.size(), 0);
+        for (size_t i = 0; i < runs.size(); i++) {
+          const size_t row = static_cast<size_t>(runs[i].row) * cols;
+          for (int c = runs[i].begin; c < runs[i].end; c++) labels[row + c] = run_labels[i];
+        }
+        EXPECT_EQ(labels, expected) << rows << "x" << cols << " " << density;
+      }
+    }
+  }
+}
+
+TEST(runs_tests, row_extremes_give_the_hull_of_each_component) {
+  const int rows = 300;
+  const int cols = 200;
+  const auto image = random_image(rows, cols, 0.45, 11);
+  const auto runs = ppc::core::image::encode_runs(image.data(), rows, cols, [](int p) { return p != 0; });
+  std::vector<int> run_labels;
+  const int count = ppc::core::image::label_runs(runs, Connectivity::kFour, run_labels);
+  const auto candidates = ppc::core::image::row_extremes(runs, run_labels, count);
+  ASSERT_EQ(candidates.size(), static_cast<size_t>(count));
+
+  std::vector<ppc::core::geometry::PointSet<int>> pixels(count);
+  for (size_t i = 0; i < runs.size(); i++) {
+    for (int c = runs[i].begin; c < runs[i].end; c++) pixels[run_labels[i] - 1].push_back(c, runs[i].row);
+  }
+  for (int k = 0; k < count; k++) {
+    EXPECT_LE(candidates[k].size(), pixels[k].size());
+    EXPECT_EQ(ppc::core::geometry::convex_hull(candidates[k]), ppc::core::geometry::convex_hull(pixels[k])) << k;
+  }
+}
@@ -0,0 +1,223 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_IMAGE_INCLUDE_LABELING_HPP_
+#define MODULES_CORE_IMAGE_INCLUDE_LABELING_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::image {
+
+// Which pixels touch. kSix is the hexagonal grid stored in rows: the four
+// side neighbours plus the up-right and down-left corners.
+enum class Connectivity { kFour, kSix, kEight };
+
+// One connected component: its pixel count and inclusive bounding box.
+struct ComponentStats {
+  long long area = 0;
+  int top = 0;
+  int left = 0;
+  int bottom = -1;
+  int right = -1;
+};
+
+namespace detail {
+
+// Per thread; below it labeling runs on one thread.
+constexpr size_t kLabelMinPerThread = size_t{1} << 16;
+
+inline int label_threads(size_t pixels, int rows) {
+#ifdef _OPENMP
+  const size_t useful = std::max<size_t>(1, pixels / kLabelMinPerThread);
+  return static_cast<int>(std::min<size_t>({static_cast<size_t>(omp_get_max_threads()), useful,
+                                            static_cast<size_t>(std::max(rows, 1))}));
+#else
+  (void)pixels;
+  (void)rows;
+  return 1;
+#endif
+}
+
+// Offsets of the already scanned neighbours of a pixel - the row above and
+// the pixel to the left - as (row, column) steps.
+struct Step {
+  int dr;
+  int dc;
+};
+
+inline int scanned_neighbours(Connectivity connectivity, Step (&steps)[4]) {
+  steps[0] = {0, -1};
+  steps[1] = {-1, 0};
+  switch (connectivity) {
+    case Connectivity::kFour:
+      return 2;
+    case Connectivity::kSix:
+      steps[2] = {-1, 1};
+      return 3;
+    case Connectivity::kEight:
+      steps[2] = {-1, 1};
+      steps[3] = {-1, -1};
+      return 4;
+  }
+  return 2;
+}
+
+// Union-find over pixel indices, parent[p] < 0 marking background. Roots
+// are linked under the smaller index, so the root of a component is its
+// first pixel in raster order.
+inline int find(std::vector<int>& parent, int p) {
+  while (parent[p] != p) {
+    parent[p] = parent[parent[p]];
+    p = parent[p];
+  }
+  return p;
+}
+
+inline int find_root(const std::vector<int>& parent, int p) {
+  while (parent[p] != p) p = parent[p];
+  return p;
+}
+
+inline void unite(std::vector<int>& parent, int a, int b) {
+  a = find(parent, a);
+  b = find(parent, b);
+  if (a < b) {
+    parent[b] = a;
+  } else if (b < a) {
+    parent[a] = b;
+  }
+}
+
+// Links every foreground pixel of row r to its foreground neighbours in the
+// row above; both rows must already be scanned.
+inline void merge_row_above(int r, int cols, const Step* steps, int count, std::vector<int>& parent) {
+  for (int c = 0; c < cols; c++) {
+    const int p = r * cols + c;
+    if (parent[p] < 0) continue;
+    for (int s = 0; s < count; s++) {
+      const int nc = c + steps[s].dc;
+      if (steps[s].dr == 0 || nc < 0 || nc >= cols) continue;
+      const int q = p - cols + steps[s].dc;
+      if (parent[q] >= 0) unite(parent, p, q);
+    }
+  }
+}
+
+// First pass over rows [first, last): every foreground pixel joins the
+// components of its scanned neighbours inside those rows, so bands of rows
+// can be scanned by different threads and only touch their own pixels.
+template <typename T, typename Foreground>
+void scan_band(const T* image, int first, int last, int cols, Foreground& foreground, Connectivity connectivity,
+               std::vector<int>& parent) {
+  Step steps[4];
+  const int count = scanned_neighbours(connectivity, steps);
+  for (int r = first; r < last; r++) {
+    for (int c = 0; c < cols; c++) {
+      const int p = r * cols + c;
+      if (!foreground(image[p])) {
+        parent[p] = -1;
+        continue;
+      }
+      parent[p] = p;
+      if (c > 0 && parent[p - 1] >= 0) unite(parent, p, p - 1);
+    }
+    if (r > first) merge_row_above(r, cols, steps, count, parent);
+  }
+}
+
+// Labels components of the rows x cols image 1, 2, ... in raster order of
+// their first pixel and background 0, from a union-find forest over the
+// pixels. Returns the number of components.
+inline int number_components(std::vector<int>& parent, const std::vector<int>& bounds, int cols, int* labels) {
+  const int bands = static_cast<int>(bounds.size()) - 1;
+  std::vector<int> roots(bands + 1, 0);
+  // parent is only read here: other bands' roots may be looked up
+#pragma omp parallel for num_threads(bands) schedule(static) if (bands > 1)
+  for (int b = 0; b < bands; b++) {
+    int found = 0;
+    for (int p = bounds[b] * cols; p < bounds[b + 1] * cols; p++) {
+      labels[p] = parent[p] < 0 ? -1 : find_root(parent, p);
+      if (labels[p] == p) found++;
+    }
+    roots[b + 1] = found;
+  }
+  for (int b = 0; b < bands; b++) roots[b + 1] += roots[b];
+  // a root's own entry now holds its label
+#pragma omp parallel for num_threads(bands) schedule(static) if (bands > 1)
+  for (int b = 0; b < bands; b++) {
+    int next = roots[b];
+    for (int p = bounds[b] * cols; p < bounds[b + 1] * cols; p++) {
+      if (labels[p] == p) parent[p] = ++next;
+    }
+  }
+#pragma omp parallel for num_threads(bands) schedule(static) if (bands > 1)
+  for (int b = 0; b < bands; b++) {
+    for (int p = bounds[b] * cols; p < bounds[b + 1] * cols; p++) labels[p] = labels[p] < 0 ? 0 : parent[labels[p]];
+  }
+  return roots[bands];
+}
+
+}  // namespace detail
+
+// Connected-component labeling of the row-major rows x cols image, the
+// pixels for which foreground(pixel) holds being the objects: labels gets 0
+// for background and 1, 2, ... for the components in raster order of their
+// first pixel. Returns the number of components.
+//
+// Two passes over a flat union-find of the pixels. The rows are split into
+// one band per thread and each band is scanned on its own, so the threads
+// share nothing; then only the first row of every band is merged with the
+// row above it, and a last parallel pass turns roots into labels. Linear in
+// the pixels with one int of scratch per pixel, whatever the image holds.
+template <typename T, typename Foreground>
+int label_components(const T* image, int rows, int cols, Foreground foreground, Connectivity connectivity,
+                     int* labels) {
+  const size_t pixels = static_cast<size_t>(rows) * static_cast<size_t>(cols);
+  const int bands = detail::label_threads(pixels, rows);
+  std::vector<int> bounds(bands + 1, 0);
+  for (int b = 0; b <= bands; b++) bounds[b] = static_cast<int>(static_cast<long long>(rows) * b / bands);
+  std::vector<int> parent(pixels);
+#pragma omp parallel for num_threads(bands) schedule(static) if (bands > 1)
+  for (int b = 0; b < bands; b++) {
+    detail::scan_band(image, bounds[b], bounds[b + 1], cols, foreground, connectivity, parent);
+  }
+  detail::Step steps[4];
+  const int count = detail::scanned_neighbours(connectivity, steps);
+  for (int b = 1; b < bands; b++) {
+    if (bounds[b] > 0) detail::merge_row_above(bounds[b], cols, steps, count, parent);
+  }
+  return detail::number_components(parent, bounds, cols, labels);
+}
+
+// Area and bounding box of each of the count components of a labeling of
+// rows x cols pixels whose first row is row first_row of the image;
+// stats[k - 1] describes label k.
+inline std::vector<ComponentStats> component_stats(const int* labels, int rows, int cols, int count,
+                                                   int first_row = 0) {
+  std::vector<ComponentStats> stats(count);
+  for (int r = 0; r < rows; r++) {
+    for (int c = 0; c < cols; c++) {
+      const int label = labels[static_cast<size_t>(r) * cols + c];
+      if (label == 0) continue;
+      ComponentStats& s = stats[label - 1];
+      if (s.area++ == 0) {
+        s.top = s.bottom = first_row + r;
+        s.left = s.right = c;
+        continue;
+      }
+      s.bottom = first_row + r;
+      s.left = std::min(s.left, c);
+      s.right = std::max(s.right, c);
+    }
+  }
+  return stats;
+}
+
+}  // namespace ppc::core::image
+
+#endif  // MODULES_CORE_IMAGE_INCLUDE_LABELING_HPP_
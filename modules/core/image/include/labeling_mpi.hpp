@@ -0,0 +1,183 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_IMAGE_INCLUDE_LABELING_MPI_HPP_
+#define MODULES_CORE_IMAGE_INCLUDE_LABELING_MPI_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/serialization/vector.hpp>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "core/image/include/labeling.hpp"
+
+namespace ppc::core::image {
+
+namespace detail {
+
+// Component ids that meet across band borders, as (id, label) pairs sorted
+// by id: every id whose component continues into an earlier band and the
+// final label of the component it belongs to.
+inline std::vector<int> merge_borders(const std::vector<std::vector<int>>& borders, int cols,
+                                      Connectivity connectivity, int& total) {
+  Step steps[4];
+  const int count = scanned_neighbours(connectivity, steps);
+  std::vector<std::pair<int, int>> links;
+  const std::vector<int>* above = nullptr;
+  for (const auto& border : borders) {
+    if (border.empty()) continue;
+    for (int c = 0; above != nullptr && c < cols; c++) {
+      if (border[c] == 0) continue;
+      for (int s = 0; s < count; s++) {
+        const int nc = c + steps[s].dc;
+        if (steps[s].dr == 0 || nc < 0 || nc >= cols || (*above)[cols + nc] == 0) continue;
+        links.emplace_back(border[c], (*above)[cols + nc]);
+      }
+    }
+    above = &border;
+  }
+
+  // union-find over the ids that take part, indexed in id order so that
+  // linking under the smaller index keeps the smallest id as the root
+  std::vector<int> ids;
+  ids.reserve(links.size() * 2);
+  for (const auto& [a, b] : links) {
+    ids.push_back(a);
+    ids.push_back(b);
+  }
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  const auto index = [&](int id) {
+    return static_cast<int>(std::lower_bound(ids.begin(), ids.end(), id) - ids.begin());
+  };
+  std::vector<int> parent(ids.size());
+  std::iota(parent.begin(), parent.end(), 0);
+  for (const auto& [a, b] : links) unite(parent, index(a), index(b));
+
+  // ids are numbered in order once the merged ones are taken out, and a
+  // merged id takes the label of its root, which comes before it
+  std::vector<int> merged;
+  std::vector<int> label(ids.size());
+  int below = 0;
+  for (size_t i = 0; i < ids.size(); i++) {
+    const int root = find(parent, static_cast<int>(i));
+    if (root == static_cast<int>(i)) {
+      label[i] = ids[i] - below;
+      continue;
+    }
+    label[i] = label[root];
+    merged.push_back(ids[i]);
+    merged.push_back(label[i]);
+    below++;
+  }
+  total -= below;
+  return merged;
+}
+
+}  // namespace detail
+
+// Connected-component labeling of an image whose rows are split over the
+// ranks, rank r holding rows [bounds[r], bounds[r + 1]) of cols pixels in
+// band. labels gets the same labels label_components() gives the whole
+// image; returns the number of components on every rank.
+//
+// Every rank labels its band on its own threads, which numbers the
+// components of each band in raster order. Only the first and last row of
+// every band then travel to root, which merges the components that meet at
+// band borders and sends back the ids that were merged away; each rank
+// renumbers its labels from that list alone. Nothing but borders is ever
+// exchanged, however many pixels the bands hold.
+template <typename T, typename Foreground>
+int label_components(const boost::mpi::communicator& world, const T* band, const std::vector<int>& bounds, int cols,
+                     Foreground foreground, Connectivity connectivity, int* labels) {
+  const int rank = world.rank();
+  const int rows = bounds[rank + 1] - bounds[rank];
+  const int local = label_components(band, rows, cols, foreground, connectivity, labels);
+
+  // label k of rank r is component id first_id[r] + k of the whole image
+  std::vector<int> counts;
+  boost::mpi::all_gather(world, local, counts);
+  std::vector<int> first_id(world.size() + 1, 0);
+  std::partial_sum(counts.begin(), counts.end(), first_id.begin() + 1);
+  int total = first_id[world.size()];
+  const int base = first_id[rank];
+
+  std::vector<int> border;
+  if (rows > 0) {
+    border.reserve(2 * static_cast<size_t>(cols));
+    const int* last = labels + static_cast<size_t>(rows - 1) * cols;
+    for (int c = 0; c < cols; c++) border.push_back(labels[c] == 0 ? 0 : base + labels[c]);
+    for (int c = 0; c < cols; c++) border.push_back(last[c] == 0 ? 0 : base + last[c]);
+  }
+  std::vector<std::vector<int>> borders;
+  boost::mpi::gather(world, border, borders, 0);
+  std::vector<int> merged;
+  if (rank == 0) merged = detail::merge_borders(borders, cols, connectivity, total);
+  boost::mpi::broadcast(world, merged, 0);
+  boost::mpi::broadcast(world, total, 0);
+
+  // every id keeps its place among the ids left after merging, unless it
+  // was merged itself
+  std::vector<int> relabel(local + 1, 0);
+  size_t next = 0;
+  while (next < merged.size() && merged[next] <= base) next += 2;
+  int below = static_cast<int>(next / 2);
+  for (int k = 1; k <= local; k++) {
+    if (next < merged.size() && merged[next] == base + k) {
+      relabel[k] = merged[next + 1];
+      next += 2;
+      below++;
+      continue;
+    }
+    relabel[k] = base + k - below;
+  }
+  const long long pixels = static_cast<long long>(rows) * cols;
+  const int threads = detail::label_threads(static_cast<size_t>(pixels), rows);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (long long p = 0; p < pixels; p++) labels[p] = relabel[labels[p]];
+  return total;
+}
+
+// component_stats() of the whole image on root from the labels rank r
+// holds for rows [bounds[r], bounds[r + 1]); other ranks get an empty
+// vector. Each rank only sends the components its band touches.
+inline std::vector<ComponentStats> gather_component_stats(const boost::mpi::communicator& world, const int* labels,
+                                                          const std::vector<int>& bounds, int cols, int count,
+                                                          int root = 0) {
+  const int rank = world.rank();
+  const auto local = component_stats(labels, bounds[rank + 1] - bounds[rank], cols, count, bounds[rank]);
+  std::vector<long long> packed;
+  for (int k = 0; k < count; k++) {
+    const ComponentStats& s = local[k];
+    if (s.area > 0) packed.insert(packed.end(), {k, s.area, s.top, s.left, s.bottom, s.right});
+  }
+  std::vector<std::vector<long long>> all;
+  boost::mpi::gather(world, packed, all, root);
+  std::vector<ComponentStats> stats;
+  if (rank != root) return stats;
+  stats.resize(count);
+  for (const auto& part : all) {
+    for (size_t i = 0; i < part.size(); i += 6) {
+      ComponentStats& s = stats[part[i]];
+      const ComponentStats piece{part[i + 1], static_cast<int>(part[i + 2]), static_cast<int>(part[i + 3]),
+                                 static_cast<int>(part[i + 4]), static_cast<int>(part[i + 5])};
+      if (s.area == 0) {
+        s = piece;
+        continue;
+      }
+      s.area += piece.area;
+      s.top = std::min(s.top, piece.top);
+      s.left = std::min(s.left, piece.left);
+      s.bottom = std::max(s.bottom, piece.bottom);
+      s.right = std::max(s.right, piece.right);
+    }
+  }
+  return stats;
+}
+
+}  // namespace ppc::core::image
+
+#endif  // MODULES_CORE_IMAGE_INCLUDE_LABELING_MPI_HPP_
@@ -0,0 +1,130 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_IMAGE_INCLUDE_RUNS_HPP_
+#define MODULES_CORE_IMAGE_INCLUDE_RUNS_HPP_
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "core/geometry/include/hull.hpp"
+#include "core/image/include/labeling.hpp"
+
+namespace ppc::core::image {
+
+// A run of foreground pixels in one row: columns [begin, end) of row.
+struct Run {
+  int row;
+  int begin;
+  int end;
+};
+
+namespace detail {
+
+// Whether run b, one row below run a, touches it: the pixels above b for
+// kFour, also the one up-right of each for kSix and the one up-left too
+// for kEight.
+inline bool runs_touch(const Run& a, const Run& b, Connectivity connectivity) {
+  const int reach_left = connectivity == Connectivity::kEight ? 1 : 0;
+  const int reach_right = connectivity == Connectivity::kFour ? 0 : 1;
+  return a.begin < b.end + reach_right && b.begin - reach_left < a.end;
+}
+
+}  // namespace detail
+
+// Run-length encoding of the foreground of the row-major rows x cols image,
+// in raster order. Bands of rows are encoded on the threads, so the image is
+// read once in parallel and everything after works on the runs alone.
+template <typename T, typename Foreground>
+std::vector<Run> encode_runs(const T* image, int rows, int cols, Foreground foreground) {
+  const size_t pixels = static_cast<size_t>(rows) * static_cast<size_t>(cols);
+  const int bands = detail::label_threads(pixels, rows);
+  std::vector<std::vector<Run>> part(bands);
+#pragma omp parallel for num_threads(bands) schedule(static) if (bands > 1)
+  for (int b = 0; b < bands; b++) {
+    const int last = static_cast<int>(static_cast<long long>(rows) * (b + 1) / bands);
+    for (int r = static_cast<int>(static_cast<long long>(rows) * b / bands); r < last; r++) {
+      const T* row = image + static_cast<size_t>(r) * cols;
+      for (int c = 0; c < cols;) {
+        if (!foreground(row[c])) {
+          c++;
+          continue;
+        }
+        const int begin = c;
+        while (c < cols && foreground(row[c])) c++;
+        part[b].push_back({r, begin, c});
+      }
+    }
+  }
+  for (int b = 1; b < bands; b++) part[0].insert(part[0].end(), part[b].begin(), part[b].end());
+  return std::move(part[0]);
+}
+
+// Connected components of the pixels of runs from encode_runs(): labels[i]
+// gets the label of runs[i], the same label_components() gives its pixels.
+// Returns the number of components.
+//
+// The union-find is over runs, not pixels: each row's runs are swept
+// against the row above with two pointers, so the cost is linear in the
+// runs however wide they are.
+inline int label_runs(const std::vector<Run>& runs, Connectivity connectivity, std::vector<int>& labels) {
+  const int n = static_cast<int>(runs.size());
+  std::vector<int> parent(n);
+  std::iota(parent.begin(), parent.end(), 0);
+  int above = 0;  // first run of the row above the current one
+  int row = 0;    // first run of the current row
+  for (int i = 0; i < n; i++) {
+    if (i > 0 && runs[i].row != runs[i - 1].row) {
+      above = runs[i - 1].row + 1 == runs[i].row ? row : i;
+      row = i;
+    }
+    // runs of the row above that end before this one can reach are done
+    // with, as later runs of this row start further right
+    for (int j = above; j < row; j++) {
+      if (detail::runs_touch(runs[j], runs[i], connectivity)) {
+        detail::unite(parent, i, j);
+      } else if (runs[j].begin >= runs[i].end) {
+        break;
+      } else {
+        above = j + 1;
+      }
+    }
+  }
+  labels.assign(n, 0);
+  int count = 0;
+  for (int i = 0; i < n; i++) labels[i] = parent[i] == i ? ++count : labels[detail::find(parent, i)];
+  return count;
+}
+
+// Hull candidates of each of the count components of labeled runs: for
+// every row a component spans, its leftmost and rightmost pixel, as (column,
+// row) points. The rest of the row lies between those two, so a component's
+// convex hull is the hull of its candidates - at most two points per row
+// rather than every pixel.
+inline std::vector<geometry::PointSet<int>> row_extremes(const std::vector<Run>& runs, const std::vector<int>& labels,
+                                                         int count) {
+  std::vector<geometry::PointSet<int>> candidates(count);
+  std::vector<Run> open(count, Run{-1, 0, 0});
+  const auto close = [&](int k) {
+    const Run& span = open[k];
+    if (span.row < 0) return;
+    candidates[k].push_back(span.begin, span.row);
+    if (span.end - 1 != span.begin) candidates[k].push_back(span.end - 1, span.row);
+  };
+  for (size_t i = 0; i < runs.size(); i++) {
+    const int k = labels[i] - 1;
+    if (open[k].row == runs[i].row) {
+      open[k].end = runs[i].end;
+      continue;
+    }
+    close(k);
+    open[k] = runs[i];
+  }
+  for (int k = 0; k < count; k++) close(k);
+  return candidates;
+}
+
+}  // namespace ppc::core::image
+
+#endif  // MODULES_CORE_IMAGE_INCLUDE_RUNS_HPP_
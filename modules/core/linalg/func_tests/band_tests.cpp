@@ -0,0 +1,77 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/band.hpp"
+#include "core/linalg/include/gauss_jordan.hpp"
+
+namespace {
+
+// Row-major n x n matrix with kl sub- and ku super-diagonals of random
+// values. With sub-diagonals the diagonal is small, so that the elimination
+// has to pivot; without them there is nothing to pivot on and it is large.
+std::vector<double> random_band(size_t n, size_t kl, size_t ku, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> a(n * n, 0.0);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = i > kl ? i - kl : 0; j <= std::min(n - 1, i + ku); j++) {
+      a[i * n + j] = dist(gen);
+      if (i == j) a[i * n + j] = kl > 0 ? 0.01 * a[i * n + j] : a[i * n + j] + 20.0 * (ku + 1);
+    }
+  }
+  return a;
+}
+
+}  // namespace
+
+TEST(band_tests, solve_matches_dense_gauss_jordan) {
+  const size_t n = 40;
+  for (const auto& [kl, ku] : {std::pair<size_t, size_t>{1, 1}, {3, 1}, {0, 4}, {5, 5}}) {
+    const auto dense = random_band(n, kl, ku, 7);
+    std::vector<double> b(n);
+    for (size_t i = 0; i < n; i++) b[i] = static_cast<double>(i) - 3.5;
+
+    auto band = ppc::core::linalg::BandMatrix::from_dense(dense, n, kl, ku);
+    ASSERT_TRUE(band.factorize());
+    auto x = b;
+    band.solve(x);
+
+    ppc::core::linalg::GaussJordanSolver solver;
+    ASSERT_TRUE(solver.factor(dense.data(), static_cast<int>(n)));
+    auto expected = b;
+    solver.solve(expected, 1);
+    for (size_t i = 0; i < n; i++) EXPECT_NEAR(x[i], expected[i], 1e-8) << kl << " " << ku;
+  }
+}
+
+TEST(band_tests, compact_and_dense_layouts_agree) {
+  const size_t n = 6;
+  const size_t kl = 2;
+  const size_t ku = 1;
+  const auto dense = random_band(n, kl, ku, 3);
+  // column j of the compact array holds A(i, j) at row ku + i - j
+  std::vector<double> compact((kl + ku + 1) * n, 0.0);
+  for (size_t j = 0; j < n; j++) {
+    for (size_t i = j > ku ? j - ku : 0; i <= std::min(n - 1, j + kl); i++) {
+      compact[j * (kl + ku + 1) + ku + i - j] = dense[i * n + j];
+    }
+  }
+  auto from_compact = ppc::core::linalg::BandMatrix::from_compact(compact.data(), n, kl, ku);
+  auto from_dense = ppc::core::linalg::BandMatrix::from_dense(dense, n, kl, ku);
+  EXPECT_EQ(from_compact.get_data(), from_dense.get_data());
+  EXPECT_EQ(from_dense.get_data().size(), n * ppc::core::linalg::BandMatrix::leading_dim(kl, ku));
+}
+
+TEST(band_tests, singular_matrix_is_rejected) {
+  // the second column is zero
+  const std::vector<double> dense = {1.0, 0.0, 0.0, 2.0, 0.0, 1.0, 0.0, 0.0, 3.0};
+  auto band = ppc::core::linalg::BandMatrix::from_dense(dense, 3, 1, 1);
+  EXPECT_FALSE(band.factorize());
+}
@@ -0,0 +1,114 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/gauss_jordan.hpp"
+
+namespace {
+
+std::vector<double> random_dominant_matrix(int n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> a(n * n);
+  for (int i = 0; i < n; i++) {
+    double sum = 0.0;
+    for (int j = 0; j < n; j++) {
+      a[i * n + j] = dist(gen);
+      sum += std::abs(a[i * n + j]);
+    }
+    a[i * n + i] = sum + 1.0;
+  }
+  return a;
+}
+
+std::vector<double> multiply(const std::vector<double>& a, const std::vector<double>& x, int n, int k) {
+  std::vector<double> b(n * k, 0.0);
+  for (int i = 0; i < n; i++) {
+    for (int l = 0; l < n; l++) {
+      for (int j = 0; j < k; j++) b[i * k + j] += a[i * n + l] * x[l * k + j];
+    }
+  }
+  return b;
+}
+
+}  // namespace
+
+TEST(gauss_jordan_tests, solves_single_rhs) {
+  std::vector<double> a = {1, 2, 1, 4, 8, 3, 2, 5, 9};
+  std::vector<double> b = {10, 20, 30};
+
+  ppc::core::linalg::GaussJordanSolver solver;
+  ASSERT_TRUE(solver.factor(a.data(), 3));
+  solver.solve(b, 1);
+
+  EXPECT_NEAR(b[0], 250.0, 1e-9);
+  EXPECT_NEAR(b[1], -130.0, 1e-9);
+  EXPECT_NEAR(b[2], 20.0, 1e-9);
+}
+
+TEST(gauss_jordan_tests, needs_pivoting_on_zero_diagonal) {
+  std::vector<double> a = {0, 1, 1, 0};
+  std::vector<double> b = {3, 7};
+
+  ppc::core::linalg::GaussJordanSolver solver;
+  ASSERT_TRUE(solver.factor(a.data(), 2));
+  solver.solve(b, 1);
+
+  EXPECT_NEAR(b[0], 7.0, 1e-12);
+  EXPECT_NEAR(b[1], 3.0, 1e-12);
+}
+
+TEST(gauss_jordan_tests, detects_singular_matrix) {
+  std::vector<double> a = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  ppc::core::linalg::GaussJordanSolver solver;
+  EXPECT_FALSE(solver.factor(a.data(), 3));
+  EXPECT_FALSE(solver.factored());
+}
+
+TEST(gauss_jordan_tests, solves_block_of_rhs) {
+  const int n = 40;
+  const int k = 7;
+  auto a = random_dominant_matrix(n, 42);
+  std::vector<double> x(n * k);
+  for (int i = 0; i < n * k; i++) x[i] = i % 11 - 5.0;
+  auto b = multiply(a, x, n, k);
+
+  ppc::core::linalg::GaussJordanSolver solver;
+  ASSERT_TRUE(solver.factor(a.data(), n));
+  solver.solve(b, k);
+
+  for (int i = 0; i < n * k; i++) EXPECT_NEAR(b[i], x[i], 1e-9);
+}
+
+TEST(gauss_jordan_tests, factorization_is_reused_between_solves) {
+  const int n = 16;
+  auto a = random_dominant_matrix(n, 7);
+
+  ppc::core::linalg::GaussJordanSolver solver;
+  ASSERT_TRUE(solver.factor(a.data(), n));
+  for (int rep = 0; rep < 3; rep++) {
+    std::vector<double> x(n);
+    for (int i = 0; i < n; i++) x[i] = rep * 2.0 - i;
+    auto b = multiply(a, x, n, 1);
+    solver.solve(b, 1);
+    for (int i = 0; i < n; i++) EXPECT_NEAR(b[i], x[i], 1e-9);
+  }
+}
+
+TEST(gauss_jordan_tests, inverse_times_matrix_is_identity) {
+  const int n = 12;
+  auto a = random_dominant_matrix(n, 3);
+
+  ppc::core::linalg::GaussJordanSolver solver;
+  ASSERT_TRUE(solver.factor(a.data(), n));
+  auto inv = solver.inverse();
+  auto id = multiply(a, inv, n, n);
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) EXPECT_NEAR(id[i * n + j], i == j ? 1.0 : 0.0, 1e-12);
+  }
+}
@@ -0,0 +1,150 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/gemm.hpp"
+
+namespace {
+
+using ppc::core::linalg::Isa;
+using ppc::core::linalg::Op;
+
+template <typename T>
+std::vector<T> random_matrix(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-9, 9);
+  std::vector<T> a(static_cast<size_t>(rows) * cols);
+  for (auto& v : a) v = static_cast<T>(dist(gen));
+  return a;
+}
+
+// Naive op(A) * op(B) with the same strides as gemm().
+template <typename T>
+std::vector<T> reference(Op op_a, Op op_b, int m, int n, int k, const std::vector<T>& a, int lda,
+                         const std::vector<T>& b, int ldb) {
+  std::vector<T> c(static_cast<size_t>(m) * n, T{});
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      T sum{};
+      for (int p = 0; p < k; p++) {
+        const T x = op_a == Op::kNone ? a[i * lda + p] : a[p * lda + i];
+        const T y = op_b == Op::kNone ? b[p * ldb + j] : b[j * ldb + p];
+        sum += x * y;
+      }
+      c[i * n + j] = sum;
+    }
+  }
+  return c;
+}
+
+// Runs check() once for every instruction set this machine supports.
+template <typename F>
+void for_each_isa(F check) {
+  const Isa saved = ppc::core::linalg::gemm_isa();
+  for (Isa isa : {Isa::kScalar, Isa::kAvx2, Isa::kAvx512}) {
+    if (static_cast<int>(isa) > static_cast<int>(ppc::core::linalg::best_isa())) break;
+    ppc::core::linalg::set_gemm_isa(isa);
+    SCOPED_TRACE(static_cast<int>(isa));
+    check();
+  }
+  ppc::core::linalg::set_gemm_isa(saved);
+}
+
+template <typename T>
+void check_product(int m, int n, int k, unsigned seed) {
+  auto a = random_matrix<T>(m, k, seed);
+  auto b = random_matrix<T>(k, n, seed + 1);
+  auto expected = reference(Op::kNone, Op::kNone, m, n, k, a, k, b, n);
+  for_each_isa([&] {
+    std::vector<T> c(static_cast<size_t>(m) * n, T{7});
+    ppc::core::linalg::gemm(m, n, k, a.data(), b.data(), c.data());
+    EXPECT_EQ(c, expected);
+  });
+}
+
+}  // namespace
+
+TEST(gemm_tests, double_matches_naive_across_block_edges) {
+  // m, n and k cross MR/NR tiles, the MC block and the KC block
+  check_product<double>(131, 77, 300, 1);
+  check_product<double>(1, 1, 1, 2);
+  check_product<double>(7, 3, 5, 3);
+}
+
+TEST(gemm_tests, integer_types_are_exact) {
+  check_product<int32_t>(100, 41, 270, 4);
+  check_product<int64_t>(37, 53, 19, 5);
+  check_product<int16_t>(9, 11, 13, 6);
+  check_product<float>(25, 33, 17, 7);
+}
+
+TEST(gemm_tests, transposed_operands_and_leading_dimensions) {
+  const int m = 29;
+  const int n = 18;
+  const int k = 41;
+  const int pad = 3;
+  for (Op op_a : {Op::kNone, Op::kTranspose}) {
+    for (Op op_b : {Op::kNone, Op::kTranspose}) {
+      const int lda = (op_a == Op::kNone ? k : m) + pad;
+      const int ldb = (op_b == Op::kNone ? n : k) + pad;
+      auto a = random_matrix<int>(op_a == Op::kNone ? m : k, lda, 8);
+      auto b = random_matrix<int>(op_b == Op::kNone ? k : n, ldb, 9);
+      auto expected = reference(op_a, op_b, m, n, k, a, lda, b, ldb);
+      for_each_isa([&] {
+        // C is a window of a wider matrix; the columns past n stay untouched
+        const int ldc = n + pad;
+        std::vector<int> c(static_cast<size_t>(m) * ldc, -1);
+        ppc::core::linalg::gemm(op_a, op_b, m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc);
+        for (int i = 0; i < m; i++) {
+          for (int j = 0; j < n; j++) ASSERT_EQ(c[i * ldc + j], expected[i * n + j]);
+          for (int j = n; j < ldc; j++) ASSERT_EQ(c[i * ldc + j], -1);
+        }
+      });
+    }
+  }
+}
+
+TEST(gemm_tests, accumulate_adds_to_c) {
+  const int m = 13;
+  const int n = 21;
+  const int k = 8;
+  auto a = random_matrix<double>(m, k, 10);
+  auto b = random_matrix<double>(k, n, 11);
+  auto expected = reference(Op::kNone, Op::kNone, m, n, k, a, k, b, n);
+  for (auto& v : expected) v += 2.0;
+  for_each_isa([&] {
+    std::vector<double> c(static_cast<size_t>(m) * n, 2.0);
+    ppc::core::linalg::gemm(m, n, k, a.data(), b.data(), c.data(), true);
+    EXPECT_EQ(c, expected);
+  });
+}
+
+TEST(gemm_tests, empty_inner_dimension_zeroes_c) {
+  std::vector<double> c(6, 5.0);
+  ppc::core::linalg::gemm<double>(2, 3, 0, nullptr, nullptr, c.data());
+  EXPECT_EQ(c, std::vector<double>(6, 0.0));
+}
+
+TEST(gemm_tests, gemv_matches_naive) {
+  const int m = 17;
+  const int n = 23;
+  auto a = random_matrix<int>(m, n, 12);
+  auto x = random_matrix<int>(n, 1, 13);
+  auto expected = reference(Op::kNone, Op::kNone, m, 1, n, a, n, x, 1);
+  std::vector<int> y(m);
+  ppc::core::linalg::gemv(m, n, a.data(), n, x.data(), y.data());
+  EXPECT_EQ(y, expected);
+}
+
+TEST(gemm_tests, isa_can_be_pinned_down_but_not_up) {
+  const Isa best = ppc::core::linalg::best_isa();
+  const Isa saved = ppc::core::linalg::set_gemm_isa(Isa::kScalar);
+  EXPECT_EQ(ppc::core::linalg::gemm_isa(), Isa::kScalar);
+  EXPECT_EQ(ppc::core::linalg::micro_kernel<double>().mr, 4);
+  ppc::core::linalg::set_gemm_isa(Isa::kAvx512);
+  EXPECT_EQ(ppc::core::linalg::gemm_isa(), best);
+  ppc::core::linalg::set_gemm_isa(saved);
+}
@@ -0,0 +1,63 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_LINALG_INCLUDE_BAND_HPP_
+#define MODULES_CORE_LINALG_INCLUDE_BAND_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace ppc::core::linalg {
+
+// n x n band matrix with kl sub- and ku super-diagonals in LAPACK general band
+// layout: every column is stored contiguously in ld = 2 * kl + ku + 1 slots and
+// A(i, j) lives in slot kl + ku + i - j. The top kl slots stay free for the
+// fill-in produced by row interchanges, so the factorization never leaves the
+// band and the whole matrix costs O(n * (kl + ku)) memory.
+class BandMatrix {
+ public:
+  BandMatrix() = default;
+  BandMatrix(size_t n, size_t kl, size_t ku) : n_(n), kl_(kl), ku_(ku), ld_(leading_dim(kl, ku)), data_(n * ld_, 0.0) {}
+
+  // ab is the compact LAPACK band array with kl + ku + 1 rows: column j holds
+  // A(i, j) at row ku + i - j.
+  static BandMatrix from_compact(const double* ab, size_t n, size_t kl, size_t ku);
+
+  // Build from a dense row-major n x n matrix, ignoring anything outside the band.
+  static BandMatrix from_dense(const std::vector<double>& dense, size_t n, size_t kl, size_t ku);
+
+  static size_t leading_dim(size_t kl, size_t ku) { return 2 * kl + ku + 1; }
+
+  double& at(size_t i, size_t j) { return data_[j * ld_ + kl_ + ku_ + i - j]; }
+  [[nodiscard]] const double& at(size_t i, size_t j) const { return data_[j * ld_ + kl_ + ku_ + i - j]; }
+
+  double* column(size_t j) { return data_.data() + j * ld_; }
+  [[nodiscard]] const double* column(size_t j) const { return data_.data() + j * ld_; }
+
+  // Gaussian elimination with partial pivoting restricted to the band:
+  // O(n * kl * (kl + ku)) flops. Returns false for a singular matrix.
+  bool factorize(double eps = 1e-12);
+
+  // Forward and back substitution with the factors, b is overwritten with x.
+  void solve(std::vector<double>& b) const;
+
+  [[nodiscard]] size_t get_size() const { return n_; }
+  [[nodiscard]] size_t get_lower() const { return kl_; }
+  [[nodiscard]] size_t get_upper() const { return ku_; }
+
+  // The row swapped with row k at step k; set it when the factors were
+  // computed elsewhere and copied in column by column.
+  std::vector<size_t>& get_pivots() { return pivots_; }
+  std::vector<double>& get_data() { return data_; }
+
+ private:
+  size_t n_ = 0;
+  size_t kl_ = 0;
+  size_t ku_ = 0;
+  size_t ld_ = 1;
+  std::vector<double> data_;
+  std::vector<size_t> pivots_;
+};
+
+}  // namespace ppc::core::linalg
+
+#endif  // MODULES_CORE_LINALG_INCLUDE_BAND_HPP_
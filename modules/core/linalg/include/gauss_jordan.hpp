@@ -0,0 +1,41 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_LINALG_INCLUDE_GAUSS_JORDAN_HPP_
+#define MODULES_CORE_LINALG_INCLUDE_GAUSS_JORDAN_HPP_
+
+#include <vector>
+
+namespace ppc::core::linalg {
+
+// Gauss-Jordan elimination with partial pivoting that is factored once and
+// then replayed on any number of right-hand sides. Rows are never swapped:
+// the row chosen as the pivot of step s keeps its place and the permutation
+// is applied when the solution is read back.
+class GaussJordanSolver {
+ public:
+  // Factor the n x n row-major matrix a. Returns false if it is singular.
+  bool factor(const double* a, int n, double eps = 1e-12);
+
+  // Solve A X = B for a row-major n x k block of right-hand sides.
+  // b is overwritten with X. Costs O(n^2 * k).
+  void solve(double* b, int k) const;
+  void solve(std::vector<double>& b, int k) const { solve(b.data(), k); }
+
+  // A^-1 in row-major order (solve with B = I).
+  [[nodiscard]] std::vector<double> inverse() const;
+
+  [[nodiscard]] int size() const { return n_; }
+  [[nodiscard]] bool factored() const { return factored_; }
+
+ private:
+  int n_ = 0;
+  bool factored_ = false;
+  // multipliers_[i * n + s] - factor row i was reduced by at step s
+  std::vector<double> multipliers_;
+  std::vector<double> pivots_;
+  std::vector<int> pivot_rows_;
+};
+
+}  // namespace ppc::core::linalg
+
+#endif  // MODULES_CORE_LINALG_INCLUDE_GAUSS_JORDAN_HPP_
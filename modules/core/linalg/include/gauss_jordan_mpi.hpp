@@ -0,0 +1,194 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_LINALG_INCLUDE_GAUSS_JORDAN_MPI_HPP_
+#define MODULES_CORE_LINALG_INCLUDE_GAUSS_JORDAN_MPI_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cmath>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ppc::core::linalg {
+
+// Row-block distributed counterpart of GaussJordanSolver. Every rank owns a
+// contiguous block of rows of A and of every right-hand side block, so one
+// elimination step costs a single pivot search reduction plus a broadcast of
+// the pivot row. Multipliers stay on the owning rank and are replayed by
+// solve(), which only moves one k-wide pivot row per step.
+class GaussJordanSolverMPI {
+ public:
+  explicit GaussJordanSolverMPI(boost::mpi::communicator world = {}) : world_(std::move(world)) {}
+
+  // a (n x n, row-major) is read on rank 0 only. Collective; returns the same
+  // value on every rank.
+  bool factor(const double* a, int n, double eps = 1e-12) {
+    if (world_.rank() == 0) n_ = n;
+    boost::mpi::broadcast(world_, n_, 0);
+    factored_ = false;
+    split_rows();
+
+    const int local_rows = row_counts_[world_.rank()];
+    const int first_row = row_displs_[world_.rank()];
+    std::vector<double> work(static_cast<size_t>(local_rows) * n_);
+    std::vector<int> sizes(world_.size());
+    std::vector<int> displs(world_.size());
+    for (int r = 0; r < world_.size(); r++) {
+      sizes[r] = row_counts_[r] * n_;
+      displs[r] = row_displs_[r] * n_;
+    }
+    if (world_.rank() == 0) {
+      boost::mpi::scatterv(world_, a, sizes, displs, work.data(), sizes[0], 0);
+    } else {
+      boost::mpi::scatterv(world_, work.data(), sizes[world_.rank()], 0);
+    }
+
+    multipliers_.assign(static_cast<size_t>(local_rows) * n_, 0.0);
+    pivots_.assign(n_, 0.0);
+    pivot_rows_.assign(n_, -1);
+    std::vector<char> used(local_rows, 0);
+    std::vector<double> pivot_row(n_ + 1);
+
+    for (int s = 0; s < n_; s++) {
+      std::pair<double, int> candidate(eps, -1);
+      for (int i = 0; i < local_rows; i++) {
+        double v = std::abs(work[i * n_ + s]);
+        if (used[i] == 0 && v > candidate.first) candidate = {v, first_row + i};
+      }
+      std::pair<double, int> best;
+      boost::mpi::all_reduce(world_, candidate, best, PivotMax());
+      if (best.second < 0) return false;
+
+      const int p = best.second;
+      const int owner = owner_of(p);
+      const int width = n_ - s;
+      if (world_.rank() == owner) {
+        const int lp = p - first_row;
+        used[lp] = 1;
+        const double* row = work.data() + static_cast<size_t>(lp) * n_;
+        pivot_row[0] = row[s];
+        for (int j = 1; j < width; j++) pivot_row[j] = row[s + j] / row[s];
+      }
+      boost::mpi::broadcast(world_, pivot_row.data(), width, owner);
+      pivots_[s] = pivot_row[0];
+      pivot_rows_[s] = p;
+
+      for (int i = 0; i < local_rows; i++) {
+        double* row = work.data() + static_cast<size_t>(i) * n_;
+        if (first_row + i == p) {
+          std::copy(pivot_row.begin() + 1, pivot_row.begin() + width, row + s + 1);
+          continue;
+        }
+        const double m = row[s];
+        multipliers_[i * n_ + s] = m;
+        if (m == 0.0) continue;
+        for (int j = 1; j < width; j++) row[s + j] -= m * pivot_row[j];
+      }
+    }
+    factored_ = true;
+    return true;
+  }
+
+  // Solve A X = B for n x k right-hand sides. b is read and overwritten with X
+  // on rank 0 only; k must be the same on every rank. Costs O(n^2 * k / P)
+  // flops and n broadcasts of k values.
+  void solve(double* b, int k) {
+    const int local_rows = row_counts_[world_.rank()];
+    const int first_row = row_displs_[world_.rank()];
+    std::vector<int> sizes(world_.size());
+    std::vector<int> displs(world_.size());
+    for (int r = 0; r < world_.size(); r++) {
+      sizes[r] = row_counts_[r] * k;
+      displs[r] = row_displs_[r] * k;
+    }
+    std::vector<double> local(static_cast<size_t>(local_rows) * k);
+    if (world_.rank() == 0) {
+      boost::mpi::scatterv(world_, b, sizes, displs, local.data(), sizes[0], 0);
+    } else {
+      boost::mpi::scatterv(world_, local.data(), sizes[world_.rank()], 0);
+    }
+
+    std::vector<double> pivot_row(k);
+    for (int s = 0; s < n_; s++) {
+      const int p = pivot_rows_[s];
+      const int owner = owner_of(p);
+      if (world_.rank() == owner) {
+        double* row = local.data() + static_cast<size_t>(p - first_row) * k;
+        const double inv = 1.0 / pivots_[s];
+        for (int j = 0; j < k; j++) row[j] *= inv;
+        std::copy(row, row + k, pivot_row.begin());
+      }
+      boost::mpi::broadcast(world_, pivot_row.data(), k, owner);
+      for (int i = 0; i < local_rows; i++) {
+        const double m = multipliers_[i * n_ + s];
+        if (first_row + i == p || m == 0.0) continue;
+        double* row = local.data() + static_cast<size_t>(i) * k;
+        for (int j = 0; j < k; j++) row[j] -= m * pivot_row[j];
+      }
+    }
+
+    if (world_.rank() == 0) {
+      std::vector<double> reduced(static_cast<size_t>(n_) * k);
+      boost::mpi::gatherv(world_, local.data(), sizes[0], reduced.data(), sizes, displs, 0);
+      for (int s = 0; s < n_; s++) {
+        std::copy(reduced.begin() + static_cast<size_t>(pivot_rows_[s]) * k,
+                  reduced.begin() + static_cast<size_t>(pivot_rows_[s] + 1) * k, b + static_cast<size_t>(s) * k);
+      }
+    } else {
+      boost::mpi::gatherv(world_, local.data(), sizes[world_.rank()], 0);
+    }
+  }
+
+  // A^-1 gathered on rank 0 (empty on the other ranks).
+  std::vector<double> inverse() {
+    std::vector<double> inv;
+    if (world_.rank() == 0) {
+      inv.assign(static_cast<size_t>(n_) * n_, 0.0);
+      for (int i = 0; i < n_; i++) inv[i * n_ + i] = 1.0;
+    }
+    solve(inv.data(), n_);
+    return inv;
+  }
+
+  [[nodiscard]] int size() const { return n_; }
+  [[nodiscard]] bool factored() const { return factored_; }
+
+ private:
+  struct PivotMax {
+    std::pair<double, int> operator()(const std::pair<double, int>& a, const std::pair<double, int>& b) const {
+      if (a.first != b.first) return a.first > b.first ? a : b;
+      return a.second < b.second ? a : b;
+    }
+  };
+
+  void split_rows() {
+    const int size = world_.size();
+    row_counts_.assign(size, n_ / size);
+    row_displs_.assign(size, 0);
+    for (int r = 0; r < n_ % size; r++) row_counts_[r]++;
+    for (int r = 1; r < size; r++) row_displs_[r] = row_displs_[r - 1] + row_counts_[r - 1];
+  }
+
+  [[nodiscard]] int owner_of(int row) const {
+    auto it = std::upper_bound(row_displs_.begin(), row_displs_.end(), row);
+    int r = static_cast<int>(it - row_displs_.begin()) - 1;
+    while (row_counts_[r] == 0) r--;
+    return r;
+  }
+
+  boost::mpi::communicator world_;
+  int n_ = 0;
+  bool factored_ = false;
+  std::vector<int> row_counts_;
+  std::vector<int> row_displs_;
+  // multipliers_[i * n + s] - factor local row i was reduced by at step s
+  std::vector<double> multipliers_;
+  std::vector<double> pivots_;
+  std::vector<int> pivot_rows_;
+};
+
+}  // namespace ppc::core::linalg
+
+#endif  // MODULES_CORE_LINALG_INCLUDE_GAUSS_JORDAN_MPI_HPP_
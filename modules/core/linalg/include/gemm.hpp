@@ -0,0 +1,206 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_LINALG_INCLUDE_GEMM_HPP_
+#define MODULES_CORE_LINALG_INCLUDE_GEMM_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ppc::core::linalg {
+
+// Dense row-major C = op(A) * op(B) (+ C). The operands are packed into
+// contiguous panels - KC x NR slivers of B that stay in L1, an MC x KC block
+// of A that stays in L2 - and every MR x NR tile of C is produced by a
+// register-blocked microkernel. The microkernel is picked at run time from
+// the widest instruction set the CPU supports.
+
+enum class Op { kNone, kTranspose };
+
+enum class Isa { kScalar, kAvx2, kAvx512 };
+
+// Widest instruction set this build can use on this CPU.
+Isa best_isa();
+// Instruction set the kernels currently use; best_isa() unless pinned lower.
+Isa gemm_isa();
+// Pin the kernels to isa (clamped to best_isa()). Returns the previous value.
+Isa set_gemm_isa(Isa isa);
+
+// c[i * ldc + j] += sum_p pa[p * MR + i] * pb[p * NR + j] for a full MR x NR
+// tile; pa and pb are the packed slivers of A and B.
+template <typename T>
+struct MicroKernel {
+  int mr;
+  int nr;
+  void (*run)(int kc, const T* pa, const T* pb, T* c, int ldc);
+};
+
+template <typename T, int MR, int NR>
+void scalar_kernel(int kc, const T* pa, const T* pb, T* c, int ldc) {
+  T acc[MR * NR] = {};
+  for (int p = 0; p < kc; p++) {
+    for (int i = 0; i < MR; i++) {
+      for (int j = 0; j < NR; j++) acc[i * NR + j] += pa[i] * pb[j];
+    }
+    pa += MR;
+    pb += NR;
+  }
+  for (int i = 0; i < MR; i++) {
+    for (int j = 0; j < NR; j++) c[i * ldc + j] += acc[i * NR + j];
+  }
+}
+
+// Microkernel for gemm_isa(). Element types without a vector kernel use the
+// portable one.
+template <typename T>
+MicroKernel<T> micro_kernel() {
+  return {4, 4, &scalar_kernel<T, 4, 4>};
+}
+
+template <>
+MicroKernel<float> micro_kernel<float>();
+template <>
+MicroKernel<double> micro_kernel<double>();
+template <>
+MicroKernel<int32_t> micro_kernel<int32_t>();
+template <>
+MicroKernel<int64_t> micro_kernel<int64_t>();
+
+namespace detail {
+
+constexpr int kKc = 256;
+constexpr int kMc = 96;
+constexpr int kNc = 4096;
+
+// Strides of op(X) for X stored row-major with row stride ld: element (r, c)
+// of op(X) is x[r * first + c * second].
+inline std::pair<size_t, size_t> op_strides(int ld, Op op) {
+  return op == Op::kNone ? std::make_pair(static_cast<size_t>(ld), size_t{1})
+                         : std::make_pair(size_t{1}, static_cast<size_t>(ld));
+}
+
+// Rows [i0, i0 + mc) x cols [p0, p0 + kc) of op(A) as MR-row slivers, each
+// stored column by column. The last sliver is padded with zeros.
+template <typename T>
+void pack_a(const T* a, int lda, Op op, int i0, int mc, int p0, int kc, int mr, T* dst) {
+  const auto [rs, cs] = op_strides(lda, op);
+  for (int is = 0; is < mc; is += mr) {
+    const int rows = std::min(mr, mc - is);
+    const T* src = a + (i0 + is) * rs + p0 * cs;
+    for (int p = 0; p < kc; p++) {
+      for (int i = 0; i < rows; i++) dst[i] = src[i * rs + p * cs];
+      for (int i = rows; i < mr; i++) dst[i] = T{};
+      dst += mr;
+    }
+  }
+}
+
+// Rows [p0, p0 + kc) x cols [j0, j0 + nc) of op(B) as NR-column slivers,
+// each stored row by row. The last sliver is padded with zeros.
+template <typename T>
+void pack_b(const T* b, int ldb, Op op, int p0, int kc, int j0, int nc, int nr, T* dst) {
+  const auto [rs, cs] = op_strides(ldb, op);
+  for (int js = 0; js < nc; js += nr) {
+    const int cols = std::min(nr, nc - js);
+    const T* src = b + p0 * rs + (j0 + js) * cs;
+    for (int p = 0; p < kc; p++) {
+      for (int j = 0; j < cols; j++) dst[j] = src[p * rs + j * cs];
+      for (int j = cols; j < nr; j++) dst[j] = T{};
+      dst += nr;
+    }
+  }
+}
+
+// C block (mc x nc) += packed A block * packed B panel. Edge tiles are
+// computed into a scratch tile and only their valid part is added to C.
+template <typename T>
+void macro_kernel(const MicroKernel<T>& kern, int mc, int nc, int kc, const T* pa, const T* pb, T* c, int ldc) {
+  std::vector<T> tile(static_cast<size_t>(kern.mr) * kern.nr);
+  for (int jr = 0; jr < nc; jr += kern.nr) {
+    const int cols = std::min(kern.nr, nc - jr);
+    const T* b_sliver = pb + static_cast<size_t>(jr) * kc;
+    for (int ir = 0; ir < mc; ir += kern.mr) {
+      const int rows = std::min(kern.mr, mc - ir);
+      const T* a_sliver = pa + static_cast<size_t>(ir) * kc;
+      T* c_tile = c + static_cast<size_t>(ir) * ldc + jr;
+      if (rows == kern.mr && cols == kern.nr) {
+        kern.run(kc, a_sliver, b_sliver, c_tile, ldc);
+        continue;
+      }
+      std::fill(tile.begin(), tile.end(), T{});
+      kern.run(kc, a_sliver, b_sliver, tile.data(), kern.nr);
+      for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) c_tile[static_cast<size_t>(i) * ldc + j] += tile[i * kern.nr + j];
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+// C (m x n, leading dimension ldc) = op(A) * op(B), or += when accumulate is
+// set. op(A) is m x k and op(B) is k x n; lda and ldb are the row strides of
+// A and B as stored. Row blocks of C are shared between OpenMP threads.
+// Integer results are exact; floating-point sums are regrouped by KC and may
+// use fused multiply-adds, so they can differ from a naive loop in the last
+// bits.
+template <typename T>
+void gemm(Op op_a, Op op_b, int m, int n, int k, const T* a, int lda, const T* b, int ldb, T* c, int ldc,
+          bool accumulate = false) {
+  if (m <= 0 || n <= 0) return;
+  if (!accumulate) {
+    for (int i = 0; i < m; i++) std::fill_n(c + static_cast<size_t>(i) * ldc, n, T{});
+  }
+  if (k <= 0) return;
+
+  const MicroKernel<T> kern = micro_kernel<T>();
+  const int mc_max = std::max(kern.mr, detail::kMc / kern.mr * kern.mr);
+  const int nc_max = std::max(kern.nr, detail::kNc / kern.nr * kern.nr);
+  const int m_blocks = (m + mc_max - 1) / mc_max;
+  std::vector<T> pb(static_cast<size_t>(std::min(nc_max, (n + kern.nr - 1) / kern.nr * kern.nr)) *
+                    std::min(detail::kKc, k));
+
+  for (int jc = 0; jc < n; jc += nc_max) {
+    const int nc = std::min(nc_max, n - jc);
+    for (int pc = 0; pc < k; pc += detail::kKc) {
+      const int kc = std::min(detail::kKc, k - pc);
+      detail::pack_b(b, ldb, op_b, pc, kc, jc, nc, kern.nr, pb.data());
+#pragma omp parallel if (m_blocks > 1)
+      {
+        std::vector<T> pa(static_cast<size_t>(mc_max) * kc);
+#pragma omp for schedule(static)
+        for (int ib = 0; ib < m_blocks; ib++) {
+          const int ic = ib * mc_max;
+          const int mc = std::min(mc_max, m - ic);
+          detail::pack_a(a, lda, op_a, ic, mc, pc, kc, kern.mr, pa.data());
+          detail::macro_kernel(kern, mc, nc, kc, pa.data(), pb.data(), c + static_cast<size_t>(ic) * ldc + jc, ldc);
+        }
+      }
+    }
+  }
+}
+
+// Row-major C = A * B for contiguous A (m x k), B (k x n) and C (m x n).
+template <typename T>
+void gemm(int m, int n, int k, const T* a, const T* b, T* c, bool accumulate = false) {
+  gemm(Op::kNone, Op::kNone, m, n, k, a, k, b, n, c, n, accumulate);
+}
+
+// y = A * x for a row-major m x n A. A single right-hand side gains nothing
+// from packing, so this is a plain row-parallel dot product.
+template <typename T>
+void gemv(int m, int n, const T* a, int lda, const T* x, T* y) {
+#pragma omp parallel for schedule(static) if (static_cast<size_t>(m) * n > 65536)
+  for (int i = 0; i < m; i++) {
+    const T* row = a + static_cast<size_t>(i) * lda;
+    T sum{};
+    for (int j = 0; j < n; j++) sum += row[j] * x[j];
+    y[i] = sum;
+  }
+}
+
+}  // namespace ppc::core::linalg
+
+#endif  // MODULES_CORE_LINALG_INCLUDE_GEMM_HPP_
@@ -0,0 +1,74 @@
+// Copyright 2023 Nesterov Alexander
+#include "core/linalg/include/band.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+ppc::core::linalg::BandMatrix ppc::core::linalg::BandMatrix::from_compact(const double* ab, size_t n, size_t kl,
+                                                                          size_t ku) {
+  BandMatrix band(n, kl, ku);
+  const size_t compact_ld = kl + ku + 1;
+  for (size_t j = 0; j < n; ++j) {
+    std::copy(ab + j * compact_ld, ab + (j + 1) * compact_ld, band.column(j) + kl);
+  }
+  return band;
+}
+
+ppc::core::linalg::BandMatrix ppc::core::linalg::BandMatrix::from_dense(const std::vector<double>& dense, size_t n,
+                                                                        size_t kl, size_t ku) {
+  BandMatrix band(n, kl, ku);
+  for (size_t j = 0; j < n; ++j) {
+    const size_t first = j > ku ? j - ku : 0;
+    const size_t last = std::min(n - 1, j + kl);
+    for (size_t i = first; i <= last; ++i) {
+      band.at(i, j) = dense[i * n + j];
+    }
+  }
+  return band;
+}
+
+bool ppc::core::linalg::BandMatrix::factorize(double eps) {
+  pivots_.assign(n_, 0);
+  for (size_t k = 0; k < n_; ++k) {
+    const size_t last = std::min(n_ - 1, k + kl_);
+    size_t p = k;
+    for (size_t i = k + 1; i <= last; ++i) {
+      if (std::abs(at(i, k)) > std::abs(at(p, k))) p = i;
+    }
+    if (std::abs(at(p, k)) < eps) {
+      return false;
+    }
+    pivots_[k] = p;
+
+    const size_t jlast = std::min(n_ - 1, k + kl_ + ku_);
+    if (p != k) {
+      for (size_t j = k; j <= jlast; ++j) std::swap(at(k, j), at(p, j));
+    }
+    double* lcol = &at(k, k);
+    const double inv = 1.0 / lcol[0];
+    for (size_t i = 1; i <= last - k; ++i) lcol[i] *= inv;
+
+    for (size_t j = k + 1; j <= jlast; ++j) {
+      double* col = &at(k, j);
+      const double t = col[0];
+      if (t == 0.0) continue;
+      for (size_t i = 1; i <= last - k; ++i) col[i] -= lcol[i] * t;
+    }
+  }
+  return true;
+}
+
+void ppc::core::linalg::BandMatrix::solve(std::vector<double>& b) const {
+  for (size_t k = 0; k < n_; ++k) {
+    std::swap(b[k], b[pivots_[k]]);
+    const size_t last = std::min(n_ - 1, k + kl_);
+    const double* lcol = &at(k, k);
+    for (size_t i = 1; i <= last - k; ++i) b[k + i] -= lcol[i] * b[k];
+  }
+  for (size_t j = n_; j-- > 0;) {
+    const size_t first = j > kl_ + ku_ ? j - kl_ - ku_ : 0;
+    b[j] /= at(j, j);
+    for (size_t i = first; i < j; ++i) b[i] -= at(i, j) * b[j];
+  }
+}
@@ -0,0 +1,75 @@
+// Copyright 2023 Nesterov Alexander
+#include "core/linalg/include/gauss_jordan.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+bool ppc::core::linalg::GaussJordanSolver::factor(const double* a, int n, double eps) {
+  n_ = n;
+  factored_ = false;
+  std::vector<double> work(a, a + static_cast<size_t>(n) * n);
+  multipliers_.assign(static_cast<size_t>(n) * n, 0.0);
+  pivots_.assign(n, 0.0);
+  pivot_rows_.assign(n, -1);
+  std::vector<char> used(n, 0);
+
+  for (int s = 0; s < n; s++) {
+    int p = -1;
+    double best = eps;
+    for (int i = 0; i < n; i++) {
+      if (used[i] == 0 && std::abs(work[static_cast<size_t>(i) * n + s]) > best) {
+        best = std::abs(work[static_cast<size_t>(i) * n + s]);
+        p = i;
+      }
+    }
+    if (p < 0) return false;
+    used[p] = 1;
+    pivot_rows_[s] = p;
+    pivots_[s] = work[static_cast<size_t>(p) * n + s];
+
+    double* pivot_row = work.data() + static_cast<size_t>(p) * n;
+    const double inv = 1.0 / pivots_[s];
+    for (int j = s + 1; j < n; j++) pivot_row[j] *= inv;
+
+    for (int i = 0; i < n; i++) {
+      if (i == p) continue;
+      double* row = work.data() + static_cast<size_t>(i) * n;
+      const double m = row[s];
+      multipliers_[static_cast<size_t>(i) * n + s] = m;
+      if (m == 0.0) continue;
+      for (int j = s + 1; j < n; j++) row[j] -= m * pivot_row[j];
+    }
+  }
+  factored_ = true;
+  return true;
+}
+
+void ppc::core::linalg::GaussJordanSolver::solve(double* b, int k) const {
+  const int n = n_;
+  for (int s = 0; s < n; s++) {
+    double* pivot_row = b + static_cast<size_t>(pivot_rows_[s]) * k;
+    const double inv = 1.0 / pivots_[s];
+    for (int j = 0; j < k; j++) pivot_row[j] *= inv;
+    for (int i = 0; i < n; i++) {
+      const double m = multipliers_[static_cast<size_t>(i) * n + s];
+      if (i == pivot_rows_[s] || m == 0.0) continue;
+      double* row = b + static_cast<size_t>(i) * k;
+      for (int j = 0; j < k; j++) row[j] -= m * pivot_row[j];
+    }
+  }
+
+  // Unknown s ended up in the row that was the pivot of step s.
+  std::vector<double> x(static_cast<size_t>(n) * k);
+  for (int s = 0; s < n; s++) {
+    std::copy(b + static_cast<size_t>(pivot_rows_[s]) * k, b + static_cast<size_t>(pivot_rows_[s] + 1) * k,
+              x.begin() + static_cast<size_t>(s) * k);
+  }
+  std::copy(x.begin(), x.end(), b);
+}
+
+std::vector<double> ppc::core::linalg::GaussJordanSolver::inverse() const {
+  std::vector<double> inv(static_cast<size_t>(n_) * n_, 0.0);
+  for (int i = 0; i < n_; i++) inv[static_cast<size_t>(i) * n_ + i] = 1.0;
+  solve(inv.data(), n_);
+  return inv;
+}
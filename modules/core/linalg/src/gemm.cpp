@@ -0,0 +1,251 @@
+// Copyright 2023 Nesterov Alexander
+#include "core/linalg/include/gemm.hpp"
+
+#include <atomic>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PPC_GEMM_X86 1
+#include <immintrin.h>
+#endif
+
+namespace ppc::core::linalg {
+
+namespace {
+
+#ifdef PPC_GEMM_X86
+
+#define PPC_AVX2 __attribute__((target("avx2,fma"), always_inline)) inline
+#define PPC_AVX512 __attribute__((target("avx512f,avx512dq"), always_inline)) inline
+
+// One vector register of a given element type: the handful of operations the
+// microkernels need. madd(a, b, c) is c + a * b.
+struct Avx2Double {
+  using Scalar = double;
+  using Reg = __m256d;
+  static constexpr int kLanes = 4;
+  PPC_AVX2 static Reg zero() { return _mm256_setzero_pd(); }
+  PPC_AVX2 static Reg load(const Scalar* p) { return _mm256_loadu_pd(p); }
+  PPC_AVX2 static Reg set1(Scalar x) { return _mm256_set1_pd(x); }
+  PPC_AVX2 static Reg madd(Reg a, Reg b, Reg c) { return _mm256_fmadd_pd(a, b, c); }
+  PPC_AVX2 static Reg add(Reg a, Reg b) { return _mm256_add_pd(a, b); }
+  PPC_AVX2 static void store(Scalar* p, Reg x) { _mm256_storeu_pd(p, x); }
+};
+
+struct Avx2Float {
+  using Scalar = float;
+  using Reg = __m256;
+  static constexpr int kLanes = 8;
+  PPC_AVX2 static Reg zero() { return _mm256_setzero_ps(); }
+  PPC_AVX2 static Reg load(const Scalar* p) { return _mm256_loadu_ps(p); }
+  PPC_AVX2 static Reg set1(Scalar x) { return _mm256_set1_ps(x); }
+  PPC_AVX2 static Reg madd(Reg a, Reg b, Reg c) { return _mm256_fmadd_ps(a, b, c); }
+  PPC_AVX2 static Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+  PPC_AVX2 static void store(Scalar* p, Reg x) { _mm256_storeu_ps(p, x); }
+};
+
+struct Avx2Int32 {
+  using Scalar = int32_t;
+  using Reg = __m256i;
+  static constexpr int kLanes = 8;
+  PPC_AVX2 static Reg zero() { return _mm256_setzero_si256(); }
+  PPC_AVX2 static Reg load(const Scalar* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+  PPC_AVX2 static Reg set1(Scalar x) { return _mm256_set1_epi32(x); }
+  PPC_AVX2 static Reg madd(Reg a, Reg b, Reg c) { return _mm256_add_epi32(c, _mm256_mullo_epi32(a, b)); }
+  PPC_AVX2 static Reg add(Reg a, Reg b) { return _mm256_add_epi32(a, b); }
+  PPC_AVX2 static void store(Scalar* p, Reg x) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x); }
+};
+
+struct Avx512Double {
+  using Scalar = double;
+  using Reg = __m512d;
+  static constexpr int kLanes = 8;
+  PPC_AVX512 static Reg zero() { return _mm512_setzero_pd(); }
+  PPC_AVX512 static Reg load(const Scalar* p) { return _mm512_loadu_pd(p); }
+  PPC_AVX512 static Reg set1(Scalar x) { return _mm512_set1_pd(x); }
+  PPC_AVX512 static Reg madd(Reg a, Reg b, Reg c) { return _mm512_fmadd_pd(a, b, c); }
+  PPC_AVX512 static Reg add(Reg a, Reg b) { return _mm512_add_pd(a, b); }
+  PPC_AVX512 static void store(Scalar* p, Reg x) { _mm512_storeu_pd(p, x); }
+};
+
+struct Avx512Float {
+  using Scalar = float;
+  using Reg = __m512;
+  static constexpr int kLanes = 16;
+  PPC_AVX512 static Reg zero() { return _mm512_setzero_ps(); }
+  PPC_AVX512 static Reg load(const Scalar* p) { return _mm512_loadu_ps(p); }
+  PPC_AVX512 static Reg set1(Scalar x) { return _mm512_set1_ps(x); }
+  PPC_AVX512 static Reg madd(Reg a, Reg b, Reg c) { return _mm512_fmadd_ps(a, b, c); }
+  PPC_AVX512 static Reg add(Reg a, Reg b) { return _mm512_add_ps(a, b); }
+  PPC_AVX512 static void store(Scalar* p, Reg x) { _mm512_storeu_ps(p, x); }
+};
+
+struct Avx512Int32 {
+  using Scalar = int32_t;
+  using Reg = __m512i;
+  static constexpr int kLanes = 16;
+  PPC_AVX512 static Reg zero() { return _mm512_setzero_si512(); }
+  PPC_AVX512 static Reg load(const Scalar* p) { return _mm512_loadu_si512(p); }
+  PPC_AVX512 static Reg set1(Scalar x) { return _mm512_set1_epi32(x); }
+  PPC_AVX512 static Reg madd(Reg a, Reg b, Reg c) { return _mm512_add_epi32(c, _mm512_mullo_epi32(a, b)); }
+  PPC_AVX512 static Reg add(Reg a, Reg b) { return _mm512_add_epi32(a, b); }
+  PPC_AVX512 static void store(Scalar* p, Reg x) { _mm512_storeu_si512(p, x); }
+};
+
+struct Avx512Int64 {
+  using Scalar = int64_t;
+  using Reg = __m512i;
+  static constexpr int kLanes = 8;
+  PPC_AVX512 static Reg zero() { return _mm512_setzero_si512(); }
+  PPC_AVX512 static Reg load(const Scalar* p) { return _mm512_loadu_si512(p); }
+  PPC_AVX512 static Reg set1(Scalar x) { return _mm512_set1_epi64(x); }
+  PPC_AVX512 static Reg madd(Reg a, Reg b, Reg c) { return _mm512_add_epi64(c, _mm512_mullo_epi64(a, b)); }
+  PPC_AVX512 static Reg add(Reg a, Reg b) { return _mm512_add_epi64(a, b); }
+  PPC_AVX512 static void store(Scalar* p, Reg x) { _mm512_storeu_si512(p, x); }
+};
+
+// MR x (NV * lanes) tile kept in MR * NV accumulator registers: per step of
+// k, NV vectors of the B sliver are loaded once and every broadcast element
+// of the A sliver is multiplied into all of them. The bodies are identical;
+// they only differ in the instruction set they are compiled for.
+#define PPC_GEMM_KERNEL_BODY                                                   \
+  using Reg = typename V::Reg;                                                 \
+  Reg acc[MR][NV];                                                             \
+  _Pragma("GCC unroll 8") for (int i = 0; i < MR; i++) {                       \
+    _Pragma("GCC unroll 4") for (int j = 0; j < NV; j++) acc[i][j] = V::zero(); \
+  }                                                                            \
+  for (int p = 0; p < kc; p++) {                                               \
+    Reg b[NV];                                                                 \
+    _Pragma("GCC unroll 4") for (int j = 0; j < NV; j++) {                     \
+      b[j] = V::load(pb + j * V::kLanes);                                      \
+    }                                                                          \
+    _Pragma("GCC unroll 8") for (int i = 0; i < MR; i++) {                     \
+      const Reg a = V::set1(pa[i]);                                            \
+      _Pragma("GCC unroll 4") for (int j = 0; j < NV; j++) {                   \
+        acc[i][j] = V::madd(a, b[j], acc[i][j]);                               \
+      }                                                                        \
+    }                                                                          \
+    pa += MR;                                                                  \
+    pb += NV * V::kLanes;                                                      \
+  }                                                                            \
+  _Pragma("GCC unroll 8") for (int i = 0; i < MR; i++) {                       \
+    _Pragma("GCC unroll 4") for (int j = 0; j < NV; j++) {                     \
+      auto* dst = c + static_cast<size_t>(i) * ldc + j * V::kLanes;            \
+      V::store(dst, V::add(V::load(dst), acc[i][j]));                          \
+    }                                                                          \
+  }
+
+template <class V, int MR, int NV>
+__attribute__((target("avx2,fma"))) void avx2_kernel(int kc, const typename V::Scalar* pa,
+                                                     const typename V::Scalar* pb, typename V::Scalar* c, int ldc) {
+  PPC_GEMM_KERNEL_BODY
+}
+
+template <class V, int MR, int NV>
+__attribute__((target("avx512f,avx512dq"))) void avx512_kernel(int kc, const typename V::Scalar* pa,
+                                                               const typename V::Scalar* pb, typename V::Scalar* c,
+                                                               int ldc) {
+  PPC_GEMM_KERNEL_BODY
+}
+
+#undef PPC_GEMM_KERNEL_BODY
+
+// 6 x 2 vectors leaves room for the B vectors and the broadcast in the 16
+// AVX2 registers; AVX-512 has 32, so 8 x 2.
+template <class V>
+MicroKernel<typename V::Scalar> avx2() {
+  return {6, 2 * V::kLanes, &avx2_kernel<V, 6, 2>};
+}
+
+template <class V>
+MicroKernel<typename V::Scalar> avx512() {
+  return {8, 2 * V::kLanes, &avx512_kernel<V, 8, 2>};
+}
+
+Isa detect_isa() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) return Isa::kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return Isa::kAvx2;
+  return Isa::kScalar;
+}
+
+#else
+
+Isa detect_isa() { return Isa::kScalar; }
+
+#endif
+
+std::atomic<Isa>& active_isa() {
+  static std::atomic<Isa> isa{best_isa()};
+  return isa;
+}
+
+}  // namespace
+
+Isa best_isa() {
+  static const Isa isa = detect_isa();
+  return isa;
+}
+
+Isa gemm_isa() { return active_isa().load(); }
+
+Isa set_gemm_isa(Isa isa) {
+  if (static_cast<int>(isa) > static_cast<int>(best_isa())) isa = best_isa();
+  return active_isa().exchange(isa);
+}
+
+template <>
+MicroKernel<double> micro_kernel<double>() {
+#ifdef PPC_GEMM_X86
+  switch (gemm_isa()) {
+    case Isa::kAvx512:
+      return avx512<Avx512Double>();
+    case Isa::kAvx2:
+      return avx2<Avx2Double>();
+    default:
+      break;
+  }
+#endif
+  return {4, 4, &scalar_kernel<double, 4, 4>};
+}
+
+template <>
+MicroKernel<float> micro_kernel<float>() {
+#ifdef PPC_GEMM_X86
+  switch (gemm_isa()) {
+    case Isa::kAvx512:
+      return avx512<Avx512Float>();
+    case Isa::kAvx2:
+      return avx2<Avx2Float>();
+    default:
+      break;
+  }
+#endif
+  return {4, 4, &scalar_kernel<float, 4, 4>};
+}
+
+template <>
+MicroKernel<int32_t> micro_kernel<int32_t>() {
+#ifdef PPC_GEMM_X86
+  switch (gemm_isa()) {
+    case Isa::kAvx512:
+      return avx512<Avx512Int32>();
+    case Isa::kAvx2:
+      return avx2<Avx2Int32>();
+    default:
+      break;
+  }
+#endif
+  return {4, 4, &scalar_kernel<int32_t, 4, 4>};
+}
+
+// AVX2 has no 64-bit lane multiply, so int64 goes straight from AVX-512 to
+// the portable kernel.
+template <>
+MicroKernel<int64_t> micro_kernel<int64_t>() {
+#ifdef PPC_GEMM_X86
+  if (gemm_isa() == Isa::kAvx512) return avx512<Avx512Int64>();
+#endif
+  return {4, 4, &scalar_kernel<int64_t, 4, 4>};
+}
+
+}  // namespace ppc::core::linalg
@@ -0,0 +1,105 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "core/sort/include/batcher.hpp"
+
+namespace {
+
+// Runs the network over blocks the way batcher_sort() does over ranks.
+std::vector<std::vector<int>> run_blocks(std::vector<std::vector<int>> blocks) {
+  size_t block = 0;
+  for (auto& b : blocks) {
+    std::sort(b.begin(), b.end());
+    block = std::max(block, b.size());
+  }
+  std::vector<int> scratch;
+  for (const auto& round : ppc::core::sort::batcher_network(static_cast<int>(blocks.size()))) {
+    for (const auto& c : round) {
+      const auto low = blocks[c.low];
+      const auto high = blocks[c.high];
+      ppc::core::sort::merge_split(blocks[c.low], high.data(), high.size(), block, true, std::less<>(), scratch);
+      ppc::core::sort::merge_split(blocks[c.high], low.data(), low.size(), block, false, std::less<>(), scratch);
+    }
+  }
+  return blocks;
+}
+
+}  // namespace
+
+TEST(batcher_tests, network_sorts_every_zero_one_input) {
+  // 0-1 principle: a comparator network that sorts all 0-1 inputs sorts everything
+  for (int n = 1; n <= 12; n++) {
+    const auto network = ppc::core::sort::batcher_network(n);
+    for (int mask = 0; mask < (1 << n); mask++) {
+      std::vector<int> v(n);
+      for (int i = 0; i < n; i++) v[i] = (mask >> i) & 1;
+      for (const auto& round : network) {
+        for (const auto& c : round) {
+          if (v[c.low] > v[c.high]) std::swap(v[c.low], v[c.high]);
+        }
+      }
+      ASSERT_TRUE(std::is_sorted(v.begin(), v.end())) << "n = " << n << ", mask = " << mask;
+    }
+  }
+}
+
+TEST(batcher_tests, rounds_are_disjoint) {
+  for (int n = 2; n <= 33; n++) {
+    for (const auto& round : ppc::core::sort::batcher_network(n)) {
+      std::vector<int> used(n, 0);
+      for (const auto& c : round) {
+        ASSERT_LT(c.low, c.high);
+        ASSERT_EQ(used[c.low]++, 0);
+        ASSERT_EQ(used[c.high]++, 0);
+      }
+    }
+  }
+}
+
+TEST(batcher_tests, steps_mirror_each_other) {
+  const int n = 6;
+  for (int r = 0; r < n; r++) {
+    for (const auto& step : ppc::core::sort::batcher_steps(n, r)) {
+      const auto partner = ppc::core::sort::batcher_steps(n, step.partner);
+      EXPECT_TRUE(std::any_of(partner.begin(), partner.end(), [&](const auto& s) {
+        return s.partner == r && s.keep_low != step.keep_low;
+      }));
+    }
+  }
+}
+
+TEST(batcher_tests, merge_split_sorts_blocks_of_unequal_length) {
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> length(0, 12);
+  std::uniform_int_distribution<int> value(-20, 20);
+  for (int ranks = 1; ranks <= 9; ranks++) {
+    std::vector<std::vector<int>> blocks(ranks);
+    std::vector<int> expected;
+    for (auto& b : blocks) {
+      b.resize(length(gen));
+      for (auto& v : b) v = value(gen);
+      expected.insert(expected.end(), b.begin(), b.end());
+    }
+    std::sort(expected.begin(), expected.end());
+    std::vector<int> result;
+    for (const auto& b : run_blocks(blocks)) result.insert(result.end(), b.begin(), b.end());
+    EXPECT_EQ(result, expected) << ranks << " ranks";
+  }
+}
+
+TEST(batcher_tests, merge_split_keeps_each_side_its_own_count) {
+  // odd_even_sort() passes the low side's length as the block
+  std::vector<int> low = {1, 4, 6, 9};
+  std::vector<int> high = {2, 3, 5, 7, 8, 10};
+  const auto low_copy = low;
+  std::vector<int> scratch;
+  ppc::core::sort::merge_split(low, high.data(), high.size(), low.size(), true, std::less<>(), scratch);
+  ppc::core::sort::merge_split(high, low_copy.data(), low_copy.size(), low_copy.size(), false, std::less<>(), scratch);
+  EXPECT_EQ(low, std::vector<int>({1, 2, 3, 4}));
+  EXPECT_EQ(high, std::vector<int>({5, 6, 7, 8, 9, 10}));
+}
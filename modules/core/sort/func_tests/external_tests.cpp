@@ -0,0 +1,100 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/sort/include/external.hpp"
+#include "core/sort/include/mapped_file.hpp"
+
+namespace {
+
+std::string temp_path(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / ("ppc_external_tests_" + name)).string();
+}
+
+template <typename T>
+void write_file(const std::string& path, const std::vector<T>& data) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+}
+
+template <typename T>
+std::vector<T> read_file(const std::string& path) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  std::vector<T> data(static_cast<size_t>(in.tellg()) / sizeof(T));
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+  return data;
+}
+
+std::vector<int> random_ints(size_t n, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  std::vector<int> v(n);
+  for (auto& x : v) x = dist(gen);
+  return v;
+}
+
+}  // namespace
+
+TEST(external_tests, mapped_file_reads_what_was_written) {
+  const std::string path = temp_path("mapped");
+  const auto data = random_ints(5000, 1000, 1);
+  write_file(path, data);
+  ppc::core::sort::MappedFile file(path);
+  ASSERT_TRUE(file.is_open());
+  ASSERT_EQ(file.size(), data.size() * sizeof(int));
+  const auto* mapped = reinterpret_cast<const int*>(file.data());
+  EXPECT_TRUE(std::equal(data.begin(), data.end(), mapped));
+  file.close();
+  EXPECT_FALSE(file.is_open());
+  std::filesystem::remove(path);
+
+  EXPECT_FALSE(file.open(temp_path("missing")));
+}
+
+TEST(external_tests, sorts_in_many_runs) {
+  const std::string input = temp_path("many_in");
+  const std::string output = temp_path("many_out");
+  for (size_t n : {0, 1, 1000, 100000}) {
+    auto data = random_ints(n, 1000000, static_cast<unsigned>(n));
+    write_file(input, data);
+    // 1024 keys a run: up to 98 runs merged at once
+    ASSERT_TRUE(ppc::core::sort::external_sort<int>(input, output, 4096));
+    std::sort(data.begin(), data.end());
+    EXPECT_EQ(read_file<int>(output), data);
+  }
+  EXPECT_FALSE(std::filesystem::exists(ppc::core::sort::detail::run_path(output, 0, 0)));
+  std::filesystem::remove(input);
+  std::filesystem::remove(output);
+}
+
+TEST(external_tests, custom_comparator_and_duplicates) {
+  const std::string input = temp_path("dup_in");
+  const std::string output = temp_path("dup_out");
+  std::vector<double> data(30000);
+  std::mt19937 gen(2);
+  for (auto& x : data) x = static_cast<double>(gen() % 7);
+  write_file(input, data);
+  ASSERT_TRUE(ppc::core::sort::external_sort<double>(input, output, 1 << 12, std::greater<>()));
+  std::sort(data.begin(), data.end(), std::greater<>());
+  EXPECT_EQ(read_file<double>(output), data);
+  std::filesystem::remove(input);
+  std::filesystem::remove(output);
+}
+
+TEST(external_tests, rejects_bad_input) {
+  const std::string input = temp_path("bad_in");
+  const std::string output = temp_path("bad_out");
+  EXPECT_FALSE(ppc::core::sort::external_sort<int>(temp_path("missing"), output, 4096));
+  // not a whole number of ints
+  write_file(input, std::vector<char>{1, 2, 3, 4, 5});
+  EXPECT_FALSE(ppc::core::sort::external_sort<int>(input, output, 4096));
+  std::filesystem::remove(input);
+}
@@ -0,0 +1,83 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/merge.hpp"
+
+namespace {
+
+// k sorted runs of random lengths (some empty) laid out back to back
+std::pair<std::vector<int>, std::vector<size_t>> random_runs(int k, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> length(0, 40);
+  std::uniform_int_distribution<int> value(-50, 50);
+  std::vector<int> data;
+  std::vector<size_t> bounds = {0};
+  for (int r = 0; r < k; r++) {
+    std::vector<int> run(length(gen));
+    for (auto& v : run) v = value(gen);
+    std::sort(run.begin(), run.end());
+    data.insert(data.end(), run.begin(), run.end());
+    bounds.push_back(data.size());
+  }
+  return {data, bounds};
+}
+
+}  // namespace
+
+TEST(merge_tests, multiway_merge_sorts_any_number_of_runs) {
+  for (int k = 1; k <= 9; k++) {
+    auto [data, bounds] = random_runs(k, k);
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(ppc::core::sort::multiway_merge(data, bounds), expected);
+  }
+}
+
+TEST(merge_tests, multiway_merge_honours_comparator) {
+  std::vector<int> data = {9, 5, 1, 8, 2, 7, 7, 3};
+  std::vector<size_t> bounds = {0, 3, 5, 8};
+  EXPECT_EQ(ppc::core::sort::multiway_merge(data, bounds, std::greater<>()),
+            std::vector<int>({9, 8, 7, 7, 5, 3, 2, 1}));
+}
+
+TEST(merge_tests, multiway_merge_is_stable) {
+  // equal keys must come out in run order: compare by key only
+  std::vector<std::pair<int, int>> data = {{1, 0}, {2, 0}, {1, 1}, {2, 1}, {1, 2}, {2, 2}};
+  std::vector<size_t> bounds = {0, 2, 4, 6};
+  auto merged = ppc::core::sort::multiway_merge(data, bounds, [](const auto& a, const auto& b) {
+    return a.first < b.first;
+  });
+  EXPECT_EQ(merged, (std::vector<std::pair<int, int>>{{1, 0}, {1, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}}));
+}
+
+TEST(merge_tests, multiway_merge_of_empty_runs_is_empty) {
+  std::vector<int> data;
+  EXPECT_TRUE(ppc::core::sort::multiway_merge(data, {0, 0, 0, 0}).empty());
+}
+
+TEST(merge_tests, multiway_merge_of_many_runs) {
+  for (int k : {16, 17, 31, 100}) {
+    auto [data, bounds] = random_runs(k, 100 + k);
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(ppc::core::sort::multiway_merge(data, bounds), expected);
+  }
+}
+
+TEST(merge_tests, loser_tree_of_one_source) {
+  ppc::core::sort::LoserTree<int> tree(1);
+  tree.start({4}, {1});
+  ASSERT_FALSE(tree.empty());
+  EXPECT_EQ(tree.top(), 0);
+  EXPECT_EQ(tree.top_key(), 4);
+  tree.replace_top(6);
+  EXPECT_EQ(tree.top_key(), 6);
+  tree.pop_top();
+  EXPECT_TRUE(tree.empty());
+}
@@ -0,0 +1,49 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/serialization/vector.hpp>
+#include <vector>
+
+#include "core/sort/include/odd_even_mpi.hpp"
+
+TEST(odd_even_mpi_tests, keys_cross_empty_blocks) {
+  boost::mpi::communicator world;
+  // every odd rank holds nothing, the others descending runs, so keys have
+  // to cross the empty ranks; on two ranks rank 1 is empty at the end
+  std::vector<int> local;
+  std::vector<int> all_input;
+  for (int r = 0; r < world.size(); r += 2) {
+    for (int i = 0; i < 50; i++) {
+      all_input.push_back((world.size() - r) * 100 - i);
+      if (r == world.rank()) local.push_back(all_input.back());
+    }
+  }
+
+  ppc::core::sort::odd_even_sort(world, local);
+
+  std::vector<std::vector<int>> blocks;
+  boost::mpi::gather(world, local, blocks, 0);
+  if (world.rank() == 0) {
+    std::vector<int> result;
+    for (size_t r = 0; r < blocks.size(); r++) {
+      // each rank keeps as many keys as it had
+      ASSERT_EQ(blocks[r].size(), r % 2 == 0 ? 50U : 0U);
+      result.insert(result.end(), blocks[r].begin(), blocks[r].end());
+    }
+    std::sort(all_input.begin(), all_input.end());
+    EXPECT_EQ(result, all_input);
+  }
+}
+
+TEST(odd_even_mpi_tests, sorted_input_stops_after_two_phases) {
+  boost::mpi::communicator world;
+  std::vector<int> local(20);
+  for (int i = 0; i < 20; i++) local[i] = world.rank() * 20 + i;
+  const auto before = local;
+  const int phases = ppc::core::sort::odd_even_sort(world, local);
+  EXPECT_EQ(local, before);
+  EXPECT_LE(phases, 2);
+}
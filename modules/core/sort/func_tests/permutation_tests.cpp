@@ -0,0 +1,31 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "core/sort/include/permutation.hpp"
+
+TEST(permutation_tests, keyed_less_orders_ties_by_position) {
+  const std::vector<int> keys = {3, 1, 3, 2, 1, 3};
+  auto records = ppc::core::sort::detail::make_keyed(keys, 10);
+  std::sort(records.begin(), records.end(), ppc::core::sort::KeyedLess<>());
+  std::vector<int> sorted;
+  std::vector<long long> origin;
+  ppc::core::sort::detail::split_keyed(records, sorted, origin);
+  EXPECT_EQ(sorted, std::vector<int>({1, 1, 2, 3, 3, 3}));
+  EXPECT_EQ(origin, std::vector<long long>({11, 14, 13, 10, 12, 15}));
+
+  std::sort(records.begin(), records.end(), ppc::core::sort::KeyedLess<std::greater<>>());
+  ppc::core::sort::detail::split_keyed(records, sorted, origin);
+  EXPECT_EQ(sorted, std::vector<int>({3, 3, 3, 2, 1, 1}));
+  EXPECT_EQ(origin, std::vector<long long>({10, 12, 15, 13, 11, 14}));
+}
+
+TEST(permutation_tests, apply_permutation_gathers_values) {
+  std::vector<std::string> values = {"a", "b", "c", "d"};
+  ppc::core::sort::apply_permutation(std::vector<long long>({2, 0, 3, 1}), values);
+  EXPECT_EQ(values, std::vector<std::string>({"c", "a", "d", "b"}));
+}
@@ -0,0 +1,102 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "core/sort/include/quicksort.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+std::vector<int> random_ints(size_t n, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  std::vector<int> v(n);
+  for (auto& x : v) x = dist(gen);
+  return v;
+}
+
+template <typename T, typename Compare = std::less<>>
+void check_sorts(std::vector<T> v, Compare comp = {}) {
+  auto expected = v;
+  std::sort(expected.begin(), expected.end(), comp);
+  ppc::core::sort::quicksort(v, comp);
+  EXPECT_EQ(v, expected);
+}
+
+// Runs body with n OpenMP threads, so the task and parallel partition paths
+// are taken even where the test runs on one core.
+template <typename Body>
+void with_threads(int n, Body body) {
+#ifdef _OPENMP
+  const int saved = omp_get_max_threads();
+  omp_set_num_threads(n);
+#endif
+  body();
+#ifdef _OPENMP
+  omp_set_num_threads(saved);
+#endif
+}
+
+}  // namespace
+
+TEST(quicksort_tests, sorts_random_input) {
+  for (size_t n : {0, 1, 2, 3, 24, 25, 127, 128, 1000, 100000}) check_sorts(random_ints(n, 1000000, n));
+}
+
+TEST(quicksort_tests, presorted_and_duplicate_heavy_inputs) {
+  std::vector<int> ascending(50000);
+  for (size_t i = 0; i < ascending.size(); i++) ascending[i] = static_cast<int>(i);
+  std::vector<int> descending(ascending.rbegin(), ascending.rend());
+  std::vector<int> organ_pipe(ascending.begin(), ascending.begin() + 25000);
+  organ_pipe.insert(organ_pipe.end(), descending.begin() + 25000, descending.end());
+  check_sorts(ascending);
+  check_sorts(descending);
+  check_sorts(organ_pipe);
+  check_sorts(std::vector<int>(50000, 7));
+  check_sorts(random_ints(50000, 3, 1));
+}
+
+TEST(quicksort_tests, custom_comparator) {
+  std::vector<double> v(20000);
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (auto& x : v) x = dist(gen);
+  check_sorts(v, std::greater<>());
+}
+
+TEST(quicksort_tests, depth_guard_falls_back_to_heap_sort) {
+  auto v = random_ints(5000, 100, 3);
+  auto expected = v;
+  std::sort(expected.begin(), expected.end());
+  ppc::core::sort::detail::introsort_loop(v.data(), v.data() + v.size(), 0, std::less<>());
+  EXPECT_EQ(v, expected);
+}
+
+TEST(quicksort_tests, parallel_partition_splits_by_predicate) {
+  auto v = random_ints(100003, 1000, 4);
+  const auto below = [](int x) { return x < 250; };
+  const auto expected = std::count_if(v.begin(), v.end(), below);
+  ptrdiff_t left = 0;
+  with_threads(4, [&] {
+#pragma omp parallel
+#pragma omp single
+    left = ppc::core::sort::detail::parallel_partition(v.data(), static_cast<ptrdiff_t>(v.size()), 7, below);
+  });
+  EXPECT_EQ(left, expected);
+  EXPECT_TRUE(std::is_partitioned(v.begin(), v.end(), below));
+}
+
+TEST(quicksort_tests, large_input_with_threads) {
+  with_threads(4, [] {
+    check_sorts(random_ints(1 << 20, 1 << 30, 5));
+    check_sorts(random_ints(1 << 20, 10, 6));
+    check_sorts(std::vector<int>(1 << 19, -1));
+  });
+}
@@ -0,0 +1,153 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/sort/include/radix.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+template <typename T>
+std::vector<T> random_values(size_t n, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> v(n);
+  if constexpr (std::is_floating_point_v<T>) {
+    std::uniform_real_distribution<T> dist(-1e6, 1e6);
+    for (auto& x : v) x = dist(gen);
+  } else {
+    std::uniform_int_distribution<int64_t> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+    for (auto& x : v) x = static_cast<T>(dist(gen));
+  }
+  return v;
+}
+
+template <typename T>
+void check_sorts(size_t n, unsigned seed, int digit_bits = 0) {
+  auto v = random_values<T>(n, seed);
+  auto expected = v;
+  std::sort(expected.begin(), expected.end());
+  ppc::core::sort::radix_sort(v, digit_bits);
+  EXPECT_EQ(v, expected);
+}
+
+}  // namespace
+
+TEST(radix_tests, sorts_every_key_type) {
+  check_sorts<double>(1000, 1);
+  check_sorts<float>(1000, 2);
+  check_sorts<int32_t>(1000, 3);
+  check_sorts<int64_t>(1000, 4);
+  check_sorts<uint32_t>(1000, 5);
+  check_sorts<int16_t>(1000, 6);
+  check_sorts<uint8_t>(1000, 7);
+}
+
+TEST(radix_tests, special_floating_point_values) {
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<double> v = {3.5, -0.0, inf, -inf, 0.0, -1e-300, std::numeric_limits<double>::denorm_min(), -2.0};
+  ppc::core::sort::radix_sort(v);
+  const std::vector<double> expected = {-inf, -2.0, -1e-300, -0.0, 0.0, std::numeric_limits<double>::denorm_min(),
+                                        3.5,  inf};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < v.size(); i++) {
+    EXPECT_EQ(v[i], expected[i]);
+    EXPECT_EQ(std::signbit(v[i]), std::signbit(expected[i])) << i;
+  }
+}
+
+TEST(radix_tests, any_digit_width) {
+  for (int bits : {1, 3, 8, 11, 16}) check_sorts<int32_t>(5000, bits, bits);
+  check_sorts<double>(5000, 17, 13);
+}
+
+TEST(radix_tests, shared_digits_are_skipped_without_changing_the_result) {
+  // only the low byte differs: all other passes are skipped
+  std::vector<uint64_t> v(3000);
+  std::mt19937 gen(8);
+  for (auto& x : v) x = 0xABCD000000000000ULL | (gen() & 0xFF);
+  auto expected = v;
+  std::sort(expected.begin(), expected.end());
+  ppc::core::sort::radix_sort(v);
+  EXPECT_EQ(v, expected);
+}
+
+TEST(radix_tests, large_input_with_threads) {
+#ifdef _OPENMP
+  const int saved = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+  check_sorts<double>(1 << 19, 9);
+  check_sorts<int32_t>(1 << 22, 10);
+#ifdef _OPENMP
+  omp_set_num_threads(saved);
+#endif
+}
+
+TEST(radix_tests, tiny_inputs) {
+  std::vector<double> empty;
+  ppc::core::sort::radix_sort(empty);
+  EXPECT_TRUE(empty.empty());
+  std::vector<int> one = {5};
+  ppc::core::sort::radix_sort(one);
+  EXPECT_EQ(one, std::vector<int>({5}));
+}
+
+TEST(radix_tests, permutation_is_stable) {
+  // few distinct keys, so most of them tie
+  std::vector<int> keys(20000);
+  std::mt19937 gen(11);
+  for (auto& x : keys) x = static_cast<int>(gen() % 50) - 25;
+  std::vector<size_t> expected(keys.size());
+  std::iota(expected.begin(), expected.end(), size_t{0});
+  std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+  const auto before = keys;
+  EXPECT_EQ(ppc::core::sort::radix_sort_permutation(keys.data(), keys.data() + keys.size()), expected);
+  EXPECT_EQ(keys, before);
+}
+
+TEST(radix_tests, sort_by_key_carries_values_along) {
+  auto keys = random_values<double>(5000, 12);
+  for (size_t i = 0; i < keys.size(); i += 3) keys[i] = 0.5;
+  std::vector<std::string> values(keys.size());
+  for (size_t i = 0; i < values.size(); i++) values[i] = std::to_string(i);
+  std::vector<size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+  auto sorted_keys = keys;
+  ppc::core::sort::radix_sort_by_key(sorted_keys, values);
+  for (size_t i = 0; i < keys.size(); i++) {
+    EXPECT_EQ(sorted_keys[i], keys[order[i]]);
+    EXPECT_EQ(values[i], std::to_string(order[i]));
+  }
+}
+
+TEST(radix_tests, permutation_with_threads) {
+#ifdef _OPENMP
+  const int saved = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+  std::vector<uint32_t> keys(1 << 20);
+  std::mt19937 gen(13);
+  for (auto& x : keys) x = gen() % 1000;
+  const auto perm = ppc::core::sort::radix_sort_permutation(keys.data(), keys.data() + keys.size());
+  for (size_t i = 1; i < perm.size(); i++) {
+    const uint32_t a = keys[perm[i - 1]];
+    const uint32_t b = keys[perm[i]];
+    ASSERT_TRUE(a < b || (a == b && perm[i - 1] < perm[i])) << i;
+  }
+#ifdef _OPENMP
+  omp_set_num_threads(saved);
+#endif
+}
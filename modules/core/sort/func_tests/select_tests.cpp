@@ -0,0 +1,86 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "core/sort/include/select.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+std::vector<int> random_ints(size_t n, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  std::vector<int> v(n);
+  for (auto& x : v) x = dist(gen);
+  return v;
+}
+
+void check_select(std::vector<int> v, size_t nth) {
+  auto expected = v;
+  std::sort(expected.begin(), expected.end());
+  ppc::core::sort::select_nth(v.data(), v.data() + nth, v.data() + v.size());
+  ASSERT_EQ(v[nth], expected[nth]);
+  for (size_t i = 0; i < nth; i++) ASSERT_LE(v[i], v[nth]);
+  for (size_t i = nth + 1; i < v.size(); i++) ASSERT_GE(v[i], v[nth]);
+}
+
+}  // namespace
+
+TEST(select_tests, select_nth_matches_sort) {
+  for (size_t n : {1, 2, 25, 1000, 100001}) {
+    const auto v = random_ints(n, 1000000, n);
+    for (size_t nth : {size_t{0}, n / 3, n / 2, n - 1}) check_select(v, nth);
+  }
+  std::vector<int> organ_pipe(50000);
+  for (size_t i = 0; i < organ_pipe.size(); i++) organ_pipe[i] = static_cast<int>(std::min(i, organ_pipe.size() - i));
+  check_select(organ_pipe, 12345);
+  check_select(std::vector<int>(30000, 4), 777);
+  check_select(random_ints(30000, 2, 7), 15000);
+}
+
+TEST(select_tests, quantiles_in_query_order) {
+  const auto v = random_ints(10001, 1000000, 1);
+  auto sorted = v;
+  std::sort(sorted.begin(), sorted.end());
+  const std::vector<double> qs = {0.99, 0.5, 0.0, 1.0, 0.5, 0.25, -1.0};
+  const std::vector<int> expected = {sorted[9900], sorted[5000], sorted[0], sorted[10000],
+                                     sorted[5000], sorted[2500], sorted[0]};
+  EXPECT_EQ(ppc::core::sort::quantiles(v, qs), expected);
+  EXPECT_TRUE(ppc::core::sort::quantiles(std::vector<int>{}, qs).empty());
+  // the lower median of an even count
+  EXPECT_EQ(ppc::core::sort::quantiles(std::vector<int>{4, 1, 3, 2}, {0.5}), std::vector<int>{2});
+}
+
+TEST(select_tests, top_k_best_first) {
+  const auto v = random_ints(200000, 1000, 2);
+  auto sorted = v;
+  std::sort(sorted.begin(), sorted.end(), std::greater<>());
+  for (size_t k : {0, 1, 10, 5000}) {
+    EXPECT_EQ(ppc::core::sort::top_k(v, k, std::greater<>()), std::vector<int>(sorted.begin(), sorted.begin() + k));
+  }
+  std::sort(sorted.begin(), sorted.end());
+  EXPECT_EQ(ppc::core::sort::top_k(v, 300), std::vector<int>(sorted.begin(), sorted.begin() + 300));
+  EXPECT_EQ(ppc::core::sort::top_k(std::vector<int>{3, 1, 2}, 10), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(select_tests, top_k_with_threads) {
+#ifdef _OPENMP
+  const int saved = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+  const auto v = random_ints(1 << 20, 1 << 30, 3);
+  auto sorted = v;
+  std::sort(sorted.begin(), sorted.end(), std::greater<>());
+  EXPECT_EQ(ppc::core::sort::top_k(v, 1000, std::greater<>()), std::vector<int>(sorted.begin(), sorted.begin() + 1000));
+#ifdef _OPENMP
+  omp_set_num_threads(saved);
+#endif
+}
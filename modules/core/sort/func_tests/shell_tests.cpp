@@ -0,0 +1,117 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "core/sort/include/shell.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+std::vector<int> random_ints(size_t n, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  std::vector<int> v(n);
+  for (auto& x : v) x = dist(gen);
+  return v;
+}
+
+template <typename Gaps, typename T, typename Compare = std::less<>>
+void check_sorts(std::vector<T> v, Compare comp = {}) {
+  auto expected = v;
+  std::sort(expected.begin(), expected.end(), comp);
+  ppc::core::sort::shell_sort<Gaps>(v, comp);
+  EXPECT_EQ(v, expected);
+}
+
+template <typename Gaps>
+std::vector<ptrdiff_t> first_gaps(int count) {
+  std::vector<ptrdiff_t> gaps;
+  for (int k = 0; k < count; k++) gaps.push_back(Gaps::gap(k));
+  return gaps;
+}
+
+// Runs body with n OpenMP threads, so the split passes and the tiles are
+// shared out even where the test runs on one core.
+template <typename Body>
+void with_threads(int n, Body body) {
+#ifdef _OPENMP
+  const int saved = omp_get_max_threads();
+  omp_set_num_threads(n);
+#endif
+  body();
+#ifdef _OPENMP
+  omp_set_num_threads(saved);
+#endif
+}
+
+}  // namespace
+
+TEST(shell_tests, gap_sequences) {
+  using ppc::core::sort::CiuraGaps;
+  using ppc::core::sort::SedgewickGaps;
+  using ppc::core::sort::TokudaGaps;
+  EXPECT_EQ(first_gaps<CiuraGaps>(10), (std::vector<ptrdiff_t>{1, 4, 10, 23, 57, 132, 301, 701, 1577, 3548}));
+  EXPECT_EQ(first_gaps<TokudaGaps>(10), (std::vector<ptrdiff_t>{1, 4, 9, 20, 46, 103, 233, 525, 1182, 2660}));
+  EXPECT_EQ(first_gaps<SedgewickGaps>(8), (std::vector<ptrdiff_t>{1, 8, 23, 77, 281, 1073, 4193, 16577}));
+  EXPECT_EQ(ppc::core::sort::detail::shell_gaps<CiuraGaps>(58), (std::vector<ptrdiff_t>{57, 23, 10, 4, 1}));
+}
+
+TEST(shell_tests, sorts_random_input_with_every_gap_sequence) {
+  for (size_t n : {0, 1, 2, 3, 57, 1000, 32768, 32769, 100000, 300007}) {
+    const auto v = random_ints(n, 1000000, n);
+    check_sorts<ppc::core::sort::CiuraGaps>(v);
+    check_sorts<ppc::core::sort::TokudaGaps>(v);
+    check_sorts<ppc::core::sort::SedgewickGaps>(v);
+  }
+}
+
+TEST(shell_tests, presorted_and_duplicate_heavy_inputs) {
+  std::vector<int> ascending(100000);
+  for (size_t i = 0; i < ascending.size(); i++) ascending[i] = static_cast<int>(i);
+  std::vector<int> descending(ascending.rbegin(), ascending.rend());
+  check_sorts<ppc::core::sort::CiuraGaps>(ascending);
+  check_sorts<ppc::core::sort::CiuraGaps>(descending);
+  check_sorts<ppc::core::sort::CiuraGaps>(std::vector<int>(100000, 7));
+  check_sorts<ppc::core::sort::CiuraGaps>(random_ints(100000, 3, 1));
+}
+
+TEST(shell_tests, custom_comparator) {
+  std::vector<double> v(50000);
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (auto& x : v) x = dist(gen);
+  check_sorts<ppc::core::sort::TokudaGaps>(v, std::greater<>());
+}
+
+TEST(shell_tests, h_sort_chains_touches_only_its_chains) {
+  auto v = random_ints(1000, 1000, 3);
+  const auto before = v;
+  const ptrdiff_t h = 10;
+  ppc::core::sort::detail::h_sort_chains(v.data(), static_cast<ptrdiff_t>(v.size()), h, 3, 7, std::less<>());
+  for (ptrdiff_t c = 0; c < h; c++) {
+    std::vector<int> chain;
+    std::vector<int> was;
+    for (size_t i = c; i < v.size(); i += h) {
+      chain.push_back(v[i]);
+      was.push_back(before[i]);
+    }
+    // chains 3 to 6 end up sorted, the others as they were
+    if (c >= 3 && c < 7) std::sort(was.begin(), was.end());
+    EXPECT_EQ(chain, was);
+  }
+}
+
+TEST(shell_tests, large_input_with_threads) {
+  with_threads(4, [] {
+    check_sorts<ppc::core::sort::CiuraGaps>(random_ints(1 << 20, 1 << 30, 5));
+    check_sorts<ppc::core::sort::SedgewickGaps>(random_ints(1 << 20, 10, 6));
+  });
+}
@@ -0,0 +1,102 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <numeric>
+#include <vector>
+
+#include "core/sort/include/batcher_mpi.hpp"
+#include "core/sort/include/distribute_mpi.hpp"
+#include "core/sort/include/permutation.hpp"
+#include "core/sort/include/sample_sort_mpi.hpp"
+
+namespace {
+
+// Keys with many duplicates, counts[r] of them on rank r, the same on every rank.
+std::vector<int> duplicate_keys(const std::vector<int>& counts) {
+  std::vector<int> keys;
+  for (int r = 0; r < static_cast<int>(counts.size()); r++) {
+    for (int i = 0; i < counts[r]; i++) {
+      keys.push_back((i * 7 + r * 3) % 5 - 2);
+    }
+  }
+  return keys;
+}
+
+// Runs a stable engine on the block of this rank and checks on rank 0 that
+// the keys come back in std::stable_sort order with the positions they had.
+template <typename Sort>
+void check_stable_sort(const std::vector<int>& counts, Sort sort) {
+  boost::mpi::communicator world;
+  const std::vector<int> all_keys = duplicate_keys(counts);
+  int first = 0;
+  for (int r = 0; r < world.rank(); r++) first += counts[r];
+  std::vector<int> keys(all_keys.begin() + first, all_keys.begin() + first + counts[world.rank()]);
+  std::vector<long long> origin;
+  sort(world, keys, origin);
+  ASSERT_EQ(keys.size(), origin.size());
+
+  const auto sorted_keys = ppc::core::sort::gather_sorted(world, keys);
+  const auto sorted_origin = ppc::core::sort::gather_sorted(world, origin);
+  if (world.rank() == 0) {
+    std::vector<long long> expected(all_keys.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](long long a, long long b) { return all_keys[a] < all_keys[b]; });
+    EXPECT_EQ(sorted_origin, expected);
+    std::vector<int> expected_keys = all_keys;
+    ppc::core::sort::apply_permutation(expected, expected_keys);
+    EXPECT_EQ(sorted_keys, expected_keys);
+    // origin is a permutation of the input positions
+    auto positions = sorted_origin;
+    std::sort(positions.begin(), positions.end());
+    for (size_t i = 0; i < positions.size(); i++) {
+      ASSERT_EQ(positions[i], static_cast<long long>(i));
+    }
+  }
+}
+
+std::vector<int> unequal_counts(int size) {
+  std::vector<int> counts(size);
+  for (int r = 0; r < size; r++) counts[r] = 37 + 11 * r;
+  return counts;
+}
+
+std::vector<int> all_on_rank_zero(int size) {
+  std::vector<int> counts(size, 0);
+  counts[0] = 120;
+  return counts;
+}
+
+const auto kStableSample = [](const boost::mpi::communicator& world, std::vector<int>& keys,
+                              std::vector<long long>& origin) {
+  ppc::core::sort::stable_sample_sort(world, keys, origin);
+};
+
+const auto kStableBatcher = [](const boost::mpi::communicator& world, std::vector<int>& keys,
+                               std::vector<long long>& origin) {
+  ppc::core::sort::stable_batcher_sort(world, keys, origin);
+};
+
+}  // namespace
+
+TEST(stable_mpi_tests, stable_sample_sort_keeps_equal_keys_in_order) {
+  boost::mpi::communicator world;
+  check_stable_sort(unequal_counts(world.size()), kStableSample);
+}
+
+TEST(stable_mpi_tests, stable_sample_sort_all_keys_on_one_rank) {
+  boost::mpi::communicator world;
+  check_stable_sort(all_on_rank_zero(world.size()), kStableSample);
+}
+
+TEST(stable_mpi_tests, stable_batcher_sort_keeps_equal_keys_in_order) {
+  boost::mpi::communicator world;
+  check_stable_sort(unequal_counts(world.size()), kStableBatcher);
+}
+
+TEST(stable_mpi_tests, stable_batcher_sort_all_keys_on_one_rank) {
+  boost::mpi::communicator world;
+  check_stable_sort(all_on_rank_zero(world.size()), kStableBatcher);
+}
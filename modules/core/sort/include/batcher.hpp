@@ -0,0 +1,101 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_BATCHER_HPP_
+#define MODULES_CORE_SORT_INCLUDE_BATCHER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ppc::core::sort {
+
+struct Comparator {
+  int low;
+  int high;
+};
+
+// Batcher's merge-exchange network (Knuth, TAOCP 5.2.2, algorithm M) for any
+// n, not only powers of two. Each round is a set of disjoint comparators that
+// can run at the same time; there are O(log^2 n) rounds.
+inline std::vector<std::vector<Comparator>> batcher_network(int n) {
+  std::vector<std::vector<Comparator>> rounds;
+  if (n < 2) return rounds;
+  int t = 1;
+  while ((1 << t) < n) t++;
+  for (int p = 1 << (t - 1); p > 0; p /= 2) {
+    int q = 1 << (t - 1);
+    int r = 0;
+    int d = p;
+    while (true) {
+      std::vector<Comparator> round;
+      for (int i = 0; i + d < n; i++) {
+        if ((i & p) == r) round.push_back({i, i + d});
+      }
+      if (!round.empty()) rounds.push_back(std::move(round));
+      if (q == p) break;
+      d = q - p;
+      q /= 2;
+      r = p;
+    }
+  }
+  return rounds;
+}
+
+struct MergeSplitStep {
+  int partner;
+  bool keep_low;
+};
+
+// The comparators of batcher_network(n) that touch position index, in round
+// order: what one rank has to do, worked out once instead of per round.
+inline std::vector<MergeSplitStep> batcher_steps(int n, int index) {
+  std::vector<MergeSplitStep> steps;
+  for (const auto& round : batcher_network(n)) {
+    for (const auto& c : round) {
+      if (c.low == index) steps.push_back({c.high, true});
+      if (c.high == index) steps.push_back({c.low, false});
+    }
+  }
+  return steps;
+}
+
+// Block compare-exchange. Both blocks hold `block` slots; mine and theirs
+// are the sorted real elements at the front, the rest is padding that goes
+// after everything. The low side keeps the `block` smallest of the union,
+// the high side the `block` largest, so padding never has to be a value of
+// T and blocks of unequal length still form a valid network. Only the kept
+// half is merged. On ties the low side takes its own elements first and the
+// high side its own last, so both sides agree on the split.
+template <typename T, typename Compare>
+void merge_split(std::vector<T>& mine, const T* theirs, size_t their_count, size_t block, bool keep_low,
+                 Compare comp, std::vector<T>& scratch) {
+  const size_t total = mine.size() + their_count;
+  if (keep_low) {
+    scratch.resize(std::min(block, total));
+    size_t i = 0;
+    size_t j = 0;
+    for (auto& out : scratch) {
+      if (j == their_count || (i < mine.size() && !comp(theirs[j], mine[i]))) {
+        out = mine[i++];
+      } else {
+        out = theirs[j++];
+      }
+    }
+  } else {
+    scratch.resize(total > block ? total - block : 0);
+    size_t i = mine.size();
+    size_t j = their_count;
+    for (auto out = scratch.rbegin(); out != scratch.rend(); ++out) {
+      if (j == 0 || (i > 0 && !comp(mine[i - 1], theirs[j - 1]))) {
+        *out = mine[--i];
+      } else {
+        *out = theirs[--j];
+      }
+    }
+  }
+  mine.swap(scratch);
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_BATCHER_HPP_
@@ -0,0 +1,68 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_BATCHER_MPI_HPP_
+#define MODULES_CORE_SORT_INCLUDE_BATCHER_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/operations.hpp>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "core/sort/include/batcher.hpp"
+#include "core/sort/include/distribute_mpi.hpp"
+#include "core/sort/include/permutation.hpp"
+
+namespace ppc::core::sort {
+
+// Batcher odd-even merge sort over the ranks of world. local_sort(local)
+// sorts each block first (std::sort by default), then every comparator of
+// batcher_network(size) is a merge-split between two ranks: one
+// MPI_Sendrecv of the blocks in both directions at once, after which each
+// side keeps its half. Blocks may differ in length; the shorter ones are
+// treated as padded to the longest. On return rank r holds a sorted block
+// and nothing on rank r goes after anything on rank r + 1; the padding ends
+// up on the last ranks, so trailing ranks may be left with fewer elements.
+template <typename T, typename Compare = std::less<>, typename LocalSort = detail::StdSort<Compare>>
+void batcher_sort(const boost::mpi::communicator& world, std::vector<T>& local, Compare comp = {},
+                  LocalSort local_sort = {}) {
+  local_sort(local);
+  if (world.size() == 1) return;
+
+  int block = 0;
+  boost::mpi::all_reduce(world, static_cast<int>(local.size()), block, boost::mpi::maximum<int>());
+  if (block == 0) return;
+
+  std::vector<T> theirs(block);
+  std::vector<T> scratch;
+  for (const auto& step : batcher_steps(world.size(), world.rank())) {
+    MPI_Status status;
+    MPI_Sendrecv(local.data(), static_cast<int>(local.size()), detail::mpi_type<T>(), step.partner, 0,
+                 theirs.data(), block, detail::mpi_type<T>(), step.partner, 0, world, &status);
+    int count = 0;
+    MPI_Get_count(&status, detail::mpi_type<T>(), &count);
+    merge_split(local, theirs.data(), static_cast<size_t>(count), static_cast<size_t>(block), step.keep_low, comp,
+                scratch);
+  }
+}
+
+// Stable batcher_sort() with the input position of every key in origin, as
+// stable_sample_sort() does it; the blocks are left as batcher_sort() leaves
+// them.
+template <typename K, typename Compare = std::less<>>
+void stable_batcher_sort(const boost::mpi::communicator& world, std::vector<K>& keys, std::vector<long long>& origin,
+                         Compare comp = {}) {
+  const KeyedLess<Compare> keyed_comp{comp};
+  std::vector<Keyed<K>> records = detail::make_keyed(keys, detail::global_offset(world, keys.size()));
+  batcher_sort(world, records, keyed_comp,
+               [&](std::vector<Keyed<K>>& v) { std::sort(v.begin(), v.end(), keyed_comp); });
+  detail::split_keyed(records, keys, origin);
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_BATCHER_MPI_HPP_
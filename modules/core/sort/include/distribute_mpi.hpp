@@ -0,0 +1,101 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_DISTRIBUTE_MPI_HPP_
+#define MODULES_CORE_SORT_INCLUDE_DISTRIBUTE_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "core/sort/include/permutation.hpp"
+
+namespace ppc::core::sort {
+
+namespace detail {
+
+template <typename T>
+MPI_Datatype mpi_type() {
+  if constexpr (is_keyed<T>::value) {
+    // a key and its position go as the raw bytes of the record, which have
+    // the same layout on every rank of the job
+    static_assert(std::is_trivially_copyable_v<T>, "keyed records are exchanged as raw bytes");
+    static const MPI_Datatype type = [] {
+      MPI_Datatype bytes;
+      MPI_Type_contiguous(static_cast<int>(sizeof(T)), MPI_BYTE, &bytes);
+      MPI_Type_commit(&bytes);
+      return bytes;
+    }();
+    return type;
+  } else {
+    static_assert(boost::mpi::is_mpi_datatype<T>::value, "the sort engines exchange raw MPI buffers");
+    return boost::mpi::get_mpi_datatype<T>(T{});
+  }
+}
+
+// Default local sort of the distributed engines.
+template <typename Compare>
+struct StdSort {
+  template <typename T>
+  void operator()(std::vector<T>& v) const {
+    std::sort(v.begin(), v.end(), Compare{});
+  }
+};
+
+inline std::vector<int> displacements(const std::vector<int>& counts) {
+  std::vector<int> displs(counts.size(), 0);
+  for (size_t r = 1; r < counts.size(); r++) displs[r] = displs[r - 1] + counts[r - 1];
+  return displs;
+}
+
+// Position of the first local element in the sequence the ranks hold
+// together in rank order.
+inline long long global_offset(const boost::mpi::communicator& world, size_t local_size) {
+  const auto n = static_cast<long long>(local_size);
+  long long inclusive = 0;
+  boost::mpi::scan(world, n, inclusive, std::plus<>());
+  return inclusive - n;
+}
+
+}  // namespace detail
+
+// Even block distribution of the data held on root: rank r gets n / size
+// elements and the first n % size ranks one more.
+template <typename T>
+std::vector<T> scatter_even(const boost::mpi::communicator& world, const std::vector<T>& all, int root = 0) {
+  const int size = world.size();
+  int n = static_cast<int>(all.size());
+  boost::mpi::broadcast(world, n, root);
+  std::vector<int> counts(size, n / size);
+  for (int r = 0; r < n % size; r++) counts[r]++;
+  const std::vector<int> displs = detail::displacements(counts);
+  std::vector<T> local(counts[world.rank()]);
+  MPI_Scatterv(all.data(), counts.data(), displs.data(), detail::mpi_type<T>(), local.data(), counts[world.rank()],
+               detail::mpi_type<T>(), root, world);
+  return local;
+}
+
+// Concatenates the blocks of all ranks in rank order on root, which is the
+// whole sorted sequence after sample_sort() or batcher_sort(). Other ranks get an empty vector.
+template <typename T>
+std::vector<T> gather_sorted(const boost::mpi::communicator& world, const std::vector<T>& local, int root = 0) {
+  const int size = world.size();
+  const int n = static_cast<int>(local.size());
+  std::vector<int> counts(size, 0);
+  boost::mpi::gather(world, n, counts.data(), root);
+  const std::vector<int> displs = detail::displacements(counts);
+  std::vector<T> all(world.rank() == root ? displs[size - 1] + counts[size - 1] : 0);
+  MPI_Gatherv(local.data(), n, detail::mpi_type<T>(), all.data(), counts.data(), displs.data(), detail::mpi_type<T>(),
+              root, world);
+  return all;
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_DISTRIBUTE_MPI_HPP_
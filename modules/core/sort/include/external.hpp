@@ -0,0 +1,138 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_EXTERNAL_HPP_
+#define MODULES_CORE_SORT_INCLUDE_EXTERNAL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "core/sort/include/mapped_file.hpp"
+#include "core/sort/include/merge.hpp"
+#include "core/sort/include/quicksort.hpp"
+
+namespace ppc::core::sort {
+
+namespace detail {
+
+template <typename T>
+bool write_block(std::ostream& out, const T* data, size_t count) {
+  out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(count * sizeof(T)));
+  return static_cast<bool>(out);
+}
+
+inline std::string run_path(const std::string& output, int rank, size_t run) {
+  return output + ".run" + std::to_string(rank) + "_" + std::to_string(run);
+}
+
+inline void remove_runs(const std::vector<std::string>& runs) {
+  std::error_code ignored;
+  for (const auto& run : runs) std::filesystem::remove(run, ignored);
+}
+
+// Cuts [first, first + n) into runs of run_length elements, sorts each in
+// memory and writes it to a file of its own named by run_path(output, rank,
+// i), appending the names to runs. on_run(run) sees each sorted run before
+// it is written.
+template <typename T, typename Compare, typename OnRun>
+bool form_runs(const T* first, size_t n, size_t run_length, const std::string& output, int rank, Compare comp,
+               std::vector<std::string>& runs, OnRun on_run) {
+  std::vector<T> buffer;
+  buffer.reserve(std::min(n, run_length));
+  for (size_t begin = 0; begin < n; begin += run_length) {
+    const size_t end = std::min(n, begin + run_length);
+    buffer.assign(first + begin, first + end);
+    quicksort(buffer, comp);
+    on_run(buffer);
+    runs.push_back(run_path(output, rank, runs.size()));
+    std::ofstream out(runs.back(), std::ios::binary | std::ios::trunc);
+    if (!out || !write_block(out, buffer.data(), buffer.size())) return false;
+  }
+  return true;
+}
+
+// Merges the sorted ranges [first[r], last[r]) into out with a LoserTree,
+// buffer_length elements per write.
+template <typename T, typename Compare>
+bool merge_ranges(std::vector<const T*> first, const std::vector<const T*>& last, std::ostream& out,
+                  size_t buffer_length, Compare comp) {
+  const int k = static_cast<int>(first.size());
+  std::vector<T> heads(k);
+  std::vector<char> live(k, 0);
+  for (int r = 0; r < k; r++) {
+    if (first[r] == last[r]) continue;
+    heads[r] = *first[r];
+    live[r] = 1;
+  }
+  LoserTree<T, Compare> tree(k, comp);
+  tree.start(heads, live);
+  std::vector<T> buffer;
+  buffer.reserve(std::max<size_t>(buffer_length, 1));
+  while (!tree.empty()) {
+    const int r = tree.top();
+    buffer.push_back(tree.top_key());
+    if (++first[r] != last[r]) {
+      tree.replace_top(*first[r]);
+    } else {
+      tree.pop_top();
+    }
+    if (buffer.size() >= buffer_length) {
+      if (!write_block(out, buffer.data(), buffer.size())) return false;
+      buffer.clear();
+    }
+  }
+  return write_block(out, buffer.data(), buffer.size());
+}
+
+}  // namespace detail
+
+// Sorts the file input, a raw array of T, into the file output with about
+// memory_budget bytes of RAM, however large the input. The input is
+// memory-mapped and cut into runs of memory_budget bytes, each sorted with
+// quicksort() and written to a temporary file next to output. The runs are
+// then mapped in turn and merged with a LoserTree into output through a
+// buffer of the same size, so all I/O is large and sequential and the only
+// memory the sort holds on to is the run or write buffer. Returns false if
+// a file cannot be read or written or input is not a whole number of T.
+template <typename T, typename Compare = std::less<>>
+bool external_sort(const std::string& input, const std::string& output, size_t memory_budget, Compare comp = {}) {
+  static_assert(std::is_trivially_copyable_v<T>, "the files hold raw arrays of T");
+  MappedFile in;
+  if (!in.open(input) || in.size() % sizeof(T) != 0) return false;
+  const size_t n = in.size() / sizeof(T);
+  const size_t run_length = std::max<size_t>(1, memory_budget / sizeof(T));
+
+  std::vector<std::string> runs;
+  bool ok = detail::form_runs(reinterpret_cast<const T*>(in.data()), n, run_length, output, 0, comp, runs,
+                              [](const std::vector<T>&) {});
+  in.close();
+
+  if (ok) {
+    std::vector<MappedFile> mapped(runs.size());
+    std::vector<const T*> first;
+    std::vector<const T*> last;
+    for (size_t i = 0; ok && i < runs.size(); i++) {
+      ok = mapped[i].open(runs[i]);
+      first.push_back(reinterpret_cast<const T*>(mapped[i].data()));
+      last.push_back(first.back() + mapped[i].size() / sizeof(T));
+    }
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    ok = ok && out && detail::merge_ranges(first, last, out, run_length, comp);
+    out.close();
+    ok = ok && !out.fail();
+  }
+  detail::remove_runs(runs);
+  return ok;
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_EXTERNAL_HPP_
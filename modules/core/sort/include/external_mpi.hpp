@@ -0,0 +1,116 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_EXTERNAL_MPI_HPP_
+#define MODULES_CORE_SORT_INCLUDE_EXTERNAL_MPI_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "core/sort/include/distribute_mpi.hpp"
+#include "core/sort/include/external.hpp"
+#include "core/sort/include/mapped_file.hpp"
+#include "core/sort/include/sample_sort_mpi.hpp"
+
+namespace ppc::core::sort {
+
+// external_sort() over the ranks of world, which must share the file system
+// the files live on (one node, or a parallel file system). Every rank maps
+// input and forms runs of memory_budget bytes from its own slice of it,
+// offering up to size evenly spaced keys of each run as samples. Splitters
+// picked from the samples as in sample_sort() give each rank a bucket; the
+// rank maps every run of every rank, merges the part of each that falls into
+// its bucket and writes the result straight to its place in output, whose
+// offset is the number of keys in the buckets before. No key goes through
+// MPI and no rank holds more than its buffers. Returns false on every rank
+// if any of them failed.
+template <typename T, typename Compare = std::less<>>
+bool external_sort(const boost::mpi::communicator& world, const std::string& input, const std::string& output,
+                   size_t memory_budget, Compare comp = {}) {
+  static_assert(std::is_trivially_copyable_v<T>, "the files hold raw arrays of T");
+  const int size = world.size();
+  const int rank = world.rank();
+  const auto all_ok = [&](bool ok) {
+    bool all = false;
+    boost::mpi::all_reduce(world, ok, all, std::logical_and<>());
+    return all;
+  };
+
+  MappedFile in;
+  if (!all_ok(in.open(input) && in.size() % sizeof(T) == 0)) return false;
+  const size_t n = in.size() / sizeof(T);
+  const size_t run_length = std::max<size_t>(1, memory_budget / sizeof(T));
+  const size_t begin = n * rank / size;
+  const size_t end = n * (rank + 1) / size;
+
+  std::vector<std::string> runs;
+  std::vector<T> samples;
+  const bool formed =
+      detail::form_runs(reinterpret_cast<const T*>(in.data()) + begin, end - begin, run_length, output, rank, comp,
+                        runs, [&](const std::vector<T>& run) {
+                          const size_t offer = std::min(run.size(), static_cast<size_t>(size));
+                          for (size_t s = 0; s < offer; s++) samples.push_back(run[s * run.size() / offer]);
+                        });
+  in.close();
+  if (!all_ok(formed)) {
+    detail::remove_runs(runs);
+    return false;
+  }
+  std::sort(samples.begin(), samples.end(), comp);
+  const std::vector<T> splitters = regular_splitters(world, samples, size, comp);
+
+  std::vector<int> run_counts;
+  boost::mpi::all_gather(world, static_cast<int>(runs.size()), run_counts);
+  size_t total_runs = 0;
+  for (int count : run_counts) total_runs += count;
+  std::vector<MappedFile> mapped(total_runs);
+  std::vector<const T*> first;
+  std::vector<const T*> last;
+  bool ok = true;
+  size_t bucket = 0;
+  for (int r = 0, i = 0; r < size; r++) {
+    for (int run = 0; run < run_counts[r]; run++, i++) {
+      ok = ok && mapped[i].open(detail::run_path(output, r, run));
+      const T* data = reinterpret_cast<const T*>(mapped[i].data());
+      const T* data_end = data + mapped[i].size() / sizeof(T);
+      // bucket b is (splitters[b - 1], splitters[b]], the same cut in every run
+      first.push_back(rank == 0 ? data : std::upper_bound(data, data_end, splitters[rank - 1], comp));
+      last.push_back(rank == size - 1 ? data_end : std::upper_bound(data, data_end, splitters[rank], comp));
+      bucket += last.back() - first.back();
+    }
+  }
+  const long long offset = detail::global_offset(world, bucket);
+
+  if (rank == 0) {
+    std::error_code error;
+    std::ofstream(output, std::ios::binary | std::ios::trunc).close();
+    std::filesystem::resize_file(output, n * sizeof(T), error);
+    ok = ok && !error;
+  }
+  world.barrier();
+  if (ok && bucket > 0) {
+    std::fstream out(output, std::ios::binary | std::ios::in | std::ios::out);
+    out.seekp(static_cast<std::streamoff>(offset * static_cast<long long>(sizeof(T))));
+    ok = out && detail::merge_ranges(first, last, out, run_length, comp);
+    out.close();
+    ok = ok && !out.fail();
+  }
+  mapped.clear();
+  // the other ranks read these runs until here
+  world.barrier();
+  detail::remove_runs(runs);
+  return all_ok(ok);
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_EXTERNAL_MPI_HPP_
@@ -0,0 +1,136 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_HYPERCUBE_MPI_HPP_
+#define MODULES_CORE_SORT_INCLUDE_HYPERCUBE_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "core/sort/include/distribute_mpi.hpp"
+
+namespace ppc::core::sort {
+
+namespace detail {
+
+// Sends count elements of data to partner and returns what partner sent,
+// whose length is exchanged first.
+template <typename T>
+std::vector<T> exchange_block(const boost::mpi::communicator& world, int partner, const T* data, int count) {
+  int their_count = 0;
+  MPI_Sendrecv(&count, 1, MPI_INT, partner, 0, &their_count, 1, MPI_INT, partner, 0, world, MPI_STATUS_IGNORE);
+  std::vector<T> theirs(their_count);
+  MPI_Sendrecv(data, count, mpi_type<T>(), partner, 1, theirs.data(), their_count, mpi_type<T>(), partner, 1, world,
+               MPI_STATUS_IGNORE);
+  return theirs;
+}
+
+// Pivot for the subcube of ranks that differ from rank only in bits
+// [0, dim]: the median of the ranks' local medians, each weighted by the
+// number of keys behind it, so a rank holding most of the keys also has most
+// of the say. The medians are gathered by recursive doubling over those
+// dim + 1 dimensions; every rank of the subcube gets the same set and
+// picks the same pivot. Returns false when the subcube holds no keys.
+template <typename T, typename Compare>
+bool subcube_pivot(const boost::mpi::communicator& world, int dim, const std::vector<T>& sorted, Compare comp,
+                   T& pivot) {
+  std::vector<T> medians(1, sorted.empty() ? T{} : sorted[sorted.size() / 2]);
+  std::vector<int> counts(1, static_cast<int>(sorted.size()));
+  for (int k = 0; k <= dim; k++) {
+    const int partner = world.rank() ^ (1 << k);
+    const int n = static_cast<int>(medians.size());
+    medians.resize(2 * n);
+    counts.resize(2 * n);
+    MPI_Sendrecv(medians.data(), n, mpi_type<T>(), partner, 2, medians.data() + n, n, mpi_type<T>(), partner, 2, world,
+                 MPI_STATUS_IGNORE);
+    MPI_Sendrecv(counts.data(), n, MPI_INT, partner, 3, counts.data() + n, n, MPI_INT, partner, 3, world,
+                 MPI_STATUS_IGNORE);
+  }
+
+  std::vector<int> order;
+  long long total = 0;
+  for (int i = 0; i < static_cast<int>(counts.size()); i++) {
+    if (counts[i] == 0) continue;
+    order.push_back(i);
+    total += counts[i];
+  }
+  if (total == 0) return false;
+  std::sort(order.begin(), order.end(), [&](int a, int b) { return comp(medians[a], medians[b]); });
+  long long seen = 0;
+  for (int i : order) {
+    seen += counts[i];
+    if (2 * seen >= total) {
+      pivot = medians[i];
+      break;
+    }
+  }
+  return true;
+}
+
+}  // namespace detail
+
+// Hypercube quicksort over the ranks of world. The largest power of two
+// 2^d <= size ranks form a hypercube; the others hand their keys to rank -
+// 2^d first and end up empty. local_sort(local) sorts each block once
+// (std::sort by default), then d rounds go down the dimensions: the
+// subcube of the round agrees on a pivot with subcube_pivot(), every rank
+// splits its block there and swaps one side with its partner across the
+// dimension, the lower rank keeping the keys before the pivot, and merges
+// what it kept with what it got. Keys equal to the pivot are split evenly
+// between both sides, so heavy duplicates do not pile up on one rank. Each
+// round moves about half a block per rank, O(n / size log size) in all
+// instead of the O(n / size log^2 size) of batcher_sort(). On return rank r
+// holds a sorted block and nothing on rank r goes after anything on rank
+// r + 1; block sizes follow the pivots and need not be equal.
+template <typename T, typename Compare = std::less<>, typename LocalSort = detail::StdSort<Compare>>
+void hypercube_quicksort(const boost::mpi::communicator& world, std::vector<T>& local, Compare comp = {},
+                         LocalSort local_sort = {}) {
+  const int size = world.size();
+  const int rank = world.rank();
+  int dims = 0;
+  while ((2 << dims) <= size) dims++;
+  const int cube = 1 << dims;
+
+  if (rank >= cube) {
+    const int count = static_cast<int>(local.size());
+    MPI_Send(&count, 1, MPI_INT, rank - cube, 0, world);
+    MPI_Send(local.data(), count, detail::mpi_type<T>(), rank - cube, 1, world);
+    local.clear();
+    return;
+  }
+  if (rank + cube < size) {
+    int count = 0;
+    MPI_Recv(&count, 1, MPI_INT, rank + cube, 0, world, MPI_STATUS_IGNORE);
+    const size_t mine = local.size();
+    local.resize(mine + count);
+    MPI_Recv(local.data() + mine, count, detail::mpi_type<T>(), rank + cube, 1, world, MPI_STATUS_IGNORE);
+  }
+  local_sort(local);
+
+  std::vector<T> merged;
+  for (int dim = dims - 1; dim >= 0; dim--) {
+    T pivot{};
+    if (!detail::subcube_pivot(world, dim, local, comp, pivot)) continue;
+    const auto lo = std::lower_bound(local.begin(), local.end(), pivot, comp);
+    const auto hi = std::upper_bound(lo, local.end(), pivot, comp);
+    const size_t split = (lo - local.begin()) + (hi - lo) / 2;
+    const bool keep_low = (rank & (1 << dim)) == 0;
+    const T* keep = keep_low ? local.data() : local.data() + split;
+    const size_t keep_count = keep_low ? split : local.size() - split;
+    const T* send = keep_low ? local.data() + split : local.data();
+    const auto send_count = static_cast<int>(local.size() - keep_count);
+
+    const std::vector<T> theirs = detail::exchange_block(world, rank ^ (1 << dim), send, send_count);
+    merged.resize(keep_count + theirs.size());
+    std::merge(keep, keep + keep_count, theirs.begin(), theirs.end(), merged.begin(), comp);
+    local.swap(merged);
+  }
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_HYPERCUBE_MPI_HPP_
@@ -0,0 +1,44 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_MAPPED_FILE_HPP_
+#define MODULES_CORE_SORT_INCLUDE_MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <string>
+
+namespace ppc::core::sort {
+
+// Read-only memory mapping of a whole file, for inputs far larger than RAM:
+// pages are read in on first touch and dropped again by the OS under memory
+// pressure. The mapping is marked for sequential access, so the kernel
+// reads ahead in large blocks.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  explicit MappedFile(const std::string& path) { open(path); }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile() { close(); }
+
+  // Maps path, unmapping what was mapped before. Returns false if the file
+  // cannot be opened or mapped. An empty file maps to size() 0.
+  bool open(const std::string& path);
+  void close();
+
+  [[nodiscard]] bool is_open() const { return open_; }
+  [[nodiscard]] const unsigned char* data() const { return data_; }
+  [[nodiscard]] size_t size() const { return size_; }
+
+ private:
+  const unsigned char* data_ = nullptr;
+  size_t size_ = 0;
+  bool open_ = false;
+#ifdef _WIN32
+  void* file_ = nullptr;
+  void* mapping_ = nullptr;
+#endif
+};
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_MAPPED_FILE_HPP_
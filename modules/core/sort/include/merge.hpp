@@ -0,0 +1,128 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_MERGE_HPP_
+#define MODULES_CORE_SORT_INCLUDE_MERGE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ppc::core::sort {
+
+// Tournament tree over k sources of sorted keys that yields the smallest
+// head in log2(k) comparisons per key, one per level on the way up from the
+// source that changed, half of what a binary heap needs. Inner node n keeps
+// the loser of the match played there, node 0 the overall winner. Ties go
+// to the lower source, so merging with it is stable. A source without keys
+// left loses every match.
+template <typename T, typename Compare = std::less<>>
+class LoserTree {
+ public:
+  explicit LoserTree(int k, Compare comp = {}) : k_(k), comp_(comp), heads_(k), live_(k, 0), tree_(std::max(k, 1)) {}
+
+  // Plays every match once; live[r] tells whether source r has a head,
+  // heads[r] is that head.
+  void start(const std::vector<T>& heads, const std::vector<char>& live) {
+    heads_ = heads;
+    live_ = live;
+    // winners of the subtrees; leaf r sits at k + r
+    std::vector<int> winner(2 * k_);
+    for (int r = 0; r < k_; r++) winner[k_ + r] = r;
+    for (int n = k_ - 1; n >= 1; n--) {
+      const int a = winner[2 * n];
+      const int b = winner[2 * n + 1];
+      winner[n] = beats(a, b) ? a : b;
+      tree_[n] = beats(a, b) ? b : a;
+    }
+    tree_[0] = k_ > 1 ? winner[1] : 0;
+  }
+
+  // Source of the smallest head, and that head; only while !empty().
+  [[nodiscard]] int top() const { return tree_[0]; }
+  [[nodiscard]] const T& top_key() const { return heads_[tree_[0]]; }
+  [[nodiscard]] bool empty() const { return k_ == 0 || live_[tree_[0]] == 0; }
+
+  // The winning source moves on to its next key, or has none left.
+  void replace_top(const T& next) {
+    heads_[tree_[0]] = next;
+    replay(tree_[0]);
+  }
+  void pop_top() {
+    live_[tree_[0]] = 0;
+    replay(tree_[0]);
+  }
+
+ private:
+  // whether source a's head goes before source b's
+  bool beats(int a, int b) const {
+    if (live_[a] == 0 || live_[b] == 0) return live_[b] == 0 && (live_[a] != 0 || a < b);
+    if (comp_(heads_[a], heads_[b])) return true;
+    if (comp_(heads_[b], heads_[a])) return false;
+    return a < b;
+  }
+
+  void replay(int r) {
+    int winner = r;
+    for (int n = (k_ + r) / 2; n >= 1; n /= 2) {
+      if (beats(tree_[n], winner)) std::swap(tree_[n], winner);
+    }
+    tree_[0] = winner;
+  }
+
+  int k_;
+  Compare comp_;
+  std::vector<T> heads_;
+  std::vector<char> live_;
+  std::vector<int> tree_;
+};
+
+// Merges the sorted runs src[bounds[r], bounds[r + 1]) into dst, which must
+// not overlap src. A LoserTree of run heads makes this O(n log k) instead of
+// the O(n k) of merging the runs in one by one. Equivalent elements are
+// taken from the lower run first, so the merge is stable.
+template <typename T, typename Compare = std::less<>>
+void multiway_merge(const T* src, const std::vector<size_t>& bounds, T* dst, Compare comp = {}) {
+  const int k = static_cast<int>(bounds.size()) - 1;
+  if (k <= 0) return;
+  if (k == 1) {
+    std::copy(src + bounds[0], src + bounds[1], dst);
+    return;
+  }
+  if (k == 2) {
+    std::merge(src + bounds[0], src + bounds[1], src + bounds[1], src + bounds[2], dst, comp);
+    return;
+  }
+
+  std::vector<size_t> pos(bounds.begin(), bounds.end() - 1);
+  std::vector<T> heads(k);
+  std::vector<char> live(k, 0);
+  for (int r = 0; r < k; r++) {
+    if (pos[r] == bounds[r + 1]) continue;
+    heads[r] = src[pos[r]];
+    live[r] = 1;
+  }
+  LoserTree<T, Compare> tree(k, comp);
+  tree.start(heads, live);
+  while (!tree.empty()) {
+    const int r = tree.top();
+    *dst++ = src[pos[r]++];
+    if (pos[r] < bounds[r + 1]) {
+      tree.replace_top(src[pos[r]]);
+    } else {
+      tree.pop_top();
+    }
+  }
+}
+
+template <typename T, typename Compare = std::less<>>
+std::vector<T> multiway_merge(const std::vector<T>& src, const std::vector<size_t>& bounds, Compare comp = {}) {
+  std::vector<T> dst(src.size());
+  multiway_merge(src.data(), bounds, dst.data(), comp);
+  return dst;
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_MERGE_HPP_
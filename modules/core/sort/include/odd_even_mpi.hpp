@@ -0,0 +1,92 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_ODD_EVEN_MPI_HPP_
+#define MODULES_CORE_SORT_INCLUDE_ODD_EVEN_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/operations.hpp>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "core/sort/include/batcher.hpp"
+#include "core/sort/include/distribute_mpi.hpp"
+
+namespace ppc::core::sort {
+
+// Block odd-even transposition sort over the ranks of world. local_sort(local)
+// sorts each block first (std::sort by default); then the phases alternate
+// between the pairs (0, 1), (2, 3), ... and (1, 2), (3, 4), ..., each pair
+// doing a merge_split() after which both ranks hold as many elements as
+// before. A pair first swaps only its boundary keys and skips the block
+// exchange when those are in order already. After each phase an allreduce
+// tells whether any pair moved anything; once an even and an odd phase in a
+// row moved nothing every neighbour pair is in order and the sort stops. So
+// sorted or nearly sorted input is done after a few phases rather than the
+// size phases equal blocks can take. Ranks with an empty block sit the
+// phases out and their neighbours pair up across them, as merge_split()
+// never changes a count and a key could not cross an empty rank otherwise.
+// On return rank r holds a sorted block and nothing on rank r goes after
+// anything on a later rank. Returns the number of phases run.
+template <typename T, typename Compare = std::less<>, typename LocalSort = detail::StdSort<Compare>>
+int odd_even_sort(const boost::mpi::communicator& world, std::vector<T>& local, Compare comp = {},
+                  LocalSort local_sort = {}) {
+  local_sort(local);
+  const int rank = world.rank();
+
+  // the phases run over the ranks that hold something, in rank order
+  std::vector<int> counts;
+  boost::mpi::all_gather(world, static_cast<int>(local.size()), counts);
+  std::vector<int> holders;
+  for (int r = 0; r < world.size(); r++) {
+    if (counts[r] > 0) holders.push_back(r);
+  }
+  const int size = static_cast<int>(holders.size());
+  if (size <= 1) return 0;
+  const int place = static_cast<int>(std::find(holders.begin(), holders.end(), rank) - holders.begin());
+
+  const int block = *std::max_element(counts.begin(), counts.end());
+  std::vector<T> theirs(block);
+  std::vector<T> scratch;
+  int phase = 0;
+  // consecutive phases in which no pair moved anything
+  int quiet = 0;
+  while (quiet < 2) {
+    const int other = phase % 2 == place % 2 ? place + 1 : place - 1;
+    int moved = 0;
+    if (place < size && other >= 0 && other < size) {
+      const int partner = holders[other];
+      const bool keep_low = rank < partner;
+      // the low side offers its largest key, the high side its smallest
+      const T edge = keep_low ? local.back() : local.front();
+      T their_edge{};
+      MPI_Status status;
+      MPI_Sendrecv(&edge, 1, detail::mpi_type<T>(), partner, 0, &their_edge, 1, detail::mpi_type<T>(), partner, 0, world,
+                   &status);
+      moved = (keep_low ? comp(their_edge, edge) : comp(edge, their_edge)) ? 1 : 0;
+
+      if (moved == 1) {
+        MPI_Sendrecv(local.data(), static_cast<int>(local.size()), detail::mpi_type<T>(), partner, 1, theirs.data(),
+                     block, detail::mpi_type<T>(), partner, 1, world, &status);
+        int count = 0;
+        MPI_Get_count(&status, detail::mpi_type<T>(), &count);
+        // with block set to what the low side has, each side keeps its own count
+        const size_t low_count = keep_low ? local.size() : static_cast<size_t>(count);
+        merge_split(local, theirs.data(), static_cast<size_t>(count), low_count, keep_low, comp, scratch);
+      }
+    }
+    int any_moved = 0;
+    boost::mpi::all_reduce(world, moved, any_moved, boost::mpi::maximum<int>());
+    quiet = any_moved == 1 ? 0 : quiet + 1;
+    phase++;
+  }
+  return phase;
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_ODD_EVEN_MPI_HPP_
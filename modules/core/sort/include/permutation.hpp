@@ -0,0 +1,77 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_PERMUTATION_HPP_
+#define MODULES_CORE_SORT_INCLUDE_PERMUTATION_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::core::sort {
+
+// A key and the position it had in the input. Sorting these with KeyedLess
+// is a stable sort of the keys whose indices, read off afterwards, are the
+// permutation that sorts them.
+template <typename K>
+struct Keyed {
+  K key;
+  long long index;
+};
+
+template <typename T>
+struct is_keyed : std::false_type {};
+
+template <typename K>
+struct is_keyed<Keyed<K>> : std::true_type {};
+
+// Orders by key with comp, then by input position. No two records compare
+// equal, so any sort, stable or not, puts equal keys in input order.
+template <typename Compare = std::less<>>
+struct KeyedLess {
+  Compare comp{};
+
+  template <typename K>
+  bool operator()(const Keyed<K>& a, const Keyed<K>& b) const {
+    if (comp(a.key, b.key)) return true;
+    if (comp(b.key, a.key)) return false;
+    return a.index < b.index;
+  }
+};
+
+// Gathers values into permuted order, values[i] becoming the old
+// values[perm[i]]: each payload moves once, whatever passes produced perm.
+template <typename V, typename Index>
+void apply_permutation(const std::vector<Index>& perm, std::vector<V>& values) {
+  std::vector<V> permuted;
+  permuted.reserve(perm.size());
+  for (const Index i : perm) permuted.push_back(std::move(values[static_cast<size_t>(i)]));
+  values.swap(permuted);
+}
+
+namespace detail {
+
+// Keyed records of keys numbered from first_index on.
+template <typename K>
+std::vector<Keyed<K>> make_keyed(const std::vector<K>& keys, long long first_index) {
+  std::vector<Keyed<K>> records(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) records[i] = {keys[i], first_index + static_cast<long long>(i)};
+  return records;
+}
+
+template <typename K>
+void split_keyed(const std::vector<Keyed<K>>& records, std::vector<K>& keys, std::vector<long long>& origin) {
+  keys.resize(records.size());
+  origin.resize(records.size());
+  for (size_t i = 0; i < records.size(); i++) {
+    keys[i] = records[i].key;
+    origin[i] = records[i].index;
+  }
+}
+
+}  // namespace detail
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_PERMUTATION_HPP_
@@ -0,0 +1,271 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_QUICKSORT_HPP_
+#define MODULES_CORE_SORT_INCLUDE_QUICKSORT_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::sort {
+
+namespace detail {
+
+// Ranges this short are finished by insertion sort.
+constexpr ptrdiff_t kInsertionCutoff = 24;
+// From this size on the pivot is Tukey's ninther instead of a median of three.
+constexpr ptrdiff_t kNintherMin = 128;
+// Ranges this short are not worth a task of their own.
+constexpr ptrdiff_t kTaskCutoff = ptrdiff_t{1} << 14;
+// Per thread; below it the sort runs on one thread, and a range is only
+// partitioned by several threads while each gets at least this much.
+constexpr ptrdiff_t kQuicksortMinPerThread = ptrdiff_t{1} << 15;
+
+inline int quicksort_threads(ptrdiff_t n) {
+#ifdef _OPENMP
+  const ptrdiff_t useful = std::max<ptrdiff_t>(1, n / kQuicksortMinPerThread);
+  return static_cast<int>(std::min<ptrdiff_t>(omp_get_max_threads(), useful));
+#else
+  (void)n;
+  return 1;
+#endif
+}
+
+template <typename T, typename Compare>
+void insertion_sort(T* first, T* last, Compare comp) {
+  if (last - first < 2) return;
+  for (T* i = first + 1; i < last; ++i) {
+    T value = std::move(*i);
+    if (comp(value, *first)) {
+      std::move_backward(first, i, i + 1);
+      *first = std::move(value);
+      continue;
+    }
+    // *first does not go after value, so the scan stops without a bound check
+    T* j = i;
+    for (; comp(value, *(j - 1)); --j) *j = std::move(*(j - 1));
+    *j = std::move(value);
+  }
+}
+
+template <typename T, typename Compare>
+T* median_of_three(T* a, T* b, T* c, Compare comp) {
+  if (comp(*a, *b)) {
+    if (comp(*b, *c)) return b;
+    return comp(*a, *c) ? c : a;
+  }
+  if (comp(*a, *c)) return a;
+  return comp(*b, *c) ? c : b;
+}
+
+// Median of first, middle and last, or for longer ranges the median of the
+// medians of three such triples spread over the range, which keeps sorted,
+// reversed and organ-pipe inputs from choosing bad pivots.
+template <typename T, typename Compare>
+T* choose_pivot(T* first, T* last, Compare comp) {
+  const ptrdiff_t n = last - first;
+  T* mid = first + n / 2;
+  if (n < kNintherMin) return median_of_three(first, mid, last - 1, comp);
+  const ptrdiff_t s = n / 8;
+  return median_of_three(median_of_three(first, first + s, first + 2 * s, comp),
+                         median_of_three(mid - s, mid, mid + s, comp),
+                         median_of_three(last - 1 - 2 * s, last - 1 - s, last - 1, comp), comp);
+}
+
+// Hoare partition of [first + 1, last) around the pivot moved to *first.
+// Both scans stop on keys equal to the pivot, so runs of duplicates split
+// evenly. The pivot was a median of samples from the range, so another
+// sample not less than it stops the left scan and *first stops the right
+// one: neither needs a bound check. Returns cut with [first, cut) not after
+// the pivot and [cut, last) not before it, both non-empty.
+template <typename T, typename Compare>
+T* partition_pivot(T* first, T* last, Compare comp) {
+  std::iter_swap(first, choose_pivot(first, last, comp));
+  T* left = first + 1;
+  T* right = last;
+  while (true) {
+    while (comp(*left, *first)) ++left;
+    --right;
+    while (comp(*first, *right)) --right;
+    if (!(left < right)) return left;
+    std::iter_swap(left, right);
+    ++left;
+  }
+}
+
+// Introsort: quicksort that recurses into the smaller side and loops on the
+// larger, gives up on a range after depth bad splits and heap-sorts it.
+template <typename T, typename Compare>
+void introsort_loop(T* first, T* last, int depth, Compare comp) {
+  while (last - first > kInsertionCutoff) {
+    if (depth-- == 0) {
+      std::make_heap(first, last, comp);
+      std::sort_heap(first, last, comp);
+      return;
+    }
+    T* cut = partition_pivot(first, last, comp);
+    if (cut - first < last - cut) {
+      introsort_loop(first, cut, depth, comp);
+      first = cut;
+    } else {
+      introsort_loop(cut, last, depth, comp);
+      last = cut;
+    }
+  }
+  insertion_sort(first, last, comp);
+}
+
+// introsort_loop() with the smaller side of each split above kTaskCutoff
+// handed to an OpenMP task. Must run inside a parallel region.
+template <typename T, typename Compare>
+void introsort_tasks(T* first, T* last, int depth, Compare comp) {
+  while (last - first > kTaskCutoff) {
+    if (depth-- == 0) {
+      std::make_heap(first, last, comp);
+      std::sort_heap(first, last, comp);
+      return;
+    }
+    T* cut = partition_pivot(first, last, comp);
+    if (cut - first < last - cut) {
+#pragma omp task
+      introsort_tasks(first, cut, depth, comp);
+      first = cut;
+    } else {
+#pragma omp task
+      introsort_tasks(cut, last, depth, comp);
+      last = cut;
+    }
+  }
+  introsort_loop(first, last, depth, comp);
+}
+
+// Half-open [first, second) offsets.
+using Span = std::pair<ptrdiff_t, ptrdiff_t>;
+
+// Swaps the k-th misplaced element of high with the k-th of low for k in
+// [from, to), a contiguous stretch at a time.
+template <typename T>
+void swap_misplaced(T* base, const std::vector<Span>& high, const std::vector<Span>& low, ptrdiff_t from,
+                    ptrdiff_t to) {
+  const auto length = [](const Span& s) { return s.second - s.first; };
+  size_t h = 0;
+  size_t l = 0;
+  ptrdiff_t h_off = from;
+  ptrdiff_t l_off = from;
+  for (; h_off >= length(high[h]); h++) h_off -= length(high[h]);
+  for (; l_off >= length(low[l]); l++) l_off -= length(low[l]);
+  while (from < to) {
+    const ptrdiff_t step = std::min({to - from, length(high[h]) - h_off, length(low[l]) - l_off});
+    T* a = base + high[h].first + h_off;
+    std::swap_ranges(a, a + step, base + low[l].first + l_off);
+    from += step;
+    h_off += step;
+    l_off += step;
+    if (h_off == length(high[h])) {
+      h++;
+      h_off = 0;
+    }
+    if (l_off == length(low[l])) {
+      l++;
+      l_off = 0;
+    }
+  }
+}
+
+// Moves the elements of [first, first + n) that satisfy pred to the front
+// and returns how many there are, using parts tasks. Each task partitions
+// its own chunk; the elements then on the wrong side of the global split
+// are equally many on both sides and are swapped pairwise, again split
+// between parts tasks. Must run inside a parallel region.
+template <typename T, typename Pred>
+ptrdiff_t parallel_partition(T* first, ptrdiff_t n, int parts, Pred pred) {
+  std::vector<ptrdiff_t> split(parts);
+  for (int c = 0; c < parts; c++) {
+#pragma omp task shared(split)
+    split[c] = std::partition(first + n * c / parts, first + n * (c + 1) / parts, pred) - first;
+  }
+#pragma omp taskwait
+
+  ptrdiff_t left = 0;
+  for (int c = 0; c < parts; c++) left += split[c] - n * c / parts;
+  std::vector<Span> high;
+  std::vector<Span> low;
+  ptrdiff_t misplaced = 0;
+  for (int c = 0; c < parts; c++) {
+    const ptrdiff_t begin = n * c / parts;
+    const ptrdiff_t end = n * (c + 1) / parts;
+    if (split[c] < left) {
+      high.emplace_back(split[c], std::min(end, left));
+      misplaced += high.back().second - high.back().first;
+    }
+    if (split[c] > left) low.emplace_back(std::max(begin, left), split[c]);
+  }
+  if (misplaced == 0) return left;
+  for (int c = 0; c < parts; c++) {
+#pragma omp task shared(high, low)
+    swap_misplaced(first, high, low, misplaced * c / parts, misplaced * (c + 1) / parts);
+  }
+#pragma omp taskwait
+  return left;
+}
+
+// The top levels, where a range is long enough for several threads: the
+// partition itself runs on parts threads, first splitting off the keys
+// before the pivot and then, from the rest, those equal to it, which are in
+// place already. The threads are shared out between the two sides by size.
+template <typename T, typename Compare>
+void quicksort_parallel(T* first, T* last, int depth, int parts, Compare comp) {
+  const ptrdiff_t n = last - first;
+  parts = static_cast<int>(std::min<ptrdiff_t>(parts, n / kQuicksortMinPerThread));
+  if (parts < 2 || depth == 0) {
+    introsort_tasks(first, last, depth, comp);
+    return;
+  }
+  const T pivot = *choose_pivot(first, last, comp);
+  const ptrdiff_t less = parallel_partition(first, n, parts, [&](const T& x) { return comp(x, pivot); });
+  const ptrdiff_t equal =
+      parallel_partition(first + less, n - less, parts, [&](const T& x) { return !comp(pivot, x); });
+  const ptrdiff_t greater = n - less - equal;
+  const auto low_parts = static_cast<int>(less + greater > 0 ? parts * less / (less + greater) : 0);
+#pragma omp task
+  quicksort_parallel(first, first + less, depth - 1, low_parts, comp);
+  quicksort_parallel(last - greater, last, depth - 1, parts - low_parts, comp);
+}
+
+}  // namespace detail
+
+// Unstable in-place sort of [first, last). Introsort (ninther pivots, Hoare
+// partitioning, insertion sort below kInsertionCutoff, heap sort after
+// 2 log2(n) levels) that with OpenMP runs the recursion as tasks and
+// partitions the top levels with all threads, so a single rank uses every
+// core it has.
+template <typename T, typename Compare = std::less<>>
+void quicksort(T* first, T* last, Compare comp = {}) {
+  const ptrdiff_t n = last - first;
+  if (n < 2) return;
+  const int depth = 2 * (std::bit_width(static_cast<size_t>(n)) - 1);
+  const int threads = detail::quicksort_threads(n);
+  if (threads == 1) {
+    detail::introsort_loop(first, last, depth, comp);
+    return;
+  }
+#pragma omp parallel num_threads(threads)
+#pragma omp single
+  detail::quicksort_parallel(first, last, depth, threads, comp);
+}
+
+template <typename T, typename Compare = std::less<>>
+void quicksort(std::vector<T>& v, Compare comp = {}) {
+  quicksort(v.data(), v.data() + v.size(), comp);
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_QUICKSORT_HPP_
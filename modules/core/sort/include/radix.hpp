@@ -0,0 +1,325 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_RADIX_HPP_
+#define MODULES_CORE_SORT_INCLUDE_RADIX_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "core/sort/include/permutation.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::sort {
+
+// Order-preserving map from an arithmetic type to an unsigned integer of the
+// same width: unsigned keys as they are, signed keys with the sign bit
+// flipped, IEEE-754 keys with the sign bit flipped when positive and all
+// bits flipped when negative. -0.0 sorts before +0.0 and NaNs go to the ends
+// according to their sign bit.
+template <typename T>
+struct RadixKey {
+  static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "radix keys must be numbers");
+  using Bits = std::conditional_t<
+      sizeof(T) == 8, uint64_t,
+      std::conditional_t<sizeof(T) == 4, uint32_t, std::conditional_t<sizeof(T) == 2, uint16_t, uint8_t>>>;
+  static constexpr int kBits = static_cast<int>(sizeof(Bits) * CHAR_BIT);
+  static constexpr Bits kSign = static_cast<Bits>(Bits{1} << (kBits - 1));
+
+  static Bits encode(T value) {
+    const auto bits = std::bit_cast<Bits>(value);
+    if constexpr (std::is_floating_point_v<T>) {
+      return (bits & kSign) != 0 ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | kSign);
+    } else if constexpr (std::is_signed_v<T>) {
+      return static_cast<Bits>(bits ^ kSign);
+    } else {
+      return bits;
+    }
+  }
+
+  static T decode(Bits bits) {
+    if constexpr (std::is_floating_point_v<T>) {
+      bits = (bits & kSign) != 0 ? static_cast<Bits>(bits & ~kSign) : static_cast<Bits>(~bits);
+    } else if constexpr (std::is_signed_v<T>) {
+      bits = static_cast<Bits>(bits ^ kSign);
+    }
+    return std::bit_cast<T>(bits);
+  }
+};
+
+namespace detail {
+
+// Wider digits mean fewer passes but bigger histograms, which only pay off
+// once the array dwarfs them: 8 bits up to 64K keys, 11 bits up to 2M keys,
+// 16 bits beyond (four passes over doubles instead of eight).
+inline int radix_digit_bits(int key_bits, size_t n) {
+  if (n < (size_t{1} << 16)) return std::min(8, key_bits);
+  if (n < (size_t{1} << 21)) return std::min(11, key_bits);
+  return std::min(16, key_bits);
+}
+
+// Below this many keys per thread the per-pass histogram exchange costs more
+// than the extra threads save.
+constexpr size_t kRadixMinPerThread = size_t{1} << 16;
+
+inline int radix_threads(size_t n) {
+#ifdef _OPENMP
+  const size_t useful = std::max<size_t>(1, n / kRadixMinPerThread);
+  return static_cast<int>(std::min<size_t>(static_cast<size_t>(omp_get_max_threads()), useful));
+#else
+  (void)n;
+  return 1;
+#endif
+}
+
+inline int radix_thread_id() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+// Scatters src[begin, end) into dst by one digit. next[b] is where the next
+// key of bucket b goes and is advanced. Keys are staged per bucket in one
+// cache line and written out a line at a time, so the stores to 2^11
+// scattered places do not each pull a line into the cache; 16-bit digits
+// would need 4 MiB of staging and scatter directly.
+template <typename Bits>
+void radix_scatter(const Bits* src, size_t begin, size_t end, Bits* dst, int shift, Bits mask, size_t* next,
+                   int digit_bits) {
+  constexpr size_t kLine = 64 / sizeof(Bits);
+  if (digit_bits > 11 || end - begin < kLine * (size_t{1} << digit_bits)) {
+    for (size_t i = begin; i < end; i++) {
+      const Bits key = src[i];
+      dst[next[(key >> shift) & mask]++] = key;
+    }
+    return;
+  }
+  const size_t buckets = size_t{1} << digit_bits;
+  std::vector<Bits> line(buckets * kLine);
+  std::vector<uint8_t> fill(buckets, 0);
+  for (size_t i = begin; i < end; i++) {
+    const Bits key = src[i];
+    const size_t b = (key >> shift) & mask;
+    Bits* staged = line.data() + b * kLine;
+    staged[fill[b]++] = key;
+    if (fill[b] == kLine) {
+      std::memcpy(dst + next[b], staged, sizeof(staged[0]) * kLine);
+      next[b] += kLine;
+      fill[b] = 0;
+    }
+  }
+  for (size_t b = 0; b < buckets; b++) {
+    std::memcpy(dst + next[b], line.data() + b * kLine, sizeof(Bits) * fill[b]);
+    next[b] += fill[b];
+  }
+}
+
+// radix_scatter() for keys that carry their input position in src_index
+// along; both go straight to their slots.
+template <typename Bits>
+void radix_scatter_indexed(const Bits* src, const size_t* src_index, size_t begin, size_t end, Bits* dst,
+                           size_t* dst_index, int shift, Bits mask, size_t* next) {
+  for (size_t i = begin; i < end; i++) {
+    const Bits key = src[i];
+    const size_t slot = next[(key >> shift) & mask]++;
+    dst[slot] = key;
+    dst_index[slot] = src_index[i];
+  }
+}
+
+// LSD radix sort of keys[0, n) using buffer[0, n) as scratch; the result
+// ends up in keys. hist holds, per pass, the bucket counts of all keys. With
+// index given, index[i] moves along with keys[i] (index_buffer is its
+// scratch), which leaves the sorting permutation in index.
+template <typename Bits>
+void radix_sort_bits(Bits* keys, Bits* buffer, size_t n, int digit_bits, int threads,
+                     const std::vector<std::vector<size_t>>& hist, size_t* index = nullptr,
+                     size_t* index_buffer = nullptr) {
+  const int passes = static_cast<int>(hist.size());
+  const size_t buckets = size_t{1} << digit_bits;
+  const auto mask = static_cast<Bits>(buckets - 1);
+  Bits* src = keys;
+  Bits* dst = buffer;
+  size_t* src_index = index;
+  size_t* dst_index = index_buffer;
+  // next[t * buckets + b]: where thread t puts its next key of bucket b
+  std::vector<size_t> next(static_cast<size_t>(threads) * buckets);
+
+  for (int pass = 0; pass < passes; pass++) {
+    // every key has the same digit here, the pass would be a plain copy
+    if (std::find(hist[pass].begin(), hist[pass].end(), n) != hist[pass].end()) continue;
+    const int shift = pass * digit_bits;
+    const auto scatter = [&](size_t begin, size_t end, size_t* next_slot) {
+      if (index == nullptr) {
+        radix_scatter(src, begin, end, dst, shift, mask, next_slot, digit_bits);
+      } else {
+        radix_scatter_indexed(src, src_index, begin, end, dst, dst_index, shift, mask, next_slot);
+      }
+    };
+
+    if (threads == 1) {
+      size_t sum = 0;
+      for (size_t b = 0; b < buckets; b++) {
+        next[b] = sum;
+        sum += hist[pass][b];
+      }
+      scatter(0, n, next.data());
+    } else {
+#pragma omp parallel num_threads(threads)
+      {
+        const int t = radix_thread_id();
+        const size_t begin = n * t / threads;
+        const size_t end = n * (t + 1) / threads;
+        size_t* mine = next.data() + static_cast<size_t>(t) * buckets;
+        std::fill(mine, mine + buckets, 0);
+        for (size_t i = begin; i < end; i++) mine[(src[i] >> shift) & mask]++;
+#pragma omp barrier
+#pragma omp single
+        {
+          // bucket-major, thread-minor: thread t's keys of bucket b follow
+          // those of threads 0..t-1, which keeps the sort stable
+          size_t sum = 0;
+          for (size_t b = 0; b < buckets; b++) {
+            for (int u = 0; u < threads; u++) {
+              const size_t count = next[u * buckets + b];
+              next[u * buckets + b] = sum;
+              sum += count;
+            }
+          }
+        }
+        scatter(begin, end, mine);
+      }
+    }
+    std::swap(src, dst);
+    std::swap(src_index, dst_index);
+  }
+  if (src != keys) std::copy(src, src + n, keys);
+  if (src_index != index) std::copy(src_index, src_index + n, index);
+}
+
+// The encoded keys of [first, first + n) and the bucket counts of every
+// pass, built in the same read.
+template <typename T>
+void radix_encode(const T* first, size_t n, int digit_bits, int threads,
+                  std::vector<typename RadixKey<T>::Bits>& keys, std::vector<std::vector<size_t>>& hist) {
+  using Key = RadixKey<T>;
+  using Bits = typename Key::Bits;
+  const int passes = (Key::kBits + digit_bits - 1) / digit_bits;
+  const size_t buckets = size_t{1} << digit_bits;
+  const auto mask = static_cast<Bits>(buckets - 1);
+  keys.resize(n);
+  hist.assign(passes, std::vector<size_t>(buckets, 0));
+  const auto count_all = [&](size_t begin, size_t end, std::vector<std::vector<size_t>>& h) {
+    for (size_t i = begin; i < end; i++) {
+      const Bits key = Key::encode(first[i]);
+      keys[i] = key;
+      for (int p = 0; p < passes; p++) h[p][(key >> (p * digit_bits)) & mask]++;
+    }
+  };
+  if (threads == 1) {
+    count_all(0, n, hist);
+    return;
+  }
+#pragma omp parallel num_threads(threads)
+  {
+    const int t = radix_thread_id();
+    std::vector<std::vector<size_t>> local(passes, std::vector<size_t>(buckets, 0));
+    count_all(n * t / threads, n * (t + 1) / threads, local);
+#pragma omp critical
+    for (int p = 0; p < passes; p++) {
+      for (size_t b = 0; b < buckets; b++) hist[p][b] += local[p][b];
+    }
+  }
+}
+
+template <typename T>
+int radix_pick_digit_bits(int digit_bits, size_t n) {
+  if (digit_bits <= 0) digit_bits = radix_digit_bits(RadixKey<T>::kBits, n);
+  return std::min(digit_bits, RadixKey<T>::kBits);
+}
+
+// Stable sorting permutation of [first, first + n): the keys are encoded
+// and sorted with their positions in tow, and the positions come out in
+// index[0, n). The encoded keys are left sorted in keys.
+template <typename T>
+void radix_permutation(const T* first, size_t n, int digit_bits, std::vector<typename RadixKey<T>::Bits>& keys,
+                       std::vector<size_t>& index) {
+  digit_bits = radix_pick_digit_bits<T>(digit_bits, n);
+  const int threads = radix_threads(n);
+  std::vector<std::vector<size_t>> hist;
+  radix_encode(first, n, digit_bits, threads, keys, hist);
+  std::vector<typename RadixKey<T>::Bits> buffer(n);
+  index.resize(n);
+  std::iota(index.begin(), index.end(), size_t{0});
+  std::vector<size_t> index_buffer(n);
+  radix_sort_bits(keys.data(), buffer.data(), n, digit_bits, threads, hist, index.data(), index_buffer.data());
+}
+
+}  // namespace detail
+
+// Stable LSD radix sort of [first, last) in ascending order. digit_bits of
+// 0 picks the width from the key size and n. Keys are transformed once with
+// RadixKey, the histograms of every pass are built in the same read, passes
+// where all keys share the digit are skipped, and with OpenMP each pass
+// counts and scatters per thread with prefix-summed offsets.
+template <typename T>
+void radix_sort(T* first, T* last, int digit_bits = 0) {
+  using Key = RadixKey<T>;
+  const auto n = static_cast<size_t>(last - first);
+  if (n < 2) return;
+  digit_bits = detail::radix_pick_digit_bits<T>(digit_bits, n);
+  const int threads = detail::radix_threads(n);
+
+  std::vector<typename Key::Bits> keys;
+  std::vector<std::vector<size_t>> hist;
+  detail::radix_encode(first, n, digit_bits, threads, keys, hist);
+  std::vector<typename Key::Bits> buffer(n);
+  detail::radix_sort_bits(keys.data(), buffer.data(), n, digit_bits, threads, hist);
+
+  const auto count = static_cast<long long>(n);
+#pragma omp parallel for num_threads(threads) schedule(static)
+  for (long long i = 0; i < count; i++) first[i] = Key::decode(keys[i]);
+}
+
+template <typename T>
+void radix_sort(std::vector<T>& v, int digit_bits = 0) {
+  radix_sort(v.data(), v.data() + v.size(), digit_bits);
+}
+
+// The permutation that stably sorts [first, last) ascending, leaving the
+// keys where they are: the key that goes i-th is first[perm[i]].
+template <typename T>
+std::vector<size_t> radix_sort_permutation(const T* first, const T* last, int digit_bits = 0) {
+  std::vector<typename RadixKey<T>::Bits> keys;
+  std::vector<size_t> perm;
+  detail::radix_permutation(first, static_cast<size_t>(last - first), digit_bits, keys, perm);
+  return perm;
+}
+
+// Stable radix sort of keys that takes values, one per key, along. Only the
+// keys and their positions go through the passes; each value is moved once
+// at the end with apply_permutation(), however large the payload.
+template <typename T, typename V>
+void radix_sort_by_key(std::vector<T>& keys, std::vector<V>& values, int digit_bits = 0) {
+  using Key = RadixKey<T>;
+  std::vector<typename Key::Bits> sorted;
+  std::vector<size_t> perm;
+  detail::radix_permutation(keys.data(), keys.size(), digit_bits, sorted, perm);
+  for (size_t i = 0; i < keys.size(); i++) keys[i] = Key::decode(sorted[i]);
+  apply_permutation(perm, values);
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_RADIX_HPP_
@@ -0,0 +1,114 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_SAMPLE_SORT_MPI_HPP_
+#define MODULES_CORE_SORT_INCLUDE_SAMPLE_SORT_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "core/sort/include/distribute_mpi.hpp"
+#include "core/sort/include/merge.hpp"
+#include "core/sort/include/permutation.hpp"
+
+namespace ppc::core::sort {
+
+// Regular sampling: every rank offers up to `parts` evenly spaced elements of
+// its sorted block, root sorts the samples and broadcasts parts - 1 evenly
+// spaced splitters. With n / parts^2 or more elements per rank no bucket gets
+// more than about twice its share; heavy runs of one key still land in a
+// single bucket.
+template <typename T, typename Compare = std::less<>>
+std::vector<T> regular_splitters(const boost::mpi::communicator& world, const std::vector<T>& sorted, int parts,
+                                 Compare comp = {}, int root = 0) {
+  const int size = world.size();
+  const int n = static_cast<int>(sorted.size());
+  const int offer = std::min(parts, n);
+  std::vector<T> samples(offer);
+  for (int s = 0; s < offer; s++) samples[s] = sorted[static_cast<size_t>(s) * n / offer];
+
+  std::vector<int> counts(size, 0);
+  boost::mpi::gather(world, offer, counts.data(), root);
+  std::vector<int> displs = detail::displacements(counts);
+  std::vector<T> all_samples(world.rank() == root ? displs[size - 1] + counts[size - 1] : 0);
+  MPI_Gatherv(samples.data(), offer, detail::mpi_type<T>(), all_samples.data(), counts.data(), displs.data(),
+              detail::mpi_type<T>(), root, world);
+
+  std::vector<T> splitters(parts - 1);
+  int have = 0;
+  if (world.rank() == root && !all_samples.empty()) {
+    std::sort(all_samples.begin(), all_samples.end(), comp);
+    const size_t total = all_samples.size();
+    for (int s = 1; s < parts; s++) splitters[s - 1] = all_samples[s * total / parts];
+    have = 1;
+  }
+  boost::mpi::broadcast(world, have, root);
+  if (have == 0) return {};
+  MPI_Bcast(splitters.data(), parts - 1, detail::mpi_type<T>(), root, world);
+  return splitters;
+}
+
+// Distributed sample sort. On entry each rank holds any part of the sequence
+// in local; local_sort(local) must sort a vector in comp order (std::sort by
+// default, tasks pass their own algorithm). On return rank r holds bucket r
+// of the result: sorted, and nothing on rank r goes after anything on rank
+// r + 1. Buckets move with one all-to-all exchange and are merged locally, so
+// no rank ever holds more than its own bucket. Use gather_sorted() when the
+// whole sequence is needed on one rank.
+template <typename T, typename Compare = std::less<>, typename LocalSort = detail::StdSort<Compare>>
+void sample_sort(const boost::mpi::communicator& world, std::vector<T>& local, Compare comp = {},
+                 LocalSort local_sort = {}) {
+  local_sort(local);
+  const int size = world.size();
+  if (size == 1) return;
+
+  const std::vector<T> splitters = regular_splitters(world, local, size, comp);
+  if (splitters.empty()) return;  // every rank is empty
+
+  // the local block is sorted, so bucket r is the range up to splitter r
+  std::vector<int> send_counts(size, 0);
+  auto begin = local.begin();
+  for (int r = 0; r < size; r++) {
+    auto end = r + 1 < size ? std::upper_bound(begin, local.end(), splitters[r], comp) : local.end();
+    send_counts[r] = static_cast<int>(end - begin);
+    begin = end;
+  }
+  std::vector<int> recv_counts(size, 0);
+  boost::mpi::all_to_all(world, send_counts.data(), recv_counts.data());
+
+  const std::vector<int> send_displs = detail::displacements(send_counts);
+  const std::vector<int> recv_displs = detail::displacements(recv_counts);
+  std::vector<T> received(recv_displs[size - 1] + recv_counts[size - 1]);
+  MPI_Alltoallv(local.data(), send_counts.data(), send_displs.data(), detail::mpi_type<T>(), received.data(),
+                recv_counts.data(), recv_displs.data(), detail::mpi_type<T>(), world);
+
+  // one sorted run per source rank
+  std::vector<size_t> bounds(size + 1);
+  for (int r = 0; r <= size; r++) bounds[r] = r < size ? recv_displs[r] : received.size();
+  local.resize(received.size());
+  multiway_merge(received.data(), bounds, local.data(), comp);
+}
+
+// Stable sample_sort() that reports where each key came from, for records
+// whose payload should not travel through the exchange. On return keys
+// holds bucket r as sample_sort() leaves it, equal keys in input order, and
+// origin[i] is the input position of keys[i], counted over all ranks in rank
+// order. The payload then moves once: gather origin with gather_sorted() and
+// apply_permutation() it on root, or send it straight to the owner.
+template <typename K, typename Compare = std::less<>>
+void stable_sample_sort(const boost::mpi::communicator& world, std::vector<K>& keys, std::vector<long long>& origin,
+                        Compare comp = {}) {
+  const KeyedLess<Compare> keyed_comp{comp};
+  std::vector<Keyed<K>> records = detail::make_keyed(keys, detail::global_offset(world, keys.size()));
+  sample_sort(world, records, keyed_comp, [&](std::vector<Keyed<K>>& v) { std::sort(v.begin(), v.end(), keyed_comp); });
+  detail::split_keyed(records, keys, origin);
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_SAMPLE_SORT_MPI_HPP_
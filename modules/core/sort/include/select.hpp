@@ -0,0 +1,159 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_SELECT_HPP_
+#define MODULES_CORE_SORT_INCLUDE_SELECT_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/quicksort.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::sort {
+
+namespace detail {
+
+// Per thread; below it top_k() streams the input on one thread.
+constexpr ptrdiff_t kSelectMinPerThread = ptrdiff_t{1} << 15;
+
+inline int select_threads(ptrdiff_t n) {
+#ifdef _OPENMP
+  const ptrdiff_t useful = std::max<ptrdiff_t>(1, n / kSelectMinPerThread);
+  return static_cast<int>(std::min<ptrdiff_t>(omp_get_max_threads(), useful));
+#else
+  (void)n;
+  return 1;
+#endif
+}
+
+// Introselect: quickselect with the pivots and partition of quicksort(),
+// keeping only the side that holds nth, which gives up after 2 log2(n) bad
+// splits and heap-selects the rest. Leaves [first, last) as
+// std::nth_element() does.
+template <typename T, typename Compare>
+void introselect(T* first, T* nth, T* last, Compare comp) {
+  if (nth >= last) return;
+  int depth = 2 * static_cast<int>(std::bit_width(static_cast<size_t>(last - first)));
+  while (last - first > kInsertionCutoff) {
+    if (depth-- == 0) {
+      std::partial_sort(first, nth + 1, last, comp);
+      return;
+    }
+    T* cut = partition_pivot(first, last, comp);
+    if (nth < cut) {
+      last = cut;
+    } else {
+      first = cut;
+    }
+  }
+  insertion_sort(first, last, comp);
+}
+
+// Puts base[r] in place for every rank r in [rank_first, rank_last), which
+// are ascending, distinct and inside [first, last): selects the middle one
+// and recurses into the two sides, so q ranks cost O(n log q) rather than q
+// passes over the data.
+template <typename T, typename Compare>
+void multiselect(T* base, T* first, T* last, const size_t* rank_first, const size_t* rank_last, Compare comp) {
+  if (rank_first == rank_last) return;
+  const size_t* mid = rank_first + (rank_last - rank_first) / 2;
+  T* nth = base + *mid;
+  introselect(first, nth, last, comp);
+  multiselect(base, first, nth, rank_first, mid, comp);
+  multiselect(base, nth + 1, last, mid + 1, rank_last, comp);
+}
+
+// The k elements of [first, last) that come first in comp order as a heap
+// whose top is the worst of them: a key that does not beat the top costs a
+// single comparison.
+template <typename T, typename Compare>
+std::vector<T> heap_top_k(const T* first, const T* last, size_t k, Compare comp) {
+  std::vector<T> heap;
+  if (k == 0) return heap;
+  heap.reserve(std::min(k, static_cast<size_t>(last - first)));
+  for (const T* it = first; it < last; ++it) {
+    if (heap.size() < k) {
+      heap.push_back(*it);
+      std::push_heap(heap.begin(), heap.end(), comp);
+    } else if (comp(*it, heap.front())) {
+      std::pop_heap(heap.begin(), heap.end(), comp);
+      heap.back() = *it;
+      std::push_heap(heap.begin(), heap.end(), comp);
+    }
+  }
+  return heap;
+}
+
+}  // namespace detail
+
+// Rearranges [first, last) as std::nth_element() does: *nth is the element
+// a sort would put there, nothing before it goes after it and nothing after
+// it before it. Expected linear time, O(n log n) at worst.
+template <typename T, typename Compare = std::less<>>
+void select_nth(T* first, T* nth, T* last, Compare comp = {}) {
+  detail::introselect(first, nth, last, comp);
+}
+
+// Rank of the q-quantile among n > 0 elements: the lower of the two
+// nearest, so q = 0.5 of an even count is the lower median.
+inline size_t quantile_rank(size_t n, double q) {
+  const double clamped = std::clamp(q, 0.0, 1.0);
+  return std::min(n - 1, static_cast<size_t>(clamped * static_cast<double>(n - 1)));
+}
+
+// The q-quantiles of values for every q in qs, in the order of qs, found
+// by selection alone; values is taken by copy and left partially ordered.
+template <typename T, typename Compare = std::less<>>
+std::vector<T> quantiles(std::vector<T> values, const std::vector<double>& qs, Compare comp = {}) {
+  if (values.empty()) return {};
+  std::vector<size_t> ranks;
+  for (double q : qs) ranks.push_back(quantile_rank(values.size(), q));
+  std::vector<size_t> sorted_ranks = ranks;
+  std::sort(sorted_ranks.begin(), sorted_ranks.end());
+  sorted_ranks.erase(std::unique(sorted_ranks.begin(), sorted_ranks.end()), sorted_ranks.end());
+  T* base = values.data();
+  detail::multiselect(base, base, base + values.size(), sorted_ranks.data(), sorted_ranks.data() + sorted_ranks.size(),
+                      comp);
+  std::vector<T> result;
+  result.reserve(ranks.size());
+  for (size_t r : ranks) result.push_back(values[r]);
+  return result;
+}
+
+// The k elements of [first, last) that come first in comp order, best
+// first; std::greater<>() gives the k largest. Each OpenMP thread streams
+// its share of the input through a heap of k candidates and the heaps are
+// merged at the end, so the input is read once and never reordered.
+template <typename T, typename Compare = std::less<>>
+std::vector<T> top_k(const T* first, const T* last, size_t k, Compare comp = {}) {
+  const ptrdiff_t n = last - first;
+  const int threads = detail::select_threads(n);
+  std::vector<std::vector<T>> heaps(threads);
+#pragma omp parallel for num_threads(threads) schedule(static) if (threads > 1)
+  for (int t = 0; t < threads; t++) {
+    heaps[t] = detail::heap_top_k(first + n * t / threads, first + n * (t + 1) / threads, k, comp);
+  }
+  std::vector<T> best = std::move(heaps[0]);
+  if (threads > 1) {
+    for (int t = 1; t < threads; t++) best.insert(best.end(), heaps[t].begin(), heaps[t].end());
+    best = detail::heap_top_k(best.data(), best.data() + best.size(), k, comp);
+  }
+  std::sort_heap(best.begin(), best.end(), comp);
+  return best;
+}
+
+template <typename T, typename Compare = std::less<>>
+std::vector<T> top_k(const std::vector<T>& values, size_t k, Compare comp = {}) {
+  return top_k(values.data(), values.data() + values.size(), k, comp);
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_SELECT_HPP_
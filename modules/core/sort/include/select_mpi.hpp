@@ -0,0 +1,174 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_SELECT_MPI_HPP_
+#define MODULES_CORE_SORT_INCLUDE_SELECT_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+#include "core/sort/include/distribute_mpi.hpp"
+#include "core/sort/include/quicksort.hpp"
+#include "core/sort/include/select.hpp"
+
+namespace ppc::core::sort {
+
+namespace detail {
+
+// Once this few candidates are left on all ranks together they are
+// gathered everywhere and finished by a local select.
+constexpr long long kSelectGatherBelow = 1 << 12;
+// Evenly spaced keys of its candidates a rank picks its pivot offer from.
+constexpr ptrdiff_t kPivotSamples = 63;
+
+// Median of the per-rank offers weighted by how many candidates each rank
+// still holds, from ranks with any.
+template <typename T, typename Compare>
+T weighted_median(const std::vector<T>& offers, const std::vector<long long>& counts, Compare comp) {
+  std::vector<int> ranks;
+  for (int r = 0; r < static_cast<int>(counts.size()); r++) {
+    if (counts[r] > 0) ranks.push_back(r);
+  }
+  std::sort(ranks.begin(), ranks.end(), [&](int a, int b) { return comp(offers[a], offers[b]); });
+  const long long total = std::accumulate(counts.begin(), counts.end(), 0LL);
+  long long seen = 0;
+  for (int r : ranks) {
+    seen += counts[r];
+    if (2 * seen >= total) return offers[r];
+  }
+  return offers[ranks.back()];
+}
+
+// Collectively finds the keys of global ranks [rank_first, rank_last),
+// ascending and distinct, among the candidates [first, last) the ranks
+// hold together, remaining of them, that make up positions offset on of
+// the whole sequence, and stores them to out in the same order. Each round
+// every rank offers the median of a sample of its candidates and the pivot
+// is the median of the offers weighted by the candidate counts. Every rank
+// partitions its candidates around it in place, and one all_reduce of how
+// many keys went before and equal to it settles the ranks that hit the
+// pivot and tells on which side to look for the others. Both sides recurse
+// with their ranks, so q ranks cost about log q passes; the last
+// kSelectGatherBelow candidates are gathered and finished locally.
+template <typename T, typename Compare>
+void select_ranks(const boost::mpi::communicator& world, T* first, T* last, long long remaining, long long offset,
+                  const long long* rank_first, const long long* rank_last, T* out, Compare comp) {
+  if (rank_first == rank_last) return;
+  if (remaining <= kSelectGatherBelow) {
+    const int n = static_cast<int>(last - first);
+    std::vector<int> counts;
+    boost::mpi::all_gather(world, n, counts);
+    const std::vector<int> displs = displacements(counts);
+    std::vector<T> all(static_cast<size_t>(remaining));
+    MPI_Allgatherv(first, n, mpi_type<T>(), all.data(), counts.data(), displs.data(), mpi_type<T>(), world);
+    std::vector<size_t> local_ranks;
+    for (const long long* r = rank_first; r < rank_last; r++) local_ranks.push_back(static_cast<size_t>(*r - offset));
+    multiselect(all.data(), all.data(), all.data() + all.size(), local_ranks.data(),
+                local_ranks.data() + local_ranks.size(), comp);
+    for (size_t i = 0; i < local_ranks.size(); i++) out[i] = all[local_ranks[i]];
+    return;
+  }
+
+  const long long count = last - first;
+  T offer{};
+  if (count > 0) {
+    std::vector<T> sample;
+    const ptrdiff_t samples = std::min<ptrdiff_t>(count, kPivotSamples);
+    for (ptrdiff_t s = 0; s < samples; s++) sample.push_back(first[s * count / samples]);
+    introselect(sample.data(), sample.data() + samples / 2, sample.data() + samples, comp);
+    offer = sample[samples / 2];
+  }
+  std::vector<T> offers(world.size());
+  MPI_Allgather(&offer, 1, mpi_type<T>(), offers.data(), 1, mpi_type<T>(), world);
+  std::vector<long long> counts;
+  boost::mpi::all_gather(world, count, counts);
+  const T pivot = weighted_median(offers, counts, comp);
+
+  T* less_end = std::partition(first, last, [&](const T& x) { return comp(x, pivot); });
+  T* equal_end = std::partition(less_end, last, [&](const T& x) { return !comp(pivot, x); });
+  const long long local_split[2] = {less_end - first, equal_end - less_end};
+  long long split[2] = {0, 0};
+  boost::mpi::all_reduce(world, local_split, 2, split, std::plus<>());
+  const long long equal_from = offset + split[0];
+  const long long greater_from = equal_from + split[1];
+  const long long* equal_ranks = std::lower_bound(rank_first, rank_last, equal_from);
+  const long long* greater_ranks = std::lower_bound(equal_ranks, rank_last, greater_from);
+  std::fill(out + (equal_ranks - rank_first), out + (greater_ranks - rank_first), pivot);
+  select_ranks(world, first, less_end, split[0], offset, rank_first, equal_ranks, out, comp);
+  select_ranks(world, equal_end, last, remaining - split[0] - split[1], greater_from, greater_ranks, rank_last,
+               out + (greater_ranks - rank_first), comp);
+}
+
+}  // namespace detail
+
+// The q-quantiles, in the sense of quantile_rank(), of the nonempty
+// sequence the ranks hold together for every q in qs, in the order of qs,
+// on every rank. A distributed quickselect (see detail::select_ranks())
+// works on a copy of local: no key but a few pivot offers per round
+// crosses the network until only kSelectGatherBelow are left, and nothing
+// is ever sorted or gathered in full.
+template <typename T, typename Compare = std::less<>>
+std::vector<T> quantiles(const boost::mpi::communicator& world, std::vector<T> local, const std::vector<double>& qs,
+                         Compare comp = {}) {
+  long long n = 0;
+  boost::mpi::all_reduce(world, static_cast<long long>(local.size()), n, std::plus<>());
+  if (n == 0) return {};
+  std::vector<long long> ranks;
+  for (double q : qs) ranks.push_back(static_cast<long long>(quantile_rank(static_cast<size_t>(n), q)));
+  std::vector<long long> sorted_ranks = ranks;
+  std::sort(sorted_ranks.begin(), sorted_ranks.end());
+  sorted_ranks.erase(std::unique(sorted_ranks.begin(), sorted_ranks.end()), sorted_ranks.end());
+  std::vector<T> found(sorted_ranks.size());
+  detail::select_ranks(world, local.data(), local.data() + local.size(), n, 0, sorted_ranks.data(),
+                       sorted_ranks.data() + sorted_ranks.size(), found.data(), comp);
+  std::vector<T> result;
+  result.reserve(ranks.size());
+  for (long long r : ranks) {
+    result.push_back(found[std::lower_bound(sorted_ranks.begin(), sorted_ranks.end(), r) - sorted_ranks.begin()]);
+  }
+  return result;
+}
+
+// The element of global rank nth, 0 <= nth < the total size, of the
+// sequence the ranks hold together, on every rank.
+template <typename T, typename Compare = std::less<>>
+T select_nth(const boost::mpi::communicator& world, std::vector<T> local, long long nth, Compare comp = {}) {
+  long long n = 0;
+  boost::mpi::all_reduce(world, static_cast<long long>(local.size()), n, std::plus<>());
+  T found{};
+  detail::select_ranks(world, local.data(), local.data() + local.size(), n, 0, &nth, &nth + 1, &found, comp);
+  return found;
+}
+
+// The k elements of the sequence the ranks hold together that come first
+// in comp order, best first, on root; other ranks get an empty vector.
+// select_nth() finds the k-th, every rank streams its keys against it and
+// only the ones strictly before it, fewer than k, are gathered; the rest of
+// the answer are copies of the k-th.
+template <typename T, typename Compare = std::less<>>
+std::vector<T> top_k(const boost::mpi::communicator& world, const std::vector<T>& local, size_t k, int root = 0,
+                     Compare comp = {}) {
+  long long n = 0;
+  boost::mpi::all_reduce(world, static_cast<long long>(local.size()), n, std::plus<>());
+  k = std::min(k, static_cast<size_t>(n));
+  if (k == 0) return {};
+  const T kth = select_nth(world, local, static_cast<long long>(k) - 1, comp);
+  std::vector<T> before;
+  std::copy_if(local.begin(), local.end(), std::back_inserter(before), [&](const T& x) { return comp(x, kth); });
+  std::vector<T> best = gather_sorted(world, before, root);
+  if (world.rank() != root) return best;
+  quicksort(best, comp);
+  best.resize(k, kth);
+  return best;
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_SELECT_MPI_HPP_
@@ -0,0 +1,159 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SORT_INCLUDE_SHELL_HPP_
+#define MODULES_CORE_SORT_INCLUDE_SHELL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::core::sort {
+
+// Gap sequences for shell_sort(), picked by template argument. gap(k) is the
+// k-th smallest gap; gap(0) is always 1.
+
+// Ciura's experimentally found gaps, continued by a factor of 2.25.
+struct CiuraGaps {
+  static ptrdiff_t gap(int k) {
+    constexpr ptrdiff_t kTable[] = {1, 4, 10, 23, 57, 132, 301, 701};
+    constexpr int kTableSize = static_cast<int>(std::size(kTable));
+    if (k < kTableSize) return kTable[k];
+    ptrdiff_t h = kTable[kTableSize - 1];
+    for (int i = kTableSize - 1; i < k; i++) h = h * 9 / 4;
+    return h;
+  }
+};
+
+// Tokuda's gaps, ceil((9^(k+1) - 4^(k+1)) / (5 * 4^k)): 1, 4, 9, 20, 46, ...
+struct TokudaGaps {
+  static ptrdiff_t gap(int k) {
+    double h = 1.0;
+    for (int i = 0; i < k; i++) h = 2.25 * h + 1.0;
+    return static_cast<ptrdiff_t>(std::ceil(h));
+  }
+};
+
+// Sedgewick's gaps 4^k + 3 * 2^(k-1) + 1 after 1: 1, 8, 23, 77, 281, ...
+struct SedgewickGaps {
+  static ptrdiff_t gap(int k) {
+    if (k == 0) return 1;
+    return (ptrdiff_t{1} << (2 * k)) + 3 * (ptrdiff_t{1} << (k - 1)) + 1;
+  }
+};
+
+namespace detail {
+
+// Tiles of this many elements stay in a core's L2 while the small gaps run
+// over them.
+constexpr ptrdiff_t kShellTile = ptrdiff_t{1} << 15;
+// Gaps below this are small and run tile by tile. Once the array is
+// h-sorted for every larger gap, sorting the tiles on their own leaves only a
+// few keys next to the borders for the last pass to move.
+constexpr ptrdiff_t kShellSmallGap = 128;
+// Per thread; a pass is only split while each thread gets this many chains,
+// two cache lines of ints per row, and the sort stays on one thread below
+// kShellMinPerThread elements each.
+constexpr ptrdiff_t kShellMinChains = 32;
+constexpr ptrdiff_t kShellMinPerThread = ptrdiff_t{1} << 15;
+
+inline int shell_threads(ptrdiff_t n) {
+#ifdef _OPENMP
+  const ptrdiff_t useful = std::max<ptrdiff_t>(1, n / kShellMinPerThread);
+  return static_cast<int>(std::min<ptrdiff_t>(omp_get_max_threads(), useful));
+#else
+  (void)n;
+  return 1;
+#endif
+}
+
+// Gaps of the sequence below n, largest first.
+template <typename Gaps>
+std::vector<ptrdiff_t> shell_gaps(ptrdiff_t n) {
+  std::vector<ptrdiff_t> gaps;
+  for (int k = 0; Gaps::gap(k) < n; k++) gaps.push_back(Gaps::gap(k));
+  std::reverse(gaps.begin(), gaps.end());
+  return gaps;
+}
+
+// Insertion sorts the chains first[c], first[c + h], first[c + 2h], ... for
+// c in [c_begin, c_end). The chains are independent of each other and of the
+// other chains of h. They are walked a row of h elements at a time, so the
+// pass reads the array front to back instead of jumping h elements per step.
+template <typename T, typename Compare>
+void h_sort_chains(T* first, ptrdiff_t n, ptrdiff_t h, ptrdiff_t c_begin, ptrdiff_t c_end, Compare comp) {
+  for (ptrdiff_t row = h; row < n; row += h) {
+    const ptrdiff_t end = std::min(row + c_end, n);
+    for (ptrdiff_t i = row + c_begin; i < end; i++) {
+      if (!comp(first[i], first[i - h])) continue;
+      T value = std::move(first[i]);
+      ptrdiff_t j = i;
+      do {
+        first[j] = std::move(first[j - h]);
+        j -= h;
+      } while (j >= h && comp(value, first[j - h]));
+      first[j] = std::move(value);
+    }
+  }
+}
+
+// One h-sorting pass over [first, first + n), the chains of h shared out
+// between up to threads threads in contiguous ranges.
+template <typename T, typename Compare>
+void h_sort(T* first, ptrdiff_t n, ptrdiff_t h, int threads, Compare comp) {
+  const auto parts = static_cast<int>(std::min<ptrdiff_t>(threads, h / kShellMinChains));
+  if (parts < 2) {
+    h_sort_chains(first, n, h, 0, h, comp);
+    return;
+  }
+#pragma omp parallel for num_threads(parts) schedule(static)
+  for (int p = 0; p < parts; p++) h_sort_chains(first, n, h, h * p / parts, h * (p + 1) / parts, comp);
+}
+
+}  // namespace detail
+
+// Unstable in-place Shell sort of [first, last) with the gaps of Gaps
+// (Ciura's by default). Gaps of kShellSmallGap and up are whole-array
+// passes whose chains are split between the OpenMP threads. The small gaps
+// then run tile by tile, each tile of kShellTile elements sorted on its own
+// in cache and the tiles spread over the threads, and a last insertion pass
+// over the whole array puts right what crosses the tile borders; after the
+// large gaps every key is close to its place, so that pass is about linear.
+template <typename Gaps = CiuraGaps, typename T, typename Compare = std::less<>>
+void shell_sort(T* first, T* last, Compare comp = {}) {
+  const ptrdiff_t n = last - first;
+  if (n < 2) return;
+  const std::vector<ptrdiff_t> gaps = detail::shell_gaps<Gaps>(n);
+  const int threads = detail::shell_threads(n);
+
+  size_t g = 0;
+  if (n > detail::kShellTile) {
+    for (; g < gaps.size() && gaps[g] >= detail::kShellSmallGap; g++) detail::h_sort(first, n, gaps[g], threads, comp);
+  }
+  const ptrdiff_t tiles = (n + detail::kShellTile - 1) / detail::kShellTile;
+#pragma omp parallel for num_threads(threads) schedule(dynamic) if (tiles > 1)
+  for (ptrdiff_t t = 0; t < tiles; t++) {
+    const ptrdiff_t begin = n * t / tiles;
+    const ptrdiff_t end = n * (t + 1) / tiles;
+    for (size_t k = g; k < gaps.size(); k++) {
+      if (gaps[k] < end - begin) detail::h_sort_chains(first + begin, end - begin, gaps[k], 0, gaps[k], comp);
+    }
+  }
+  if (tiles > 1) detail::h_sort_chains(first, n, 1, 0, 1, comp);
+}
+
+template <typename Gaps = CiuraGaps, typename T, typename Compare = std::less<>>
+void shell_sort(std::vector<T>& v, Compare comp = {}) {
+  shell_sort<Gaps>(v.data(), v.data() + v.size(), comp);
+}
+
+}  // namespace ppc::core::sort
+
+#endif  // MODULES_CORE_SORT_INCLUDE_SHELL_HPP_
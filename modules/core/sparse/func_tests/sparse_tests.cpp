@@ -0,0 +1,173 @@
+// Copyright 2023 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/partition.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+std::vector<double> random_sparse_dense(int rows, int cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  std::uniform_int_distribution<int> value(-9, 9);
+  std::vector<double> a(rows * cols, 0.0);
+  for (auto& v : a) {
+    if (coin(gen) < density) v = value(gen);
+  }
+  return a;
+}
+
+std::vector<double> dense_multiply(const std::vector<double>& a, const std::vector<double>& b, int n, int m, int k) {
+  std::vector<double> c(n * k, 0.0);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < k; j++) {
+      for (int l = 0; l < m; l++) c[i * k + j] += a[i * m + l] * b[l * k + j];
+    }
+  }
+  return c;
+}
+
+}  // namespace
+
+TEST(sparse_tests, dense_roundtrip_and_transpose) {
+  auto dense = random_sparse_dense(7, 5, 0.3, 1);
+  auto a = ppc::core::sparse::from_dense(dense.data(), 7, 5);
+  EXPECT_EQ(ppc::core::sparse::to_dense(a.view()), dense);
+
+  auto t = ppc::core::sparse::transpose(a.view());
+  EXPECT_EQ(t.rows, 5);
+  EXPECT_EQ(t.cols, 7);
+  for (int i = 0; i < 7; i++) {
+    for (int j = 0; j < 5; j++) EXPECT_EQ(ppc::core::sparse::to_dense(t.view())[j * 7 + i], dense[i * 5 + j]);
+  }
+  EXPECT_EQ(ppc::core::sparse::transpose(t.view()), a);
+}
+
+TEST(sparse_tests, csr_csc_coo_conversions_agree) {
+  auto dense = random_sparse_dense(6, 9, 0.4, 2);
+  auto a = ppc::core::sparse::from_dense(dense.data(), 6, 9);
+
+  auto csc = ppc::core::sparse::to_csc(a.view());
+  EXPECT_EQ(csc.col_ptr.size(), 10U);
+  EXPECT_EQ(ppc::core::sparse::to_csr(csc.view()), a);
+
+  auto coo = ppc::core::sparse::to_coo(a.view());
+  EXPECT_EQ(coo.nnz(), a.nnz());
+  EXPECT_EQ(ppc::core::sparse::to_csr(coo), a);
+}
+
+TEST(sparse_tests, coo_is_sorted_and_duplicates_summed) {
+  ppc::core::sparse::COO<double> coo;
+  coo.rows = 3;
+  coo.cols = 3;
+  coo.row = {2, 0, 1, 0, 2};
+  coo.col = {0, 2, 1, 2, 2};
+  coo.values = {1.0, 2.0, 3.0, 4.0, 5.0};
+
+  auto a = ppc::core::sparse::to_csr(coo);
+  EXPECT_EQ(a.row_ptr, std::vector<int>({0, 1, 2, 4}));
+  EXPECT_EQ(a.col_idx, std::vector<int>({2, 1, 0, 2}));
+  EXPECT_EQ(a.values, std::vector<double>({6.0, 3.0, 1.0, 5.0}));
+}
+
+TEST(sparse_tests, spgemm_matches_dense_product) {
+  const int n = 40;
+  const int m = 31;
+  const int k = 25;
+  auto da = random_sparse_dense(n, m, 0.1, 3);
+  auto db = random_sparse_dense(m, k, 0.15, 4);
+  auto a = ppc::core::sparse::from_dense(da.data(), n, m);
+  auto b = ppc::core::sparse::from_dense(db.data(), m, k);
+
+  auto c = ppc::core::sparse::multiply(a.view(), b.view());
+  auto expected = dense_multiply(da, db, n, m, k);
+  EXPECT_EQ(c, ppc::core::sparse::from_dense(expected.data(), n, k));
+}
+
+TEST(sparse_tests, spgemm_csc_matches_dense_product) {
+  const int n = 17;
+  const int m = 23;
+  const int k = 11;
+  auto da = random_sparse_dense(n, m, 0.2, 5);
+  auto db = random_sparse_dense(m, k, 0.2, 6);
+  auto a = ppc::core::sparse::to_csc(ppc::core::sparse::from_dense(da.data(), n, m).view());
+  auto b = ppc::core::sparse::to_csc(ppc::core::sparse::from_dense(db.data(), m, k).view());
+
+  auto c = ppc::core::sparse::multiply(a.view(), b.view());
+  auto expected = dense_multiply(da, db, n, m, k);
+  EXPECT_EQ(c.rows, n);
+  EXPECT_EQ(c.cols, k);
+  EXPECT_EQ(c, ppc::core::sparse::to_csc(ppc::core::sparse::from_dense(expected.data(), n, k).view()));
+}
+
+TEST(sparse_tests, spgemm_drops_cancelled_entries_on_request) {
+  // [1 1] * [ 1]   = [0]
+  //         [-1]
+  std::vector<double> da = {1.0, 1.0};
+  std::vector<double> db = {1.0, -1.0};
+  auto a = ppc::core::sparse::from_dense(da.data(), 1, 2);
+  auto b = ppc::core::sparse::from_dense(db.data(), 2, 1);
+
+  EXPECT_EQ(ppc::core::sparse::multiply(a.view(), b.view()).nnz(), 0U);
+  auto structural = ppc::core::sparse::multiply(a.view(), b.view(), false);
+  EXPECT_EQ(structural.nnz(), 1U);
+  EXPECT_EQ(structural.values[0], 0.0);
+}
+
+TEST(sparse_tests, spgemm_works_with_size_t_indices) {
+  auto da = random_sparse_dense(12, 12, 0.25, 7);
+  auto a = ppc::core::sparse::from_dense<double, size_t>(da.data(), 12, 12);
+
+  auto c = ppc::core::sparse::multiply(a.view(), a.view());
+  auto expected = dense_multiply(da, da, 12, 12, 12);
+  EXPECT_EQ(ppc::core::sparse::to_dense(c.view()), expected);
+}
+
+TEST(sparse_tests, spgemm_work_counts_multiply_adds) {
+  // row 0 of A hits rows 0 and 2 of B (1 + 3 entries), row 1 hits nothing
+  std::vector<double> da = {1, 0, 1, 0, 0, 0};
+  std::vector<double> db = {1, 0, 0, 0, 1, 0, 1, 1, 1};
+  auto a = ppc::core::sparse::from_dense(da.data(), 2, 3);
+  auto b = ppc::core::sparse::from_dense(db.data(), 3, 3);
+  EXPECT_EQ(ppc::core::sparse::spgemm_work(a.view(), b.view()), std::vector<size_t>({0, 4, 4}));
+}
+
+TEST(sparse_tests, balanced_blocks_cover_rows_in_order) {
+  std::vector<int> row_ptr = {0, 5, 5, 9, 30, 31, 31, 40};
+  for (int parts = 1; parts <= 10; parts++) {
+    auto bounds = ppc::core::sparse::balanced_row_blocks(row_ptr.data(), 7, parts);
+    ASSERT_EQ(static_cast<int>(bounds.size()), parts + 1);
+    EXPECT_EQ(bounds.front(), 0);
+    EXPECT_EQ(bounds.back(), 7);
+    for (int r = 0; r < parts; r++) EXPECT_LE(bounds[r], bounds[r + 1]);
+  }
+}
+
+TEST(sparse_tests, balanced_blocks_beat_even_split_on_skewed_rows) {
+  // power-law rows: the first rows hold almost all nonzeros
+  const int rows = 1000;
+  std::vector<int> row_ptr(rows + 1, 0);
+  for (int i = 0; i < rows; i++) row_ptr[i + 1] = row_ptr[i] + 2000 / (i + 1);
+
+  const int parts = 4;
+  auto even = ppc::core::sparse::even_row_blocks(rows, parts);
+  auto balanced = ppc::core::sparse::balanced_row_blocks(row_ptr.data(), rows, parts);
+  auto even_stats = ppc::core::sparse::partition_stats(row_ptr.data(), even);
+  auto balanced_stats = ppc::core::sparse::partition_stats(row_ptr.data(), balanced);
+
+  EXPECT_GT(even_stats.imbalance, 2.0);
+  EXPECT_LT(balanced_stats.imbalance, 1.25);
+  EXPECT_DOUBLE_EQ(even_stats.mean_work, balanced_stats.mean_work);
+}
+
+TEST(sparse_tests, partition_stats_of_uniform_rows_is_perfect) {
+  std::vector<int> row_ptr = {0, 2, 4, 6, 8};
+  auto stats = ppc::core::sparse::partition_stats(row_ptr.data(), std::vector<int>({0, 2, 4}));
+  EXPECT_EQ(stats.min_work, 6U);
+  EXPECT_EQ(stats.max_work, 6U);
+  EXPECT_DOUBLE_EQ(stats.imbalance, 1.0);
+}
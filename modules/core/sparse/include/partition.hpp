@@ -0,0 +1,104 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SPARSE_INCLUDE_PARTITION_HPP_
+#define MODULES_CORE_SPARSE_INCLUDE_PARTITION_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core::sparse {
+
+// Row bounds of an even split of rows over parts: part r owns
+// [bounds[r], bounds[r + 1]).
+template <typename I>
+std::vector<I> even_row_blocks(I rows, int parts) {
+  std::vector<I> bounds(parts + 1, 0);
+  const I base = rows / static_cast<I>(parts);
+  const I extra = rows % static_cast<I>(parts);
+  for (int r = 0; r < parts; r++) bounds[r + 1] = bounds[r] + base + (static_cast<I>(r) < extra ? 1 : 0);
+  return bounds;
+}
+
+// Merge-path split of rows into contiguous blocks of equal work. prefix has
+// rows + 1 entries and prefix[i] is the cost of rows [0, i) - row_ptr for
+// nonzeros, spgemm_work() for multiply flops. Walking rows and cost units as
+// one merged sequence of length rows + prefix[rows], part r starts at the
+// first row whose path position reaches r / parts of the total, so a block
+// of empty rows and a block of dense rows cost the same. Rows are never
+// split: a single row heavier than the average share stays one block.
+template <typename W, typename I>
+std::vector<I> balanced_row_blocks(const W* prefix, I rows, int parts) {
+  std::vector<I> bounds(parts + 1, rows);
+  bounds[0] = 0;
+  const size_t total = static_cast<size_t>(rows) + static_cast<size_t>(prefix[rows]);
+  I lo = 0;
+  for (int r = 1; r < parts; r++) {
+    const size_t diagonal = total * r / parts;
+    I hi = rows;
+    while (lo < hi) {
+      const I mid = lo + (hi - lo) / 2;
+      if (static_cast<size_t>(mid) + static_cast<size_t>(prefix[mid]) < diagonal) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    bounds[r] = lo;
+  }
+  return bounds;
+}
+
+// prefix[i] = number of multiply-adds rows [0, i) of A * B cost, i.e. the sum
+// over the nonzeros A(i, k) of the length of row k of B. This is the work the
+// Gustavson kernel does, which is what a product should be balanced on:
+// equal nonzeros of A still differ wildly in cost when B rows are skewed.
+template <typename T, typename I>
+std::vector<size_t> spgemm_work(const CSRView<T, I>& a, const CSRView<T, I>& b) {
+  std::vector<size_t> prefix(static_cast<size_t>(a.rows) + 1, 0);
+  for (I i = 0; i < a.rows; i++) {
+    size_t flops = 0;
+    for (I p = a.row_ptr[i]; p < a.row_ptr[i + 1]; p++) {
+      const I k = a.col_idx[p];
+      flops += static_cast<size_t>(b.row_ptr[k + 1] - b.row_ptr[k]);
+    }
+    prefix[i + 1] = prefix[i] + flops;
+  }
+  return prefix;
+}
+
+struct PartitionStats {
+  size_t min_work = 0;
+  size_t max_work = 0;
+  double mean_work = 0.0;
+  // max_work / mean_work: 1.0 is perfect balance, parts times worse means one
+  // part does everything
+  double imbalance = 1.0;
+};
+
+// Work of every block of bounds, measured the same way balanced_row_blocks()
+// measures it (rows plus cost units).
+template <typename W, typename I>
+PartitionStats partition_stats(const W* prefix, const std::vector<I>& bounds) {
+  PartitionStats stats;
+  const int parts = static_cast<int>(bounds.size()) - 1;
+  if (parts <= 0) return stats;
+  size_t total = 0;
+  stats.min_work = static_cast<size_t>(-1);
+  for (int r = 0; r < parts; r++) {
+    const size_t work = static_cast<size_t>(bounds[r + 1] - bounds[r]) +
+                        static_cast<size_t>(prefix[bounds[r + 1]] - prefix[bounds[r]]);
+    stats.min_work = std::min(stats.min_work, work);
+    stats.max_work = std::max(stats.max_work, work);
+    total += work;
+  }
+  stats.mean_work = static_cast<double>(total) / parts;
+  if (stats.mean_work > 0.0) stats.imbalance = static_cast<double>(stats.max_work) / stats.mean_work;
+  return stats;
+}
+
+}  // namespace ppc::core::sparse
+
+#endif  // MODULES_CORE_SPARSE_INCLUDE_PARTITION_HPP_
@@ -0,0 +1,337 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SPARSE_INCLUDE_SPARSE_HPP_
+#define MODULES_CORE_SPARSE_INCLUDE_SPARSE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ppc::core::sparse {
+
+// Non-owning view of a compressed sparse row matrix. Tasks that keep their
+// own arrays (raw TaskData buffers, differently named vectors, size_t or int
+// indices) wrap them in a view and call the kernels below without copying.
+// Column indices are expected to be sorted inside every row.
+template <typename T, typename I = int>
+struct CSRView {
+  I rows = 0;
+  I cols = 0;
+  const I* row_ptr = nullptr;
+  const I* col_idx = nullptr;
+  const T* values = nullptr;
+
+  [[nodiscard]] I nnz() const { return row_ptr == nullptr ? I(0) : row_ptr[rows]; }
+};
+
+// Compressed sparse column counterpart of CSRView. The CSC arrays of A are
+// exactly the CSR arrays of A^T, which is how the kernels treat it.
+template <typename T, typename I = int>
+struct CSCView {
+  I rows = 0;
+  I cols = 0;
+  const I* col_ptr = nullptr;
+  const I* row_idx = nullptr;
+  const T* values = nullptr;
+
+  [[nodiscard]] I nnz() const { return col_ptr == nullptr ? I(0) : col_ptr[cols]; }
+  [[nodiscard]] CSRView<T, I> transposed() const { return {cols, rows, col_ptr, row_idx, values}; }
+};
+
+template <typename T, typename I = int>
+struct COO {
+  I rows = 0;
+  I cols = 0;
+  std::vector<I> row;
+  std::vector<I> col;
+  std::vector<T> values;
+
+  [[nodiscard]] size_t nnz() const { return values.size(); }
+};
+
+template <typename T, typename I = int>
+struct CSR {
+  I rows = 0;
+  I cols = 0;
+  std::vector<I> row_ptr = std::vector<I>(1, 0);
+  std::vector<I> col_idx;
+  std::vector<T> values;
+
+  [[nodiscard]] size_t nnz() const { return values.size(); }
+  [[nodiscard]] CSRView<T, I> view() const { return {rows, cols, row_ptr.data(), col_idx.data(), values.data()}; }
+
+  bool operator==(const CSR& other) const {
+    return rows == other.rows && cols == other.cols && row_ptr == other.row_ptr && col_idx == other.col_idx &&
+           values == other.values;
+  }
+};
+
+template <typename T, typename I = int>
+struct CSC {
+  I rows = 0;
+  I cols = 0;
+  std::vector<I> col_ptr = std::vector<I>(1, 0);
+  std::vector<I> row_idx;
+  std::vector<T> values;
+
+  [[nodiscard]] size_t nnz() const { return values.size(); }
+  [[nodiscard]] CSCView<T, I> view() const { return {rows, cols, col_ptr.data(), row_idx.data(), values.data()}; }
+
+  bool operator==(const CSC& other) const {
+    return rows == other.rows && cols == other.cols && col_ptr == other.col_ptr && row_idx == other.row_idx &&
+           values == other.values;
+  }
+};
+
+// ---------------------------------------------------------------------------
+// Conversions
+// ---------------------------------------------------------------------------
+
+// Row-major dense rows x cols block to CSR, exact zeros are skipped.
+template <typename T, typename I = int>
+CSR<T, I> from_dense(const T* a, I rows, I cols) {
+  CSR<T, I> m;
+  m.rows = rows;
+  m.cols = cols;
+  m.row_ptr.assign(static_cast<size_t>(rows) + 1, 0);
+  for (I i = 0; i < rows; i++) {
+    for (I j = 0; j < cols; j++) {
+      const T& v = a[static_cast<size_t>(i) * cols + j];
+      if (v == T{}) continue;
+      m.col_idx.push_back(j);
+      m.values.push_back(v);
+    }
+    m.row_ptr[i + 1] = static_cast<I>(m.values.size());
+  }
+  return m;
+}
+
+template <typename T, typename I>
+std::vector<T> to_dense(const CSRView<T, I>& m) {
+  std::vector<T> a(static_cast<size_t>(m.rows) * m.cols, T{});
+  for (I i = 0; i < m.rows; i++) {
+    for (I p = m.row_ptr[i]; p < m.row_ptr[i + 1]; p++) {
+      a[static_cast<size_t>(i) * m.cols + m.col_idx[p]] = m.values[p];
+    }
+  }
+  return a;
+}
+
+// A^T in CSR, i.e. A in CSC. One counting pass over the column indices; rows
+// are visited in order so the output stays sorted without a comparison sort.
+template <typename T, typename I>
+CSR<T, I> transpose(const CSRView<T, I>& m) {
+  CSR<T, I> t;
+  t.rows = m.cols;
+  t.cols = m.rows;
+  const I nnz = m.nnz();
+  t.row_ptr.assign(static_cast<size_t>(m.cols) + 1, 0);
+  t.col_idx.resize(nnz);
+  t.values.resize(nnz);
+  for (I p = 0; p < nnz; p++) t.row_ptr[m.col_idx[p] + 1]++;
+  for (I j = 0; j < m.cols; j++) t.row_ptr[j + 1] += t.row_ptr[j];
+
+  std::vector<I> next(t.row_ptr.begin(), t.row_ptr.end() - 1);
+  for (I i = 0; i < m.rows; i++) {
+    for (I p = m.row_ptr[i]; p < m.row_ptr[i + 1]; p++) {
+      const I dst = next[m.col_idx[p]]++;
+      t.col_idx[dst] = i;
+      t.values[dst] = m.values[p];
+    }
+  }
+  return t;
+}
+
+template <typename T, typename I>
+CSC<T, I> to_csc(const CSRView<T, I>& m) {
+  CSR<T, I> t = transpose(m);
+  return {m.rows, m.cols, std::move(t.row_ptr), std::move(t.col_idx), std::move(t.values)};
+}
+
+template <typename T, typename I>
+CSR<T, I> to_csr(const CSCView<T, I>& m) {
+  return transpose(m.transposed());
+}
+
+template <typename T, typename I>
+COO<T, I> to_coo(const CSRView<T, I>& m) {
+  COO<T, I> c;
+  c.rows = m.rows;
+  c.cols = m.cols;
+  c.row.reserve(m.nnz());
+  for (I i = 0; i < m.rows; i++) {
+    for (I p = m.row_ptr[i]; p < m.row_ptr[i + 1]; p++) c.row.push_back(i);
+  }
+  c.col.assign(m.col_idx, m.col_idx + m.nnz());
+  c.values.assign(m.values, m.values + m.nnz());
+  return c;
+}
+
+// Triplets in any order to CSR. Two stable counting sorts (by column, then by
+// row) give row-major order in O(nnz + rows + cols); duplicates are summed.
+template <typename T, typename I>
+CSR<T, I> to_csr(const COO<T, I>& c) {
+  const size_t nnz = c.nnz();
+  std::vector<I> by_col(nnz);
+  {
+    std::vector<size_t> start(static_cast<size_t>(c.cols) + 1, 0);
+    for (size_t e = 0; e < nnz; e++) start[c.col[e] + 1]++;
+    for (I j = 0; j < c.cols; j++) start[j + 1] += start[j];
+    for (size_t e = 0; e < nnz; e++) by_col[start[c.col[e]]++] = static_cast<I>(e);
+  }
+
+  CSR<T, I> m;
+  m.rows = c.rows;
+  m.cols = c.cols;
+  m.row_ptr.assign(static_cast<size_t>(c.rows) + 1, 0);
+  std::vector<size_t> start(static_cast<size_t>(c.rows) + 1, 0);
+  for (size_t e = 0; e < nnz; e++) start[c.row[e] + 1]++;
+  for (I i = 0; i < c.rows; i++) start[i + 1] += start[i];
+  std::vector<I> order(nnz);
+  for (const I e : by_col) order[start[c.row[e]]++] = e;
+
+  m.col_idx.reserve(nnz);
+  m.values.reserve(nnz);
+  size_t e = 0;
+  for (I i = 0; i < c.rows; i++) {
+    const size_t row_end = start[i];
+    const size_t row_begin = m.values.size();
+    for (; e < row_end; e++) {
+      const I src = order[e];
+      if (m.values.size() > row_begin && m.col_idx.back() == c.col[src]) {
+        m.values.back() += c.values[src];
+      } else {
+        m.col_idx.push_back(c.col[src]);
+        m.values.push_back(c.values[src]);
+      }
+    }
+    m.row_ptr[i + 1] = static_cast<I>(m.values.size());
+  }
+  return m;
+}
+
+// ---------------------------------------------------------------------------
+// SpGEMM
+// ---------------------------------------------------------------------------
+
+// Removes entries that cancelled to exactly zero, in place.
+template <typename T, typename I>
+void drop_zeros(CSR<T, I>& m) {
+  I write = 0;
+  I row_begin = 0;
+  for (I i = 0; i < m.rows; i++) {
+    const I row_end = m.row_ptr[i + 1];
+    for (I p = row_begin; p < row_end; p++) {
+      if (m.values[p] == T{}) continue;
+      m.col_idx[write] = m.col_idx[p];
+      m.values[write] = m.values[p];
+      write++;
+    }
+    row_begin = row_end;
+    m.row_ptr[i + 1] = write;
+  }
+  m.col_idx.resize(write);
+  m.values.resize(write);
+}
+
+// C = A * B by Gustavson's row-by-row algorithm in two phases. The symbolic
+// phase counts the structural nonzeros of every row of C so the output is
+// allocated exactly once; the numeric phase then scatters each row of A times
+// the matching rows of B into a dense accumulator owned by the thread and
+// writes the touched columns straight into their final slots (sorted, or
+// swept off the marker when the row is dense enough for that to be cheaper).
+// Rows are independent, so both phases are parallel over rows with OpenMP and
+// the only per-thread allocations are the two accumulators of length B.cols.
+//
+// Products for a given C(i, j) are summed in increasing k, the same order as
+// the textbook triple loop, so results equal a dense product up to rounding.
+template <typename T, typename I>
+CSR<T, I> multiply(const CSRView<T, I>& a, const CSRView<T, I>& b, bool prune = true) {
+  CSR<T, I> c;
+  c.rows = a.rows;
+  c.cols = b.cols;
+  c.row_ptr.assign(static_cast<size_t>(a.rows) + 1, 0);
+  const long long rows = static_cast<long long>(a.rows);
+
+#pragma omp parallel
+  {
+    // marker[j] == i + 1 <=> column j was already touched by row i
+    std::vector<I> marker(b.cols, 0);
+#pragma omp for schedule(dynamic, 64)
+    for (long long i = 0; i < rows; i++) {
+      const I tag = static_cast<I>(i + 1);
+      I count = 0;
+      for (I p = a.row_ptr[i]; p < a.row_ptr[i + 1]; p++) {
+        const I k = a.col_idx[p];
+        for (I q = b.row_ptr[k]; q < b.row_ptr[k + 1]; q++) {
+          const I j = b.col_idx[q];
+          if (marker[j] != tag) {
+            marker[j] = tag;
+            count++;
+          }
+        }
+        // the row is already full, the remaining products cannot add columns
+        if (count == b.cols) break;
+      }
+      c.row_ptr[i + 1] = count;
+    }
+  }
+
+  for (I i = 0; i < a.rows; i++) c.row_ptr[i + 1] += c.row_ptr[i];
+  c.col_idx.resize(c.row_ptr[a.rows]);
+  c.values.resize(c.row_ptr[a.rows]);
+
+#pragma omp parallel
+  {
+    std::vector<I> marker(b.cols, 0);
+    std::vector<T> acc(b.cols);
+#pragma omp for schedule(dynamic, 64)
+    for (long long i = 0; i < rows; i++) {
+      const I tag = static_cast<I>(i + 1);
+      I* cols = c.col_idx.data() + c.row_ptr[i];
+      I count = 0;
+      for (I p = a.row_ptr[i]; p < a.row_ptr[i + 1]; p++) {
+        const I k = a.col_idx[p];
+        const T& av = a.values[p];
+        for (I q = b.row_ptr[k]; q < b.row_ptr[k + 1]; q++) {
+          const I j = b.col_idx[q];
+          if (marker[j] != tag) {
+            marker[j] = tag;
+            cols[count++] = j;
+            acc[j] = av * b.values[q];
+          } else {
+            acc[j] += av * b.values[q];
+          }
+        }
+      }
+      if (static_cast<size_t>(count) * 16 < static_cast<size_t>(b.cols)) {
+        std::sort(cols, cols + count);
+      } else {
+        // dense-ish row: one sweep over the marker is cheaper than sorting
+        I t = 0;
+        for (I j = 0; j < b.cols; j++) {
+          if (marker[j] == tag) cols[t++] = j;
+        }
+      }
+      T* vals = c.values.data() + c.row_ptr[i];
+      for (I t = 0; t < count; t++) vals[t] = acc[cols[t]];
+    }
+  }
+
+  if (prune) drop_zeros(c);
+  return c;
+}
+
+// C = A * B for CSC operands: C^T = B^T * A^T, and the CSC arrays of a matrix
+// are the CSR arrays of its transpose, so this is the CSR kernel with the
+// operands swapped and no conversion at all.
+template <typename T, typename I>
+CSC<T, I> multiply(const CSCView<T, I>& a, const CSCView<T, I>& b, bool prune = true) {
+  CSR<T, I> ct = multiply(b.transposed(), a.transposed(), prune);
+  return {a.rows, b.cols, std::move(ct.row_ptr), std::move(ct.col_idx), std::move(ct.values)};
+}
+
+}  // namespace ppc::core::sparse
+
+#endif  // MODULES_CORE_SPARSE_INCLUDE_SPARSE_HPP_
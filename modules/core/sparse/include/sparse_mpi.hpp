@@ -0,0 +1,187 @@
+// Copyright 2023 Nesterov Alexander
+
+#ifndef MODULES_CORE_SPARSE_INCLUDE_SPARSE_MPI_HPP_
+#define MODULES_CORE_SPARSE_INCLUDE_SPARSE_MPI_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/partition.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core::sparse {
+
+namespace detail {
+
+// boost::mpi asserts a non-null buffer on root even when every count is zero,
+// which is exactly what an empty std::vector gives back from data().
+template <typename V>
+V* non_null(V* p) {
+  static V dummy{};
+  return p != nullptr ? p : &dummy;
+}
+
+}  // namespace detail
+
+// Hands every rank r its own copy of the rows [bounds[r], bounds[r + 1]) of
+// a, which rank root holds: row_ptr rebased to start at 0, column ids kept.
+// bounds is only read on root.
+template <typename T, typename I>
+CSR<T, I> scatter_rows(const boost::mpi::communicator& world, const CSRView<T, I>& a, const std::vector<I>& bounds,
+                       int root = 0) {
+  const int size = world.size();
+  const int rank = world.rank();
+  I cols = a.cols;
+  boost::mpi::broadcast(world, cols, root);
+
+  // counts of rows and of nonzeros per rank
+  std::vector<int> row_counts(size);
+  std::vector<int> row_displs(size);
+  std::vector<int> nnz_counts(size);
+  std::vector<int> nnz_displs(size);
+  if (rank == root) {
+    for (int r = 0; r < size; r++) {
+      row_displs[r] = static_cast<int>(bounds[r]);
+      row_counts[r] = static_cast<int>(bounds[r + 1] - bounds[r]);
+      nnz_displs[r] = static_cast<int>(a.row_ptr[bounds[r]]);
+      nnz_counts[r] = static_cast<int>(a.row_ptr[bounds[r + 1]] - a.row_ptr[bounds[r]]);
+    }
+  }
+  boost::mpi::broadcast(world, row_counts.data(), size, root);
+  boost::mpi::broadcast(world, nnz_counts.data(), size, root);
+  boost::mpi::broadcast(world, nnz_displs.data(), size, root);
+
+  const int local_rows = row_counts[rank];
+  const int local_nnz = nnz_counts[rank];
+  CSR<T, I> block;
+  block.rows = static_cast<I>(local_rows);
+  block.cols = cols;
+  block.row_ptr.resize(local_rows + 1);
+  block.col_idx.resize(local_nnz);
+  block.values.resize(local_nnz);
+  if (rank == root) {
+    boost::mpi::scatterv(world, a.row_ptr + 1, row_counts, row_displs, block.row_ptr.data() + 1, local_rows, root);
+    boost::mpi::scatterv(world, detail::non_null(a.col_idx), nnz_counts, nnz_displs, block.col_idx.data(), local_nnz,
+                         root);
+    boost::mpi::scatterv(world, detail::non_null(a.values), nnz_counts, nnz_displs, block.values.data(), local_nnz,
+                         root);
+  } else {
+    boost::mpi::scatterv(world, block.row_ptr.data() + 1, local_rows, root);
+    boost::mpi::scatterv(world, block.col_idx.data(), local_nnz, root);
+    boost::mpi::scatterv(world, block.values.data(), local_nnz, root);
+  }
+  // the received row pointers are offsets into the whole of a; rebase them
+  const I offset = static_cast<I>(nnz_displs[rank]);
+  block.row_ptr[0] = 0;
+  for (int i = 1; i <= local_rows; i++) block.row_ptr[i] -= offset;
+  return block;
+}
+
+// Row-block distributed C = A * B. Rank root holds A and B; every rank gets
+// the contiguous rows [bounds[r], bounds[r + 1]) of A (scatter_rows()) and a
+// copy of B, runs the shared-memory Gustavson kernel on its block and the row
+// blocks of C are concatenated on root. bounds is only read on root. The
+// result is returned on root, other ranks get an empty matrix.
+template <typename T, typename I>
+CSR<T, I> multiply(const boost::mpi::communicator& world, const CSRView<T, I>& a, const CSRView<T, I>& b,
+                   const std::vector<I>& bounds, bool prune = true, int root = 0) {
+  const int size = world.size();
+  const int rank = world.rank();
+
+  std::vector<I> dims = {a.rows, a.cols, b.rows, b.cols, b.nnz()};
+  boost::mpi::broadcast(world, dims.data(), static_cast<int>(dims.size()), root);
+
+  // B is needed everywhere: root broadcasts straight from its view
+  std::vector<I> b_row_ptr;
+  std::vector<I> b_col_idx;
+  std::vector<T> b_values;
+  CSRView<T, I> local_b = b;
+  if (rank != root) {
+    b_row_ptr.resize(static_cast<size_t>(dims[2]) + 1);
+    b_col_idx.resize(dims[4]);
+    b_values.resize(dims[4]);
+    local_b = {dims[2], dims[3], b_row_ptr.data(), b_col_idx.data(), b_values.data()};
+  }
+  boost::mpi::broadcast(world, const_cast<I*>(local_b.row_ptr), static_cast<int>(dims[2]) + 1, root);
+  boost::mpi::broadcast(world, const_cast<I*>(local_b.col_idx), static_cast<int>(dims[4]), root);
+  boost::mpi::broadcast(world, const_cast<T*>(local_b.values), static_cast<int>(dims[4]), root);
+
+  const CSR<T, I> block = scatter_rows(world, a, bounds, root);
+  const int local_rows = static_cast<int>(block.rows);
+  std::vector<int> row_counts(size);
+  std::vector<int> row_displs(size);
+  if (rank == root) {
+    for (int r = 0; r < size; r++) {
+      row_displs[r] = static_cast<int>(bounds[r]);
+      row_counts[r] = static_cast<int>(bounds[r + 1] - bounds[r]);
+    }
+  }
+
+  CSR<T, I> local_c = multiply(block.view(), local_b, prune);
+
+  // concatenate the C blocks on root
+  std::vector<int> c_nnz(size);
+  boost::mpi::gather(world, static_cast<int>(local_c.nnz()), c_nnz.data(), root);
+  CSR<T, I> c;
+  if (rank == root) {
+    c.rows = dims[0];
+    c.cols = dims[3];
+    c.row_ptr.assign(static_cast<size_t>(dims[0]) + 1, 0);
+    std::vector<int> c_displs(size, 0);
+    for (int r = 1; r < size; r++) c_displs[r] = c_displs[r - 1] + c_nnz[r - 1];
+    c.col_idx.resize(c_displs[size - 1] + c_nnz[size - 1]);
+    c.values.resize(c.col_idx.size());
+    boost::mpi::gatherv(world, local_c.row_ptr.data() + 1, local_rows, c.row_ptr.data() + 1, row_counts, row_displs,
+                        root);
+    boost::mpi::gatherv(world, local_c.col_idx.data(), c_nnz[rank], detail::non_null(c.col_idx.data()), c_nnz,
+                        c_displs, root);
+    boost::mpi::gatherv(world, local_c.values.data(), c_nnz[rank], detail::non_null(c.values.data()), c_nnz, c_displs,
+                        root);
+    for (int r = 0; r < size; r++) {
+      for (int i = row_displs[r]; i < row_displs[r] + row_counts[r]; i++) c.row_ptr[i + 1] += c_displs[r];
+    }
+  } else {
+    boost::mpi::gatherv(world, local_c.row_ptr.data() + 1, local_rows, root);
+    boost::mpi::gatherv(world, local_c.col_idx.data(), static_cast<int>(local_c.nnz()), root);
+    boost::mpi::gatherv(world, local_c.values.data(), static_cast<int>(local_c.nnz()), root);
+  }
+  return c;
+}
+
+// Row bounds that give every rank the same share of multiply-adds of A * B.
+// Only meaningful on the rank that holds both operands.
+template <typename T, typename I>
+std::vector<I> balanced_product_blocks(const CSRView<T, I>& a, const CSRView<T, I>& b, int parts) {
+  const std::vector<size_t> work = spgemm_work(a, b);
+  return balanced_row_blocks(work.data(), a.rows, parts);
+}
+
+template <typename T, typename I>
+CSR<T, I> multiply(const boost::mpi::communicator& world, const CSRView<T, I>& a, const CSRView<T, I>& b,
+                   bool prune = true, int root = 0) {
+  std::vector<I> bounds;
+  if (world.rank() == root) bounds = balanced_product_blocks(a, b, world.size());
+  return multiply(world, a, b, bounds, prune, root);
+}
+
+// CSC operands: the columns of B (rows of B^T) are distributed. bounds split
+// the columns of B; see balanced_product_blocks(b.transposed(), a.transposed()).
+template <typename T, typename I>
+CSC<T, I> multiply(const boost::mpi::communicator& world, const CSCView<T, I>& a, const CSCView<T, I>& b,
+                   const std::vector<I>& bounds, bool prune = true, int root = 0) {
+  CSR<T, I> ct = multiply(world, b.transposed(), a.transposed(), bounds, prune, root);
+  return {ct.cols, ct.rows, std::move(ct.row_ptr), std::move(ct.col_idx), std::move(ct.values)};
+}
+
+template <typename T, typename I>
+CSC<T, I> multiply(const boost::mpi::communicator& world, const CSCView<T, I>& a, const CSCView<T, I>& b,
+                   bool prune = true, int root = 0) {
+  CSR<T, I> ct = multiply(world, b.transposed(), a.transposed(), prune, root);
+  return {ct.cols, ct.rows, std::move(ct.row_ptr), std::move(ct.col_idx), std::move(ct.values)};
+}
+
+}  // namespace ppc::core::sparse
+
+#endif  // MODULES_CORE_SPARSE_INCLUDE_SPARSE_MPI_HPP_
@@ -18,9 +18,11 @@ if [[ -z "$ASAN_RUN" ]]; then
   if [[ $OSTYPE == "linux-gnu" ]]; then
     mpirun --oversubscribe -np $PROC_COUNT ./build/bin/sample_mpi
     mpirun --oversubscribe -np $PROC_COUNT ./build/bin/sample_mpi_boost
+    mpirun --oversubscribe -np $PROC_COUNT ./build/bin/core_mpi_func_tests
   elif [[ $OSTYPE == "darwin"* ]]; then
     mpirun -np $PROC_COUNT ./build/bin/sample_mpi
     mpirun -np $PROC_COUNT ./build/bin/sample_mpi_boost
+    mpirun -np $PROC_COUNT ./build/bin/core_mpi_func_tests
   fi
 fi
 ./build/bin/sample_omp
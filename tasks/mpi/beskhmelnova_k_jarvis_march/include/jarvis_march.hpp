@@ -8,23 +8,17 @@
 #include <boost/mpi/environment.hpp>
 #include <vector>
 
+#include "core/geometry/include/hull.hpp"
 #include "core/task/include/task.hpp"
 
 namespace beskhmelnova_k_jarvis_march_mpi {
 
+// Strict convex hull of the points, counter-clockwise from the leftmost
+// point (the lowest of those), as coordinate arrays.
 template <typename DataType>
-DataType crossProduct(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                      const std::vector<DataType>& p3);
-
-template <typename DataType>
-bool isLeftAngle(const std::vector<DataType>& p1, const std::vector<DataType>& p2, const std::vector<DataType>& p3);
-
-template <typename DataType>
-void jarvisMarch(int& num_points, std::vector<std::vector<DataType>>& input, std::vector<DataType>& res_x,
+void jarvisMarch(const ppc::core::geometry::PointSet<DataType>& points, std::vector<DataType>& res_x,
                  std::vector<DataType>& res_y);
 
-int localNumPoints(int num_points, int world_size, int rank);
-
 template <typename DataType>
 class TestMPITaskSequential : public ppc::core::Task {
  public:
@@ -36,8 +30,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  int num_points{};
-  std::vector<std::vector<DataType>> input;
+  ppc::core::geometry::PointSet<DataType> input;
   std::vector<DataType> res_x;
   std::vector<DataType> res_y;
 };
@@ -55,15 +48,9 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   boost::mpi::communicator world;
 
-  int num_points{};
-  std::vector<DataType> input_x;
-  std::vector<DataType> input_y;
+  ppc::core::geometry::PointSet<DataType> input;
+  ppc::core::geometry::PointSet<DataType> local_input;
   std::vector<DataType> res_x;
   std::vector<DataType> res_y;
-
-  int local_num_points{};
-  std::vector<DataType> local_input_x;
-  std::vector<DataType> local_input_y;
-  std::vector<std::vector<DataType>> local_input;
 };
 }  // namespace beskhmelnova_k_jarvis_march_mpi
\ No newline at end of file
@@ -1,10 +1,11 @@
 #include "mpi/borisov_s_crs_mul/include/ops_mpi.hpp"
 
 #include <algorithm>
-#include <boost/serialization/vector.hpp>
-#include <functional>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse_mpi.hpp"
+
 using namespace std::chrono_literals;
 
 namespace borisov_s_crs_mul_mpi {
@@ -71,77 +72,18 @@ bool CrsMatrixMulTaskMPI::validation() {
 bool CrsMatrixMulTaskMPI::run() {
   internal_order_test();
 
-  boost::mpi::broadcast(world, A_values_, 0);
-  boost::mpi::broadcast(world, A_col_index_, 0);
-  boost::mpi::broadcast(world, A_row_ptr_, 0);
-  boost::mpi::broadcast(world, B_values_, 0);
-  boost::mpi::broadcast(world, B_col_index_, 0);
-  boost::mpi::broadcast(world, B_row_ptr_, 0);
-  boost::mpi::broadcast(world, C_nrows_, 0);
-  boost::mpi::broadcast(world, C_ncols_, 0);
-
-  int rows_per_process = C_nrows_ / world.size();
-  int start_row = world.rank() * rows_per_process;
-  int end_row = (world.rank() == world.size() - 1) ? C_nrows_ : start_row + rows_per_process;
-
-  std::vector<double> temp(C_ncols_, 0.0);
-  std::vector<double> local_values;
-  std::vector<int> local_col_index;
-  std::vector<int> local_row_ptr(end_row - start_row + 1, 0);
-
-  int local_nnz_count = 0;
-
-  for (int i = start_row; i < end_row; ++i) {
-    std::fill(temp.begin(), temp.end(), 0.0);
-
-    for (int posA = A_row_ptr_[i]; posA < A_row_ptr_[i + 1]; ++posA) {
-      double a_val = A_values_[posA];
-      int a_col = A_col_index_[posA];
-      for (int posB = B_row_ptr_[a_col]; posB < B_row_ptr_[a_col + 1]; ++posB) {
-        int b_col = B_col_index_[posB];
-        double b_val = B_values_[posB];
-        temp[b_col] += a_val * b_val;
-      }
-    }
-
-    local_row_ptr[i - start_row] = local_nnz_count;
-    for (int col = 0; col < C_ncols_; ++col) {
-      if (temp[col] != 0.0) {
-        local_values.push_back(temp[col]);
-        local_col_index.push_back(col);
-        ++local_nnz_count;
-      }
-    }
+  ppc::core::sparse::CSRView<double> a;
+  ppc::core::sparse::CSRView<double> b;
+  if (world.rank() == 0) {
+    a = {A_nrows_, A_ncols_, A_row_ptr_.data(), A_col_index_.data(), A_values_.data()};
+    b = {B_nrows_, B_ncols_, B_row_ptr_.data(), B_col_index_.data(), B_values_.data()};
   }
-
-  local_row_ptr[end_row - start_row] = local_nnz_count;
+  auto c = ppc::core::sparse::multiply(world, a, b);
 
   if (world.rank() == 0) {
-    std::vector<std::vector<double>> all_values(world.size());
-    std::vector<std::vector<int>> all_col_indices(world.size());
-    std::vector<std::vector<int>> all_row_ptrs(world.size());
-
-    boost::mpi::gather(world, local_values, all_values, 0);
-    boost::mpi::gather(world, local_col_index, all_col_indices, 0);
-    boost::mpi::gather(world, local_row_ptr, all_row_ptrs, 0);
-
-    for (int i = 0; i < world.size(); ++i) {
-      C_values_.insert(C_values_.end(), all_values[i].begin(), all_values[i].end());
-      C_col_index_.insert(C_col_index_.end(), all_col_indices[i].begin(), all_col_indices[i].end());
-
-      if (i == 0) {
-        C_row_ptr_ = all_row_ptrs[i];
-      } else {
-        int offset = C_row_ptr_.back();
-        for (size_t j = 1; j < all_row_ptrs[i].size(); ++j) {
-          C_row_ptr_.push_back(all_row_ptrs[i][j] + offset);
-        }
-      }
-    }
-  } else {
-    boost::mpi::gather(world, local_values, 0);
-    boost::mpi::gather(world, local_col_index, 0);
-    boost::mpi::gather(world, local_row_ptr, 0);
+    C_values_ = std::move(c.values);
+    C_col_index_ = std::move(c.col_idx);
+    C_row_ptr_ = std::move(c.row_ptr);
   }
 
   return true;
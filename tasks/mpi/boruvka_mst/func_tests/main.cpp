@@ -0,0 +1,136 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/mst.hpp"
+#include "mpi/boruvka_mst/include/ops_mpi.hpp"
+
+namespace {
+
+using Graph = boruvka_mst_mpi::BoruvkaParallel::SparseGraphCRS;
+
+struct Result {
+  double weight = 0.0;
+  std::vector<int> edges;
+};
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(Graph& graph, double& weight, std::vector<int>& edges) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  boost::mpi::communicator world;
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&graph));
+    taskData->inputs_count.emplace_back(sizeof(Graph));
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(&weight));
+    taskData->outputs_count.emplace_back(1);
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(edges.data()));
+    taskData->outputs_count.emplace_back(edges.size());
+  }
+  return taskData;
+}
+
+// Runs the task, twice over the same split of the graph.
+Result run_task(Graph& graph) {
+  Result result;
+  result.edges.resize(2 * static_cast<size_t>(graph.num_vertices - 1));
+  boruvka_mst_mpi::BoruvkaParallel task(make_task_data(graph, result.weight, result.edges));
+  EXPECT_TRUE(task.validation());
+  EXPECT_TRUE(task.pre_processing());
+  EXPECT_TRUE(task.run());
+  EXPECT_TRUE(task.run());
+  EXPECT_TRUE(task.post_processing());
+  return result;
+}
+
+// The sequential forest, as the task writes it.
+Result expected_forest(const Graph& graph) {
+  const int n = graph.num_vertices;
+  const ppc::core::graph::GraphView<double> view{n, n, graph.row_ptr.data(), graph.col_indices.data(),
+                                                 graph.values.data()};
+  auto forest = ppc::core::graph::boruvka(view);
+  std::sort(forest.edges.begin(), forest.edges.end(), [](const auto& a, const auto& b) {
+    return std::tie(a.source, a.target) < std::tie(b.source, b.target);
+  });
+  Result result{forest.weight, std::vector<int>(2 * static_cast<size_t>(n - 1), -1)};
+  for (size_t i = 0; i < forest.edges.size(); i++) {
+    result.edges[2 * i] = forest.edges[i].source;
+    result.edges[2 * i + 1] = forest.edges[i].target;
+  }
+  return result;
+}
+
+Graph to_graph(const ppc::core::sparse::CSR<double>& csr) { return {csr.rows, csr.row_ptr, csr.col_idx, csr.values}; }
+
+}  // namespace
+
+TEST(boruvka_mst_mpi, small_graph) {
+  boost::mpi::communicator world;
+  // the square 0 1 2 3 with the diagonal 0 - 2, every edge stored both ways
+  Graph graph{4, {0, 3, 5, 8, 10}, {1, 2, 3, 0, 2, 0, 1, 3, 0, 2}, {1, 3, 4, 1, 2, 3, 2, 5, 4, 5}};
+  const auto result = run_task(graph);
+  if (world.rank() == 0) {
+    EXPECT_DOUBLE_EQ(result.weight, 7.0);
+    EXPECT_EQ(result.edges, (std::vector<int>{0, 1, 0, 3, 1, 2}));
+  }
+}
+
+TEST(boruvka_mst_mpi, forest_of_a_disconnected_graph) {
+  boost::mpi::communicator world;
+  // 0 - 1 and 2 - 3 stored one way, 4 alone
+  Graph graph{5, {0, 1, 1, 2, 2, 2}, {1, 3}, {2.5, -1.0}};
+  const auto result = run_task(graph);
+  if (world.rank() == 0) {
+    EXPECT_DOUBLE_EQ(result.weight, 1.5);
+    EXPECT_EQ(result.edges, (std::vector<int>{0, 1, 2, 3, -1, -1, -1, -1}));
+  }
+}
+
+TEST(boruvka_mst_mpi, matches_sequential_on_benchmark_graphs) {
+  boost::mpi::communicator world;
+  // real weights, then three weights only, so that most choices are ties
+  for (double max_weight : {1.0, 3.0}) {
+    const bool ties = max_weight > 1.0;
+    for (const auto& benchmark : ppc::core::graph::benchmark_graphs<double>(11, 6, ties ? 1.0 : 0.0, max_weight, 5)) {
+      auto graph = to_graph(benchmark.csr());
+      if (ties) {
+        for (auto& w : graph.values) w = static_cast<int>(w);
+      }
+      const auto result = run_task(graph);
+      if (world.rank() == 0) {
+        const auto expected = expected_forest(graph);
+        EXPECT_NEAR(result.weight, expected.weight, 1e-9 * benchmark.vertices) << benchmark.name;
+        EXPECT_EQ(result.edges, expected.edges) << benchmark.name;
+      }
+    }
+  }
+}
+
+TEST(boruvka_mst_mpi, fewer_vertices_than_ranks) {
+  boost::mpi::communicator world;
+  Graph graph{2, {0, 1, 2}, {1, 0}, {0.5, 0.5}};
+  const auto result = run_task(graph);
+  if (world.rank() == 0) {
+    EXPECT_DOUBLE_EQ(result.weight, 0.5);
+    EXPECT_EQ(result.edges, (std::vector<int>{0, 1}));
+  }
+}
+
+TEST(boruvka_mst_mpi, validation_rejects_bad_graphs) {
+  boost::mpi::communicator world;
+  double weight = 0.0;
+  std::vector<int> edges(2);
+  Graph stray{2, {0, 1, 1}, {2}, {1.0}};
+  boruvka_mst_mpi::BoruvkaParallel stray_head(make_task_data(stray, weight, edges));
+  EXPECT_EQ(stray_head.validation(), world.rank() != 0);
+
+  Graph graph{2, {0, 1, 1}, {1}, {1.0}};
+  std::vector<int> small(1);
+  boruvka_mst_mpi::BoruvkaParallel no_room(make_task_data(graph, weight, small));
+  EXPECT_EQ(no_room.validation(), world.rank() != 0);
+}
@@ -0,0 +1,42 @@
+// Copyright 2024 Nesterov Alexander
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/mst.hpp"
+#include "core/graph/include/session_mpi.hpp"
+#include "core/task/include/task.hpp"
+
+namespace boruvka_mst_mpi {
+
+// Minimum spanning forest of an undirected graph by Boruvka's algorithm
+// over all ranks, with the task data of boruvka_mst_seq on rank 0. The
+// graph is split by rows once, in pre_processing(); each round of run()
+// then agrees on the lightest edge of every component in three
+// all_reduces, and the edges left between components are redistributed
+// over the ranks by pair of components, where parallel ones collapse.
+class BoruvkaParallel : public ppc::core::Task {
+ public:
+  explicit BoruvkaParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  struct SparseGraphCRS {
+    int num_vertices;
+    std::vector<int> row_ptr;
+    std::vector<int> col_indices;
+    std::vector<double> values;
+  };
+
+ private:
+  boost::mpi::communicator world;
+  ppc::core::graph::GraphSession<double> session_{world};
+  ppc::core::graph::SpanningForest<double> forest_;
+};
+
+}  // namespace boruvka_mst_mpi
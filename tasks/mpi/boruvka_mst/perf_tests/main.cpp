@@ -0,0 +1,109 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/timer.hpp>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/mst.hpp"
+#include "core/perf/include/perf.hpp"
+#include "mpi/boruvka_mst/include/ops_mpi.hpp"
+
+namespace {
+
+using Graph = boruvka_mst_mpi::BoruvkaParallel::SparseGraphCRS;
+
+Graph to_graph(const ppc::core::sparse::CSR<double>& csr) { return {csr.rows, csr.row_ptr, csr.col_idx, csr.values}; }
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(Graph& graph, double& weight, std::vector<int>& edges) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  boost::mpi::communicator world;
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&graph));
+    taskData->inputs_count.emplace_back(sizeof(Graph));
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(&weight));
+    taskData->outputs_count.emplace_back(1);
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(edges.data()));
+    taskData->outputs_count.emplace_back(edges.size());
+  }
+  return taskData;
+}
+
+template <typename Run>
+void run_perf(Run run) {
+  boost::mpi::communicator world;
+  // the R-MAT graph of the benchmarks, 2^17 vertices, built on rank 0 only
+  Graph graph{0, {}, {}, {}};
+  double weight = 0.0;
+  std::vector<int> edges;
+  if (world.rank() == 0) {
+    graph = to_graph(ppc::core::graph::benchmark_graphs<double>(17, 8, 0.0, 1.0, 2024)[0].csr());
+    edges.resize(2 * static_cast<size_t>(graph.num_vertices - 1));
+  }
+
+  auto task = std::make_shared<boruvka_mst_mpi::BoruvkaParallel>(make_task_data(graph, weight, edges));
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  run(*perfAnalyzer, perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    const ppc::core::graph::GraphView<double> view{graph.num_vertices, graph.num_vertices, graph.row_ptr.data(),
+                                                   graph.col_indices.data(), graph.values.data()};
+    EXPECT_NEAR(weight, ppc::core::graph::boruvka(view).weight, 1e-6);
+  }
+}
+
+}  // namespace
+
+TEST(boruvka_mst_mpi_perf_test, test_pipeline_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.pipeline_run(attr, results); });
+}
+
+TEST(boruvka_mst_mpi_perf_test, test_task_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.task_run(attr, results); });
+}
+
+TEST(boruvka_mst_mpi_perf_test, test_benchmark_graphs) {
+  boost::mpi::communicator world;
+  // every benchmark topology at 2^16 vertices, checked against the
+  // sequential forest and reported in edges per second
+  for (const auto& benchmark : ppc::core::graph::benchmark_graphs<double>(16, 8, 0.0, 1.0, 2024)) {
+    auto graph = to_graph(benchmark.csr());
+    double weight = 0.0;
+    std::vector<int> edges(2 * static_cast<size_t>(graph.num_vertices - 1));
+    boruvka_mst_mpi::BoruvkaParallel task(make_task_data(graph, weight, edges));
+    ASSERT_TRUE(task.validation());
+    ASSERT_TRUE(task.pre_processing());
+    world.barrier();
+    const boost::mpi::timer timer;
+    ASSERT_TRUE(task.run());
+    const double seconds = timer.elapsed();
+    ASSERT_TRUE(task.post_processing());
+    if (world.rank() == 0) {
+      const ppc::core::graph::GraphView<double> view{graph.num_vertices, graph.num_vertices, graph.row_ptr.data(),
+                                                     graph.col_indices.data(), graph.values.data()};
+      const auto expected = ppc::core::graph::boruvka(view);
+      EXPECT_NEAR(weight, expected.weight, 1e-6) << benchmark.name;
+      EXPECT_EQ(static_cast<size_t>(std::count(edges.begin(), edges.end(), -1)),
+                edges.size() - 2 * expected.edges.size())
+          << benchmark.name;
+      ppc::core::graph::print_teps(std::cout, "boruvka_mst_mpi", benchmark.name,
+                                   static_cast<long long>(benchmark.edges.size()), seconds);
+    }
+  }
+}
@@ -0,0 +1,59 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/boruvka_mst/include/ops_mpi.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+#include "core/graph/include/loader.hpp"
+#include "core/graph/include/mst_mpi.hpp"
+
+bool boruvka_mst_mpi::BoruvkaParallel::pre_processing() {
+  internal_order_test();
+  ppc::core::graph::GraphView<double> whole{0, 0, nullptr, nullptr, nullptr};
+  if (world.rank() == 0) {
+    const auto* graph = reinterpret_cast<const SparseGraphCRS*>(taskData->inputs[0]);
+    const int n = graph->num_vertices;
+    whole = {n, n, graph->row_ptr.data(), graph->col_indices.data(), graph->values.data()};
+  }
+  session_.scatter(whole, 0);
+  return true;
+}
+
+bool boruvka_mst_mpi::BoruvkaParallel::validation() {
+  internal_order_test();
+  if (world.rank() != 0) return true;
+  if (taskData->inputs.size() != 1 || taskData->inputs[0] == nullptr || taskData->outputs.size() != 2 ||
+      taskData->outputs_count.size() != 2) {
+    return false;
+  }
+  const auto* graph = reinterpret_cast<const SparseGraphCRS*>(taskData->inputs[0]);
+  const int n = graph->num_vertices;
+  return n > 0 && graph->row_ptr.size() == static_cast<size_t>(n) + 1 &&
+         graph->values.size() == graph->col_indices.size() &&
+         ppc::core::graph::well_formed(n, graph->row_ptr.data(), graph->col_indices.data(),
+                                       graph->col_indices.size()) &&
+         taskData->outputs_count[0] == 1 && taskData->outputs_count[1] == 2 * static_cast<size_t>(n - 1);
+}
+
+bool boruvka_mst_mpi::BoruvkaParallel::run() {
+  internal_order_test();
+  forest_ = ppc::core::graph::boruvka(world, session_.local(), session_.bounds());
+  return true;
+}
+
+bool boruvka_mst_mpi::BoruvkaParallel::post_processing() {
+  internal_order_test();
+  if (world.rank() != 0) return true;
+  auto& edges = forest_.edges;
+  std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) {
+    return std::tie(a.source, a.target) < std::tie(b.source, b.target);
+  });
+  *reinterpret_cast<double*>(taskData->outputs[0]) = forest_.weight;
+  auto* out = reinterpret_cast<int*>(taskData->outputs[1]);
+  std::fill(out, out + taskData->outputs_count[1], -1);
+  for (const auto& e : edges) {
+    *out++ = e.source;
+    *out++ = e.target;
+  }
+  return true;
+}
@@ -10,6 +10,8 @@
 #include <thread>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+
 bool budazhapova_e_matrix_mult_mpi::MatrixMultSequential::pre_processing() {
   internal_order_test();
   A = std::vector<int>(reinterpret_cast<int*>(taskData->inputs[0]),
@@ -30,12 +32,7 @@ bool budazhapova_e_matrix_mult_mpi::MatrixMultSequential::validation() {
 
 bool budazhapova_e_matrix_mult_mpi::MatrixMultSequential::run() {
   internal_order_test();
-  for (int i = 0; i < rows; i++) {
-    res[i] = 0;
-    for (int j = 0; j < columns; j++) {
-      res[i] += A[j + columns * i] * b[j];
-    }
-  }
+  ppc::core::linalg::gemv(rows, columns, A.data(), columns, b.data(), res.data());
   return true;
 }
 
@@ -135,12 +132,8 @@ bool budazhapova_e_matrix_mult_mpi::MatrixMultParallel::run() {
     }
   }
 
-  for (size_t i = 0; i < local_res.size(); i++) {
-    local_res[i] = 0;
-    for (int j = 0; j < columns; j++) {
-      local_res[i] += local_A[i * columns + j] * b[j];
-    }
-  }
+  ppc::core::linalg::gemv(static_cast<int>(local_res.size()), columns, local_A.data(), columns, b.data(),
+                          local_res.data());
   res.resize(rows);
   boost::mpi::gatherv(world, local_res.data(), local_res.size(), res.data(), recv_counts, displacements, 0);
   return true;
@@ -17,8 +17,6 @@ class TestMPITaskParallel : public ppc::core::Task {
   explicit TestMPITaskParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {
     data_size = (world.rank() == 0) ? taskData->inputs_count[0] : 0;
   }
-  bool bubble_sort();
-  bool chunk_merge_sort(int neighbor_rank, std::vector<int>& chunk_sizes);
   bool pre_processing() override;
   bool validation() override;
   bool run() override;
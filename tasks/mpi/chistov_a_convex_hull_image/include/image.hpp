@@ -11,14 +11,11 @@
 #include <utility>
 #include <vector>
 
+#include "core/image/include/runs.hpp"
 #include "core/task/include/task.hpp"
 
 namespace chistov_a_convex_hull_image_mpi {
 
-struct Point {
-  int x, y;
-};
-
 class ConvexHullMPI : public ppc::core::Task {
  public:
   explicit ConvexHullMPI(std::shared_ptr<ppc::core::TaskData> taskData) : Task(std::move(taskData)) {}
@@ -30,7 +27,7 @@ class ConvexHullMPI : public ppc::core::Task {
 
  private:
   std::vector<int> image;
-  std::vector<std::vector<Point>> components;
+  std::vector<ppc::core::geometry::PointSet<int>> components;
   int width{};
   int height{};
   int size{};
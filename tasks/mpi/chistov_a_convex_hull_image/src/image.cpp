@@ -1,13 +1,14 @@
 #include "mpi/chistov_a_convex_hull_image/include/image.hpp"
 
 #include <algorithm>
+#include <boost/serialization/vector.hpp>
 #include <functional>
 #include <string>
 #include <thread>
 #include <vector>
 
 namespace chistov_a_convex_hull_image_mpi {
-std::vector<int> setPoints(const std::vector<Point>& points, int width, int height) {
+std::vector<int> setPoints(const std::vector<ppc::core::geometry::Point<int>>& points, int width, int height) {
   std::vector<int> image(width * height, 0);
   if (points.size() < 2) return image;
 
@@ -44,102 +45,14 @@ std::vector<int> setPoints(const std::vector<Point>& points, int width, int heig
   return image;
 }
 
-int cross(const Point& p1, const Point& p2, const Point& p3) {
-  return (p2.x - p1.x) * (p3.y - p1.y) - (p2.y - p1.y) * (p3.x - p1.x);
-}
-
-void labelingFirstPass(std::vector<int>& labeled_image, int width, int height) {
-  int mark = 2;
-
-  for (int i = 0; i < height; ++i) {
-    for (int j = 0; j < width; ++j) {
-      int current = labeled_image[i * width + j];
-      int left = (j == 0) ? 0 : labeled_image[i * width + (j - 1)];
-      int upper = (i == 0) ? 0 : labeled_image[(i - 1) * width + j];
-
-      if (current == 0) continue;
-
-      if (left == 0 && upper == 0) {
-        labeled_image[i * width + j] = mark++;
-      } else {
-        labeled_image[i * width + j] = std::max(left, upper);
-      }
-    }
-  }
-}
-
-void labelingSecondPass(std::vector<int>& labeled_image, int width, int height) {
-  for (int i = height - 1; i >= 0; --i) {
-    for (int j = width - 1; j >= 0; --j) {
-      int current = labeled_image[i * width + j];
-      int right = (j == width - 1) ? 0 : labeled_image[i * width + (j + 1)];
-      int lower = (i == height - 1) ? 0 : labeled_image[(i + 1) * width + j];
-
-      if (current == 0 || (right == 0 && lower == 0)) continue;
-
-      labeled_image[i * width + j] = std::max(right, lower);
-    }
-  }
-}
-
-std::vector<std::vector<Point>> processLabeledImage(const std::vector<int>& labeled_image, int width, int height) {
-  std::vector<int> component_indices;
-  std::vector<std::vector<Point>> components;
-
-  for (int i = 0; i < height; i++) {
-    for (int j = 0; j < width; j++) {
-      if (labeled_image[i * width + j] == 0) continue;
-
-      int component_label = labeled_image[i * width + j];
-
-      if (static_cast<size_t>(component_label) < component_indices.size() && component_indices[component_label] != -1) {
-        components[component_indices[component_label]].push_back(Point{j, i});
-      } else {
-        component_indices.resize(std::max(component_indices.size(), static_cast<size_t>(component_label + 1)), -1);
-        component_indices[component_label] = components.size();
-        components.push_back({Point{j, i}});
-      }
-    }
-  }
-  return components;
-}
-
-std::vector<std::vector<Point>> labeling(const std::vector<int>& image, int width, int height) {
-  std::vector<int> labeled_image(width * height);
-
-  std::copy(image.begin(), image.end(), labeled_image.begin());
-  labelingFirstPass(labeled_image, width, height);
-  labelingSecondPass(labeled_image, width, height);
-  return processLabeledImage(labeled_image, width, height);
-}
-
-std::vector<Point> graham(std::vector<Point> points) {
-  std::vector<Point> hull;
-
-  if (points.empty()) {
-    return hull;
-  }
-
-  Point min = *std::min_element(points.begin(), points.end(),
-                                [](const Point& a, const Point& b) { return a.x == b.x ? a.y < b.y : a.x < b.x; });
-
-  std::sort(points.begin(), points.end(), [min](const Point& p1, const Point& p2) {
-    if (cross(min, p1, p2) != 0) return cross(min, p1, p2) > 0;
-
-    return (p1.x - min.x) * (p1.x - min.x) + (p1.y - min.y) * (p1.y - min.y) <
-           (p2.x - min.x) * (p2.x - min.x) + (p2.y - min.y) * (p2.y - min.y);
-  });
-
-  hull.push_back(min);
-
-  for (size_t i = 1; i < points.size(); ++i) {
-    while (hull.size() > 1 && cross(hull[hull.size() - 2], hull[hull.size() - 1], points[i]) <= 0) {
-      hull.pop_back();
-    }
-    hull.push_back(points[i]);
-  }
-
-  return hull;
+// Hull candidates of every 4-connected component: the image is run-length
+// encoded and labeled by runs, and each component only keeps the two end
+// pixels of each of its rows.
+std::vector<ppc::core::geometry::PointSet<int>> labeling(const std::vector<int>& image, int width, int height) {
+  const auto runs = ppc::core::image::encode_runs(image.data(), height, width, [](int pixel) { return pixel == 1; });
+  std::vector<int> labels;
+  const int count = ppc::core::image::label_runs(runs, ppc::core::image::Connectivity::kFour, labels);
+  return ppc::core::image::row_extremes(runs, labels, count);
 }
 
 bool ConvexHullMPI::validation() {
@@ -175,82 +88,43 @@ bool ConvexHullMPI::pre_processing() {
 bool ConvexHullMPI::run() {
   internal_order_test();
 
-  std::vector<std::vector<Point>> local_components;
-
-  auto toVector = [](const std::vector<Point>& points) -> std::vector<int> {
-    std::vector<int> result;
-    result.reserve(points.size() * 2);
-    for (const auto& point : points) {
-      result.push_back(point.x);
-      result.push_back(point.y);
-    }
-    return result;
-  };
-
-  auto toPoints = [](const std::vector<int>& vec) -> std::vector<Point> {
-    std::vector<Point> points;
-    points.reserve(vec.size() / 2);
-    for (size_t i = 0; i < vec.size(); i += 2) {
-      points.push_back({vec[i], vec[i + 1]});
-    }
-    return points;
-  };
-
+  // each rank gets a block of components as their candidates, every one
+  // flattened to its size followed by x0, y0, x1, y1, ...
+  std::vector<std::vector<int>> parts;
   if (world.rank() == 0) {
-    int base_count = components.size() / world.size();
-    int remainder = components.size() % world.size();
-
-    int offset = 0;
-    for (int proc = 1; proc < world.size(); ++proc) {
-      int send_count = base_count + (proc < remainder ? 1 : 0);
-      world.send(proc, 0, &send_count, 1);
-
-      for (int i = 0; i < send_count; ++i) {
-        std::vector<int> int_component = toVector(components[offset + i]);
-        world.send(proc, 1, int_component);
+    parts.resize(world.size());
+    const int base_count = static_cast<int>(components.size()) / world.size();
+    const int remainder = static_cast<int>(components.size()) % world.size();
+    size_t next = 0;
+    for (int proc = 0; proc < world.size(); ++proc) {
+      for (int i = 0; i < base_count + (proc < remainder ? 1 : 0); ++i) {
+        const auto& component = components[next++];
+        parts[proc].push_back(static_cast<int>(component.size()));
+        for (size_t k = 0; k < component.size(); ++k) {
+          parts[proc].insert(parts[proc].end(), {component.x[k], component.y[k]});
+        }
       }
-
-      offset += send_count;
-    }
-
-    int local_count = base_count + (0 < remainder ? 1 : 0);
-    for (int i = 0; i < local_count; ++i) {
-      local_components.push_back(components[offset + i]);
-    }
-
-  } else {
-    int recv_count;
-    world.recv(0, 0, &recv_count, 1);
-
-    for (int i = 0; i < recv_count; ++i) {
-      std::vector<int> int_component;
-      world.recv(0, 1, int_component);
-      local_components.push_back(toPoints(int_component));
     }
   }
-
-  std::vector<Point> local_hulls;
-  for (const auto& component : local_components) {
-    auto hull = graham(component);
-    local_hulls.insert(local_hulls.end(), hull.begin(), hull.end());
+  std::vector<int> local;
+  boost::mpi::scatter(world, parts, local, 0);
+
+  std::vector<int> local_hulls;
+  for (size_t i = 0; i < local.size();) {
+    const auto count = static_cast<size_t>(local[i++]);
+    const auto hull = ppc::core::geometry::convex_hull(ppc::core::geometry::from_interleaved(local.data() + i, count));
+    for (const auto& point : hull) local_hulls.insert(local_hulls.end(), {point.x, point.y});
+    i += 2 * count;
   }
 
+  std::vector<std::vector<int>> hulls;
+  boost::mpi::gather(world, local_hulls, hulls, 0);
   if (world.rank() == 0) {
-    std::vector<Point> merged_hulls;
-    merged_hulls.insert(merged_hulls.end(), local_hulls.begin(), local_hulls.end());
-
-    for (int proc = 1; proc < world.size(); ++proc) {
-      std::vector<int> hull_ints;
-      world.recv(proc, 2, hull_ints);
-      auto hull = toPoints(hull_ints);
-      merged_hulls.insert(merged_hulls.end(), hull.begin(), hull.end());
+    ppc::core::geometry::PointSet<int> merged;
+    for (const auto& hull : hulls) {
+      for (size_t i = 0; i < hull.size(); i += 2) merged.push_back(hull[i], hull[i + 1]);
     }
-
-    image = setPoints(graham(merged_hulls), width, height);
-
-  } else {
-    std::vector<int> local_hulls_ints = toVector(local_hulls);
-    world.send(0, 2, local_hulls_ints);
+    image = setPoints(ppc::core::geometry::convex_hull(merged), width, height);
   }
 
   return true;
@@ -15,7 +15,6 @@
 namespace ermilova_d_Shell_sort_simple_merge_mpi {
 
 std::vector<int> ShellSort(std::vector<int> &vec, const std::function<bool(int, int)> &comp);
-std::vector<int> merge(std::vector<int> &vec1, std::vector<int> &vec2, const std::function<bool(int, int)> &comp);
 
 class TestMPITaskSequential : public ppc::core::Task {
  public:
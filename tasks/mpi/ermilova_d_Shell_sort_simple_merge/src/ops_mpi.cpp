@@ -7,6 +7,8 @@
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/sample_sort_mpi.hpp"
+
 std::vector<int> ermilova_d_Shell_sort_simple_merge_mpi::ShellSort(std::vector<int>& vec,
                                                                    const std::function<bool(int, int)>& comp) {
   size_t n = vec.size();
@@ -23,14 +25,6 @@ std::vector<int> ermilova_d_Shell_sort_simple_merge_mpi::ShellSort(std::vector<i
   return vec;
 }
 
-std::vector<int> ermilova_d_Shell_sort_simple_merge_mpi::merge(std::vector<int>& vec1, std::vector<int>& vec2,
-                                                               const std::function<bool(int, int)>& comp) {
-  std::vector<int> result;
-  std::merge(vec1.begin(), vec1.end(), vec2.begin(), vec2.end(), std::back_inserter(result), comp);
-
-  return result;
-}
-
 bool ermilova_d_Shell_sort_simple_merge_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
   is_descending = *reinterpret_cast<bool*>(taskData->inputs[1]);
@@ -85,55 +79,19 @@ bool ermilova_d_Shell_sort_simple_merge_mpi::TestMPITaskParallel::validation() {
 
 bool ermilova_d_Shell_sort_simple_merge_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  int rank = world.rank();
-  int delta = 0;
-  int extra = 0;
-  int size = input_.size();
-  broadcast(world, size, 0);
   broadcast(world, is_descending, 0);
+  local_input_ = ppc::core::sort::scatter_even(world, input_, 0);
 
-  std::vector<int> sizes_vec;
-
-  delta = size / world.size();
-  extra = size % world.size();
-
-  if (world.rank() == 0) {
-    sizes_vec.resize(world.size(), delta);
-    for (int i = 0; i < extra; i++) {
-      sizes_vec[i] += 1;
-    }
-  }
-
-  local_input_.resize(delta + (rank < extra ? 1 : 0));
-  if (world.rank() == 0) {
-    scatterv(world, input_, sizes_vec, local_input_.data(), 0);
-  } else {
-    scatterv(world, local_input_.data(), local_input_.size(), 0);
-  }
+  // ShellSort(v, std::less()) orders descending, so the bucket order is the
+  // opposite comparator
   if (is_descending) {
-    local_input_ = ShellSort(local_input_, std::less());
+    ppc::core::sort::sample_sort(world, local_input_, std::greater<>(),
+                                 [](std::vector<int>& v) { ShellSort(v, std::less()); });
   } else {
-    local_input_ = ShellSort(local_input_, std::greater());
-  }
-
-  std::vector<std::vector<int>> sorted_inputs;
-
-  gather(world, local_input_, sorted_inputs, 0);
-
-  if (world.rank() == 0) {
-    std::vector<int> merge_vec;
-    if (is_descending) {
-      for (int i = 0; i < world.size(); i++) {
-        merge_vec = ermilova_d_Shell_sort_simple_merge_mpi::merge(merge_vec, sorted_inputs[i], std::greater());
-      }
-    } else {
-      for (int i = 0; i < world.size(); i++) {
-        merge_vec = ermilova_d_Shell_sort_simple_merge_mpi::merge(merge_vec, sorted_inputs[i], std::less());
-      }
-    }
-
-    res = merge_vec;
+    ppc::core::sort::sample_sort(world, local_input_, std::less<>(),
+                                 [](std::vector<int>& v) { ShellSort(v, std::greater()); });
   }
+  res = ppc::core::sort::gather_sorted(world, local_input_, 0);
 
   return true;
 }
@@ -0,0 +1,122 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mpi/external_merge_sort/include/ops_mpi.hpp"
+
+namespace {
+
+std::string temp_path(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / ("external_merge_sort_mpi_" + name)).string();
+}
+
+void write_ints(const std::string& path, const std::vector<int>& data) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+}
+
+std::vector<int> read_ints(const std::string& path) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  std::vector<int> data(static_cast<size_t>(in.tellg()) / sizeof(int));
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+  return data;
+}
+
+std::vector<int> random_ints(size_t n, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  std::vector<int> v(n);
+  for (auto& x : v) x = dist(gen);
+  return v;
+}
+
+// Runs the task with the input file written by rank 0 and returns what
+// run() returned; on success rank 0 checks the output file.
+bool run_task(std::vector<int> data, size_t memory_budget, bool write_input = true) {
+  boost::mpi::communicator world;
+  std::string input = temp_path("in");
+  std::string output = temp_path("out");
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    if (write_input) write_ints(input, data);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+    taskDataPar->inputs_count.emplace_back(input.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&memory_budget));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+    taskDataPar->outputs_count.emplace_back(output.size());
+  }
+  // the other ranks map the input in run()
+  world.barrier();
+
+  external_merge_sort_mpi::ExternalSortParallel task(taskDataPar);
+  EXPECT_TRUE(task.validation());
+  task.pre_processing();
+  const bool ok = task.run();
+  task.post_processing();
+
+  if (world.rank() == 0) {
+    if (ok) {
+      std::sort(data.begin(), data.end());
+      EXPECT_EQ(read_ints(output), data);
+    }
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+  }
+  world.barrier();
+  return ok;
+}
+
+}  // namespace
+
+TEST(external_merge_sort_mpi, sorts_random_file_in_many_runs) {
+  EXPECT_TRUE(run_task(random_ints(50000, 1000000, 1), 1024));
+}
+
+TEST(external_merge_sort_mpi, sorts_when_budget_holds_whole_file) {
+  EXPECT_TRUE(run_task(random_ints(1000, 1000000, 2), 1 << 20));
+}
+
+TEST(external_merge_sort_mpi, sorts_duplicates_and_reversed_input) {
+  EXPECT_TRUE(run_task(random_ints(20000, 5, 3), 512));
+  EXPECT_TRUE(run_task(std::vector<int>(5000, 7), 256));
+  std::vector<int> reversed(10000);
+  for (size_t i = 0; i < reversed.size(); i++) reversed[i] = static_cast<int>(reversed.size() - i);
+  EXPECT_TRUE(run_task(reversed, 4096));
+}
+
+TEST(external_merge_sort_mpi, sorts_files_smaller_than_world) {
+  EXPECT_TRUE(run_task({}, 1024));
+  EXPECT_TRUE(run_task({42}, 1024));
+  EXPECT_TRUE(run_task({3, 1, 2}, 4));
+}
+
+TEST(external_merge_sort_mpi, fails_on_every_rank_on_missing_input) { EXPECT_FALSE(run_task({1, 2}, 1024, false)); }
+
+TEST(external_merge_sort_mpi, validation_rejects_small_budget) {
+  boost::mpi::communicator world;
+  std::string input = temp_path("in");
+  std::string output = temp_path("out");
+  size_t memory_budget = 2;
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+    taskDataPar->inputs_count.emplace_back(input.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&memory_budget));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+    taskDataPar->outputs_count.emplace_back(output.size());
+    external_merge_sort_mpi::ExternalSortParallel task(taskDataPar);
+    EXPECT_FALSE(task.validation());
+  }
+}
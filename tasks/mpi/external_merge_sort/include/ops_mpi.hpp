@@ -0,0 +1,32 @@
+// Copyright 2024 Nesterov Alexander
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "core/task/include/task.hpp"
+
+namespace external_merge_sort_mpi {
+
+// Sorts a file of ints that need not fit in memory across all ranks, which
+// must see the same file system. The task data on rank 0 is laid out as for
+// external_merge_sort_seq: inputs[0] the input path, inputs[1] a size_t
+// memory budget in bytes per rank, outputs[0] the output path.
+class ExternalSortParallel : public ppc::core::Task {
+ public:
+  explicit ExternalSortParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  std::string input_path_, output_path_;
+  size_t memory_budget_{};
+  boost::mpi::communicator world;
+};
+
+}  // namespace external_merge_sort_mpi
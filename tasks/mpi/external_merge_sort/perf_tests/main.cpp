@@ -0,0 +1,96 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/timer.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "mpi/external_merge_sort/include/ops_mpi.hpp"
+
+namespace {
+
+const size_t kCount = 1 << 22;
+const size_t kMemoryBudget = 1 << 20;
+
+std::string temp_path(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / ("external_merge_sort_mpi_perf_" + name)).string();
+}
+
+std::vector<int> write_random_ints(const std::string& path, size_t n) {
+  std::mt19937 gen(1);
+  std::vector<int> data(n);
+  for (auto& x : data) x = static_cast<int>(gen());
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+  return data;
+}
+
+std::vector<int> read_ints(const std::string& path) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  std::vector<int> data(static_cast<size_t>(in.tellg()) / sizeof(int));
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+  return data;
+}
+
+template <typename Run>
+void run_perf(Run run) {
+  boost::mpi::communicator world;
+  std::string input = temp_path("in");
+  std::string output = temp_path("out");
+  size_t memory_budget = kMemoryBudget;
+  std::vector<int> expected;
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    expected = write_random_ints(input, kCount);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+    taskDataPar->inputs_count.emplace_back(input.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&memory_budget));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+    taskDataPar->outputs_count.emplace_back(output.size());
+  }
+  world.barrier();
+
+  auto task = std::make_shared<external_merge_sort_mpi::ExternalSortParallel>(taskDataPar);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 5;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  run(*perfAnalyzer, perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(read_ints(output), expected);
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+  }
+}
+
+}  // namespace
+
+TEST(external_merge_sort_mpi_perf_test, test_pipeline_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.pipeline_run(attr, results); });
+}
+
+TEST(external_merge_sort_mpi_perf_test, test_task_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.task_run(attr, results); });
+}
@@ -0,0 +1,41 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/external_merge_sort/include/ops_mpi.hpp"
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/serialization/string.hpp>
+
+#include "core/sort/include/external_mpi.hpp"
+
+bool external_merge_sort_mpi::ExternalSortParallel::pre_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    input_path_.assign(reinterpret_cast<const char*>(taskData->inputs[0]), taskData->inputs_count[0]);
+    memory_budget_ = *reinterpret_cast<const size_t*>(taskData->inputs[1]);
+    output_path_.assign(reinterpret_cast<const char*>(taskData->outputs[0]), taskData->outputs_count[0]);
+  }
+  return true;
+}
+
+bool external_merge_sort_mpi::ExternalSortParallel::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    return taskData->inputs.size() == 2 && taskData->inputs_count.size() == 2 && taskData->inputs_count[0] > 0 &&
+           taskData->inputs_count[1] == 1 && taskData->outputs.size() == 1 && taskData->outputs_count.size() == 1 &&
+           taskData->outputs_count[0] > 0 && *reinterpret_cast<const size_t*>(taskData->inputs[1]) >= sizeof(int);
+  }
+  return true;
+}
+
+bool external_merge_sort_mpi::ExternalSortParallel::run() {
+  internal_order_test();
+  boost::mpi::broadcast(world, input_path_, 0);
+  boost::mpi::broadcast(world, output_path_, 0);
+  boost::mpi::broadcast(world, memory_budget_, 0);
+  return ppc::core::sort::external_sort<int>(world, input_path_, output_path_, memory_budget_);
+}
+
+bool external_merge_sort_mpi::ExternalSortParallel::post_processing() {
+  internal_order_test();
+  // the sorted ints are already in the output file
+  return true;
+}
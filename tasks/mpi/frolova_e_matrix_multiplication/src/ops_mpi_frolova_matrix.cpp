@@ -8,21 +8,13 @@
 #include <thread>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+
 std::vector<int> frolova_e_matrix_multiplication_mpi::Multiplication(size_t M, size_t N, size_t K,
                                                                      const std::vector<int>& A,
                                                                      const std::vector<int>& B) {
   std::vector<int> C(M * N);
-
-  for (size_t i = 0; i < M; ++i) {
-    for (size_t j = 0; j < N; ++j) {
-      C[i * N + j] = 0;
-
-      for (size_t k = 0; k < K; ++k) {
-        C[i * N + j] += A[i * K + k] * B[k * N + j];
-      }
-    }
-  }
-
+  ppc::core::linalg::gemm(static_cast<int>(M), static_cast<int>(N), static_cast<int>(K), A.data(), B.data(), C.data());
   return C;
 }
 
@@ -161,23 +153,16 @@ void frolova_e_matrix_multiplication_mpi::multiplyAndPlace(lineStruc& line, cons
   if (line.res_lines.size() != line.numberOfLines * line.outgoingLineLength) {
     line.res_lines.resize(line.numberOfLines * line.outgoingLineLength, 0);
   }
-  for (size_t i = 0; i < line.numberOfLines; ++i) {
-    for (size_t j = 0; j < column.numberOfColumns; ++j) {
-      int sum = 0;
-
-      for (size_t k = 0; k < line.enterLineslenght; ++k) {
-        size_t lineIndex = i * line.enterLineslenght + k;
-        size_t columnIndex = j * line.enterLineslenght + k;
-
-        sum += line.local_lines[lineIndex] * column.local_columns[columnIndex];
-      }
-
-      size_t globalCol = column.index_colums[j];
-      size_t localPos = i * line.outgoingLineLength + globalCol;
-
-      line.res_lines[localPos] = sum;
-    }
+  if (column.numberOfColumns == 0) {
+    return;
   }
+  // columns arrive stored column by column (B^T rows) and cover a contiguous
+  // range of the result starting at index_colums[0]
+  const auto k = static_cast<int>(line.enterLineslenght);
+  ppc::core::linalg::gemm(ppc::core::linalg::Op::kNone, ppc::core::linalg::Op::kTranspose,
+                          static_cast<int>(line.numberOfLines), static_cast<int>(column.numberOfColumns), k,
+                          line.local_lines.data(), k, column.local_columns.data(), k,
+                          line.res_lines.data() + column.index_colums[0], static_cast<int>(line.outgoingLineLength));
 }
 
 bool frolova_e_matrix_multiplication_mpi::matrixMultiplicationParallel::run() {
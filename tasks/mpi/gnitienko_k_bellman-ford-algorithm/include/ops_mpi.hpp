@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/session_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace gnitienko_k_bellman_ford_algorithm_mpi {
@@ -45,18 +46,15 @@ class BellmanFordAlgMPI : public ppc::core::Task {
 
  private:
   size_t V{};
-  size_t values_size{};
-  size_t columns_size{};
-  size_t row_ptr_size{};
   std::vector<int> values;
   std::vector<int> columns;
   std::vector<int> row_ptr;
   std::vector<int> shortest_paths;
   boost::mpi::communicator world;
+  // the rows of this rank's vertices, split off once in pre_processing
+  ppc::core::graph::GraphSession<int> session{world};
   const int INF = std::numeric_limits<int>::max();
 
-  bool Iteration(std::vector<int>& paths);
-  bool check_negative_cycle();
   void toCRS(const int* input_matrix);
 };
 
@@ -0,0 +1,105 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/coloring.hpp"
+#include "mpi/graph_coloring/include/ops_mpi.hpp"
+
+namespace {
+
+using Graph = graph_coloring_mpi::ColoringParallel::SparseGraphCRS;
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(Graph& graph, std::vector<int>& colors) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  boost::mpi::communicator world;
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&graph));
+    taskData->inputs_count.emplace_back(sizeof(Graph));
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(colors.data()));
+    taskData->outputs_count.emplace_back(colors.size());
+  }
+  return taskData;
+}
+
+// Runs the task, twice over the same split of the graph.
+std::vector<int> run_task(Graph& graph) {
+  std::vector<int> colors(graph.num_vertices, -2);
+  graph_coloring_mpi::ColoringParallel task(make_task_data(graph, colors));
+  EXPECT_TRUE(task.validation());
+  EXPECT_TRUE(task.pre_processing());
+  EXPECT_TRUE(task.run());
+  EXPECT_TRUE(task.run());
+  EXPECT_TRUE(task.post_processing());
+  return colors;
+}
+
+ppc::core::graph::GraphView<double> view_of(const Graph& graph) {
+  return {graph.num_vertices, graph.num_vertices, graph.row_ptr.data(), graph.col_indices.data(),
+          graph.values.data()};
+}
+
+Graph to_graph(const ppc::core::sparse::CSR<double>& csr) { return {csr.rows, csr.row_ptr, csr.col_idx, csr.values}; }
+
+}  // namespace
+
+TEST(graph_coloring_mpi, triangle_with_a_tail) {
+  boost::mpi::communicator world;
+  // the triangle 0 1 2 and the path 2 - 3 - 4, every edge stored both ways
+  Graph graph{5, {0, 2, 4, 7, 9, 10}, {1, 2, 0, 2, 0, 1, 3, 2, 4, 3}, {}};
+  const auto colors = run_task(graph);
+  if (world.rank() == 0) {
+    EXPECT_TRUE(ppc::core::graph::proper_coloring(view_of(graph), colors));
+    EXPECT_EQ(colors, ppc::core::graph::jones_plassmann(view_of(graph), graph_coloring_mpi::ColoringParallel::kSeed));
+  }
+}
+
+TEST(graph_coloring_mpi, matches_sequential_on_benchmark_graphs) {
+  boost::mpi::communicator world;
+  for (const auto& benchmark : ppc::core::graph::benchmark_graphs<double>(11, 6, 1.0, 1.0, 17)) {
+    auto graph = to_graph(benchmark.csr());
+    const auto colors = run_task(graph);
+    if (world.rank() == 0) {
+      EXPECT_TRUE(ppc::core::graph::proper_coloring(view_of(graph), colors)) << benchmark.name;
+      EXPECT_EQ(colors, ppc::core::graph::jones_plassmann(view_of(graph), graph_coloring_mpi::ColoringParallel::kSeed))
+          << benchmark.name;
+    }
+  }
+}
+
+TEST(graph_coloring_mpi, fewer_vertices_than_ranks) {
+  boost::mpi::communicator world;
+  Graph graph{2, {0, 1, 2}, {1, 0}, {1.0, 1.0}};
+  const auto colors = run_task(graph);
+  if (world.rank() == 0) {
+    EXPECT_TRUE(ppc::core::graph::proper_coloring(view_of(graph), colors));
+    EXPECT_EQ(std::count(colors.begin(), colors.end(), 0), 1);
+  }
+}
+
+TEST(graph_coloring_mpi, validation_rejects_bad_graphs) {
+  boost::mpi::communicator world;
+  std::vector<int> colors(2);
+  Graph stray{2, {0, 1, 1}, {2}, {}};
+  graph_coloring_mpi::ColoringParallel stray_head(make_task_data(stray, colors));
+  EXPECT_EQ(stray_head.validation(), world.rank() != 0);
+
+  Graph graph{2, {0, 1, 2}, {1, 0}, {}};
+  std::vector<int> small(1);
+  graph_coloring_mpi::ColoringParallel no_room(make_task_data(graph, small));
+  EXPECT_EQ(no_room.validation(), world.rank() != 0);
+}
+
+TEST(graph_coloring_mpi, validation_rejects_one_way_edges) {
+  boost::mpi::communicator world;
+  // 0 -> 1 without 1 -> 0: the owner of 1 would never send its color
+  std::vector<int> colors(2);
+  Graph one_way{2, {0, 1, 1}, {1}, {1.0}};
+  graph_coloring_mpi::ColoringParallel task(make_task_data(one_way, colors));
+  EXPECT_EQ(task.validation(), world.rank() != 0);
+}
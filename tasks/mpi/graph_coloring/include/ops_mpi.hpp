@@ -0,0 +1,44 @@
+// Copyright 2024 Nesterov Alexander
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/session_mpi.hpp"
+#include "core/task/include/task.hpp"
+
+namespace graph_coloring_mpi {
+
+// Jones-Plassmann coloring over all ranks, with the task data of
+// graph_coloring_seq on rank 0 and the same colors as it gives. The graph is
+// split by rows once, in pre_processing(); each round of run() colors the
+// ready vertices of every rank and sends only the colors of boundary
+// vertices, to the ranks that hold their neighbours.
+class ColoringParallel : public ppc::core::Task {
+ public:
+  explicit ColoringParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  struct SparseGraphCRS {
+    int num_vertices;
+    std::vector<int> row_ptr;
+    std::vector<int> col_indices;
+    std::vector<double> values;
+  };
+
+  static constexpr std::uint64_t kSeed = 1;
+
+ private:
+  boost::mpi::communicator world;
+  ppc::core::graph::GraphSession<double> session_{world};
+  std::vector<double> no_values_;
+  std::vector<int> colors_;
+};
+
+}  // namespace graph_coloring_mpi
@@ -0,0 +1,102 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/timer.hpp>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/coloring.hpp"
+#include "core/perf/include/perf.hpp"
+#include "mpi/graph_coloring/include/ops_mpi.hpp"
+
+namespace {
+
+using Graph = graph_coloring_mpi::ColoringParallel::SparseGraphCRS;
+
+Graph to_graph(const ppc::core::sparse::CSR<double>& csr) { return {csr.rows, csr.row_ptr, csr.col_idx, csr.values}; }
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(Graph& graph, std::vector<int>& colors) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  boost::mpi::communicator world;
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&graph));
+    taskData->inputs_count.emplace_back(sizeof(Graph));
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(colors.data()));
+    taskData->outputs_count.emplace_back(colors.size());
+  }
+  return taskData;
+}
+
+ppc::core::graph::GraphView<double> view_of(const Graph& graph) {
+  return {graph.num_vertices, graph.num_vertices, graph.row_ptr.data(), graph.col_indices.data(),
+          graph.values.data()};
+}
+
+template <typename Run>
+void run_perf(Run run) {
+  boost::mpi::communicator world;
+  // the R-MAT graph of the benchmarks, 2^17 vertices, built on rank 0 only
+  Graph graph{0, {}, {}, {}};
+  std::vector<int> colors;
+  if (world.rank() == 0) {
+    graph = to_graph(ppc::core::graph::benchmark_graphs<double>(17, 8, 1.0, 1.0, 2024)[0].csr());
+    colors.resize(graph.num_vertices);
+  }
+
+  auto task = std::make_shared<graph_coloring_mpi::ColoringParallel>(make_task_data(graph, colors));
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  run(*perfAnalyzer, perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    EXPECT_TRUE(ppc::core::graph::proper_coloring(view_of(graph), colors));
+  }
+}
+
+}  // namespace
+
+TEST(graph_coloring_mpi_perf_test, test_pipeline_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.pipeline_run(attr, results); });
+}
+
+TEST(graph_coloring_mpi_perf_test, test_task_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.task_run(attr, results); });
+}
+
+TEST(graph_coloring_mpi_perf_test, test_benchmark_graphs) {
+  boost::mpi::communicator world;
+  // every benchmark topology at 2^16 vertices, checked against the
+  // sequential colors and reported in edges per second
+  for (const auto& benchmark : ppc::core::graph::benchmark_graphs<double>(16, 8, 1.0, 1.0, 2024)) {
+    auto graph = to_graph(benchmark.csr());
+    std::vector<int> colors(graph.num_vertices);
+    graph_coloring_mpi::ColoringParallel task(make_task_data(graph, colors));
+    ASSERT_TRUE(task.validation());
+    ASSERT_TRUE(task.pre_processing());
+    world.barrier();
+    const boost::mpi::timer timer;
+    ASSERT_TRUE(task.run());
+    const double seconds = timer.elapsed();
+    ASSERT_TRUE(task.post_processing());
+    if (world.rank() == 0) {
+      EXPECT_EQ(colors, ppc::core::graph::jones_plassmann(view_of(graph), graph_coloring_mpi::ColoringParallel::kSeed))
+          << benchmark.name;
+      ppc::core::graph::print_teps(std::cout, "graph_coloring_mpi", benchmark.name,
+                                   static_cast<long long>(benchmark.edges.size()), seconds);
+    }
+  }
+}
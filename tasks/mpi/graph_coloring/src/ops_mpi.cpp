@@ -0,0 +1,55 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/graph_coloring/include/ops_mpi.hpp"
+
+#include <algorithm>
+
+#include "core/graph/include/coloring_mpi.hpp"
+#include "core/graph/include/loader.hpp"
+
+bool graph_coloring_mpi::ColoringParallel::pre_processing() {
+  internal_order_test();
+  ppc::core::graph::GraphView<double> whole{0, 0, nullptr, nullptr, nullptr};
+  if (world.rank() == 0) {
+    const auto* graph = reinterpret_cast<const SparseGraphCRS*>(taskData->inputs[0]);
+    const int n = graph->num_vertices;
+    // the values go unused, but the split sends an edge's value with it
+    const double* values = graph->values.data();
+    if (graph->values.size() != graph->col_indices.size()) {
+      no_values_.assign(graph->col_indices.size(), 0.0);
+      values = no_values_.data();
+    }
+    whole = {n, n, graph->row_ptr.data(), graph->col_indices.data(), values};
+  }
+  session_.scatter(whole, 0);
+  no_values_.clear();
+  return true;
+}
+
+bool graph_coloring_mpi::ColoringParallel::validation() {
+  internal_order_test();
+  if (world.rank() != 0) return true;
+  if (taskData->inputs.size() != 1 || taskData->inputs[0] == nullptr || taskData->outputs.size() != 1 ||
+      taskData->outputs_count.size() != 1) {
+    return false;
+  }
+  const auto* graph = reinterpret_cast<const SparseGraphCRS*>(taskData->inputs[0]);
+  const int n = graph->num_vertices;
+  return n > 0 && graph->row_ptr.size() == static_cast<size_t>(n) + 1 &&
+         ppc::core::graph::well_formed(n, graph->row_ptr.data(), graph->col_indices.data(),
+                                       graph->col_indices.size()) &&
+         ppc::core::graph::symmetric(n, graph->row_ptr.data(), graph->col_indices.data()) &&
+         taskData->outputs_count[0] == static_cast<size_t>(n);
+}
+
+bool graph_coloring_mpi::ColoringParallel::run() {
+  internal_order_test();
+  colors_ = ppc::core::graph::jones_plassmann(world, session_.local(), session_.bounds(), kSeed);
+  return true;
+}
+
+bool graph_coloring_mpi::ColoringParallel::post_processing() {
+  internal_order_test();
+  const auto colors = session_.gather(colors_);
+  if (world.rank() == 0) std::copy(colors.begin(), colors.end(), reinterpret_cast<int*>(taskData->outputs[0]));
+  return true;
+}
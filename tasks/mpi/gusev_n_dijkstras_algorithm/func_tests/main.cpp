@@ -3,8 +3,12 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <queue>
+#include <random>
+#include <utility>
 #include <vector>
 
 #include "mpi/gusev_n_dijkstras_algorithm/include/ops_mpi.hpp"
@@ -152,3 +156,101 @@ TEST(gusev_n_dijkstras_algorithm_mpi, TestNoOutputDataValidation) {
   gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel task(task_data);
   ASSERT_FALSE(task.validation()) << "Validation should fail with no output data";
 }
+
+namespace {
+
+using SparseGraphCRS = gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel::SparseGraphCRS;
+
+// n vertices with degree random out-edges each, added in source order.
+std::shared_ptr<SparseGraphCRS> random_graph(int n, int degree) {
+  auto graph = std::make_shared<SparseGraphCRS>(n);
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> head(0, n - 1);
+  std::uniform_real_distribution<double> weight(0.1, 10.0);
+  graph->row_ptr.assign(n + 1, 0);
+  for (int u = 0; u < n; u++) {
+    for (int k = 0; k < degree; k++) {
+      graph->col_indices.push_back(head(gen));
+      graph->values.push_back(weight(gen));
+    }
+    graph->row_ptr[u + 1] = static_cast<int>(graph->values.size());
+  }
+  return graph;
+}
+
+// Plain heap Dijkstra from vertex 0.
+std::vector<double> reference_distances(const SparseGraphCRS& graph) {
+  std::vector<double> dist(graph.num_vertices, std::numeric_limits<double>::infinity());
+  std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> queue;
+  dist[0] = 0.0;
+  queue.emplace(0.0, 0);
+  while (!queue.empty()) {
+    auto [d, u] = queue.top();
+    queue.pop();
+    if (d > dist[u]) continue;
+    for (int j = graph.row_ptr[u]; j < graph.row_ptr[u + 1]; ++j) {
+      if (d + graph.values[j] < dist[graph.col_indices[j]]) {
+        dist[graph.col_indices[j]] = d + graph.values[j];
+        queue.emplace(dist[graph.col_indices[j]], graph.col_indices[j]);
+      }
+    }
+  }
+  return dist;
+}
+
+void check_random_graph(int n, int degree, std::vector<double> delta) {
+  boost::mpi::communicator world;
+  auto graph = random_graph(n, degree);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(graph.get()));
+  task_data->inputs_count.push_back(sizeof(SparseGraphCRS));
+  if (!delta.empty()) {
+    task_data->inputs.push_back(reinterpret_cast<uint8_t*>(delta.data()));
+    task_data->inputs_count.push_back(1);
+  }
+  std::vector<double> output_data(n);
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output_data.data()));
+  task_data->outputs_count.push_back(output_data.size() * sizeof(double));
+
+  gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel task(task_data);
+  ASSERT_TRUE(task.validation());
+  ASSERT_TRUE(task.pre_processing());
+  ASSERT_TRUE(task.run());
+  ASSERT_TRUE(task.post_processing());
+
+  if (world.rank() == 0) {
+    const auto expected = reference_distances(*graph);
+    for (int v = 0; v < n; ++v) {
+      if (std::isinf(expected[v])) {
+        EXPECT_TRUE(std::isinf(output_data[v])) << "Distance to vertex " << v << " should be infinity";
+      } else {
+        EXPECT_NEAR(output_data[v], expected[v], 1e-9) << "Incorrect distance to vertex " << v;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(gusev_n_dijkstras_algorithm_mpi, TestRandomGraphDefaultDelta) { check_random_graph(3000, 4, {}); }
+
+TEST(gusev_n_dijkstras_algorithm_mpi, TestRandomGraphSmallDelta) { check_random_graph(1000, 3, {0.5}); }
+
+TEST(gusev_n_dijkstras_algorithm_mpi, TestRandomGraphLargeDelta) { check_random_graph(1000, 2, {1000.0}); }
+
+TEST(gusev_n_dijkstras_algorithm_mpi, TestNegativeWeightValidation) {
+  auto graph = std::make_shared<gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel::SparseGraphCRS>(3);
+  graph->add_edge(0, 1, 2.0);
+  graph->add_edge(1, 2, -1.0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(graph.get()));
+  task_data->inputs_count.push_back(
+      sizeof(gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel::SparseGraphCRS));
+  std::vector<double> output_data(3);
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output_data.data()));
+  task_data->outputs_count.push_back(output_data.size() * sizeof(double));
+
+  gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel task(task_data);
+  ASSERT_FALSE(task.validation()) << "Validation should fail with a negative weight";
+}
@@ -6,7 +6,6 @@
 #include <boost/mpi.hpp>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
-#include <boost/serialization/access.hpp>
 #include <boost/serialization/vector.hpp>
 #include <functional>
 #include <iostream>
@@ -17,6 +16,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/sssp.hpp"
 #include "core/task/include/task.hpp"
 
 namespace gusev_n_dijkstras_algorithm_mpi {
@@ -45,22 +45,15 @@ class DijkstrasAlgorithmParallel : public ppc::core::Task {
       }
     }
   };
-  struct MinVertex {
-    double distance;
-    int vertex;
-
-    template <class Archive>
-    void serialize(Archive& ar, const unsigned int version) {
-      ar & distance;
-      ar & vertex;
-    }
-
-    bool operator<(const MinVertex& other) const { return distance < other.distance; }
-  };
 
  private:
   boost::mpi::communicator world;
   std::vector<double> local_distances;
+  // this rank's block of vertices, fixed in pre_processing for every run
+  std::vector<int> bounds_;
+  ppc::core::graph::GraphView<double> local_{};
+  // bucket width of the delta-stepping run, resolved once in pre_processing
+  double delta_{};
 };
 
 }  // namespace gusev_n_dijkstras_algorithm_mpi
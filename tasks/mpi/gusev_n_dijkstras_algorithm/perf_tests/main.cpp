@@ -1,10 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <boost/mpi/timer.hpp>
 #include <cmath>
+#include <iostream>
 #include <random>
 #include <vector>
 
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/bfs.hpp"
+#include "core/graph/include/sssp.hpp"
 #include "core/perf/include/perf.hpp"
 #include "mpi/gusev_n_dijkstras_algorithm/include/ops_mpi.hpp"
 
@@ -110,3 +115,50 @@ TEST(gusev_n_dijkstras_algorithm_mpi, run_task) {
 
   if (world.rank() == 0) ppc::core::Perf::print_perf_statistic(perfResults);
 }
+
+TEST(gusev_n_dijkstras_algorithm_mpi, run_benchmark_graphs) {
+  boost::mpi::communicator world;
+
+  // 2^14 vertices of each benchmark topology, checked against the sequential
+  // Dijkstra and reported in TEPS next to a direction-optimizing BFS
+  for (const auto& graph : ppc::core::graph::benchmark_graphs<double>(14, 8, 0.1, 10.0, 2024)) {
+    const auto csr = graph.csr();
+    gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel::SparseGraphCRS task_graph(graph.vertices);
+    task_graph.row_ptr = csr.row_ptr;
+    task_graph.col_indices = csr.col_idx;
+    task_graph.values = csr.values;
+
+    std::vector<double> output_data(graph.vertices);
+
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs.push_back(reinterpret_cast<uint8_t*>(&task_graph));
+    task_data->inputs_count.push_back(
+        sizeof(gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel::SparseGraphCRS));
+    task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output_data.data()));
+    task_data->outputs_count.push_back(output_data.size() * sizeof(double));
+
+    gusev_n_dijkstras_algorithm_mpi::DijkstrasAlgorithmParallel task(task_data);
+    ASSERT_EQ(task.validation(), true);
+    task.pre_processing();
+    world.barrier();
+    const boost::mpi::timer timer;
+    task.run();
+    const double seconds = timer.elapsed();
+    task.post_processing();
+
+    if (world.rank() == 0) {
+      const auto expected = ppc::core::graph::dijkstra(csr.view(), 0);
+      EXPECT_TRUE(std::equal(output_data.begin(), output_data.end(), expected.begin(), [](double a, double b) {
+        return a == b || std::abs(a - b) <= 1e-9 * std::abs(b);
+      })) << graph.name;
+      const long long edges =
+          ppc::core::graph::traversed_edges(csr.view(), expected, ppc::core::graph::unreachable<double>());
+      ppc::core::graph::print_teps(std::cout, "gusev_n_dijkstras_algorithm_mpi", graph.name, edges, seconds);
+
+      const boost::mpi::timer bfs_timer;
+      const auto levels = ppc::core::graph::bfs(csr.view(), 0);
+      ppc::core::graph::print_teps(std::cout, "bfs", graph.name, edges, bfs_timer.elapsed());
+      EXPECT_EQ(levels, ppc::core::graph::bfs_levels(csr.view(), 0)) << graph.name;
+    }
+  }
+}
@@ -7,6 +7,8 @@
 #include <thread>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+
 bool kalinin_d_matrix_mult_hor_a_vert_b_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
 
@@ -37,13 +39,7 @@ bool kalinin_d_matrix_mult_hor_a_vert_b_mpi::TestMPITaskSequential::validation()
 bool kalinin_d_matrix_mult_hor_a_vert_b_mpi::TestMPITaskSequential::run() {
   internal_order_test();
 
-  for (int i = 0; i < rows_A; ++i) {
-    for (int j = 0; j < columns_B; ++j) {
-      for (int k = 0; k < columns_A; ++k) {
-        C[i * columns_B + j] += input_A[i * columns_A + k] * input_B[k * columns_B + j];
-      }
-    }
-  }
+  ppc::core::linalg::gemm(rows_A, columns_B, columns_A, input_A, input_B, C.data(), true);
 
   return true;
 }
@@ -165,15 +161,7 @@ bool kalinin_d_matrix_mult_hor_a_vert_b_mpi::TestMPITaskParallel::run() {
 
   int local_rows = sendcounts[rank] / column_A;
   auto* local_res = new int[local_rows * column_B];
-  std::fill(local_res, local_res + local_rows * column_B, 0);
-
-  for (int i = 0; i < local_rows; ++i) {
-    for (int j = 0; j < column_B; ++j) {
-      for (int k = 0; k < column_A; ++k) {
-        local_res[i * column_B + j] += local_A[i * column_A + k] * input_B[k * column_B + j];
-      }
-    }
-  }
+  ppc::core::linalg::gemm(local_rows, column_B, column_A, local_A, input_B, local_res);
 
   MPI_Barrier(MPI_COMM_WORLD);
 
@@ -19,7 +19,6 @@ namespace kapustin_i_bubble_sort_mpi {
 class BubbleSortMPI : public ppc::core::Task {
  public:
   explicit BubbleSortMPI(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
-  std::vector<int> merge(int partner, std::vector<int>& local_data);
   bool validation() override;
 
   bool pre_processing() override;
@@ -9,13 +9,11 @@
 
 namespace kazunin_n_quicksort_simple_merge_mpi {
 
-void iterative_quicksort(std::vector<int>& data);
 void worker_function(boost::mpi::communicator& world, const std::vector<int>& local_data);
 std::vector<int> master_function(boost::mpi::communicator& world, const std::vector<int>& local_data,
                                  const std::vector<int>& sizes);
 void merge_func(boost::mpi::communicator& world, const std::vector<int>& local_data, const std::vector<int>& sizes,
                 std::vector<int>& res);
-void iterative_quicksort(std::vector<int>& data);
 
 class QuicksortSimpleMerge : public ppc::core::Task {
  public:
@@ -30,7 +28,6 @@ class QuicksortSimpleMerge : public ppc::core::Task {
   std::vector<int> input_vector;
   std::vector<int> local_vector;
   std::vector<int> sizes;
-  std::vector<int> displs;
   boost::mpi::communicator world;
 };
 
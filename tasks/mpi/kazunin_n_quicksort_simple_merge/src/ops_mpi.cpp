@@ -3,7 +3,9 @@
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/vector.hpp>
 #include <queue>
-#include <stack>
+
+#include "core/sort/include/distribute_mpi.hpp"
+#include "core/sort/include/quicksort.hpp"
 
 namespace kazunin_n_quicksort_simple_merge_mpi {
 
@@ -76,32 +78,6 @@ void merge_func(boost::mpi::communicator& world, const std::vector<int>& local_d
   world.barrier();
 }
 
-void iterative_quicksort(std::vector<int>& data) {
-  std::stack<std::pair<int, int>> stack;
-  stack.emplace(0, data.size() - 1);
-
-  while (!stack.empty()) {
-    auto [low, high] = stack.top();
-    stack.pop();
-
-    if (low < high) {
-      int pivot = data[high];
-      int i = low - 1;
-
-      for (int j = low; j < high; ++j) {
-        if (data[j] < pivot) {
-          std::swap(data[++i], data[j]);
-        }
-      }
-      std::swap(data[i + 1], data[high]);
-      int p = i + 1;
-
-      stack.emplace(low, p - 1);
-      stack.emplace(p + 1, high);
-    }
-  }
-}
-
 bool QuicksortSimpleMerge::validation() {
   internal_order_test();
 
@@ -120,24 +96,20 @@ bool QuicksortSimpleMerge::pre_processing() {
     input_vector.assign(vec_data, vec_data + vec_size);
   }
   sizes.resize(world.size());
-  displs.resize(world.size());
 
   for (int i = 0; i < world.size(); ++i) {
     sizes[i] = vector_size / world.size() + (i < vector_size % world.size() ? 1 : 0);
-    displs[i] = (i == 0) ? 0 : displs[i - 1] + sizes[i - 1];
   }
 
-  local_vector.resize(sizes[world.rank()]);
-
   return true;
 }
 
 bool QuicksortSimpleMerge::run() {
   internal_order_test();
 
-  boost::mpi::scatterv(world, input_vector.data(), sizes, displs, local_vector.data(), sizes[world.rank()], 0);
+  local_vector = ppc::core::sort::scatter_even(world, input_vector, 0);
 
-  iterative_quicksort(local_vector);
+  ppc::core::sort::quicksort(local_vector);
 
   merge_func(world, local_vector, sizes, input_vector);
 
@@ -26,9 +26,6 @@ class RadixSortSequential : public ppc::core::Task {
  private:
   std::vector<double> data;
   int n = 0;
-
-  static void radix_sort_doubles(std::vector<double>& data);
-  static void radix_sort_uint64(std::vector<uint64_t>& keys);
 };
 
 class RadixSortParallel : public ppc::core::Task {
@@ -43,9 +40,6 @@ class RadixSortParallel : public ppc::core::Task {
   std::vector<double> data;
   int n = 0;
   boost::mpi::communicator world;
-
-  static void radix_sort_doubles(std::vector<double>& data);
-  static void radix_sort_uint64(std::vector<uint64_t>& keys);
 };
 
 }  // namespace kharin_m_radix_double_sort
\ No newline at end of file
@@ -2,7 +2,9 @@
 
 #include <boost/mpi.hpp>
 #include <cmath>
-#include <queue>
+
+#include "core/sort/include/distribute_mpi.hpp"
+#include "core/sort/include/radix.hpp"
 
 namespace mpi = boost::mpi;
 using namespace kharin_m_radix_double_sort;
@@ -36,7 +38,7 @@ bool RadixSortSequential::run() {
   internal_order_test();
 
   // Поразрядная сортировка
-  radix_sort_doubles(data);
+  ppc::core::sort::radix_sort(data);
   return true;
 }
 
@@ -49,56 +51,6 @@ bool RadixSortSequential::post_processing() {
   return true;
 }
 
-void RadixSortSequential::radix_sort_doubles(std::vector<double>& data_) {
-  size_t n_ = data_.size();
-  std::vector<uint64_t> keys(n_);
-  for (size_t i = 0; i < n_; ++i) {
-    uint64_t u;
-    std::memcpy(&u, &data_[i], sizeof(double));
-    // Перевод для сохранения порядка
-    if ((u & 0x8000000000000000ULL) != 0) {
-      u = ~u;
-    } else {
-      u |= 0x8000000000000000ULL;
-    }
-    keys[i] = u;
-  }
-
-  radix_sort_uint64(keys);
-
-  for (size_t i = 0; i < n_; ++i) {
-    uint64_t u = keys[i];
-    if ((u & 0x8000000000000000ULL) != 0) {
-      u &= ~0x8000000000000000ULL;
-    } else {
-      u = ~u;
-    }
-    std::memcpy(&data_[i], &u, sizeof(double));
-  }
-}
-
-void RadixSortSequential::radix_sort_uint64(std::vector<uint64_t>& keys) {
-  const int BITS = 64;
-  const int RADIX = 256;
-  std::vector<uint64_t> temp(keys.size());
-
-  for (int shift = 0; shift < BITS; shift += 8) {
-    size_t count[RADIX + 1] = {0};
-    for (size_t i = 0; i < keys.size(); ++i) {
-      uint8_t byte = (keys[i] >> shift) & 0xFF;
-      ++count[byte + 1];
-    }
-    for (int i = 0; i < RADIX; ++i) {
-      count[i + 1] += count[i];
-    }
-    for (size_t i = 0; i < keys.size(); ++i) {
-      uint8_t byte = (keys[i] >> shift) & 0xFF;
-      temp[count[byte]++] = keys[i];
-    }
-    keys.swap(temp);
-  }
-}
-
 bool RadixSortParallel::pre_processing() {
   internal_order_test();
 
@@ -134,30 +86,10 @@ bool RadixSortParallel::run() {
 
   int rank = world.rank();
   int size = world.size();
-  int local_n = n / size;
-  int remainder = n % size;
-
-  std::vector<int> counts(size);
-  std::vector<int> displs(size);
-  if (rank == 0) {
-    for (int i = 0; i < size; ++i) {
-      counts[i] = local_n + (i < remainder ? 1 : 0);
-    }
-    displs[0] = 0;
-    for (int i = 1; i < size; ++i) {
-      displs[i] = displs[i - 1] + counts[i - 1];
-    }
-  }
-
-  mpi::broadcast(world, counts, 0);
-  mpi::broadcast(world, displs, 0);
-
-  std::vector<double> local_data(counts[rank]);
-  mpi::scatterv(world, (rank == 0 ? data.data() : (double*)nullptr), counts, displs, local_data.data(), counts[rank],
-                0);
+  std::vector<double> local_data = ppc::core::sort::scatter_even(world, data, 0);
 
   // Локальная поразрядная сортировка
-  radix_sort_doubles(local_data);
+  ppc::core::sort::radix_sort(local_data);
 
   // Организуем дерево слияний.
   // Общее число шагов = ceil(log2(size))
@@ -229,52 +161,3 @@ bool RadixSortParallel::post_processing() {
 
   return true;
 }
-
-void RadixSortParallel::radix_sort_doubles(std::vector<double>& data_) {
-  size_t n_ = data_.size();
-  std::vector<uint64_t> keys(n_);
-  for (size_t i = 0; i < n_; ++i) {
-    uint64_t u;
-    std::memcpy(&u, &data_[i], sizeof(double));
-    if ((u & 0x8000000000000000ULL) != 0) {
-      u = ~u;
-    } else {
-      u |= 0x8000000000000000ULL;
-    }
-    keys[i] = u;
-  }
-
-  radix_sort_uint64(keys);
-
-  for (size_t i = 0; i < n_; ++i) {
-    uint64_t u = keys[i];
-    if ((u & 0x8000000000000000ULL) != 0) {
-      u &= ~0x8000000000000000ULL;
-    } else {
-      u = ~u;
-    }
-    std::memcpy(&data_[i], &u, sizeof(double));
-  }
-}
-
-void RadixSortParallel::radix_sort_uint64(std::vector<uint64_t>& keys) {
-  const int BITS = 64;
-  const int RADIX = 256;
-  std::vector<uint64_t> temp(keys.size());
-
-  for (int shift = 0; shift < BITS; shift += 8) {
-    size_t count[RADIX + 1] = {0};
-    for (size_t i = 0; i < keys.size(); ++i) {
-      uint8_t byte = (keys[i] >> shift) & 0xFF;
-      ++count[byte + 1];
-    }
-    for (int i = 0; i < RADIX; ++i) {
-      count[i + 1] += count[i];
-    }
-    for (size_t i = 0; i < keys.size(); ++i) {
-      uint8_t byte = (keys[i] >> shift) & 0xFF;
-      temp[count[byte]++] = keys[i];
-    }
-    keys.swap(temp);
-  }
-}
\ No newline at end of file
@@ -1,6 +1,10 @@
 // Copyright 2023 Nesterov Alexander
 #include "mpi/kondratev_ya_radix_sort_batcher_merge/include/ops_mpi.hpp"
 
+#include <functional>
+
+#include "core/sort/include/batcher_mpi.hpp"
+
 void kondratev_ya_radix_sort_batcher_merge_mpi::radixSortDouble(std::vector<double>& arr, int32_t start, int32_t end) {
   constexpr int32_t byte_size = 8;
   constexpr int32_t double_bit_size = byte_size * sizeof(double);
@@ -110,96 +114,15 @@ bool kondratev_ya_radix_sort_batcher_merge_mpi::TestMPITaskParallel::validation(
 bool kondratev_ya_radix_sort_batcher_merge_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  broadcast(world, size_, 0);
-
-  int32_t step = size_ / world.size();
-  int32_t remain = size_ % world.size();
-
-  std::vector<int32_t> sizes(world.size(), step);
-  for (int32_t i = 0; i < remain; i++) sizes[i]++;
-
-  local_input_.resize(sizes[world.rank()]);
-  scatterv(world, input_, sizes, local_input_.data(), 0);
-
-  kondratev_ya_radix_sort_batcher_merge_mpi::radixSortDouble(local_input_, 0, local_input_.size() - 1);
-
-  for (int32_t merge_step = 0; merge_step < world.size(); ++merge_step) {
-    if (merge_step % 2 == 0) {
-      if (world.rank() % 2 == 0 && world.rank() + 1 < world.size()) {
-        exchange_and_merge(world.rank(), sizes[world.rank()], world.rank() + 1, sizes[world.rank() + 1]);
-      } else if (world.rank() % 2 != 0) {
-        exchange_and_merge(world.rank() - 1, sizes[world.rank() - 1], world.rank(), sizes[world.rank()]);
-      }
-    } else {
-      if (world.rank() % 2 == 1 && world.rank() + 1 < world.size()) {
-        exchange_and_merge(world.rank(), sizes[world.rank()], world.rank() + 1, sizes[world.rank() + 1]);
-      } else if (world.rank() % 2 == 0 && world.rank() > 0) {
-        exchange_and_merge(world.rank() - 1, sizes[world.rank() - 1], world.rank(), sizes[world.rank()]);
-      }
-    }
-  }
-
-  gatherv(world, local_input_.data(), local_input_.size(), res_.data(), sizes, 0);
+  local_input_ = ppc::core::sort::scatter_even(world, input_, 0);
+  ppc::core::sort::batcher_sort(world, local_input_, std::less<>(), [](std::vector<double>& v) {
+    kondratev_ya_radix_sort_batcher_merge_mpi::radixSortDouble(v, 0, static_cast<int32_t>(v.size()) - 1);
+  });
+  res_ = ppc::core::sort::gather_sorted(world, local_input_, 0);
 
   return true;
 }
 
-void kondratev_ya_radix_sort_batcher_merge_mpi::TestMPITaskParallel::exchange_and_merge(int32_t rank1, int32_t size1,
-                                                                                        int32_t rank2, int32_t size2) {
-  if (size1 <= 0 || size2 <= 0) return;
-  std::vector<double> neighbor_data;
-
-  boost::mpi::request reqs[2];
-  if (world.rank() == rank1) {
-    neighbor_data.resize(size2);
-    reqs[0] = world.isend(rank2, 0, local_input_.data(), size1);
-    reqs[1] = world.irecv(rank2, 0, neighbor_data.data(), size2);
-  } else if (world.rank() == rank2) {
-    neighbor_data.resize(size1);
-    reqs[0] = world.irecv(rank1, 0, neighbor_data.data(), size1);
-    reqs[1] = world.isend(rank1, 0, local_input_.data(), size2);
-  }
-
-  reqs[0].wait();
-  reqs[1].wait();
-
-  if (!neighbor_data.empty()) {
-    std::vector<double> merged_data(local_input_.size() + neighbor_data.size());
-    merge(local_input_, neighbor_data, merged_data);
-
-    if (world.rank() == rank1) {
-      local_input_.assign(merged_data.begin(), merged_data.begin() + local_input_.size());
-    } else {
-      local_input_.assign(merged_data.end() - local_input_.size(), merged_data.end());
-    }
-  }
-}
-
-void kondratev_ya_radix_sort_batcher_merge_mpi::TestMPITaskParallel::merge(const std::vector<double>& first,
-                                                                           const std::vector<double>& second,
-                                                                           std::vector<double>& result) {
-  auto it1 = first.begin();
-  auto last1 = first.end();
-  auto it2 = second.begin();
-  auto last2 = second.end();
-  auto out = result.begin();
-
-  while (it1 != last1 && it2 != last2) {
-    if (*it1 <= *it2)
-      *out++ = *it1++;
-    else
-      *out++ = *it2++;
-  }
-
-  while (it1 != last1) {
-    *out++ = *it1++;
-  }
-
-  while (it2 != last2) {
-    *out++ = *it2++;
-  }
-}
-
 bool kondratev_ya_radix_sort_batcher_merge_mpi::TestMPITaskParallel::post_processing() {
   internal_order_test();
 
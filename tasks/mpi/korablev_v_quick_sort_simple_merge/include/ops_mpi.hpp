@@ -43,7 +43,6 @@ class QuickSortSimpleMergeParallel : public ppc::core::Task {
   boost::mpi::communicator world;
 };
 
-inline std::vector<int> merge(const std::vector<int>& left, const std::vector<int>& right);
 inline std::vector<int> quick_sort_with_merge(const std::span<int>& arr);
 
 }  // namespace korablev_v_quick_sort_simple_merge_mpi
@@ -5,31 +5,11 @@
 #include <boost/mpi.hpp>
 #include <boost/serialization/vector.hpp>
 #include <cmath>
+#include <functional>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
-
-std::vector<int> korablev_v_quick_sort_simple_merge_mpi::merge(const std::vector<int>& left,
-                                                               const std::vector<int>& right) {
-  std::vector<int> result;
-  result.reserve(left.size() + right.size());
-
-  size_t i = 0;
-  size_t j = 0;
-
-  while (i < left.size() && j < right.size()) {
-    if (left[i] < right[j]) {
-      result.push_back(left[i++]);
-    } else {
-      result.push_back(right[j++]);
-    }
-  }
-
-  result.insert(result.end(), left.begin() + i, left.end());
-  result.insert(result.end(), right.begin() + j, right.end());
-
-  return result;
-}
+#include "core/sort/include/sample_sort_mpi.hpp"
 
 std::vector<int> korablev_v_quick_sort_simple_merge_mpi::quick_sort_with_merge(const std::span<int>& arr) {
   if (arr.size() <= 1) {
@@ -56,8 +36,10 @@ std::vector<int> korablev_v_quick_sort_simple_merge_mpi::quick_sort_with_merge(c
   std::vector<int> sortedLeft = quick_sort_with_merge(left);
   std::vector<int> sortedRight = quick_sort_with_merge(right);
 
-  std::vector<int> merged = merge(sortedLeft, equal);
-  return merge(merged, sortedRight);
+  // left < equal < right, so the three runs only need to be concatenated
+  sortedLeft.insert(sortedLeft.end(), equal.begin(), equal.end());
+  sortedLeft.insert(sortedLeft.end(), sortedRight.begin(), sortedRight.end());
+  return sortedLeft;
 }
 
 bool korablev_v_quick_sort_simple_merge_mpi::QuickSortSimpleMergeParallel::pre_processing() {
@@ -97,41 +79,10 @@ bool korablev_v_quick_sort_simple_merge_mpi::QuickSortSimpleMergeParallel::valid
 bool korablev_v_quick_sort_simple_merge_mpi::QuickSortSimpleMergeParallel::run() {
   internal_order_test();
 
-  boost::mpi::broadcast(world, input_, 0);
-
-  size_t n = input_.size();
-
-  size_t chunk_size = n / world.size();
-  size_t remainder = n % world.size();
-
-  std::vector<int> sizes(world.size(), chunk_size);
-  for (size_t i = 0; i < remainder; ++i) {
-    sizes[i]++;
-  }
-
-  std::vector<int> displs(world.size(), 0);
-  for (int i = 1; i < world.size(); ++i) {
-    displs[i] = displs[i - 1] + sizes[i - 1];
-  }
-
-  local_data_.resize(sizes[world.rank()]);
-  boost::mpi::scatterv(world, input_.data(), sizes, displs, local_data_.data(), sizes[world.rank()], 0);
-
-  local_data_ = quick_sort_with_merge(local_data_);
-
-  std::vector<int> gathered_data;
-  if (world.rank() == 0) {
-    gathered_data.resize(n);
-  }
-  boost::mpi::gatherv(world, local_data_.data(), sizes[world.rank()], gathered_data.data(), sizes, displs, 0);
-
-  if (world.rank() == 0) {
-    output_.assign(gathered_data.begin(), gathered_data.begin() + sizes[0]);
-    for (int i = 1; i < world.size(); ++i) {
-      std::vector<int> right(gathered_data.begin() + displs[i], gathered_data.begin() + displs[i] + sizes[i]);
-      output_ = merge(output_, right);
-    }
-  }
+  local_data_ = ppc::core::sort::scatter_even(world, input_, 0);
+  ppc::core::sort::sample_sort(world, local_data_, std::less<>(),
+                               [](std::vector<int>& v) { v = quick_sort_with_merge(v); });
+  output_ = ppc::core::sort::gather_sorted(world, local_data_, 0);
 
   return true;
 }
@@ -2,8 +2,11 @@
 
 #include <boost/serialization/vector.hpp>
 #include <cstring>
+#include <functional>
 #include <vector>
 
+#include "core/sort/include/batcher_mpi.hpp"
+
 bool kozlova_e_radix_batcher_sort_mpi::RadixBatcherSortSequential::pre_processing() {
   internal_order_test();
   input_size = taskData->inputs_count[0];
@@ -146,73 +149,7 @@ void kozlova_e_radix_batcher_sort_mpi::RadixBatcherSortMPI::radixSort(std::vecto
 }
 
 void kozlova_e_radix_batcher_sort_mpi::RadixBatcherSortMPI::RadixSortWithOddEvenMerge(std::vector<double>& a) {
-  a.resize(input_size);
-  boost::mpi::broadcast(world, a.data(), a.size(), 0);
-
-  int total_size = a.size();
-  int num_processes = world.size();
-  int local_size = total_size / num_processes;
-  int remainder = total_size % num_processes;
-
-  std::vector<int> send_counts(num_processes, local_size);
-  for (int i = 0; i < remainder; ++i) {
-    send_counts[i]++;
-  }
-
-  std::vector<int> send_displacements(num_processes, 0);
-  for (int i = 1; i < num_processes; ++i) {
-    send_displacements[i] = send_displacements[i - 1] + send_counts[i - 1];
-  }
-
-  std::vector<double> local_input(send_counts[world.rank()]);
-
-  boost::mpi::scatterv(world, a.data(), send_counts, send_displacements, local_input.data(), send_counts[world.rank()],
-                       0);
-
-  radixSort(local_input);
-
-  int step = 1;
-  bool is_even_phase = true;
-
-  while (step <= world.size()) {
-    int partner = -1;
-    radixSort(local_input);
-    if (is_even_phase) {
-      if (world.rank() % 2 == 0 && world.rank() + 1 < world.size()) {
-        partner = world.rank() + 1;
-      } else if (world.rank() % 2 != 0) {
-        partner = world.rank() - 1;
-      }
-    } else {
-      if (world.rank() % 2 != 0 && world.rank() + 1 < world.size()) {
-        partner = world.rank() + 1;
-      } else if (world.rank() % 2 == 0 && world.rank() > 0) {
-        partner = world.rank() - 1;
-      }
-    }
-
-    if (partner != -1) {
-      std::vector<double> recv_data(local_input.size());
-      world.sendrecv(partner, 0, local_input, partner, 0, recv_data);
-
-      std::vector<double> merged(local_input.size() + recv_data.size());
-      std::merge(local_input.begin(), local_input.end(), recv_data.begin(), recv_data.end(), merged.begin());
-
-      radixSort(merged);
-
-      int local_keep = send_counts[world.rank()];
-
-      if (world.rank() < partner) {
-        local_input.assign(merged.begin(), merged.begin() + local_keep);
-      } else {
-        local_input.assign(merged.end() - local_keep, merged.end());
-      }
-    }
-
-    is_even_phase = !is_even_phase;
-    step++;
-  }
-
-  boost::mpi::gatherv(world, local_input.data(), send_counts[world.rank()], a.data(), send_counts, send_displacements,
-                      0);
+  std::vector<double> local_input = ppc::core::sort::scatter_even(world, a, 0);
+  ppc::core::sort::batcher_sort(world, local_input, std::less<>(), radixSort);
+  a = ppc::core::sort::gather_sorted(world, local_input, 0);
 }
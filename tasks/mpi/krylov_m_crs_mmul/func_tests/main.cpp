@@ -97,6 +97,43 @@ INSTANTIATE_TEST_SUITE_P(krylov_m_crs_mmul_test, krylov_m_crs_mmul_test,
 
 TEST_F(krylov_m_crs_mmul_test, random_3_7_13) { peform_mul_test(3, 7, 13, -128, 128, 0.5f); }
 
+TEST_F(krylov_m_crs_mmul_test, skewed_rows_are_balanced_by_work) {
+  // power-law lhs: row i has n / (i + 1) leading nonzeros
+  const size_t n = 96;
+  auto lhs = krylov_m_crs_mmul::Matrix<TestElementType>::create(n, n);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n / (i + 1); j++) {
+      lhs.at(i, j) = static_cast<TestElementType>((i + j) % 7 + 1);
+    }
+  }
+  auto rhs = generate_random_matrix(n, n, -16, 16, 0.3f);
+
+  krylov_m_crs_mmul::CRSMatrix<TestElementType> slhs(lhs);
+  krylov_m_crs_mmul::CRSMatrix<TestElementType> srhs(rhs);
+  krylov_m_crs_mmul::CRSMatrix<TestElementType> sout;
+
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    krylov_m_crs_mmul::fill_task_data(*taskData, slhs, srhs, sout);
+  }
+
+  krylov_m_crs_mmul::TaskParallel<TestElementType> task(taskData);
+  ASSERT_TRUE(task.validation());
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+
+  if (world.rank() == 0) {
+    EXPECT_EQ(sout.densify(), lhs * rhs);
+
+    const auto work = ppc::core::sparse::spgemm_work(slhs.view(), srhs.view());
+    const auto even = ppc::core::sparse::even_row_blocks(n, world.size());
+    const auto even_stats = ppc::core::sparse::partition_stats(work.data(), even);
+    EXPECT_EQ(task.row_bounds().size(), static_cast<size_t>(world.size() + 1));
+    EXPECT_LE(task.partition_stats().imbalance, even_stats.imbalance);
+  }
+}
+
 TEST_F(krylov_m_crs_mmul_test, bad_task_fail_validation) {
   krylov_m_crs_mmul::CRSMatrix<TestElementType> sout;
 
@@ -6,6 +6,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+#include "core/sparse/include/sparse.hpp"
+
 namespace krylov_m_crs_mmul {
 
 namespace utils {
@@ -44,14 +47,8 @@ struct Matrix {
 
   Matrix operator*(const Matrix& rhs) const {
     auto res = create(this->rows, rhs.cols);
-    for (size_t i = 0; i < this->rows; i++) {
-      for (size_t j = 0; j < rhs.cols; j++) {
-        res.at(i, j) = 0;
-        for (size_t k = 0; k < rhs.rows; k++) {
-          res.at(i, j) += this->at(i, k) * rhs.at(k, j);
-        }
-      }
-    }
+    ppc::core::linalg::gemm(static_cast<int>(this->rows), static_cast<int>(rhs.cols), static_cast<int>(rhs.rows),
+                            this->storage.data(), rhs.storage.data(), res.storage.data());
     return res;
   }
 
@@ -83,6 +80,8 @@ struct CRSMatrix {
         col_indices(std::move(col_indices_)),
         data(std::move(data_)),
         cols_(cols) {}
+  explicit CRSMatrix(ppc::core::sparse::CSR<T, size_t>&& m)
+      : CRSMatrix(std::move(m.row_ptr), std::move(m.col_idx), std::move(m.values), m.cols) {}
 
   explicit CRSMatrix(const Matrix<T>& dense) : CRSMatrix(dense.rows, dense.cols) {
     size_t idx = 0;
@@ -118,33 +117,12 @@ struct CRSMatrix {
     return std::nullopt;
   }
 
-  CRSMatrix transpose() const {
-    const auto [n, m] = std::make_pair(rows(), cols());
-
-    CRSMatrix res{m + 1, n};
-    res.col_indices.resize(col_indices.size(), 0);
-    res.data.resize(data.size(), 0);
-
-    for (size_t i = 0; i < data.size(); ++i) {
-      ++res.row_pointers[col_indices[i] + 2];
-    }
-
-    for (size_t i = 2; i < res.row_pointers.size(); ++i) {
-      res.row_pointers[i] += res.row_pointers[i - 1];
-    }
-
-    for (size_t i = 0; i < n; ++i) {
-      for (size_t j = row_pointers[i]; j < row_pointers[i + 1]; ++j) {
-        const auto translated_idx = res.row_pointers[col_indices[j] + 1]++;
-        res.data[translated_idx] = data[j];
-        res.col_indices[translated_idx] = i;
-      }
-    }
-    res.row_pointers.pop_back();
-
-    return res;
+  ppc::core::sparse::CSRView<T, size_t> view() const {
+    return {rows(), cols(), row_pointers.data(), col_indices.data(), data.data()};
   }
 
+  CRSMatrix transpose() const { return CRSMatrix(ppc::core::sparse::transpose(view())); }
+
   Matrix<T> densify() const {
     auto dense = Matrix<T>::create(rows(), cols());
     for (size_t row = 0; row < dense.rows; ++row) {
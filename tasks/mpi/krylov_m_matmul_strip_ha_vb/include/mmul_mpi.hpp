@@ -16,6 +16,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace krylov_m_matmul_strip_ha_vb_mpi {
@@ -136,14 +137,8 @@ class TaskSequential : public TaskCommon<T> {
 
     const auto& [lhs, rhs] = this->input;
 
-    for (dimen_t i = 0; i < lhs.rows; i++) {
-      for (dimen_t j = 0; j < rhs.cols; j++) {
-        this->res.at(i, j) = 0;
-        for (dimen_t k = 0; k < rhs.rows; k++) {
-          this->res.at(i, j) += lhs.at(i, k) * rhs.at(k, j);
-        }
-      }
-    }
+    ppc::core::linalg::gemm(static_cast<int>(lhs.rows), static_cast<int>(rhs.cols), static_cast<int>(rhs.rows),
+                            lhs.storage.data(), rhs.storage.data(), this->res.storage.data());
 
     return true;
   }
@@ -299,14 +294,10 @@ class TaskParallel : public TaskCommon<T> {
 
       const dimen_t h_off = calc_horizontal_offset_up_to(vid);
 
-      for (dimen_t i = 0; i < h.rows; ++i) {
-        for (dimen_t j = 0; j < v_.cols; ++j) {
-          res_strip.at(i, j + h_off) = 0;
-          for (dimen_t k = 0; k < v_.rows; ++k) {
-            res_strip.at(i, j + h_off) += h.at(i, k) * v_.at(k, j);
-          }
-        }
-      }
+      // the strip product lands in columns [h_off, h_off + v_.cols) of res_strip
+      ppc::core::linalg::gemm(ppc::core::linalg::Op::kNone, ppc::core::linalg::Op::kNone, h.rows, v_.cols, v_.rows,
+                              h.storage.data(), h.cols, v_.storage.data(), v_.cols, res_strip.storage.data() + h_off,
+                              res_strip.cols);
     };
     const auto recv_and_mul = [&](dimen_t begin, dimen_t end) {
       for (dimen_t i = begin; i < end; ++i) {
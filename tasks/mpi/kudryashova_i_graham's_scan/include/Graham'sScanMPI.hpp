@@ -4,6 +4,7 @@
 #include <boost/mpi/communicator.hpp>
 #include <random>
 
+#include "core/geometry/include/hull.hpp"
 #include "core/task/include/task.hpp"
 namespace kudryashova_i_graham_scan_mpi {
 class TestMPITaskSequential : public ppc::core::Task {
@@ -17,7 +18,6 @@ class TestMPITaskSequential : public ppc::core::Task {
 
  private:
   std::vector<int8_t> input_data;
-  std::vector<int> firstHalf, secondHalf;
   std::vector<int8_t> result_vec;
 };
 class TestMPITaskParallel : public ppc::core::Task {
@@ -32,12 +32,7 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   boost::mpi::communicator world;
   std::vector<int8_t> input_data;
-  std::vector<int> firstHalf, secondHalf;
-  std::vector<int> local_input1_, local_input2_;
-  std::vector<int> segments;
-  std::vector<int8_t> local_result;
+  ppc::core::geometry::PointSet<int8_t> points;
   std::vector<int8_t> result_vec;
-  int delta{};
-  int processes{};
 };
 }  // namespace kudryashova_i_graham_scan_mpi
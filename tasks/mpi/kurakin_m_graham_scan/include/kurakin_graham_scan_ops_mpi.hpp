@@ -9,15 +9,14 @@
 #include <utility>
 #include <vector>
 
+#include "core/geometry/include/hull.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kurakin_m_graham_scan_mpi {
 
-bool isLeftAngle(std::vector<double>& p1, std::vector<double>& p2, std::vector<double>& p3);
-
-int grahamScan(std::vector<std::vector<double>>& input_);
-
-int getCountPoint(int count_point, int size, int rank);
+// Every point of the set on its convex hull boundary, repeats included,
+// counter-clockwise from the lowest point (the rightmost of those).
+std::vector<ppc::core::geometry::Point<double>> grahamScan(const ppc::core::geometry::PointSet<double>& points);
 
 class TestMPITaskSequential : public ppc::core::Task {
  public:
@@ -28,9 +27,8 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  int count_point{};
-  std::vector<std::vector<double>> input_;
-  std::vector<double> res;
+  ppc::core::geometry::PointSet<double> input_;
+  std::vector<ppc::core::geometry::Point<double>> hull_;
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -43,11 +41,8 @@ class TestMPITaskParallel : public ppc::core::Task {
 
  private:
   boost::mpi::communicator world;
-  int count_point{};
-  std::vector<double> input_;
-  int local_count_point{};
-  std::vector<double> local_input_;
-  std::vector<std::vector<double>> graham_input_;
+  ppc::core::geometry::PointSet<double> input_;
+  std::vector<ppc::core::geometry::Point<double>> hull_;
 };
 
 }  // namespace kurakin_m_graham_scan_mpi
\ No newline at end of file
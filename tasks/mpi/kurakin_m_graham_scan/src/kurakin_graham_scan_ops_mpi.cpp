@@ -1,59 +1,38 @@
 #include "mpi/kurakin_m_graham_scan/include/kurakin_graham_scan_ops_mpi.hpp"
 
-#include <algorithm>
-#include <cmath>
-#include <functional>
-#include <random>
-#include <thread>
 #include <vector>
 
-bool kurakin_m_graham_scan_mpi::isLeftAngle(std::vector<double>& p1, std::vector<double>& p2, std::vector<double>& p3) {
-  return ((p2[0] - p1[0]) * (p3[1] - p1[1]) - (p3[0] - p1[0]) * (p2[1] - p1[1])) < 0;
+#include "core/geometry/include/hull_mpi.hpp"
+
+namespace {
+
+bool lowest_then_rightmost(const ppc::core::geometry::Point<double>& a, const ppc::core::geometry::Point<double>& b) {
+  return a.y < b.y || (a.y == b.y && a.x > b.x);
 }
 
-int kurakin_m_graham_scan_mpi::grahamScan(std::vector<std::vector<double>>& input_) {
-  int count_point = input_.size();
-  int ind_min_y = std::min_element(input_.begin(), input_.end(),
-                                   [&](std::vector<double> a, std::vector<double> b) {
-                                     return a[1] < b[1] || (a[1] == b[1] && a[0] > b[0]);
-                                   }) -
-                  input_.begin();
-  std::swap(input_[0], input_[ind_min_y]);
-  std::sort(input_.begin() + 1, input_.end(),
-            [&](std::vector<double> a, std::vector<double> b) { return isLeftAngle(a, input_[0], b); });
-
-  int k = 1;
-  for (int i = 2; i < count_point; i++) {
-    while (k > 0 && isLeftAngle(input_[k - 1], input_[k], input_[i])) {
-      k--;
-    }
-    std::swap(input_[i], input_[k + 1]);
-    k++;
+void write_hull(const std::vector<ppc::core::geometry::Point<double>>& hull, ppc::core::TaskData& taskData) {
+  reinterpret_cast<int*>(taskData.outputs[0])[0] = static_cast<int>(hull.size());
+  auto* out = reinterpret_cast<double*>(taskData.outputs[1]);
+  for (size_t i = 0; i < hull.size(); i++) {
+    out[2 * i] = hull[i].x;
+    out[2 * i + 1] = hull[i].y;
   }
-  return k + 1;
 }
 
-int kurakin_m_graham_scan_mpi::getCountPoint(int count_point, int size, int rank) {
-  if (count_point / size < 3) {
-    if (count_point / 3 <= rank) return 0;
-    size = count_point / 3;
-  }
-  if (count_point % size <= rank) {
-    return count_point / size;
-  }
-  return count_point / size + 1;
+}  // namespace
+
+std::vector<ppc::core::geometry::Point<double>> kurakin_m_graham_scan_mpi::grahamScan(
+    const ppc::core::geometry::PointSet<double>& points) {
+  auto hull = ppc::core::geometry::convex_hull(points, ppc::core::geometry::HullPoints::kBoundary);
+  ppc::core::geometry::start_at(hull, lowest_then_rightmost);
+  return hull;
 }
 
 bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
 
-  count_point = (int)taskData->inputs_count[0] / 2;
-  input_ = std::vector<std::vector<double>>(count_point, std::vector<double>(2, 0));
-  auto* tmp_ptr = reinterpret_cast<double*>(taskData->inputs[0]);
-  for (int i = 0; i < count_point * 2; i += 2) {
-    input_[i / 2][0] = tmp_ptr[i];
-    input_[i / 2][1] = tmp_ptr[i + 1];
-  }
+  input_ = ppc::core::geometry::from_interleaved(reinterpret_cast<double*>(taskData->inputs[0]),
+                                                 taskData->inputs_count[0] / 2);
 
   return true;
 }
@@ -69,7 +48,7 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::validation() {
 bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::run() {
   internal_order_test();
 
-  count_point = grahamScan(input_);
+  hull_ = grahamScan(input_);
 
   return true;
 }
@@ -77,17 +56,19 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::run() {
 bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::post_processing() {
   internal_order_test();
 
-  reinterpret_cast<int*>(taskData->outputs[0])[0] = count_point;
-  for (int i = 0; i < count_point * 2; i += 2) {
-    reinterpret_cast<double*>(taskData->outputs[1])[i] = input_[i / 2][0];
-    reinterpret_cast<double*>(taskData->outputs[1])[i + 1] = input_[i / 2][1];
-  }
+  write_hull(hull_, *taskData);
 
   return true;
 }
 
 bool kurakin_m_graham_scan_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
+
+  if (world.rank() == 0) {
+    input_ = ppc::core::geometry::from_interleaved(reinterpret_cast<double*>(taskData->inputs[0]),
+                                                   taskData->inputs_count[0] / 2);
+  }
+
   return true;
 }
 
@@ -107,77 +88,11 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskParallel::validation() {
 bool kurakin_m_graham_scan_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  if (world.rank() == 0) {
-    count_point = (int)taskData->inputs_count[0] / 2;
-    input_ = std::vector<double>((int)taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<double*>(taskData->inputs[0]);
-    for (int i = 0; i < count_point * 2; i += 2) {
-      input_[i] = tmp_ptr[i];
-      input_[i + 1] = tmp_ptr[i + 1];
-    }
-  }
-  broadcast(world, count_point, 0);
-
-  if (world.rank() == 0) {
-    local_count_point = getCountPoint(count_point, world.size(), world.rank());
-    local_input_ = std::vector<double>(input_.begin(), input_.begin() + local_count_point * 2);
-
-    int sum_next_count_point = local_count_point;
-    for (int i = 1; i < world.size(); i++) {
-      int next_count_point = getCountPoint(count_point, world.size(), i);
-      if (next_count_point != 0) {
-        world.send(i, 0, input_.data() + sum_next_count_point * 2, next_count_point * 2);
-      }
-      sum_next_count_point += next_count_point;
-    }
-  } else {
-    local_count_point = getCountPoint(count_point, world.size(), world.rank());
-    if (local_count_point != 0) {
-      local_input_ = std::vector<double>(local_count_point * 2);
-      world.recv(0, 0, local_input_.data(), local_count_point * 2);
-    }
-  }
-
-  if (local_count_point != 0) {
-    graham_input_ = std::vector<std::vector<double>>(local_count_point, std::vector<double>(2, 0));
-    for (int i = 0; i < local_count_point * 2; i += 2) {
-      graham_input_[i / 2][0] = local_input_[i];
-      graham_input_[i / 2][1] = local_input_[i + 1];
-    }
-    local_count_point = grahamScan(graham_input_);
-    for (int i = 0; i < local_count_point * 2; i += 2) {
-      local_input_[i] = graham_input_[i / 2][0];
-      local_input_[i + 1] = graham_input_[i / 2][1];
-    }
-  }
-
-  if (world.rank() == 0) {
-    std::copy(local_input_.begin(), local_input_.begin() + local_count_point * 2, input_.begin());
-    int sum_next_count_point = local_count_point;
-    for (int i = 1; i < world.size(); i++) {
-      int next_count_point;
-      world.recv(i, 0, &next_count_point, 1);
-      if (next_count_point != 0) {
-        world.recv(i, 0, input_.data() + sum_next_count_point * 2, next_count_point * 2);
-      }
-      sum_next_count_point += next_count_point;
-    }
-    local_count_point = sum_next_count_point;
-  } else {
-    world.send(0, 0, &local_count_point, 1);
-    if (local_count_point != 0) {
-      world.send(0, 0, local_input_.data(), local_count_point * 2);
-    }
-  }
-
-  if (world.rank() == 0) {
-    graham_input_ = std::vector<std::vector<double>>(local_count_point, std::vector<double>(2, 0));
-    for (int i = 0; i < local_count_point * 2; i += 2) {
-      graham_input_[i / 2][0] = input_[i];
-      graham_input_[i / 2][1] = input_[i + 1];
-    }
-    count_point = grahamScan(graham_input_);
-  }
+  // each rank keeps only its points on the hull boundary, and rank 0 puts
+  // those in order
+  const auto local = ppc::core::geometry::scatter_points(world, input_);
+  hull_ = ppc::core::geometry::convex_hull(world, local, ppc::core::geometry::HullPoints::kBoundary);
+  if (world.rank() == 0) ppc::core::geometry::start_at(hull_, lowest_then_rightmost);
 
   return true;
 }
@@ -186,11 +101,7 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskParallel::post_processing() {
   internal_order_test();
 
   if (world.rank() == 0) {
-    reinterpret_cast<int*>(taskData->outputs[0])[0] = count_point;
-    for (int i = 0; i < count_point * 2; i += 2) {
-      reinterpret_cast<double*>(taskData->outputs[1])[i] = graham_input_[i / 2][0];
-      reinterpret_cast<double*>(taskData->outputs[1])[i + 1] = graham_input_[i / 2][1];
-    }
+    write_hull(hull_, *taskData);
   }
 
   return true;
@@ -16,8 +16,6 @@ struct Node {
   bool operator>(const Node& other) const { return value > other.value; }
 };
 
-void mergeSortedVectorsInPlace(std::vector<double>& arr, const std::vector<int>& sizes, const std::vector<int>& displs);
-
 template <typename RandomIt>
 void radixSortDouble(RandomIt begin, RandomIt end) {
   if (begin == end) return;
@@ -87,8 +85,6 @@ class RadixSimpleMerge : public ppc::core::Task {
   int wrank;
   int vsize;
   std::vector<double> arr;
-  std::vector<int> sizes;
-  std::vector<int> displs;
   std::vector<double> local_arr;
   boost::mpi::communicator world;
 };
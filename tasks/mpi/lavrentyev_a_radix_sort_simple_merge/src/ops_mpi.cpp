@@ -3,38 +3,10 @@
 #include <algorithm>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/vector.hpp>
-#include <queue>
+#include <functional>
 #include <vector>
 
-void lavrentyev_a_radix_sort_simple_merge_mpi::mergeSortedVectorsInPlace(std::vector<double>& arr,
-                                                                         const std::vector<int>& sizes,
-                                                                         const std::vector<int>& displs) {
-  std::vector<double> result;
-  using Element = std::pair<double, std::pair<int, int>>;
-  std::priority_queue<Element, std::vector<Element>, std::greater<>> min_heap;
-
-  for (size_t i = 0; i < sizes.size(); ++i) {
-    if (sizes[i] > 0) {
-      min_heap.push({arr[displs[i]], {static_cast<int>(i), 0}});
-    }
-  }
-
-  while (!min_heap.empty()) {
-    auto [value, indices] = min_heap.top();
-    min_heap.pop();
-
-    result.push_back(value);
-
-    int vec_index = indices.first;
-    int elem_index = indices.second;
-
-    if (elem_index + 1 < sizes[vec_index]) {
-      min_heap.push({arr[displs[vec_index] + elem_index + 1], {vec_index, elem_index + 1}});
-    }
-  }
-
-  arr = std::move(result);
-}
+#include "core/sort/include/sample_sort_mpi.hpp"
 
 bool lavrentyev_a_radix_sort_simple_merge_mpi::RadixSimpleMerge::validation() {
   internal_order_test();
@@ -58,29 +30,17 @@ bool lavrentyev_a_radix_sort_simple_merge_mpi::RadixSimpleMerge::pre_processing(
     arr.assign(vec_data, vec_data + vsize);
   }
 
-  sizes.resize(wsize, 0);
-  displs.resize(wsize, 0);
-
-  for (int i = 0; i < wsize; i++) {
-    sizes[i] = vsize / wsize + (i < vsize % wsize ? 1 : 0);
-    displs[i] = (i == 0) ? 0 : displs[i - 1] + sizes[i - 1];
-  }
-
-  local_arr.resize(sizes[wrank]);
-
   return true;
 }
 
 bool lavrentyev_a_radix_sort_simple_merge_mpi::RadixSimpleMerge::run() {
   internal_order_test();
 
-  boost::mpi::scatterv(world, arr.data(), sizes, displs, local_arr.data(), sizes[wrank], 0);
-
-  radixSortDouble(local_arr.begin(), local_arr.end());
+  local_arr = ppc::core::sort::scatter_even(world, arr, 0);
 
-  if (wrank == 0) arr.clear();
-  boost::mpi::gatherv(world, local_arr.data(), local_arr.size(), arr.data(), sizes, displs, 0);
-  if (wrank == 0) mergeSortedVectorsInPlace(arr, sizes, displs);
+  ppc::core::sort::sample_sort(world, local_arr, std::less<>(),
+                               [](std::vector<double>& v) { radixSortDouble(v.begin(), v.end()); });
+  arr = ppc::core::sort::gather_sorted(world, local_arr, 0);
 
   return true;
 }
@@ -404,3 +404,83 @@ TEST(lopatin_i_quick_batcher_mergesort_mpi, test_6300_int) {
     EXPECT_EQ(resultArray, referenceArray);
   }
 }
+
+TEST(lopatin_i_quick_batcher_mergesort_mpi, test_hypercube_6300_int) {
+  boost::mpi::communicator world;
+  std::vector<int> inputArray = lopatin_i_quick_bathcer_sort_mpi::generateArray(6300, -300, 300);
+  std::vector<int> resultArray(6300, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataParallel = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    taskDataParallel->inputs.emplace_back(reinterpret_cast<uint8_t *>(inputArray.data()));
+    taskDataParallel->inputs_count.emplace_back(inputArray.size());
+    taskDataParallel->outputs.emplace_back(reinterpret_cast<uint8_t *>(resultArray.data()));
+    taskDataParallel->outputs_count.emplace_back(resultArray.size());
+  }
+
+  lopatin_i_quick_batcher_mergesort_mpi::TestMPITaskParallel testTaskParallel(
+      taskDataParallel, lopatin_i_quick_batcher_mergesort_mpi::MergeMode::kHypercube);
+  ASSERT_TRUE(testTaskParallel.validation());
+  testTaskParallel.pre_processing();
+  testTaskParallel.run();
+  testTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    std::vector<int> referenceArray(6300, 0);
+    std::shared_ptr<ppc::core::TaskData> taskDataSequential = std::make_shared<ppc::core::TaskData>();
+
+    taskDataSequential->inputs.emplace_back(reinterpret_cast<uint8_t *>(inputArray.data()));
+    taskDataSequential->inputs_count.emplace_back(inputArray.size());
+    taskDataSequential->outputs.emplace_back(reinterpret_cast<uint8_t *>(referenceArray.data()));
+    taskDataSequential->outputs_count.emplace_back(referenceArray.size());
+
+    lopatin_i_quick_batcher_mergesort_mpi::TestMPITaskSequential testTaskSequential(taskDataSequential);
+    ASSERT_TRUE(testTaskSequential.validation());
+    testTaskSequential.pre_processing();
+    testTaskSequential.run();
+    testTaskSequential.post_processing();
+
+    EXPECT_EQ(resultArray, referenceArray);
+  }
+}
+
+TEST(lopatin_i_quick_batcher_mergesort_mpi, test_hypercube_duplicates_1000_int) {
+  boost::mpi::communicator world;
+  std::vector<int> inputArray = lopatin_i_quick_bathcer_sort_mpi::generateArray(1000, -3, 3);
+  std::vector<int> resultArray(1000, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataParallel = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    taskDataParallel->inputs.emplace_back(reinterpret_cast<uint8_t *>(inputArray.data()));
+    taskDataParallel->inputs_count.emplace_back(inputArray.size());
+    taskDataParallel->outputs.emplace_back(reinterpret_cast<uint8_t *>(resultArray.data()));
+    taskDataParallel->outputs_count.emplace_back(resultArray.size());
+  }
+
+  lopatin_i_quick_batcher_mergesort_mpi::TestMPITaskParallel testTaskParallel(
+      taskDataParallel, lopatin_i_quick_batcher_mergesort_mpi::MergeMode::kHypercube);
+  ASSERT_TRUE(testTaskParallel.validation());
+  testTaskParallel.pre_processing();
+  testTaskParallel.run();
+  testTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    std::vector<int> referenceArray(1000, 0);
+    std::shared_ptr<ppc::core::TaskData> taskDataSequential = std::make_shared<ppc::core::TaskData>();
+
+    taskDataSequential->inputs.emplace_back(reinterpret_cast<uint8_t *>(inputArray.data()));
+    taskDataSequential->inputs_count.emplace_back(inputArray.size());
+    taskDataSequential->outputs.emplace_back(reinterpret_cast<uint8_t *>(referenceArray.data()));
+    taskDataSequential->outputs_count.emplace_back(referenceArray.size());
+
+    lopatin_i_quick_batcher_mergesort_mpi::TestMPITaskSequential testTaskSequential(taskDataSequential);
+    ASSERT_TRUE(testTaskSequential.validation());
+    testTaskSequential.pre_processing();
+    testTaskSequential.run();
+    testTaskSequential.post_processing();
+
+    EXPECT_EQ(resultArray, referenceArray);
+  }
+}
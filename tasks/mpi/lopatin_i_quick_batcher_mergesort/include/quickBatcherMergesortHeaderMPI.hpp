@@ -12,6 +12,9 @@ namespace lopatin_i_quick_batcher_mergesort_mpi {
 void quicksort(std::vector<int>& arr, int low, int high);
 int partition(std::vector<int>& arr, int low, int high);
 
+// How the parallel task combines the sorted blocks of the ranks.
+enum class MergeMode { kBatcher, kHypercube };
+
 class TestMPITaskSequential : public ppc::core::Task {
  public:
   explicit TestMPITaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
@@ -29,7 +32,8 @@ class TestMPITaskSequential : public ppc::core::Task {
 
 class TestMPITaskParallel : public ppc::core::Task {
  public:
-  explicit TestMPITaskParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  explicit TestMPITaskParallel(std::shared_ptr<ppc::core::TaskData> taskData_, MergeMode mode_ = MergeMode::kBatcher)
+      : Task(std::move(taskData_)), mode(mode_) {}
   bool validation() override;
   bool pre_processing() override;
   bool run() override;
@@ -43,6 +47,7 @@ class TestMPITaskParallel : public ppc::core::Task {
 
   int sizeArray;
 
+  MergeMode mode;
   boost::mpi::communicator world;
 };
 
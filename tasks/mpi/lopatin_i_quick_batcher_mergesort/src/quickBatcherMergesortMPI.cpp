@@ -1,5 +1,10 @@
 #include "mpi/lopatin_i_quick_batcher_mergesort/include/quickBatcherMergesortHeaderMPI.hpp"
 
+#include <functional>
+
+#include "core/sort/include/batcher_mpi.hpp"
+#include "core/sort/include/hypercube_mpi.hpp"
+
 namespace lopatin_i_quick_batcher_mergesort_mpi {
 
 void quicksort(std::vector<int>& arr, int low, int high) {
@@ -97,107 +102,14 @@ bool TestMPITaskParallel::pre_processing() {
 bool TestMPITaskParallel::run() {
   internal_order_test();
 
-  boost::mpi::broadcast(world, sizeArray, 0);
-
-  int chunkSize = sizeArray / world.size();
-  int remainder = sizeArray % world.size();
-
-  int startPosition = world.rank() * chunkSize;
-  int actualChunkSize = chunkSize;
-
-  if (world.rank() < remainder) {
-    startPosition += world.rank();
-    actualChunkSize++;
-  } else {
-    startPosition += remainder;
-  }
-
-  localArray.resize(actualChunkSize);
-
-  if (world.rank() == 0) {
-    for (int proc = 1; proc < world.size(); proc++) {
-      int procStartPosition = proc * chunkSize;
-      int procActualChunkSize = chunkSize;
-      if (proc < remainder) {
-        procStartPosition += proc;
-        procActualChunkSize++;
-      } else {
-        procStartPosition += remainder;
-      }
-      if (procActualChunkSize > 0) {
-        world.send(proc, 0, inputArray_.data() + procStartPosition, procActualChunkSize);
-      }
-    }
-    std::copy(inputArray_.begin() + startPosition, inputArray_.begin() + startPosition + actualChunkSize,
-              localArray.begin());
-  } else {
-    if (actualChunkSize > 0) {
-      world.recv(0, 0, localArray.data(), actualChunkSize);
-    }
-  }
-
-  quicksort(localArray, 0, localArray.size() - 1);
-
-  for (int oddEvenStep = 0; oddEvenStep < world.size(); oddEvenStep++) {
-    int border = world.size();
-    if (oddEvenStep % 2 == 0) {  // odd
-      if (world.size() % 2 != 0) {
-        border -= 1;
-      }
-      if (world.rank() >= border) {
-        continue;
-      }
-
-      std::vector<int> recvArray(actualChunkSize);
-
-      if (world.rank() % 2 == 0) {
-        world.send(world.rank() + 1, 0, localArray);
-        world.recv(world.rank() + 1, 1, recvArray);
-        std::vector<int> mergedArrays(localArray.size() + recvArray.size());
-        std::merge(localArray.begin(), localArray.end(), recvArray.begin(), recvArray.end(), mergedArrays.begin());
-        localArray = mergedArrays;
-        localArray.resize(actualChunkSize);
-      } else {
-        world.recv(world.rank() - 1, 0, recvArray);
-        world.send(world.rank() - 1, 1, localArray);
-        std::vector<int> mergedArrays(localArray.size() + recvArray.size());
-        std::merge(localArray.begin(), localArray.end(), recvArray.begin(), recvArray.end(), mergedArrays.begin());
-        localArray = mergedArrays;
-        localArray.erase(localArray.begin(), localArray.begin() + localArray.size() / 2);
-      }
-    } else {  // even
-      if (world.size() % 2 == 0) {
-        border -= 1;
-      }
-      if (world.rank() < 1 || world.rank() >= border) {
-        continue;
-      }
-
-      std::vector<int> recvArray(actualChunkSize);
-
-      if (world.rank() % 2 != 0) {
-        world.send(world.rank() + 1, 0, localArray);
-        world.recv(world.rank() + 1, 1, recvArray);
-        std::vector<int> mergedArrays(localArray.size() + recvArray.size());
-        std::merge(localArray.begin(), localArray.end(), recvArray.begin(), recvArray.end(), mergedArrays.begin());
-        localArray = mergedArrays;
-        localArray.resize(actualChunkSize);
-      } else {
-        world.recv(world.rank() - 1, 0, recvArray);
-        world.send(world.rank() - 1, 1, localArray);
-        std::vector<int> mergedArrays(localArray.size() + recvArray.size());
-        std::merge(localArray.begin(), localArray.end(), recvArray.begin(), recvArray.end(), mergedArrays.begin());
-        localArray = mergedArrays;
-        localArray.erase(localArray.begin(), localArray.begin() + localArray.size() / 2);
-      }
-    }
-  }
-
-  if (world.rank() == 0) {
-    boost::mpi::gather(world, localArray.data(), actualChunkSize, resultArray_, 0);
+  const auto localSort = [](std::vector<int>& v) { quicksort(v, 0, static_cast<int>(v.size()) - 1); };
+  localArray = ppc::core::sort::scatter_even(world, inputArray_, 0);
+  if (mode == MergeMode::kHypercube) {
+    ppc::core::sort::hypercube_quicksort(world, localArray, std::less<>(), localSort);
   } else {
-    boost::mpi::gather(world, localArray.data(), actualChunkSize, 0);
+    ppc::core::sort::batcher_sort(world, localArray, std::less<>(), localSort);
   }
+  resultArray_ = ppc::core::sort::gather_sorted(world, localArray, 0);
 
   return true;
 }
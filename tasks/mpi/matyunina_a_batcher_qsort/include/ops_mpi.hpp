@@ -5,17 +5,14 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/request.hpp>
 #include <cmath>
-#include <stack>
 #include <string>
 #include <vector>
 
+#include "core/sort/include/quicksort.hpp"
 #include "core/task/include/task.hpp"
 
 namespace matyunina_a_batcher_qsort_mpi {
 
-template <typename T>
-void quickSort(std::vector<T>& data);
-
 template <typename T>
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -66,7 +63,7 @@ template <typename T>
 bool matyunina_a_batcher_qsort_mpi::TestTaskSequential<T>::run() {
   internal_order_test();
 
-  quickSort(data_);
+  ppc::core::sort::quicksort(data_);
 
   return true;
 }
@@ -129,7 +126,7 @@ bool matyunina_a_batcher_qsort_mpi::TestTaskParallel<T>::run() {
     world.irecv(0, world.rank(), local_.data(), local_size).wait();
   }
 
-  quickSort(local_);
+  ppc::core::sort::quicksort(local_);
 
   if (world.rank() == 0) {
     for (auto& req : reqs) {
@@ -213,45 +210,3 @@ bool matyunina_a_batcher_qsort_mpi::TestTaskParallel<T>::post_processing() {
 
   return true;
 }
-
-template <typename T>
-void matyunina_a_batcher_qsort_mpi::quickSort(std::vector<T>& data) {
-  if (data.empty()) return;
-
-  std::stack<std::pair<uint32_t, uint32_t>> stack;
-  stack.emplace(0, data.size() - 1);
-
-  uint32_t low;
-  uint32_t high;
-  T pivot;
-  uint32_t i;
-  std::pair<uint32_t, uint32_t> range;
-  while (!stack.empty()) {
-    range = stack.top();
-    stack.pop();
-
-    low = range.first;
-    high = range.second;
-    if (low < high) {
-      pivot = data[high];
-      i = low;
-
-      for (uint32_t j = low; j < high; j++) {
-        if (data[j] <= pivot) {
-          if (i != j) {
-            std::swap(data[i], data[j]);
-          }
-          i++;
-        }
-      }
-      std::swap(data[i], data[high]);
-
-      if (i > 0 && low < i - 1) {
-        stack.emplace(low, i - 1);
-      }
-      if (i + 1 < high) {
-        stack.emplace(i + 1, high);
-      }
-    }
-  }
-}
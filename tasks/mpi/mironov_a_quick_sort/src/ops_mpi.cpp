@@ -3,6 +3,8 @@
 #include <thread>
 #include <utility>
 
+#include "core/sort/include/quicksort.hpp"
+
 bool mironov_a_quick_sort_mpi::QuickSortMPI::pre_processing() {
   internal_order_test();
   if (world.rank() == 0) {
@@ -55,24 +57,6 @@ static void merge(std::vector<int>& vec, int start, int end, int* res) {
   }
 }
 
-static void quickSort(std::vector<int>& arr, int start, int end) {
-  if (start >= end) return;
-
-  int pivot = arr[(start + end) / 2];
-  int left = start;
-  int right = end;
-
-  while (left <= right) {
-    while (arr[left] < pivot) left++;
-    while (arr[right] > pivot) right--;
-
-    if (left <= right) std::swap(arr[left++], arr[right--]);
-  }
-
-  quickSort(arr, start, right);
-  quickSort(arr, left, end);
-}
-
 bool mironov_a_quick_sort_mpi::QuickSortMPI::run() {
   internal_order_test();
 
@@ -81,7 +65,7 @@ bool mironov_a_quick_sort_mpi::QuickSortMPI::run() {
   std::vector<int> local_input(delta);
 
   scatter(world, input_.data(), local_input.data(), delta, 0);
-  quickSort(local_input, 0, delta - 1);
+  ppc::core::sort::quicksort(local_input);
 
   boost::mpi::gather(world, local_input.data(), local_input.size(), result_.data(), 0);
   if (world.rank() == 0) {
@@ -124,7 +108,7 @@ bool mironov_a_quick_sort_mpi::QuickSortSequential::run() {
   internal_order_test();
 
   result_ = input_;
-  quickSort(result_, 0, result_.size() - 1);
+  ppc::core::sort::quicksort(result_);
   return true;
 }
 
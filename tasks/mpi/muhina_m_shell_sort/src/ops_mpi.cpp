@@ -6,21 +6,12 @@
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/batcher_mpi.hpp"
+#include "core/sort/include/shell.hpp"
+
 std::vector<int> muhina_m_shell_sort_mpi::shellSort(const std::vector<int>& vect) {
   std::vector<int> sortedVec = vect;
-  int n = sortedVec.size();
-  int gap;
-  for (gap = 1; gap < n / 3; gap = gap * 3 + 1);
-  for (; gap > 0; gap = (gap - 1) / 3) {
-    for (int i = gap; i < n; i++) {
-      int temp = sortedVec[i];
-      int j;
-      for (j = i; j >= gap && sortedVec[j - gap] > temp; j -= gap) {
-        sortedVec[j] = sortedVec[j - gap];
-      }
-      sortedVec[j] = temp;
-    }
-  }
+  ppc::core::sort::shell_sort(sortedVec);
   return sortedVec;
 }
 bool muhina_m_shell_sort_mpi::ShellSortMPISequential::pre_processing() {
@@ -78,47 +69,13 @@ bool muhina_m_shell_sort_mpi::ShellSortMPIParallel::validation() {
   return true;
 }
 
-std::vector<int> muhina_m_shell_sort_mpi::merge(const std::vector<int>& left, const std::vector<int>& right) {
-  std::vector<int> result;
-  result.reserve(left.size() + right.size());
-  std::merge(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(result));
-
-  return result;
-}
-
 bool muhina_m_shell_sort_mpi::ShellSortMPIParallel::run() {
   internal_order_test();
 
-  int rank = world_.rank();
-  int size = world_.size();
-
-  int n = input_.size();
-  broadcast(world_, n, 0);
-
-  int delta = n / size;
-  int remainder = n % size;
-
-  std::vector<int> sizes(world_.size(), delta);
-  for (int i = 0; i < remainder; ++i) {
-    sizes[i]++;
-  }
-
-  local_input_.resize(delta + (rank < remainder ? 1 : 0));
-  scatterv(world_, input_, sizes, local_input_.data(), 0);
-
-  local_res_ = shellSort(local_input_);
-
-  if (world_.rank() == 0) {
-    res_ = local_res_;
-    std::vector<int> temp;
-
-    for (int i = 1; i < world_.size(); ++i) {
-      world_.recv(i, 0, temp);
-      res_ = merge(res_, temp);
-    }
-  } else {
-    world_.send(0, 0, local_res_);
-  }
+  local_res_ = ppc::core::sort::scatter_even(world_, input_, 0);
+  ppc::core::sort::batcher_sort(world_, local_res_, std::less<>(),
+                                [](std::vector<int>& v) { ppc::core::sort::shell_sort(v); });
+  res_ = ppc::core::sort::gather_sorted(world_, local_res_, 0);
 
   return true;
 }
@@ -1,11 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <cstddef>
 #include <random>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
+#include "core/sparse/include/partition.hpp"
+#include "core/sparse/include/sparse.hpp"
 #include "mpi/muradov_m_matrix_multiply_ccs/include/ops_mpi.hpp"
 
 namespace muradov_m_matrix_multiply_ccs_mpi {
@@ -51,7 +55,9 @@ std::vector<std::vector<double>> multiply_matrices(const std::vector<std::vector
   return result;
 }
 
-void func_test_template(const std::vector<std::vector<double>> &A_, const std::vector<std::vector<double>> &B_) {
+// stats, when given, receives the task's column split on rank 0.
+void func_test_template(const std::vector<std::vector<double>> &A_, const std::vector<std::vector<double>> &B_,
+                        ppc::core::sparse::PartitionStats *stats = nullptr) {
   boost::mpi::communicator world;
   std::vector<double> A_val;
   std::vector<int> A_row_ind;
@@ -127,6 +133,7 @@ void func_test_template(const std::vector<std::vector<double>> &A_, const std::v
       ASSERT_EQ(exp_C_val, C_val);
       ASSERT_EQ(exp_C_row_ind, C_row_ind);
       ASSERT_EQ(exp_C_col_ptr, C_col_ptr);
+      if (stats != nullptr) *stats = task.partition_stats();
     }
   }
 }
@@ -247,3 +254,49 @@ TEST(muradov_m_matrix_multiply_ccs_mpi, Large100x50And50x100) {
   auto B_ = muradov_m_matrix_multiply_ccs_mpi::gen_rand_matrix(50, 100, 5);
   muradov_m_matrix_multiply_ccs_mpi::func_test_template(A_, B_);
 }
+
+TEST(muradov_m_matrix_multiply_ccs_mpi, CancellingProductsAreDropped) {
+  std::vector<std::vector<double>> A_ = {{1, 1, 0}, {2, 0, 0}, {0, 0, 0}};
+  std::vector<std::vector<double>> B_ = {{1, 0}, {-1, 3}, {0, 0}};
+  muradov_m_matrix_multiply_ccs_mpi::func_test_template(A_, B_);
+}
+
+TEST(muradov_m_matrix_multiply_ccs_mpi, PowerLawColumnsOfB) {
+  boost::mpi::communicator world;
+  // column j of B has 60 / (j + 1) nonzeros, so an even split by columns
+  // would leave almost all the work on the first rank
+  auto A_ = muradov_m_matrix_multiply_ccs_mpi::gen_rand_matrix(40, 60, 600);
+  std::vector<std::vector<double>> B_(60, std::vector<double>(30, 0.0));
+  for (int j = 0; j < 30; ++j) {
+    for (int i = 0; i < 60 / (j + 1); ++i) {
+      B_[i][j] = static_cast<double>(i % 5 + 1);
+    }
+  }
+  ppc::core::sparse::PartitionStats stats;
+  muradov_m_matrix_multiply_ccs_mpi::func_test_template(A_, B_, &stats);
+
+  if (world.rank() == 0) {
+    std::vector<double> A_val;
+    std::vector<int> A_row_ind;
+    std::vector<int> A_col_ptr;
+    std::vector<double> B_val;
+    std::vector<int> B_row_ind;
+    std::vector<int> B_col_ptr;
+    muradov_m_matrix_multiply_ccs_mpi::convert_to_CCS(A_, 40, 60, A_val, A_row_ind, A_col_ptr);
+    muradov_m_matrix_multiply_ccs_mpi::convert_to_CCS(B_, 60, 30, B_val, B_row_ind, B_col_ptr);
+    ppc::core::sparse::CSCView<double> a{40, 60, A_col_ptr.data(), A_row_ind.data(), A_val.data()};
+    ppc::core::sparse::CSCView<double> b{60, 30, B_col_ptr.data(), B_row_ind.data(), B_val.data()};
+    const auto work = ppc::core::sparse::spgemm_work(b.transposed(), a.transposed());
+    const auto even = ppc::core::sparse::even_row_blocks(30, world.size());
+    const auto even_stats = ppc::core::sparse::partition_stats(work.data(), even);
+    EXPECT_LE(stats.imbalance, even_stats.imbalance);
+    // no block exceeds its share by more than one column's work, which the
+    // even split does by far
+    size_t heaviest = 0;
+    for (size_t j = 0; j + 1 < work.size(); ++j) heaviest = std::max(heaviest, work[j + 1] - work[j] + 1);
+    EXPECT_LE(static_cast<double>(stats.max_work), stats.mean_work + static_cast<double>(heaviest));
+    if (world.size() > 1) {
+      EXPECT_LT(stats.imbalance, even_stats.imbalance);
+    }
+  }
+}
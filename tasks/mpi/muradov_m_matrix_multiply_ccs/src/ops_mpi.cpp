@@ -1,6 +1,9 @@
 #include "mpi/muradov_m_matrix_multiply_ccs/include/ops_mpi.hpp"
 
 #include <cassert>
+#include <utility>
+
+#include "core/sparse/include/sparse_mpi.hpp"
 
 namespace muradov_m_matrix_multiply_ccs_mpi {
 
@@ -48,10 +51,13 @@ bool MatrixMultiplyCCS::pre_processing() {
     int B_col_ptr_size = taskData->inputs_count[9];
     B_col_ptr.assign(B_col_ptr_ptr, B_col_ptr_ptr + B_col_ptr_size);
 
-    transpose_CCS(A_val, A_row_ind, A_col_ptr, rows_A, cols_A, At_val, At_row_ind, At_col_ptr);
-
-    rows_At = cols_A;
-    cols_At = rows_A;
+    // C = A * B column by column is (B^T * A^T) row by row: split the columns
+    // of B so that every rank gets the same number of multiply-adds
+    ppc::core::sparse::CSCView<double> a{rows_A, cols_A, A_col_ptr.data(), A_row_ind.data(), A_val.data()};
+    ppc::core::sparse::CSCView<double> b{rows_B, cols_B, B_col_ptr.data(), B_row_ind.data(), B_val.data()};
+    auto work = ppc::core::sparse::spgemm_work(b.transposed(), a.transposed());
+    col_bounds = ppc::core::sparse::balanced_row_blocks(work.data(), cols_B, world.size());
+    stats = ppc::core::sparse::partition_stats(work.data(), col_bounds);
   }
 
   return true;
@@ -60,71 +66,19 @@ bool MatrixMultiplyCCS::pre_processing() {
 bool MatrixMultiplyCCS::run() {
   internal_order_test();
 
-  color = static_cast<int>(world.rank() < cols_B);
-  comm = world.split(color);
-
-  boost::mpi::broadcast(comm, B_val, 0);
-  boost::mpi::broadcast(comm, B_row_ind, 0);
-  boost::mpi::broadcast(comm, B_col_ptr, 0);
-
-  boost::mpi::broadcast(comm, At_val, 0);
-  boost::mpi::broadcast(comm, At_row_ind, 0);
-  boost::mpi::broadcast(comm, At_col_ptr, 0);
-  boost::mpi::broadcast(comm, rows_At, 0);
-
-  if (color == 1) {
-    auto pair = split_into_segments(cols_B, comm.size(), comm.rank());
-
-    loc_start = pair.first;
-    loc_end = pair.second;
-    loc_cols = loc_end - loc_start;
-
-    extract_columns(B_val, B_row_ind, B_col_ptr, loc_start, loc_end, loc_val, loc_row_ind, loc_col_ptr);
-
-    multiply_CCS(At_val, At_row_ind, At_col_ptr, rows_At, loc_val, loc_row_ind, loc_col_ptr, loc_cols, loc_res_val,
-                 loc_res_row_ind, loc_res_col_ptr);
-
-    std::vector<int> sizes_val;
-    if (comm.rank() == 0) {
-      sizes_val.resize(comm.size());
-    }
-    boost::mpi::gather(comm, loc_res_col_ptr.back(), sizes_val.data(), 0);
-
-    int size_ptr_vector = 0;
-    boost::mpi::reduce(comm, static_cast<int>(loc_res_col_ptr.size() - 1), size_ptr_vector, std::plus<>(), 0);
-
-    std::vector<int> sizes_ptr;
-    if (comm.rank() == 0) {
-      sizes_ptr.resize(size_ptr_vector);
-    }
-    boost::mpi::gather(comm, static_cast<int>(loc_res_col_ptr.size() - 1), sizes_ptr, 0);
-
-    if (comm.rank() == 0) {
-      int sum = std::accumulate(sizes_val.begin(), sizes_val.end(), 0);
-      res_val.resize(sum);
-      res_ind.resize(sum);
-      res_ptr.resize(size_ptr_vector);
-
-      boost::mpi::gatherv(comm, loc_res_val.data(), loc_res_val.size(), res_val.data(), sizes_val, 0);
-      boost::mpi::gatherv(comm, loc_res_row_ind.data(), loc_res_row_ind.size(), res_ind.data(), sizes_val, 0);
-      boost::mpi::gatherv(comm, loc_res_col_ptr.data(), loc_res_col_ptr.size() - 1, res_ptr.data(), sizes_ptr, 0);
-
-      int shift = 0;
-      int offset = 0;
-      for (size_t j = 0; j < sizes_ptr.size(); j++) {
-        shift = sizes_val[j];
-        offset += sizes_ptr[j];
-        for (size_t i = offset; i < res_ptr.size(); i++) {
-          res_ptr[i] += shift;
-        }
-      }
-
-      res_ptr.push_back(sum);
-    } else {
-      boost::mpi::gatherv(comm, loc_res_val.data(), loc_res_val.size(), 0);
-      boost::mpi::gatherv(comm, loc_res_row_ind.data(), loc_res_row_ind.size(), 0);
-      boost::mpi::gatherv(comm, loc_res_col_ptr.data(), loc_res_col_ptr.size() - 1, 0);
-    }
+  // columns of B (and so of C) are split across ranks, A is replicated
+  ppc::core::sparse::CSCView<double> a;
+  ppc::core::sparse::CSCView<double> b;
+  if (world.rank() == 0) {
+    a = {rows_A, cols_A, A_col_ptr.data(), A_row_ind.data(), A_val.data()};
+    b = {rows_B, cols_B, B_col_ptr.data(), B_row_ind.data(), B_val.data()};
+  }
+  auto c = ppc::core::sparse::multiply(world, a, b, col_bounds);
+
+  if (world.rank() == 0) {
+    res_val = std::move(c.values);
+    res_ind = std::move(c.row_idx);
+    res_ptr = std::move(c.col_ptr);
   }
 
   return true;
@@ -133,7 +87,7 @@ bool MatrixMultiplyCCS::run() {
 bool MatrixMultiplyCCS::post_processing() {
   internal_order_test();
 
-  if (color == 1 && comm.rank() == 0) {
+  if (world.rank() == 0) {
     auto* C_val_ptr = reinterpret_cast<double*>(taskData->outputs[0]);
     auto* C_row_ind_ptr = reinterpret_cast<int*>(taskData->outputs[1]);
     auto* C_col_ptr_ptr = reinterpret_cast<int*>(taskData->outputs[2]);
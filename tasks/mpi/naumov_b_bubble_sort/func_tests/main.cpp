@@ -268,3 +268,39 @@ TEST(naumov_b_bubble_sort_mpi, Test_empty_array) {
     ASSERT_FALSE(tmpTaskPar.validation());
   }
 }
+
+TEST(naumov_b_bubble_sort_mpi, Test_NearlySortedArray) {
+  boost::mpi::communicator world;
+
+  std::vector<int> input_data(1001);
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    input_data[i] = static_cast<int>(i);
+  }
+  // one key far from its place: it has to cross every block boundary
+  std::rotate(input_data.begin(), input_data.end() - 1, input_data.end());
+
+  std::vector<int> sorted_data = input_data;
+  std::sort(sorted_data.begin(), sorted_data.end());
+
+  std::vector<int> output_data(input_data.size(), 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(input_data.data()));
+    taskDataPar->inputs_count.emplace_back(input_data.size());
+
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_data.data()));
+    taskDataPar->outputs_count.emplace_back(output_data.size());
+  }
+
+  naumov_b_bubble_sort_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    ASSERT_EQ(output_data, sorted_data);
+  }
+}
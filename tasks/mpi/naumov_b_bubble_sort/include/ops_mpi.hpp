@@ -38,7 +38,6 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<int> local_input_;
   std::vector<int> input_;
   boost::mpi::communicator world;
-  int total_size_;
 };
 
 }  // namespace naumov_b_bubble_sort_mpi
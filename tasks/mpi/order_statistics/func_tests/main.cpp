@@ -0,0 +1,91 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "mpi/order_statistics/include/ops_mpi.hpp"
+
+namespace {
+
+std::vector<int> random_ints(size_t n, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  std::vector<int> v(n);
+  for (auto& x : v) x = dist(gen);
+  return v;
+}
+
+void check(std::vector<int> in, std::vector<double> qs, size_t k) {
+  boost::mpi::communicator world;
+  std::vector<int> quantiles(qs.size());
+  std::vector<int> top(k);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataPar->inputs_count.emplace_back(in.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(qs.data()));
+    taskDataPar->inputs_count.emplace_back(qs.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(quantiles.data()));
+    taskDataPar->outputs_count.emplace_back(quantiles.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(top.data()));
+    taskDataPar->outputs_count.emplace_back(top.size());
+  }
+
+  order_statistics_mpi::OrderStatisticsParallel task(taskDataPar);
+  ASSERT_TRUE(task.validation());
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+
+  if (world.rank() == 0) {
+    std::sort(in.begin(), in.end());
+    for (size_t i = 0; i < qs.size(); i++) {
+      EXPECT_EQ(quantiles[i], in[static_cast<size_t>(qs[i] * static_cast<double>(in.size() - 1))]);
+    }
+    EXPECT_EQ(top, std::vector<int>(in.rbegin(), in.rbegin() + static_cast<std::ptrdiff_t>(k)));
+  }
+}
+
+}  // namespace
+
+TEST(order_statistics_mpi, median_and_p99) { check(random_ints(100001, 1000000, 1), {0.5, 0.99}, 10); }
+
+TEST(order_statistics_mpi, many_quantiles_of_small_input) {
+  check(random_ints(37, 100, 2), {0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0}, 37);
+}
+
+TEST(order_statistics_mpi, duplicates) { check(random_ints(50000, 3, 3), {0.1, 0.5, 0.9, 0.5}, 20000); }
+
+TEST(order_statistics_mpi, sorted_input) {
+  std::vector<int> in(30000);
+  for (size_t i = 0; i < in.size(); i++) in[i] = static_cast<int>(i);
+  check(in, {0.25, 0.75}, 5);
+}
+
+TEST(order_statistics_mpi, fewer_elements_than_ranks) { check({5, -1}, {0.0, 0.5, 1.0}, 2); }
+
+TEST(order_statistics_mpi, validation_rejects_bad_queries) {
+  boost::mpi::communicator world;
+  std::vector<int> in = {1, 2, 3};
+  std::vector<double> qs = {-0.5};
+  std::vector<int> quantiles(1);
+  std::vector<int> top(1);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataPar->inputs_count.emplace_back(in.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(qs.data()));
+    taskDataPar->inputs_count.emplace_back(qs.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(quantiles.data()));
+    taskDataPar->outputs_count.emplace_back(quantiles.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(top.data()));
+    taskDataPar->outputs_count.emplace_back(top.size());
+    order_statistics_mpi::OrderStatisticsParallel task(taskDataPar);
+    EXPECT_FALSE(task.validation());
+  }
+}
@@ -0,0 +1,33 @@
+// Copyright 2024 Nesterov Alexander
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace order_statistics_mpi {
+
+// Quantiles and top-k of a vector of ints spread over all ranks, with the
+// task data of order_statistics_seq on rank 0. Each rank keeps only its
+// block: the quantiles come from a distributed quickselect and only the
+// top-k answer itself is gathered.
+class OrderStatisticsParallel : public ppc::core::Task {
+ public:
+  explicit OrderStatisticsParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  std::vector<int> input_, local_input_, quantiles_, top_;
+  std::vector<double> qs_;
+  size_t k_{};
+  boost::mpi::communicator world;
+};
+
+}  // namespace order_statistics_mpi
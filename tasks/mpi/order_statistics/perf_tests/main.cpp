@@ -0,0 +1,72 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/timer.hpp>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "mpi/order_statistics/include/ops_mpi.hpp"
+
+namespace {
+
+template <typename Run>
+void run_perf(Run run) {
+  boost::mpi::communicator world;
+  const size_t count = 1 << 23;
+  std::vector<int> in;
+  std::vector<double> qs = {0.5, 0.9, 0.99, 0.999};
+  std::vector<int> quantiles(qs.size());
+  std::vector<int> top(100);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    std::mt19937 gen(1);
+    in.resize(count);
+    for (auto& x : in) x = static_cast<int>(gen());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataPar->inputs_count.emplace_back(in.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(qs.data()));
+    taskDataPar->inputs_count.emplace_back(qs.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(quantiles.data()));
+    taskDataPar->outputs_count.emplace_back(quantiles.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(top.data()));
+    taskDataPar->outputs_count.emplace_back(top.size());
+  }
+
+  auto task = std::make_shared<order_statistics_mpi::OrderStatisticsParallel>(taskDataPar);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  run(*perfAnalyzer, perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    std::sort(in.begin(), in.end());
+    EXPECT_EQ(quantiles[0], in[(count - 1) / 2]);
+    EXPECT_EQ(top[0], in.back());
+  }
+}
+
+}  // namespace
+
+TEST(order_statistics_mpi_perf_test, test_pipeline_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.pipeline_run(attr, results); });
+}
+
+TEST(order_statistics_mpi_perf_test, test_task_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.task_run(attr, results); });
+}
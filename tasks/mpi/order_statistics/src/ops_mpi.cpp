@@ -0,0 +1,54 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi/order_statistics/include/ops_mpi.hpp"
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/serialization/vector.hpp>
+#include <functional>
+
+#include "core/sort/include/distribute_mpi.hpp"
+#include "core/sort/include/select_mpi.hpp"
+
+bool order_statistics_mpi::OrderStatisticsParallel::pre_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    const auto* input = reinterpret_cast<const int*>(taskData->inputs[0]);
+    input_.assign(input, input + taskData->inputs_count[0]);
+    const auto* qs = reinterpret_cast<const double*>(taskData->inputs[1]);
+    qs_.assign(qs, qs + taskData->inputs_count[1]);
+    k_ = taskData->outputs_count[1];
+  }
+  return true;
+}
+
+bool order_statistics_mpi::OrderStatisticsParallel::validation() {
+  internal_order_test();
+  if (world.rank() != 0) return true;
+  if (taskData->inputs.size() != 2 || taskData->inputs_count.size() != 2 || taskData->outputs.size() != 2 ||
+      taskData->outputs_count.size() != 2) {
+    return false;
+  }
+  const auto* qs = reinterpret_cast<const double*>(taskData->inputs[1]);
+  return taskData->inputs_count[0] > 0 && taskData->outputs_count[0] == taskData->inputs_count[1] &&
+         taskData->outputs_count[1] <= taskData->inputs_count[0] &&
+         std::all_of(qs, qs + taskData->inputs_count[1], [](double q) { return q >= 0.0 && q <= 1.0; });
+}
+
+bool order_statistics_mpi::OrderStatisticsParallel::run() {
+  internal_order_test();
+  local_input_ = ppc::core::sort::scatter_even(world, input_, 0);
+  boost::mpi::broadcast(world, qs_, 0);
+  boost::mpi::broadcast(world, k_, 0);
+  quantiles_ = ppc::core::sort::quantiles(world, local_input_, qs_);
+  top_ = ppc::core::sort::top_k(world, local_input_, k_, 0, std::greater<>());
+  return true;
+}
+
+bool order_statistics_mpi::OrderStatisticsParallel::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    std::copy(quantiles_.begin(), quantiles_.end(), reinterpret_cast<int*>(taskData->outputs[0]));
+    std::copy(top_.begin(), top_.end(), reinterpret_cast<int*>(taskData->outputs[1]));
+  }
+  return true;
+}
@@ -19,9 +19,6 @@ TEST(petrov_a_Shell_sort_mpi, test_pipeline_run) {
 
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
 
-  taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&vector_size));
-  taskDataPar->inputs_count.emplace_back(1);
-
   if (world.rank() == 0) {
     int current = vector_size;
     std::generate(data.begin(), data.end(), [&current]() { return current--; });
@@ -63,9 +60,6 @@ TEST(petrov_a_Shell_sort_mpi, test_task_run) {
 
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
 
-  taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&vector_size));
-  taskDataPar->inputs_count.emplace_back(1);
-
   if (world.rank() == 0) {
     int current = vector_size;
     std::generate(data.begin(), data.end(), [&current]() { return current--; });
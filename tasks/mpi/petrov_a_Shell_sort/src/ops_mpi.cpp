@@ -3,10 +3,15 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <boost/mpi/communicator.hpp>
 #include <cstring>
+#include <functional>
 #include <iostream>
 #include <vector>
 
+#include "core/sort/include/batcher_mpi.hpp"
+#include "core/sort/include/shell.hpp"
+
 namespace petrov_a_Shell_sort_mpi {
 
 bool TestTaskMPI::pre_processing() {
@@ -43,38 +48,14 @@ bool TestTaskMPI::validation() {
 }
 
 bool TestTaskMPI::run() {
-  int world_size;
-  int world_rank;
-  MPI_Comm_size(MPI_COMM_WORLD, &world_size);
-  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
-  int n;
-
-  if (world_rank == 0) {
-    n = data_.size();
-  }
-
-  MPI_Bcast(&n, 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-  int local_size = n / world_size;
-  std::vector<int> local_data(local_size);
-
-  MPI_Scatter(data_.data(), local_size, MPI_INT, local_data.data(), local_size, MPI_INT, 0, MPI_COMM_WORLD);
-
-  for (int gap = local_size / 2; gap > 0; gap /= 2) {
-    for (int i = gap; i < local_size; ++i) {
-      int temp = local_data[i];
-      int j;
-      for (j = i; j >= gap && local_data[j - gap] > temp; j -= gap) {
-        local_data[j] = local_data[j - gap];
-      }
-      local_data[j] = temp;
-    }
-  }
-
-  MPI_Gather(local_data.data(), local_size, MPI_INT, data_.data(), local_size, MPI_INT, 0, MPI_COMM_WORLD);
-
-  if (world_rank == 0) {
-    std::sort(data_.begin(), data_.end());
+  boost::mpi::communicator world;
+
+  std::vector<int> local_data = ppc::core::sort::scatter_even(world, data_, 0);
+  ppc::core::sort::batcher_sort(world, local_data, std::less<>(),
+                                [](std::vector<int>& v) { ppc::core::sort::shell_sort(v); });
+  std::vector<int> sorted_data = ppc::core::sort::gather_sorted(world, local_data, 0);
+  if (world.rank() == 0) {
+    data_ = std::move(sorted_data);
   }
 
   return true;
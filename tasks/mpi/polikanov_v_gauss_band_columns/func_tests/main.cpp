@@ -85,6 +85,93 @@ void make_test(size_t n) {
   }
 }
 
+void generateBandSystem(size_t n, size_t kl, size_t ku, std::vector<double>& band, std::vector<double>& rhs,
+                        std::vector<double>& solutions) {
+  size_t ld = kl + ku + 1;
+  band.assign(ld * n, 0.0);
+  rhs.assign(n, 0.0);
+  solutions.resize(n);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> dist(-100.0, 100.0);
+
+  for (size_t i = 0; i < n; ++i) {
+    solutions[i] = dist(gen);
+  }
+  for (size_t j = 0; j < n; ++j) {
+    size_t first = j > ku ? j - ku : 0;
+    size_t last = std::min(n - 1, j + kl);
+    for (size_t i = first; i <= last; ++i) {
+      double value = dist(gen);
+      if (i == j) {
+        value += (value < 0 ? -100.0 : 100.0) * static_cast<double>(ld);
+      }
+      band[j * ld + ku + i - j] = value;
+      rhs[i] += value * solutions[j];
+    }
+  }
+}
+
+void make_band_test(size_t n, size_t kl, size_t ku) {
+  boost::mpi::communicator world;
+  std::vector<double> band;
+  std::vector<double> rhs;
+  std::vector<double> solutions;
+  std::vector<size_t> params = {n, kl, ku};
+  std::vector<double> global_result(n);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    generateBandSystem(n, kl, ku, band, rhs, solutions);
+
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(band.data()));
+    taskDataPar->inputs_count.emplace_back(band.size());
+
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(rhs.data()));
+    taskDataPar->inputs_count.emplace_back(rhs.size());
+
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(params.data()));
+    taskDataPar->inputs_count.emplace_back(params.size());
+
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  auto taskParallel = std::make_shared<polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI>(taskDataPar);
+  ASSERT_TRUE(taskParallel->validation());
+  taskParallel->pre_processing();
+  ASSERT_TRUE(taskParallel->run());
+  // a second run solves the same system again
+  ASSERT_TRUE(taskParallel->run());
+  taskParallel->post_processing();
+
+  if (world.rank() == 0) {
+    std::vector<double> seq_results(global_result.size());
+
+    auto taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs = taskDataPar->inputs;
+    taskDataSeq->inputs_count = taskDataPar->inputs_count;
+
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(seq_results.data()));
+    taskDataSeq->outputs_count.emplace_back(seq_results.size());
+
+    auto taskSequential =
+        std::make_shared<polikanov_v_gauss_band_columns_mpi::GaussBandStorageSequentialMPI>(taskDataSeq);
+    ASSERT_TRUE(taskSequential->validation());
+    taskSequential->pre_processing();
+    ASSERT_TRUE(taskSequential->run());
+    ASSERT_TRUE(taskSequential->run());
+    taskSequential->post_processing();
+
+    for (size_t i = 0; i < n; i++) {
+      EXPECT_NEAR(global_result[i], seq_results[i], 1e-9 * (1.0 + std::abs(seq_results[i])));
+      EXPECT_NEAR(global_result[i], solutions[i], 0.01);
+    }
+  }
+}
+
 }  // namespace polikanov_v_gauss_band_columns_mpi
 
 TEST(polikanov_v_gauss_band_columns_mpi, test_random_with_matrix_size_2) {
@@ -150,3 +237,106 @@ TEST(polikanov_v_gauss_band_columns_mpi, test_random_with_matrix_size_110) {
 TEST(polikanov_v_gauss_band_columns_mpi, test_random_with_matrix_size_200) {
   polikanov_v_gauss_band_columns_mpi::make_test(200);
 }
+
+TEST(polikanov_v_gauss_band_columns_mpi, test_band_storage_tridiagonal_size_1) {
+  polikanov_v_gauss_band_columns_mpi::make_band_test(1, 0, 0);
+}
+
+TEST(polikanov_v_gauss_band_columns_mpi, test_band_storage_tridiagonal_size_50) {
+  polikanov_v_gauss_band_columns_mpi::make_band_test(50, 1, 1);
+}
+
+TEST(polikanov_v_gauss_band_columns_mpi, test_band_storage_lower_only_size_40) {
+  polikanov_v_gauss_band_columns_mpi::make_band_test(40, 3, 0);
+}
+
+TEST(polikanov_v_gauss_band_columns_mpi, test_band_storage_asymmetric_size_200) {
+  polikanov_v_gauss_band_columns_mpi::make_band_test(200, 2, 5);
+}
+
+TEST(polikanov_v_gauss_band_columns_mpi, test_band_storage_wide_size_500) {
+  polikanov_v_gauss_band_columns_mpi::make_band_test(500, 8, 8);
+}
+
+TEST(polikanov_v_gauss_band_columns_mpi, test_band_storage_needs_pivoting) {
+  boost::mpi::communicator world;
+  // A = [[0, 1, 0], [1, 0, 1], [0, 1, 0.5]], x = (1, 2, 3)
+  std::vector<double> band = {0, 0, 1, 1, 0, 1, 1, 0.5, 0};
+  std::vector<double> rhs = {2, 4, 3.5};
+  std::vector<size_t> params = {3, 1, 1};
+  std::vector<double> global_result(3);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(band.data()));
+    taskDataPar->inputs_count.emplace_back(band.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(rhs.data()));
+    taskDataPar->inputs_count.emplace_back(rhs.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(params.data()));
+    taskDataPar->inputs_count.emplace_back(params.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI taskParallel(taskDataPar);
+  ASSERT_TRUE(taskParallel.validation());
+  taskParallel.pre_processing();
+  ASSERT_TRUE(taskParallel.run());
+  taskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    EXPECT_NEAR(global_result[0], 1.0, 1e-12);
+    EXPECT_NEAR(global_result[1], 2.0, 1e-12);
+    EXPECT_NEAR(global_result[2], 3.0, 1e-12);
+  }
+}
+
+TEST(polikanov_v_gauss_band_columns_mpi, test_band_storage_singular) {
+  boost::mpi::communicator world;
+  std::vector<double> band = {0, 1, 2, 0, 0, 0, 4, 0};
+  std::vector<double> rhs = {1, 1, 1, 1};
+  std::vector<size_t> params = {4, 1, 0};
+  std::vector<double> global_result(4);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(band.data()));
+    taskDataPar->inputs_count.emplace_back(band.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(rhs.data()));
+    taskDataPar->inputs_count.emplace_back(rhs.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(params.data()));
+    taskDataPar->inputs_count.emplace_back(params.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI taskParallel(taskDataPar);
+  ASSERT_TRUE(taskParallel.validation());
+  taskParallel.pre_processing();
+  EXPECT_FALSE(taskParallel.run());
+}
+
+TEST(polikanov_v_gauss_band_columns_mpi, test_band_storage_wrong_band_size) {
+  boost::mpi::communicator world;
+  std::vector<double> band(10, 1.0);
+  std::vector<double> rhs(4, 1.0);
+  std::vector<size_t> params = {4, 1, 1};
+  std::vector<double> global_result(4);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(band.data()));
+    taskDataPar->inputs_count.emplace_back(band.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(rhs.data()));
+    taskDataPar->inputs_count.emplace_back(rhs.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(params.data()));
+    taskDataPar->inputs_count.emplace_back(params.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI taskParallel(taskDataPar);
+  if (world.rank() == 0) {
+    EXPECT_FALSE(taskParallel.validation());
+  }
+}
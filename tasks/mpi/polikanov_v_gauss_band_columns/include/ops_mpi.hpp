@@ -7,9 +7,12 @@
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <vector>
 
+#include "core/linalg/include/band.hpp"
 #include "core/task/include/task.hpp"
 
 namespace polikanov_v_gauss_band_columns_mpi {
@@ -304,6 +307,8 @@ class Matrix {
   size_t get_size() const { return data->size(); }
 };
 
+using ppc::core::linalg::BandMatrix;
+
 class GaussBandColumnsParallelMPI : public ppc::core::Task {
  public:
   explicit GaussBandColumnsParallelMPI(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
@@ -337,4 +342,47 @@ class GaussBandColumnsSequentialMPI : public ppc::core::Task {
   std::vector<double> answers;
 };
 
+// Banded solver fed with the compact LAPACK band array instead of a dense
+// augmented matrix. Columns are dealt cyclically in blocks sized so that one
+// round of blocks covers the kl + ku + 1 columns touched by an elimination
+// step, so every rank has work on every step and only the pivot column
+// (kl + 1 values) is broadcast.
+// inputs: band ((kl + ku + 1) * n), b (n), {n, kl, ku}; outputs: x (n)
+class GaussBandStorageParallelMPI : public ppc::core::Task {
+ public:
+  explicit GaussBandStorageParallelMPI(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int owner(size_t j) const { return static_cast<int>((j / block) % world.size()); }
+  size_t local_index(size_t j) const { return (j / block) / world.size() * block + j % block; }
+
+  BandMatrix band;
+  size_t n{};
+  size_t kl{};
+  size_t ku{};
+  size_t block{};
+  std::vector<double> local_columns;
+  std::vector<double> rhs;
+  std::vector<double> answers;
+  boost::mpi::communicator world;
+};
+
+class GaussBandStorageSequentialMPI : public ppc::core::Task {
+ public:
+  explicit GaussBandStorageSequentialMPI(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  BandMatrix band;
+  std::vector<double> rhs;
+  std::vector<double> answers;
+};
+
 }  // namespace polikanov_v_gauss_band_columns_mpi
@@ -163,3 +163,63 @@ TEST(polikanov_v_gauss_band_columns_mpi, task_run) {
     }
   }
 }
+
+TEST(polikanov_v_gauss_band_columns_mpi, band_storage_pipeline_run) {
+  boost::mpi::environment env;
+  boost::mpi::communicator world;
+
+  size_t n = 100000;
+  size_t kl = 5;
+  size_t ku = 5;
+  size_t ld = kl + ku + 1;
+  std::vector<double> band;
+  std::vector<double> rhs;
+  std::vector<size_t> params = {n, kl, ku};
+  std::vector<double> global_result(n);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    band.assign(ld * n, 1.0);
+    rhs.assign(n, 0.0);
+    for (size_t j = 0; j < n; ++j) {
+      band[j * ld + ku] = 2.0 * static_cast<double>(ld);
+    }
+    for (size_t j = 0; j < n; ++j) {
+      size_t first = j > ku ? j - ku : 0;
+      size_t last = std::min(n - 1, j + kl);
+      for (size_t i = first; i <= last; ++i) {
+        rhs[i] += band[j * ld + ku + i - j];
+      }
+    }
+
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(band.data()));
+    taskDataPar->inputs_count.emplace_back(band.size());
+
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(rhs.data()));
+    taskDataPar->inputs_count.emplace_back(rhs.size());
+
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(params.data()));
+    taskDataPar->inputs_count.emplace_back(params.size());
+
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  auto taskParallel = std::make_shared<polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI>(taskDataPar);
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(taskParallel);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    for (size_t i = 0; i < n; i++) {
+      ASSERT_NEAR(global_result[i], 1.0, 1e-9);
+    }
+  }
+}
@@ -73,6 +73,22 @@ bool hasUniqueSolution(const std::vector<double>& augmentedMatrix1D, int n) {
   return (rankA == rankAug && rankA == n);
 }
 
+namespace {
+
+bool validBandInput(const std::shared_ptr<ppc::core::TaskData>& taskData) {
+  if (taskData->inputs.size() != 3 || taskData->inputs_count[2] != 3 || taskData->outputs.empty()) {
+    return false;
+  }
+  auto* params = reinterpret_cast<size_t*>(taskData->inputs[2]);
+  size_t n = params[0];
+  size_t kl = params[1];
+  size_t ku = params[2];
+  return n >= 1 && kl < n && ku < n && taskData->inputs_count[0] == (kl + ku + 1) * n &&
+         taskData->inputs_count[1] == n && taskData->outputs_count[0] == n;
+}
+
+}  // namespace
+
 bool polikanov_v_gauss_band_columns_mpi::GaussBandColumnsParallelMPI::validation() {
   internal_order_test();
 
@@ -281,3 +297,170 @@ bool polikanov_v_gauss_band_columns_mpi::GaussBandColumnsSequentialMPI::post_pro
 
   return true;
 }
+
+bool polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI::validation() {
+  internal_order_test();
+
+  if (world.rank() == 0) {
+    return validBandInput(taskData);
+  }
+
+  return true;
+}
+
+bool polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI::pre_processing() {
+  internal_order_test();
+
+  if (world.rank() == 0) {
+    auto* params = reinterpret_cast<size_t*>(taskData->inputs[2]);
+    n = params[0];
+    kl = params[1];
+    ku = params[2];
+    band = BandMatrix::from_compact(reinterpret_cast<double*>(taskData->inputs[0]), n, kl, ku);
+    auto* rhs_data = reinterpret_cast<double*>(taskData->inputs[1]);
+    rhs.assign(rhs_data, rhs_data + n);
+  }
+
+  return true;
+}
+
+bool polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI::run() {
+  internal_order_test();
+
+  std::vector<size_t> params = {n, kl, ku};
+  boost::mpi::broadcast(world, params.data(), 3, 0);
+  n = params[0];
+  kl = params[1];
+  ku = params[2];
+
+  size_t ld = BandMatrix::leading_dim(kl, ku);
+  size_t size = world.size();
+  block = std::max<size_t>(1, (kl + ku + size) / size);
+
+  std::vector<int> counts(size, 0);
+  for (size_t j = 0; j < n; ++j) counts[owner(j)] += static_cast<int>(ld);
+  std::vector<int> displs(size, 0);
+  for (size_t r = 1; r < size; ++r) displs[r] = displs[r - 1] + counts[r - 1];
+
+  local_columns.assign(counts[world.rank()], 0.0);
+  std::vector<double> packed;
+  if (world.rank() == 0) {
+    packed.resize(n * ld);
+    for (size_t j = 0; j < n; ++j) {
+      std::copy(band.column(j), band.column(j) + ld, packed.begin() + displs[owner(j)] + local_index(j) * ld);
+    }
+    boost::mpi::scatterv(world, packed.data(), counts, displs, local_columns.data(), counts[0], 0);
+  } else {
+    boost::mpi::scatterv(world, local_columns.data(), counts[world.rank()], 0);
+  }
+
+  // A(i, j) of an owned column j sits at local_columns[local_index(j) * ld + kl + ku + i - j]
+  auto slot = [&](size_t i, size_t j) { return local_columns.data() + local_index(j) * ld + kl + ku + i - j; };
+
+  std::vector<size_t> pivots(n);
+  std::vector<double> pivot_column(kl + 1);
+  for (size_t k = 0; k < n; ++k) {
+    size_t last = std::min(n - 1, k + kl);
+    size_t len = last - k;
+    int root = owner(k);
+    if (world.rank() == root) {
+      double* col = slot(k, k);
+      size_t p = 0;
+      for (size_t i = 1; i <= len; ++i) {
+        if (std::abs(col[i]) > std::abs(col[p])) p = i;
+      }
+      if (std::abs(col[p]) < 1e-12) {
+        pivot_column[0] = -1.0;
+      } else {
+        std::swap(col[0], col[p]);
+        double inv = 1.0 / col[0];
+        for (size_t i = 1; i <= len; ++i) pivot_column[i] = col[i] *= inv;
+        pivot_column[0] = static_cast<double>(p);
+      }
+    }
+    boost::mpi::broadcast(world, pivot_column.data(), static_cast<int>(len + 1), root);
+    if (pivot_column[0] < 0) {
+      return false;
+    }
+    size_t p = k + static_cast<size_t>(pivot_column[0]);
+    pivots[k] = p;
+
+    size_t jlast = std::min(n - 1, k + kl + ku);
+    for (size_t j = k + 1; j <= jlast; ++j) {
+      if (owner(j) != world.rank()) continue;
+      double* col = slot(k, j);
+      std::swap(col[0], col[p - k]);
+      double t = col[0];
+      if (t == 0.0) continue;
+      for (size_t i = 1; i <= len; ++i) col[i] -= pivot_column[i] * t;
+    }
+  }
+
+  if (world.rank() == 0) {
+    boost::mpi::gatherv(world, local_columns.data(), counts[0], packed.data(), counts, displs, 0);
+    // the factors go to a matrix of their own: band stays the input for the next run
+    BandMatrix factors(n, kl, ku);
+    for (size_t j = 0; j < n; ++j) {
+      auto from = packed.begin() + displs[owner(j)] + local_index(j) * ld;
+      std::copy(from, from + ld, factors.column(j));
+    }
+    factors.get_pivots() = pivots;
+    answers = rhs;
+    factors.solve(answers);
+  } else {
+    boost::mpi::gatherv(world, local_columns.data(), counts[world.rank()], 0);
+  }
+
+  return true;
+}
+
+bool polikanov_v_gauss_band_columns_mpi::GaussBandStorageParallelMPI::post_processing() {
+  internal_order_test();
+
+  if (world.rank() == 0) {
+    auto* output_data = reinterpret_cast<double*>(taskData->outputs[0]);
+    std::copy(answers.begin(), answers.end(), output_data);
+  }
+
+  return true;
+}
+
+bool polikanov_v_gauss_band_columns_mpi::GaussBandStorageSequentialMPI::validation() {
+  internal_order_test();
+
+  return validBandInput(taskData);
+}
+
+bool polikanov_v_gauss_band_columns_mpi::GaussBandStorageSequentialMPI::pre_processing() {
+  internal_order_test();
+
+  auto* params = reinterpret_cast<size_t*>(taskData->inputs[2]);
+  band = BandMatrix::from_compact(reinterpret_cast<double*>(taskData->inputs[0]), params[0], params[1], params[2]);
+  auto* rhs_data = reinterpret_cast<double*>(taskData->inputs[1]);
+  rhs.assign(rhs_data, rhs_data + params[0]);
+
+  return true;
+}
+
+bool polikanov_v_gauss_band_columns_mpi::GaussBandStorageSequentialMPI::run() {
+  internal_order_test();
+
+  // factor a copy, so that every run starts from the input matrix
+  BandMatrix factors = band;
+  if (!factors.factorize()) {
+    return false;
+  }
+  answers = rhs;
+  factors.solve(answers);
+
+  return true;
+}
+
+bool polikanov_v_gauss_band_columns_mpi::GaussBandStorageSequentialMPI::post_processing() {
+  internal_order_test();
+
+  auto* output_data = reinterpret_cast<double*>(taskData->outputs[0]);
+  std::copy(answers.begin(), answers.end(), output_data);
+
+  return true;
+}
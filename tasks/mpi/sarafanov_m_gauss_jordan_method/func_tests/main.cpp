@@ -597,3 +597,134 @@ TEST(sarafanov_m_gauss_jordan_method_mpi, random_eleven) {
     EXPECT_TRUE(true);
   }
 }
+
+TEST(sarafanov_m_gauss_jordan_method_mpi, multi_rhs_block) {
+  boost::mpi::communicator world;
+
+  int n = 3;
+  std::vector<double> a = {1, 2, 1, 4, 8, 3, 2, 5, 9};
+  // columns: x = (250, -130, 20) and x = (1, 1, 1)
+  std::vector<double> b = {10, 4, 20, 15, 30, 16};
+  std::vector<double> global_result(b.size());
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+    taskDataPar->inputs_count.emplace_back(a.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    taskDataPar->inputs_count.emplace_back(b.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  sarafanov_m_gauss_jordan_method_mpi::GaussJordanMultiRHSParallelMPI taskParallel(taskDataPar);
+  ASSERT_TRUE(taskParallel.validation());
+  ASSERT_TRUE(taskParallel.pre_processing());
+  ASSERT_TRUE(taskParallel.run());
+  ASSERT_TRUE(taskParallel.post_processing());
+
+  if (world.rank() == 0) {
+    std::vector<double> expected = {250, 1, -130, 1, 20, 1};
+    for (size_t i = 0; i < expected.size(); i++) {
+      EXPECT_NEAR(global_result[i], expected[i], 1e-9);
+    }
+  }
+}
+
+TEST(sarafanov_m_gauss_jordan_method_mpi, multi_rhs_inverse_random_eleven) {
+  boost::mpi::communicator world;
+
+  int n = 11;
+  std::vector<double> a;
+  std::vector<double> global_result(n * n);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    a = sarafanov_m_gauss_jordan_method_mpi::getRandomMatrix(n, n);
+    for (int i = 0; i < n; i++) a[i * n + i] += 20.0 * n;
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+    taskDataPar->inputs_count.emplace_back(a.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  sarafanov_m_gauss_jordan_method_mpi::GaussJordanMultiRHSParallelMPI taskParallel(taskDataPar);
+  ASSERT_TRUE(taskParallel.validation());
+  ASSERT_TRUE(taskParallel.pre_processing());
+  ASSERT_TRUE(taskParallel.run());
+  ASSERT_TRUE(taskParallel.post_processing());
+
+  if (world.rank() == 0) {
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        double sum = 0.0;
+        for (int l = 0; l < n; l++) sum += a[i * n + l] * global_result[l * n + j];
+        EXPECT_NEAR(sum, i == j ? 1.0 : 0.0, 1e-9);
+      }
+    }
+  }
+}
+
+TEST(sarafanov_m_gauss_jordan_method_mpi, multi_rhs_reuses_factorization) {
+  boost::mpi::communicator world;
+
+  int n = 3;
+  std::vector<double> a = {0, 2, 1, 4, 0, 3, 2, 5, 0};
+  std::vector<double> b(n);
+  std::vector<double> global_result(n);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+    taskDataPar->inputs_count.emplace_back(a.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    taskDataPar->inputs_count.emplace_back(b.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  sarafanov_m_gauss_jordan_method_mpi::GaussJordanMultiRHSParallelMPI taskParallel(taskDataPar);
+  ASSERT_TRUE(taskParallel.validation());
+  ASSERT_TRUE(taskParallel.pre_processing());
+  std::vector<double> x;
+  for (int rep = 1; rep <= 3; rep++) {
+    x = {1.0 * rep, -2.0, 0.5 * rep};
+    for (int i = 0; i < n; i++) b[i] = a[i * n] * x[0] + a[i * n + 1] * x[1] + a[i * n + 2] * x[2];
+    ASSERT_TRUE(taskParallel.run());
+  }
+  ASSERT_TRUE(taskParallel.post_processing());
+
+  if (world.rank() == 0) {
+    for (int i = 0; i < n; i++) EXPECT_NEAR(global_result[i], x[i], 1e-12);
+  }
+}
+
+TEST(sarafanov_m_gauss_jordan_method_mpi, multi_rhs_singular) {
+  boost::mpi::communicator world;
+
+  int n = 3;
+  std::vector<double> a = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<double> global_result(n * n);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+    taskDataPar->inputs_count.emplace_back(a.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  sarafanov_m_gauss_jordan_method_mpi::GaussJordanMultiRHSParallelMPI taskParallel(taskDataPar);
+  ASSERT_TRUE(taskParallel.validation());
+  EXPECT_FALSE(taskParallel.pre_processing());
+  EXPECT_FALSE(taskParallel.run());
+  EXPECT_FALSE(taskParallel.post_processing());
+}
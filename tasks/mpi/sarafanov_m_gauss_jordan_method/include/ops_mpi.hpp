@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/gauss_jordan_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sarafanov_m_gauss_jordan_method_mpi {
@@ -53,4 +54,25 @@ class GaussJordanMethodSequentialMPI : public ppc::core::Task {
   int n;
 };
 
+// Factors A once in pre_processing and solves a whole n x k block of
+// right-hand sides per run (A^-1 when no block is given). The caller may
+// refill the right-hand side buffer between runs to reuse the factorization.
+// inputs: A (n * n), n, optional B (n * k); outputs: X (n * k)
+class GaussJordanMultiRHSParallelMPI : public ppc::core::Task {
+ public:
+  explicit GaussJordanMultiRHSParallelMPI(std::shared_ptr<ppc::core::TaskData> taskData_)
+      : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int n = 0;
+  int k = 0;
+  std::vector<double> rhs;
+  ppc::core::linalg::GaussJordanSolverMPI solver;
+  boost::mpi::communicator world;
+};
+
 }  // namespace sarafanov_m_gauss_jordan_method_mpi
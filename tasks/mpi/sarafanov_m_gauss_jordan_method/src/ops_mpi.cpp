@@ -328,3 +328,72 @@ bool sarafanov_m_gauss_jordan_method_mpi::GaussJordanMethodSequentialMPI::post_p
 
   return true;
 }
+
+bool sarafanov_m_gauss_jordan_method_mpi::GaussJordanMultiRHSParallelMPI::validation() {
+  internal_order_test();
+  if (world.rank() != 0) {
+    return true;
+  }
+  if (taskData->inputs.size() < 2 || taskData->outputs.empty()) {
+    return false;
+  }
+  int n_val = *reinterpret_cast<int*>(taskData->inputs[1]);
+  if (n_val <= 0 || static_cast<uint32_t>(n_val * n_val) != taskData->inputs_count[0]) {
+    return false;
+  }
+  uint32_t rhs_size = static_cast<uint32_t>(n_val * n_val);
+  if (taskData->inputs.size() > 2) {
+    rhs_size = taskData->inputs_count[2];
+    if (rhs_size == 0 || rhs_size % n_val != 0) {
+      return false;
+    }
+  }
+  return taskData->outputs_count[0] == rhs_size;
+}
+
+bool sarafanov_m_gauss_jordan_method_mpi::GaussJordanMultiRHSParallelMPI::pre_processing() {
+  internal_order_test();
+
+  const double* a = nullptr;
+  if (world.rank() == 0) {
+    n = *reinterpret_cast<int*>(taskData->inputs[1]);
+    k = taskData->inputs.size() > 2 ? static_cast<int>(taskData->inputs_count[2]) / n : n;
+    a = reinterpret_cast<double*>(taskData->inputs[0]);
+  }
+  boost::mpi::broadcast(world, k, 0);
+
+  return solver.factor(a, n);
+}
+
+bool sarafanov_m_gauss_jordan_method_mpi::GaussJordanMultiRHSParallelMPI::run() {
+  internal_order_test();
+
+  if (!solver.factored()) {
+    return false;
+  }
+  if (world.rank() == 0) {
+    if (taskData->inputs.size() > 2) {
+      auto* rhs_data = reinterpret_cast<double*>(taskData->inputs[2]);
+      rhs.assign(rhs_data, rhs_data + taskData->inputs_count[2]);
+    } else {
+      rhs.assign(n * n, 0.0);
+      for (int i = 0; i < n; i++) rhs[i * n + i] = 1.0;
+    }
+  }
+  solver.solve(rhs.data(), k);
+
+  return true;
+}
+
+bool sarafanov_m_gauss_jordan_method_mpi::GaussJordanMultiRHSParallelMPI::post_processing() {
+  internal_order_test();
+  if (!solver.factored()) {
+    return false;
+  }
+  if (world.rank() == 0) {
+    auto* output_data = reinterpret_cast<double*>(taskData->outputs[0]);
+    std::copy(rhs.begin(), rhs.end(), output_data);
+  }
+
+  return true;
+}
@@ -21,7 +21,7 @@ std::vector<int> generate_random_vector(int n, int min_val = -100, int max_val =
   return vec;
 }
 
-void template_test(const std::vector<int>& input_data) {
+void template_test(const std::vector<int>& input_data, MergeMode mode = MergeMode::kBatcher) {
   boost::mpi::communicator world;
   std::vector<int> data = input_data;
   std::vector<int> result_data;
@@ -41,7 +41,7 @@ void template_test(const std::vector<int>& input_data) {
     taskDataPar->outputs_count.emplace_back(result_data.size());
   }
 
-  auto taskParallel = std::make_shared<QuicksortBatcherMerge>(taskDataPar);
+  auto taskParallel = std::make_shared<QuicksortBatcherMerge>(taskDataPar, mode);
 
   bool success = taskParallel->validation();
   boost::mpi::broadcast(world, success, 0);
@@ -175,3 +175,25 @@ TEST(sarafanov_m_quick_sort_batcher_merge_mpi, test_random_vector_size_256) {
   auto vec = sarafanov_m_quick_sort_batcher_merge_mpi::generate_random_vector(256);
   sarafanov_m_quick_sort_batcher_merge_mpi::template_test(vec);
 }
+
+TEST(sarafanov_m_quick_sort_batcher_merge_mpi, test_hypercube_random_non_power_of_two_size) {
+  sarafanov_m_quick_sort_batcher_merge_mpi::template_test(
+      sarafanov_m_quick_sort_batcher_merge_mpi::generate_random_vector(1000, -1000, 1000),
+      sarafanov_m_quick_sort_batcher_merge_mpi::MergeMode::kHypercube);
+}
+
+TEST(sarafanov_m_quick_sort_batcher_merge_mpi, test_hypercube_all_equal_elements) {
+  sarafanov_m_quick_sort_batcher_merge_mpi::template_test(
+      std::vector<int>(777, 5), sarafanov_m_quick_sort_batcher_merge_mpi::MergeMode::kHypercube);
+}
+
+TEST(sarafanov_m_quick_sort_batcher_merge_mpi, test_hypercube_few_distinct_values) {
+  sarafanov_m_quick_sort_batcher_merge_mpi::template_test(
+      sarafanov_m_quick_sort_batcher_merge_mpi::generate_random_vector(513, -2, 2),
+      sarafanov_m_quick_sort_batcher_merge_mpi::MergeMode::kHypercube);
+}
+
+TEST(sarafanov_m_quick_sort_batcher_merge_mpi, test_hypercube_fewer_elements_than_processes) {
+  sarafanov_m_quick_sort_batcher_merge_mpi::template_test(
+      {3, -1, 2}, sarafanov_m_quick_sort_batcher_merge_mpi::MergeMode::kHypercube);
+}
@@ -41,12 +41,16 @@ void quickSort(RandomIt begin, RandomIt end, Compare comp = Compare()) {
   quickSort(right + 1, end, comp);
 }
 
-void make_bitonic_sequence(std::vector<int>& arr);
-void merge_batcher(boost::mpi::communicator& world, std::vector<int>& arr, int arr_size);
+void merge_batcher(boost::mpi::communicator& world, std::vector<int>& arr);
+void sort_hypercube(boost::mpi::communicator& world, std::vector<int>& arr);
+
+// How the sorted blocks of the ranks are combined.
+enum class MergeMode { kBatcher, kHypercube };
 
 class QuicksortBatcherMerge : public ppc::core::Task {
  public:
-  explicit QuicksortBatcherMerge(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  explicit QuicksortBatcherMerge(std::shared_ptr<ppc::core::TaskData> taskData_, MergeMode mode_ = MergeMode::kBatcher)
+      : Task(std::move(taskData_)), mode(mode_) {}
   bool pre_processing() override;
   bool validation() override;
   bool run() override;
@@ -55,6 +59,7 @@ class QuicksortBatcherMerge : public ppc::core::Task {
  private:
   int vector_size;
   std::vector<int> arr;
+  MergeMode mode;
   boost::mpi::communicator world;
 };
 
@@ -2,67 +2,25 @@
 
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/vector.hpp>
+#include <functional>
+
+#include "core/sort/include/batcher_mpi.hpp"
+#include "core/sort/include/hypercube_mpi.hpp"
 
 namespace sarafanov_m_quick_sort_batcher_merge_mpi {
 
-void make_bitonic_sequence(std::vector<int>& arr) {
-  size_t n = arr.size();
-  quickSort(arr.begin(), arr.begin() + n / 2);
-  quickSort(arr.begin() + n / 2, arr.end(), std::greater<>());
+void merge_batcher(boost::mpi::communicator& world, std::vector<int>& arr) {
+  std::vector<int> local_arr = ppc::core::sort::scatter_even(world, arr, 0);
+  ppc::core::sort::batcher_sort(world, local_arr, std::less<>(),
+                                [](std::vector<int>& v) { quickSort(v.begin(), v.end()); });
+  arr = ppc::core::sort::gather_sorted(world, local_arr, 0);
 }
 
-void merge_batcher(boost::mpi::communicator& world, std::vector<int>& arr, int arr_size) {
-  int world_size = world.size();
-  int world_rank = world.rank();
-
-  int max_power_of_two = 1;
-  while (max_power_of_two * 2 <= world_size) {
-    max_power_of_two *= 2;
-  }
-
-  int color = (world_rank < max_power_of_two) ? 0 : MPI_UNDEFINED;
-  boost::mpi::communicator sub_comm = world.split(color);
-
-  if (color == 0) {
-    if (sub_comm.rank() == 0) make_bitonic_sequence(arr);
-
-    std::vector<int> local_arr(arr_size / sub_comm.size());
-    boost::mpi::scatter(sub_comm, arr.data(), local_arr.data(), arr_size / sub_comm.size(), 0);
-
-    std::vector<int> iter_send;
-
-    for (int i = sub_comm.size() / 2; i > 0; i /= 2) {
-      iter_send.clear();
-      if (sub_comm.rank() == 0) {
-        for (int rank = 0; rank < sub_comm.size(); rank++) {
-          if (rank - i < 0 || (rank + i < sub_comm.size() &&
-                               std::find(iter_send.begin(), iter_send.end(), rank - i) == iter_send.end())) {
-            iter_send.push_back(rank);
-          }
-        }
-      }
-      boost::mpi::broadcast(sub_comm, iter_send, 0);
-
-      int iter_color = (std::find(iter_send.begin(), iter_send.end(), sub_comm.rank()) != iter_send.end()) ? 0 : 1;
-      if (iter_color == 0) {
-        world.send(sub_comm.rank() + i, 0, local_arr);
-        world.recv(sub_comm.rank() + i, 1, local_arr);
-      } else {
-        std::vector<int> recv_data(local_arr.size());
-        world.recv(sub_comm.rank() - i, 0, recv_data);
-
-        for (size_t j = 0; j < local_arr.size(); ++j) {
-          if (recv_data[j] > local_arr[j]) {
-            std::swap(recv_data[j], local_arr[j]);
-          }
-        }
-
-        world.send(sub_comm.rank() - i, 1, recv_data);
-      }
-    }
-    quickSort(local_arr.begin(), local_arr.end());
-    boost::mpi::gather(sub_comm, local_arr.data(), arr_size / sub_comm.size(), arr.data(), 0);
-  }
+void sort_hypercube(boost::mpi::communicator& world, std::vector<int>& arr) {
+  std::vector<int> local_arr = ppc::core::sort::scatter_even(world, arr, 0);
+  ppc::core::sort::hypercube_quicksort(world, local_arr, std::less<>(),
+                                       [](std::vector<int>& v) { quickSort(v.begin(), v.end()); });
+  arr = ppc::core::sort::gather_sorted(world, local_arr, 0);
 }
 
 bool QuicksortBatcherMerge::validation() {
@@ -73,7 +31,7 @@ bool QuicksortBatcherMerge::validation() {
   int val_arr_size = taskData->inputs_count[0];
   int val_out_arr_size = taskData->outputs_count[0];
 
-  return val_arr_size > 0 && val_out_arr_size == val_arr_size && (val_arr_size & (val_arr_size - 1)) == 0;
+  return val_arr_size > 0 && val_out_arr_size == val_arr_size;
 }
 
 bool QuicksortBatcherMerge::pre_processing() {
@@ -94,7 +52,11 @@ bool QuicksortBatcherMerge::pre_processing() {
 bool QuicksortBatcherMerge::run() {
   internal_order_test();
 
-  merge_batcher(world, arr, vector_size);
+  if (mode == MergeMode::kHypercube) {
+    sort_hypercube(world, arr);
+  } else {
+    merge_batcher(world, arr);
+  }
 
   return true;
 }
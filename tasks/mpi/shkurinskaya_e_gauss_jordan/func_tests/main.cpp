@@ -307,3 +307,106 @@ TEST(Parallel_Operations_MPI, Test_zero_diag) {
     ASSERT_FALSE(testMpiTaskSequential.validation());
   }
 }
+
+TEST(Parallel_Operations_MPI, Test_multi_rhs_50x50) {
+  boost::mpi::communicator world;
+  int size = 50;
+  int k = 4;
+
+  std::vector<double> a;
+  std::vector<double> x(size * k);
+  std::vector<double> b(size * k, 0.0);
+  std::vector<double> output_data(size * k, 0.0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    auto augmented = shkurinskaya_e_gauss_jordan_mpi::generate_invertible_matrix(size);
+    a.resize(size * size);
+    for (int i = 0; i < size; ++i) {
+      for (int j = 0; j < size; ++j) a[i * size + j] = augmented[i * (size + 1) + j];
+    }
+    for (int i = 0; i < size * k; ++i) x[i] = (i % 13) - 6.0;
+    for (int i = 0; i < size; ++i) {
+      for (int l = 0; l < size; ++l) {
+        for (int j = 0; j < k; ++j) b[i * k + j] += a[i * size + l] * x[l * k + j];
+      }
+    }
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(&size));
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+    taskDataPar->inputs_count.emplace_back(size);
+    taskDataPar->inputs_count.emplace_back(a.size());
+    taskDataPar->inputs_count.emplace_back(b.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_data.data()));
+    taskDataPar->outputs_count.emplace_back(output_data.size());
+  }
+
+  shkurinskaya_e_gauss_jordan_mpi::MultiRHSTaskParallel testMpiTaskParallel(taskDataPar);
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  ASSERT_TRUE(testMpiTaskParallel.pre_processing());
+  ASSERT_TRUE(testMpiTaskParallel.run());
+  ASSERT_TRUE(testMpiTaskParallel.post_processing());
+
+  if (world.rank() == 0) {
+    for (int i = 0; i < size * k; ++i) {
+      ASSERT_NEAR(output_data[i], x[i], 1e-6);
+    }
+  }
+}
+
+TEST(Parallel_Operations_MPI, Test_multi_rhs_inverse) {
+  boost::mpi::communicator world;
+  int size = 2;
+
+  std::vector<double> a = {2, 3, 4, 1};
+  std::vector<double> output_data(size * size, 0.0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(&size));
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+    taskDataPar->inputs_count.emplace_back(size);
+    taskDataPar->inputs_count.emplace_back(a.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_data.data()));
+    taskDataPar->outputs_count.emplace_back(output_data.size());
+  }
+
+  shkurinskaya_e_gauss_jordan_mpi::MultiRHSTaskParallel testMpiTaskParallel(taskDataPar);
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    std::vector<double> expected = {-0.1, 0.3, 0.4, -0.2};
+    for (int i = 0; i < size * size; ++i) {
+      ASSERT_NEAR(output_data[i], expected[i], 1e-9);
+    }
+  }
+}
+
+TEST(Parallel_Operations_MPI, Test_multi_rhs_size_mismatch) {
+  boost::mpi::communicator world;
+  int size = 3;
+
+  std::vector<double> a(size * size, 1.0);
+  std::vector<double> b(size * 2 + 1, 1.0);
+  std::vector<double> output_data(b.size(), 0.0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(&size));
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+    taskDataPar->inputs_count.emplace_back(size);
+    taskDataPar->inputs_count.emplace_back(a.size());
+    taskDataPar->inputs_count.emplace_back(b.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_data.data()));
+    taskDataPar->outputs_count.emplace_back(output_data.size());
+  }
+
+  shkurinskaya_e_gauss_jordan_mpi::MultiRHSTaskParallel testMpiTaskParallel(taskDataPar);
+  if (world.rank() == 0) {
+    ASSERT_FALSE(testMpiTaskParallel.validation());
+  }
+}
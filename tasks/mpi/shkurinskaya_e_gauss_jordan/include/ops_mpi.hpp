@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/gauss_jordan_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shkurinskaya_e_gauss_jordan_mpi {
@@ -49,4 +50,23 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<int> displacements;
 };
 
+// Gauss-Jordan factorization of A reused for a block of k right-hand sides
+// (A^-1 when no block is given); repeated runs only replay the elimination.
+// inputs: n, A (n * n), optional B (n * k); outputs: X (n * k)
+class MultiRHSTaskParallel : public ppc::core::Task {
+ public:
+  explicit MultiRHSTaskParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int n = 0;
+  int k = 0;
+  std::vector<double> rhs;
+  ppc::core::linalg::GaussJordanSolverMPI solver;
+  boost::mpi::communicator world;
+};
+
 }  // namespace shkurinskaya_e_gauss_jordan_mpi
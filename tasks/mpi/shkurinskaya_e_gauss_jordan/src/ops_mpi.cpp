@@ -232,3 +232,61 @@ bool shkurinskaya_e_gauss_jordan_mpi::TestMPITaskParallel::post_processing() {
   }
   return true;
 }
+
+bool shkurinskaya_e_gauss_jordan_mpi::MultiRHSTaskParallel::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    if (taskData->inputs.size() < 2 || taskData->outputs.empty()) {
+      std::cout << "Validation failed: matrix or output is missing!" << std::endl;
+      return false;
+    }
+    int numRows = taskData->inputs_count[0];
+    if (numRows <= 0 || taskData->inputs_count[1] != static_cast<uint32_t>(numRows * numRows)) {
+      std::cout << "Validation failed: matrix size mismatch!" << std::endl;
+      return false;
+    }
+    uint32_t rhsSize = taskData->inputs.size() > 2 ? taskData->inputs_count[2] : taskData->inputs_count[1];
+    if (rhsSize == 0 || rhsSize % numRows != 0 || taskData->outputs_count[0] != rhsSize) {
+      std::cout << "Validation failed: right-hand side size mismatch!" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool shkurinskaya_e_gauss_jordan_mpi::MultiRHSTaskParallel::pre_processing() {
+  internal_order_test();
+  const double* a = nullptr;
+  if (world.rank() == 0) {
+    n = *reinterpret_cast<int*>(taskData->inputs[0]);
+    k = taskData->inputs.size() > 2 ? static_cast<int>(taskData->inputs_count[2]) / n : n;
+    a = reinterpret_cast<double*>(taskData->inputs[1]);
+  }
+  boost::mpi::broadcast(world, k, 0);
+  return solver.factor(a, n);
+}
+
+bool shkurinskaya_e_gauss_jordan_mpi::MultiRHSTaskParallel::run() {
+  internal_order_test();
+  if (!solver.factored()) return false;
+  if (world.rank() == 0) {
+    if (taskData->inputs.size() > 2) {
+      rhs = std::vector<double>(reinterpret_cast<double*>(taskData->inputs[2]),
+                                reinterpret_cast<double*>(taskData->inputs[2]) + n * k);
+    } else {
+      rhs = std::vector<double>(n * n, 0.0);
+      for (int i = 0; i < n; ++i) rhs[i * n + i] = 1.0;
+    }
+  }
+  solver.solve(rhs.data(), k);
+  return true;
+}
+
+bool shkurinskaya_e_gauss_jordan_mpi::MultiRHSTaskParallel::post_processing() {
+  internal_order_test();
+  if (!solver.factored()) return false;
+  if (world.rank() == 0) {
+    std::copy(rhs.begin(), rhs.end(), reinterpret_cast<double*>(taskData->outputs[0]));
+  }
+  return true;
+}
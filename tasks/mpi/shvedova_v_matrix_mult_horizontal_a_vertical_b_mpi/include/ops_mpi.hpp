@@ -122,8 +122,6 @@ class MatrixMultiplicationTaskParallel : public ppc::core::Task {
   int num_rows_a_;
   int num_cols_a_;
   int num_cols_b_;
-  std::vector<int> indexesA_;
-  std::vector<int> indexesB_;
   Matrix matA;
   Matrix matB;
   std::vector<int> sizes;
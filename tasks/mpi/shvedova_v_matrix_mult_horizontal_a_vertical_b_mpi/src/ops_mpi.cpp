@@ -10,6 +10,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+
 bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTaskSequential::pre_processing() {
   internal_order_test();
 
@@ -53,17 +55,8 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
   internal_order_test();
   result_vector_.resize(num_rows_a_ * num_cols_b_, 0);
 
-  for (int i = 0; i < num_rows_a_; ++i) {
-    for (int j = 0; j < num_cols_b_; ++j) {
-      int sum = 0;
-
-      for (int k = 0; k < num_cols_a_; ++k) {
-        sum += matA.matrix_[i * num_cols_a_ + k] * matB.matrix_[k * num_cols_b_ + j];
-      }
-
-      result_vector_[i * num_cols_b_ + j] = sum;
-    }
-  }
+  ppc::core::linalg::gemm(num_rows_a_, num_cols_b_, num_cols_a_, matA.matrix_.data(), matB.matrix_.data(),
+                          result_vector_.data());
 
   return true;
 }
@@ -144,9 +137,8 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
     matA = Matrix(input_matrix_a_, num_rows_a_, num_cols_a_);
     matB = Matrix(input_matrix_b_, num_cols_a_, num_cols_b_);
 
-    shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::get_indexes(num_rows_a_, num_cols_b_, indexesA_, indexesB_);
-
-    shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::calculate(num_rows_a_ * num_cols_b_, 1, world.size(), sizes,
+    // horizontal strips: every process gets whole rows of A and of the result
+    shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::calculate(num_rows_a_, num_cols_b_, world.size(), sizes,
                                                                   displs);
   }
 
@@ -168,39 +160,21 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
 bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTaskParallel::run() {
   internal_order_test();
 
+  boost::mpi::broadcast(world, num_cols_a_, 0);
+  boost::mpi::broadcast(world, num_cols_b_, 0);
   boost::mpi::broadcast(world, matA, 0);
   boost::mpi::broadcast(world, matB, 0);
   boost::mpi::broadcast(world, sizes, 0);
   boost::mpi::broadcast(world, displs, 0);
 
-  int local_size = sizes[world.rank()];
-
-  std::vector<int> local_indexes_a(local_size);
-  std::vector<int> local_indexes_b(local_size);
-
-  if (world.rank() == 0) {
-    boost::mpi::scatterv(world, indexesA_.data(), sizes, displs, local_indexes_a.data(), local_size, 0);
-    boost::mpi::scatterv(world, indexesB_.data(), sizes, displs, local_indexes_b.data(), local_size, 0);
-  } else {
-    boost::mpi::scatterv(world, local_indexes_a.data(), local_size, 0);
-    boost::mpi::scatterv(world, local_indexes_b.data(), local_size, 0);
-  }
+  const int local_size = sizes[world.rank()];
+  const int first_row = displs[world.rank()] / num_cols_b_;
+  const int local_rows = local_size / num_cols_b_;
 
   std::vector<int> local_result(local_size, 0);
-
-  for (size_t k = 0; k < local_indexes_a.size(); ++k) {
-    int i = local_indexes_a[k];
-    int j = local_indexes_b[k];
-
-    auto itA = matA.row_begin(i);
-    auto itB = matB.col_begin(j);
-
-    while (itA != matA.row_end(i) && itB != matB.col_end(j)) {
-      local_result[k] += (*itA) * (*itB);
-      ++itA;
-      ++itB;
-    }
-  }
+  ppc::core::linalg::gemm(local_rows, num_cols_b_, num_cols_a_,
+                          matA.matrix_.data() + static_cast<size_t>(first_row) * num_cols_a_, matB.matrix_.data(),
+                          local_result.data());
 
   if (world.rank() == 0) {
     boost::mpi::gatherv(world, local_result.data(), local_result.size(), result_vector_.data(), sizes, displs, 0);
@@ -5,6 +5,8 @@
 #include <random>
 #include <vector>
 
+#include "core/sort/include/batcher_mpi.hpp"
+
 void countingSortByByte(std::vector<uint64_t>& data, std::vector<uint64_t>& output, int byteIndex) {
   const int base = 256;
   std::array<int, base> count = {0};
@@ -126,59 +128,9 @@ bool somov_i_bitwise_sorting_batcher_merge_mpi::TestMPITaskParallel::validation(
 bool somov_i_bitwise_sorting_batcher_merge_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  unsigned int delta = 0;
-  unsigned int r = 0;
-  if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
-    r = taskData->inputs_count[0] % world.size();
-    local_input_.resize(delta + r);
-  }
-
-  broadcast(world, delta, 0);
-  broadcast(world, r, 0);
-
-  if (world.rank() != 0) local_input_.resize(delta);
-
-  std::vector<int> local_size(world.size(), delta);
-  local_size[0] += r;
-
-  scatterv(world, input_, local_size, local_input_.data(), 0);
-
-  radix_sort_double(local_input_);
-
-  for (int c = 0; c < world.size() * 2; c++) {
-    if (c % 2 == 0) {
-      if (world.rank() % 2 == 0 && world.rank() + 1 != world.size()) {
-        world.send(world.rank() + 1, c, local_input_);
-        world.recv(world.rank() + 1, c, local_input_);
-      }
-      if (world.rank() % 2 != 0) {
-        std::vector<double> tmp;
-        world.recv(world.rank() - 1, c, tmp);
-        std::vector<double> m(local_input_.size() + tmp.size());
-        std::merge(local_input_.begin(), local_input_.end(), tmp.begin(), tmp.end(), m.begin());
-        tmp.assign(m.begin(), m.begin() + tmp.size());
-        local_input_.assign(m.end() - local_input_.size(), m.end());
-        world.send(world.rank() - 1, c, tmp);
-      }
-    } else {
-      if (world.rank() % 2 == 1 && world.rank() + 1 != world.size()) {
-        world.send(world.rank() + 1, c, local_input_);
-        world.recv(world.rank() + 1, c, local_input_);
-      }
-      if (world.rank() % 2 == 0 && world.rank() != 0) {
-        std::vector<double> tmp;
-        world.recv(world.rank() - 1, c, tmp);
-        std::vector<double> m(local_input_.size() + tmp.size());
-        std::merge(local_input_.begin(), local_input_.end(), tmp.begin(), tmp.end(), m.begin());
-        tmp.assign(m.begin(), m.begin() + tmp.size());
-        local_input_.assign(m.end() - local_input_.size(), m.end());
-        world.send(world.rank() - 1, c, tmp);
-      }
-    }
-  }
-
-  gatherv(world, local_input_.data(), local_input_.size(), res_.data(), local_size, 0);
+  local_input_ = ppc::core::sort::scatter_even(world, input_, 0);
+  ppc::core::sort::batcher_sort(world, local_input_, std::less<>(), radix_sort_double);
+  res_ = ppc::core::sort::gather_sorted(world, local_input_, 0);
   return true;
 }
 
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/geometry/include/hull.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sorokin_a_graham_algorithm_mpi {
@@ -38,7 +39,7 @@ class TestMPITaskParallel : public ppc::core::Task {
 
  private:
   std::vector<int> input_;
-  std::vector<int> local_input_;
+  ppc::core::geometry::PointSet<int> local_input_;
   std::vector<int> res_;
   boost::mpi::communicator world;
 };
@@ -2,86 +2,41 @@
 #include "mpi/sorokin_a_graham_algorithm/include/ops_mpi.hpp"
 
 #include <algorithm>
-#include <functional>
-#include <random>
+#include <utility>
 #include <vector>
 
-std::vector<int> grahamAlg(const std::vector<int>& input) {
-  int n = input.size() / 2;
-  if (n <= 3) {
-    return input;
-  }
-  std::vector<int> indices(n);
-  for (int i = 0; i < n; ++i) {
-    indices[i] = i;
-  }
-  int minind = 0;
-  for (int i = 0; i < n; ++i) {
-    if (input[i * 2 + 1] < input[minind * 2 + 1]) {
-      minind = i;
-    }
-    if (input[i * 2 + 1] == input[minind * 2 + 1]) {
-      if (input[i * 2] < input[minind * 2]) {
-        minind = i;
-      }
-    }
-  }
-  std::sort(indices.begin(), indices.end(), [&input, minind](int p1, int p2) {
-    if (p1 == minind) return true;
-    if (p2 == minind) return false;
-    int x0 = input[minind * 2];
-    int y0 = input[minind * 2 + 1];
-    int x1 = input[p1 * 2];
-    int y1 = input[p1 * 2 + 1];
-    int x2 = input[p2 * 2];
-    int y2 = input[p2 * 2 + 1];
-    int orient = (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
-    if (orient == 0) {
-      int dx1 = input[p1 * 2] - input[minind * 2];
-      int dy1 = input[p1 * 2 + 1] - input[minind * 2 + 1];
-      int dx2 = input[p2 * 2] - input[minind * 2];
-      int dy2 = input[p2 * 2 + 1] - input[minind * 2 + 1];
-      return dx1 * dx1 + dy1 * dy1 < dx2 * dx2 + dy2 * dy2;
-    }
-    return orient > 0;
-  });
+#include "core/geometry/include/hull_mpi.hpp"
 
-  std::vector<int> stack;
-
-  stack.emplace_back(indices[0]);
-  stack.emplace_back(indices[1]);
-
-  for (int i = 2; i < n; ++i) {
-    while (stack.size() > 1) {
-      int top = stack.back();
-      int nextToTop = stack[stack.size() - 2];
-
-      int x0 = input[nextToTop * 2];
-      int y0 = input[nextToTop * 2 + 1];
-      int x1 = input[top * 2];
-      int y1 = input[top * 2 + 1];
-      int x2 = input[indices[i] * 2];
-      int y2 = input[indices[i] * 2 + 1];
-
-      int orient = (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
-
-      if (orient <= 0) {
-        stack.pop_back();
-      } else {
-        break;
-      }
-    }
-    stack.emplace_back(indices[i]);
-  }
+namespace {
 
+// Hull vertices as interleaved x, y pairs, from the lowest point (the
+// leftmost of those).
+std::vector<int> lowest_first(std::vector<ppc::core::geometry::Point<int>> hull) {
+  ppc::core::geometry::start_at(hull, [](const auto& a, const auto& b) {
+    return a.y < b.y || (a.y == b.y && a.x < b.x);
+  });
   std::vector<int> out;
-  for (int index : stack) {
-    out.emplace_back(input[2 * index]);
-    out.emplace_back(input[2 * index + 1]);
+  out.reserve(2 * hull.size());
+  for (const auto& p : hull) {
+    out.emplace_back(p.x);
+    out.emplace_back(p.y);
   }
   return out;
 }
 
+}  // namespace
+
+// Strict convex hull of interleaved x, y pairs, counter-clockwise from the
+// lowest point (the leftmost of those); three points or fewer are returned
+// as they are.
+std::vector<int> grahamAlg(const std::vector<int>& input) {
+  if (input.size() / 2 <= 3) {
+    return input;
+  }
+  return lowest_first(
+      ppc::core::geometry::convex_hull(ppc::core::geometry::from_interleaved(input.data(), input.size() / 2)));
+}
+
 bool sorokin_a_graham_algorithm_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
   input_ = std::vector<int>(taskData->inputs_count[0]);
@@ -110,28 +65,13 @@ bool sorokin_a_graham_algorithm_mpi::TestMPITaskSequential::post_processing() {
 
 bool sorokin_a_graham_algorithm_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  unsigned int remainder = 0;
-  if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / (world.size() * 2);
-    remainder = (taskData->inputs_count[0] / 2) % world.size();
-  }
-  broadcast(world, delta, 0);
-
   if (world.rank() == 0) {
     input_.resize(taskData->inputs_count[0]);
     auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
     std::copy(tmp_ptr, tmp_ptr + taskData->inputs_count[0], input_.begin());
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta * 2 + remainder * 2, delta * 2);
-    }
-  }
-  local_input_ = std::vector<int>(delta * 2);
-  if (world.rank() == 0) {
-    local_input_ = std::vector<int>(input_.begin(), input_.begin() + delta * 2 + remainder * 2);
-  } else {
-    world.recv(0, 0, local_input_.data(), delta * 2);
   }
+  local_input_ = ppc::core::geometry::scatter_points(
+      world, ppc::core::geometry::from_interleaved(input_.data(), input_.size() / 2));
   return true;
 }
 
@@ -145,29 +85,9 @@ bool sorokin_a_graham_algorithm_mpi::TestMPITaskParallel::validation() {
 
 bool sorokin_a_graham_algorithm_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  std::vector<int> local_res = grahamAlg(local_input_);
+  auto hull = ppc::core::geometry::convex_hull(world, local_input_);
   if (world.rank() == 0) {
-    std::vector<int> gathered_data;
-    for (int source = 0; source < world.size(); ++source) {
-      int size;
-      if (source == 0) {
-        size = local_res.size();
-      } else {
-        world.recv(source, 0, size);
-      }
-      std::vector<int> buffer(size);
-      if (source == 0) {
-        buffer = local_res;
-      } else {
-        world.recv(source, 1, buffer);
-      }
-      gathered_data.insert(gathered_data.end(), buffer.begin(), buffer.end());
-    }
-    res_ = grahamAlg(gathered_data);
-  } else {
-    int size = local_res.size();
-    world.send(0, 0, size);
-    world.send(0, 1, local_res);
+    res_ = input_.size() / 2 <= 3 ? input_ : lowest_first(std::move(hull));
   }
   return true;
 }
@@ -1,5 +1,11 @@
 #include <mpi/sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging/include/ops_mpi.hpp>
 
+#include <boost/mpi/communicator.hpp>
+#include <functional>
+
+#include "core/sort/include/radix.hpp"
+#include "core/sort/include/sample_sort_mpi.hpp"
+
 bool sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
   auto* input_ptr = reinterpret_cast<double*>(taskData->inputs[0]);
@@ -43,8 +49,6 @@ bool sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_mpi::TestM
   if (rank == 0) {
     auto* input_ptr = reinterpret_cast<double*>(taskData->inputs[0]);
     input_data_.assign(input_ptr, input_ptr + taskData->inputs_count[0]);
-
-    std::sort(input_data_.rbegin(), input_data_.rend());
   }
   return true;
 }
@@ -86,95 +90,12 @@ bool sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_mpi::TestM
 
 void sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_mpi::radixSortWithSignHandling(
     std::vector<double>& data) {
-  const int num_bits = sizeof(double) * 8;
-  const int radix = 2;
-
-  std::vector<double> positives;
-  std::vector<double> negatives;
-
-  for (double num : data) {
-    if (num < 0) {
-      negatives.push_back(-num);
-    } else {
-      positives.push_back(num);
-    }
-  }
-
-  radixSort(positives, num_bits, radix);
-  radixSort(negatives, num_bits, radix);
-
-  for (double& num : negatives) {
-    num = -num;
-  }
-
-  data.clear();
-  data.insert(data.end(), negatives.rbegin(), negatives.rend());
-  data.insert(data.end(), positives.begin(), positives.end());
-}
-
-void sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_mpi::radixSort(std::vector<double>& data,
-                                                                                     int num_bits, int radix) {
-  std::vector<std::vector<double>> buckets(radix);
-  std::vector<double> output(data.size());
-
-  for (int exp = 0; exp < num_bits; ++exp) {
-    for (auto& num : data) {
-      uint64_t bits = *reinterpret_cast<uint64_t*>(&num);
-      int digit = (bits >> exp) & 1;
-      buckets[digit].push_back(num);
-    }
-
-    int index = 0;
-    for (int i = 0; i < radix; ++i) {
-      for (auto& num : buckets[i]) {
-        output[index++] = num;
-      }
-      buckets[i].clear();
-    }
-
-    data = output;
-  }
+  ppc::core::sort::radix_sort(data);
 }
 
 void sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_mpi::TestMPITaskParallel::parallelSort() {
-  int total_size;
-  if (rank == 0) total_size = input_data_.size();
-  MPI_Bcast(&total_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-  std::vector<int> send_counts(size);
-  std::vector<int> displacements(size);
-
-  int base_size = total_size / size;
-  int remainder = total_size % size;
-
-  for (int i = 0; i < size; ++i) {
-    send_counts[i] = base_size + (i < remainder ? 1 : 0);
-    displacements[i] = (i > 0) ? (displacements[i - 1] + send_counts[i - 1]) : 0;
-  }
-
-  std::vector<double> local_data(send_counts[rank]);
-  MPI_Scatterv(input_data_.data(), send_counts.data(), displacements.data(), MPI_DOUBLE, local_data.data(),
-               send_counts[rank], MPI_DOUBLE, 0, MPI_COMM_WORLD);
-
-  radixSortWithSignHandling(local_data);
-
-  if (rank == 0) {
-    std::vector<double> recv_data(base_size + 1);
-    std::vector<double> merged_data;
-    sorted_data_ = local_data;
-
-    MPI_Status status;
-    merged_data.reserve(total_size);
-    for (int proc = 1; proc < size; proc++) {
-      MPI_Recv(recv_data.data(), send_counts[proc], MPI_DOUBLE, proc, 0, MPI_COMM_WORLD, &status);
-      std::merge(sorted_data_.begin(), sorted_data_.end(), recv_data.begin(), recv_data.begin() + send_counts[proc],
-                 std::back_inserter(merged_data));
-      sorted_data_ = merged_data;
-      merged_data.clear();
-    }
-  } else {
-    MPI_Send(local_data.data(), local_data.size(), MPI_DOUBLE, 0, 0, MPI_COMM_WORLD);
-  }
-
-  MPI_Barrier(MPI_COMM_WORLD);
+  boost::mpi::communicator world;
+  std::vector<double> local_data = ppc::core::sort::scatter_even(world, input_data_, 0);
+  ppc::core::sort::sample_sort(world, local_data, std::less<>(), radixSortWithSignHandling);
+  sorted_data_ = ppc::core::sort::gather_sorted(world, local_data, 0);
 }
@@ -87,28 +87,10 @@ class TestMPITaskParallel : public ppc::core::Task {
     std::vector<int> resLeft = quickSortRecursive(left);
     std::vector<int> resRight = quickSortRecursive(right);
 
-    std::vector<int> mergeEqualRight = merge(equal, resRight);
-    return merge(resLeft, mergeEqualRight);
-  }
-
-  // Вспомогательная функция для слияния двух отсортированных массивов
-  static std::vector<int> merge(const std::vector<int>& vec1, const std::vector<int>& vec2) {
-    std::vector<int> mergedvec;
-    mergedvec.reserve(vec1.size() + vec2.size());
-    int i = 0;
-    int j = 0;
-    while (i < static_cast<int>(vec1.size()) && j < static_cast<int>(vec2.size())) {
-      if (vec1[i] < vec2[j]) {
-        mergedvec.push_back(vec1[i++]);
-      } else {
-        mergedvec.push_back(vec2[j++]);
-      }
-    }
-
-    mergedvec.insert(mergedvec.end(), vec1.begin() + i, vec1.end());
-    mergedvec.insert(mergedvec.end(), vec2.begin() + j, vec2.end());
-
-    return mergedvec;
+    // left < equal < right, so the three runs only need to be concatenated
+    resLeft.insert(resLeft.end(), equal.begin(), equal.end());
+    resLeft.insert(resLeft.end(), resRight.begin(), resRight.end());
+    return resLeft;
   }
 };
 
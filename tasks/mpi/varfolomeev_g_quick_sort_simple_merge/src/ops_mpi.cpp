@@ -2,8 +2,11 @@
 
 #include <boost/mpi.hpp>
 #include <boost/serialization/vector.hpp>
+#include <functional>
 #include <vector>
 
+#include "core/sort/include/sample_sort_mpi.hpp"
+
 bool varfolomeev_g_quick_sort_simple_merge_mpi::TestTaskSequential::pre_processing() {
   internal_order_test();
   input_ = std::vector<int>(taskData->inputs_count[0]);
@@ -55,38 +58,13 @@ bool varfolomeev_g_quick_sort_simple_merge_mpi::TestMPITaskParallel::validation(
 
 bool varfolomeev_g_quick_sort_simple_merge_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  boost::mpi::broadcast(world, input_, 0);
-  int local_size = input_.size() / world.size();
-  int tail = input_.size() % world.size();
-
-  std::vector<int> distribution(world.size(), local_size);
-  for (int i = 0; i < tail; ++i) {
-    distribution[i]++;
-  }
-
-  std::vector<int> begins(world.size());
-  begins[0] = 0;
-  for (int i = 1; i < world.size(); ++i) {
-    begins[i] = begins[i - 1] + distribution[i - 1];
-  }
-
-  local_input_.resize(distribution[world.rank()]);
-  boost::mpi::scatterv(world, input_.data(), distribution, begins, local_input_.data(), distribution[world.rank()], 0);
+  local_input_ = ppc::core::sort::scatter_even(world, input_, 0);
 
-  local_input_ = quickSortRecursive(local_input_);
-
-  std::vector<int> allData;
-  if (world.rank() == 0) {
-    allData.resize(input_.size());
-  }
-  boost::mpi::gatherv(world, local_input_.data(), distribution[world.rank()], allData.data(), distribution, begins, 0);
-  if (world.rank() == 0) {
-    res.assign(allData.begin(), allData.begin() + distribution[0]);
-    for (int i = 1; i < world.size(); ++i) {
-      std::vector<int> right(allData.begin() + begins[i], allData.begin() + begins[i] + distribution[i]);
-      res = merge(res, right);
-    }
-  }
+  // every rank sorts its block and keeps one bucket of the result; only the
+  // final concatenation touches rank 0
+  ppc::core::sort::sample_sort(world, local_input_, std::less<>(),
+                               [](std::vector<int>& v) { v = quickSortRecursive(v); });
+  res = ppc::core::sort::gather_sorted(world, local_input_, 0);
   return true;
 }
 
@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <boost/mpi.hpp>
+#include <cstdint>
+#include <filesystem>
 #include <random>
+#include <string>
 
+#include "core/graph/include/loader.hpp"
 #include "mpi/vavilov_v_bellman_ford/include/ops_mpi.hpp"
 
 namespace mpi = boost::mpi;
@@ -41,6 +46,42 @@ static std::vector<int> generate_random_sparse_graph(int vertices, int edges_cou
   return graph;
 }
 
+using GraphFormat = ppc::core::graph::GraphFormat;
+
+// Edges with weights w + p(u) - p(v) for w >= 0 and a random potential p:
+// both signs, but no negative cycle.
+static std::vector<ppc::core::graph::Edge<int>> generate_potential_edges(int vertices, int edges_count,
+                                                                         unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> vertex_dist(0, vertices - 1);
+  std::uniform_int_distribution<int> weight_dist(1, 20);
+  std::uniform_int_distribution<int> potential_dist(-10, 10);
+  std::vector<int> potential(vertices);
+  for (auto& p : potential) p = potential_dist(gen);
+  std::vector<ppc::core::graph::Edge<int>> edges;
+  while (static_cast<int>(edges.size()) < edges_count) {
+    const int u = vertex_dist(gen);
+    const int v = vertex_dist(gen);
+    const int w = weight_dist(gen) + potential[u] - potential[v];
+    if (u != v && w != 0) edges.push_back({u, v, w});
+  }
+  return edges;
+}
+
+// Runs the parallel task on a graph handed over in inputs as format says.
+static bool run_parallel(GraphFormat format, const std::vector<uint8_t*>& inputs, int vertices, int edges_count,
+                         std::vector<int>& output) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs = inputs;
+  taskData->inputs_count = {static_cast<uint32_t>(vertices), static_cast<uint32_t>(edges_count), 0,
+                            static_cast<uint32_t>(format)};
+  output.assign(vertices, 0);
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+  taskData->outputs_count.emplace_back(output.size());
+  vavilov_v_bellman_ford_mpi::TestMPITaskParallel task(taskData);
+  return task.validation() && task.pre_processing() && task.run() && task.post_processing();
+}
+
 TEST(vavilov_v_bellman_ford_mpi, Random_linear_graph) {
   mpi::communicator world;
   auto taskDataPar = std::make_shared<ppc::core::TaskData>();
@@ -318,3 +359,127 @@ TEST(vavilov_v_bellman_ford_mpi, SingleVertexGraph) {
     EXPECT_EQ(output, expected_output);
   }
 }
+
+TEST(vavilov_v_bellman_ford_mpi, Edge_list_CSR_and_edge_file_match_matrix) {
+  mpi::communicator world;
+  const int vertices = 400;
+  const int edges_count = 1500;
+  auto edges = generate_potential_edges(vertices, edges_count, 17);
+
+  // the same graph as a matrix needs one edge per pair
+  std::vector<int> matrix(vertices * vertices, 0);
+  for (const auto& e : edges) matrix[e.source * vertices + e.target] = e.weight;
+  std::erase_if(edges, [&](const auto& e) { return matrix[e.source * vertices + e.target] != e.weight; });
+  const int unique_edges = static_cast<int>(edges.size());
+  std::vector<int> expected;
+  ASSERT_TRUE(run_parallel(GraphFormat::kDenseMatrix, {reinterpret_cast<uint8_t*>(matrix.data())}, vertices,
+                           unique_edges, expected));
+
+  std::vector<int> output;
+  ASSERT_TRUE(run_parallel(GraphFormat::kEdgeList, {reinterpret_cast<uint8_t*>(edges.data())}, vertices,
+                           unique_edges, output));
+  if (world.rank() == 0) {
+    EXPECT_EQ(output, expected);
+  }
+
+  ppc::core::sparse::CSR<int> csr;
+  ASSERT_TRUE(ppc::core::graph::csr_from_edges(vertices, edges.data(), edges.size(), csr));
+  const std::vector<uint8_t*> arrays = {reinterpret_cast<uint8_t*>(csr.row_ptr.data()),
+                                        reinterpret_cast<uint8_t*>(csr.col_idx.data()),
+                                        reinterpret_cast<uint8_t*>(csr.values.data())};
+  ASSERT_TRUE(run_parallel(GraphFormat::kCSR, arrays, vertices, unique_edges, output));
+  if (world.rank() == 0) {
+    EXPECT_EQ(output, expected);
+  }
+
+  std::string path = (std::filesystem::temp_directory_path() / "vavilov_v_bellman_ford_mpi_edges").string();
+  if (world.rank() == 0) {
+    ASSERT_TRUE(ppc::core::graph::write_edge_file(path, vertices, edges.data(), edges.size()));
+  }
+  world.barrier();
+  // only root's inputs are read
+  ASSERT_TRUE(run_parallel(GraphFormat::kEdgeFile, {reinterpret_cast<uint8_t*>(path.data())}, vertices, unique_edges,
+                           output));
+  if (world.rank() == 0) {
+    EXPECT_EQ(output, expected);
+  }
+  world.barrier();
+  if (world.rank() == 0) {
+    std::filesystem::remove(path);
+  }
+}
+
+TEST(vavilov_v_bellman_ford_mpi, Edge_list_with_stray_vertex_is_rejected) {
+  mpi::communicator world;
+  std::vector<ppc::core::graph::Edge<int>> edges = {{0, 1, 2}, {1, 5, 3}};
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(edges.data()));
+  taskData->inputs_count = {3, 2, 0, static_cast<uint32_t>(GraphFormat::kEdgeList)};
+  std::vector<int> output(3);
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+  taskData->outputs_count.emplace_back(output.size());
+  vavilov_v_bellman_ford_mpi::TestMPITaskParallel task(taskData);
+  ASSERT_TRUE(task.validation());
+  // the graph is partitioned in pre_processing, so every rank hears of it
+  EXPECT_FALSE(task.pre_processing());
+}
+
+TEST(vavilov_v_bellman_ford_mpi, Missing_edge_file_fails_on_every_rank) {
+  mpi::communicator world;
+  std::string path = (std::filesystem::temp_directory_path() / "vavilov_v_bellman_ford_mpi_missing").string();
+  std::vector<int> output;
+  EXPECT_FALSE(run_parallel(GraphFormat::kEdgeFile, {reinterpret_cast<uint8_t*>(path.data())}, 3, 2, output));
+}
+
+TEST(vavilov_v_bellman_ford_mpi, Batch_of_sources_matches_one_run_per_source) {
+  mpi::communicator world;
+  const int vertices = 300;
+  const int edges_count = 1200;
+  auto edges = generate_potential_edges(vertices, edges_count, 23);
+  std::vector<int> sources = {0, 299, 17, 0, 150};
+  const int lanes = static_cast<int>(sources.size());
+
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs = {reinterpret_cast<uint8_t*>(edges.data()), reinterpret_cast<uint8_t*>(sources.data())};
+  taskData->inputs_count = {vertices, edges_count, 0, static_cast<uint32_t>(GraphFormat::kEdgeList),
+                            static_cast<uint32_t>(lanes)};
+  std::vector<int> output(lanes * vertices, 0);
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+  taskData->outputs_count.emplace_back(output.size());
+  vavilov_v_bellman_ford_mpi::TestMPITaskParallel task(taskData);
+  ASSERT_TRUE(task.validation());
+  ASSERT_TRUE(task.pre_processing());
+  // the partitioned graph answers any number of runs
+  ASSERT_TRUE(task.run());
+  ASSERT_TRUE(task.run());
+  ASSERT_TRUE(task.post_processing());
+
+  for (int k = 0; k < lanes; k++) {
+    auto one = std::make_shared<ppc::core::TaskData>();
+    one->inputs = {reinterpret_cast<uint8_t*>(edges.data())};
+    one->inputs_count = {vertices, edges_count, static_cast<uint32_t>(sources[k]),
+                         static_cast<uint32_t>(GraphFormat::kEdgeList)};
+    std::vector<int> expected(vertices, 0);
+    one->outputs.emplace_back(reinterpret_cast<uint8_t*>(expected.data()));
+    one->outputs_count.emplace_back(expected.size());
+    vavilov_v_bellman_ford_mpi::TestMPITaskParallel single(one);
+    ASSERT_TRUE(single.validation() && single.pre_processing() && single.run() && single.post_processing());
+    if (world.rank() == 0) {
+      EXPECT_TRUE(std::equal(expected.begin(), expected.end(), output.begin() + k * vertices)) << k;
+    }
+  }
+}
+
+TEST(vavilov_v_bellman_ford_mpi, Source_out_of_range_is_rejected) {
+  mpi::communicator world;
+  std::vector<ppc::core::graph::Edge<int>> edges = {{0, 1, 2}, {1, 2, 3}};
+  std::vector<int> sources = {1, 3};
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs = {reinterpret_cast<uint8_t*>(edges.data()), reinterpret_cast<uint8_t*>(sources.data())};
+  taskData->inputs_count = {3, 2, 0, static_cast<uint32_t>(GraphFormat::kEdgeList), 2};
+  std::vector<int> output(6);
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+  taskData->outputs_count.emplace_back(output.size());
+  vavilov_v_bellman_ford_mpi::TestMPITaskParallel task(taskData);
+  EXPECT_EQ(task.validation(), world.rank() != 0);
+}
@@ -8,8 +8,12 @@
 #include <boost/serialization/vector.hpp>
 #include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "core/graph/include/multi_source_mpi.hpp"
+#include "core/graph/include/session_mpi.hpp"
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_bellman_ford_mpi {
@@ -30,6 +34,16 @@ class TestMPITaskSequential : public ppc::core::Task {
   void CRS(const int* matrix);
 };
 
+// inputs_count = {vertices, edges, source[, format[, sources]]}, where the
+// optional format is a ppc::core::graph::GraphFormat saying how inputs hold
+// the graph: a dense matrix by default, or an edge list, CSR arrays or the
+// path of an edge file, which every rank then reads its share of by itself.
+// With a count of sources K, the input after the graph's holds K source
+// vertices that replace source, and the output gets K * vertices distances,
+// those from the k-th source at [k * vertices, (k + 1) * vertices).
+//
+// The graph is partitioned once in pre_processing() and stays on the ranks,
+// so repeated run() calls only relax edges, for all the sources at once.
 class TestMPITaskParallel : public ppc::core::Task {
  public:
   explicit TestMPITaskParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
@@ -40,10 +54,13 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> row_offsets_, col_indices_, weights_;
+  ppc::core::sparse::CSR<int> graph_;
+  std::string graph_path_;
+  bool from_file_{false};
+  std::vector<int> sources_;
   std::vector<int> distances_;
   int vertices_{0}, edges_count_{0}, source_{0};
-  void CRS(const int* matrix);
   boost::mpi::communicator world;
+  ppc::core::graph::GraphSession<int> session_{world};
 };
 }  // namespace vavilov_v_bellman_ford_mpi
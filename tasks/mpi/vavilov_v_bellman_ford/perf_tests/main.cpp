@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/timer.hpp>
+#include <cstdint>
+#include <iostream>
 #include <vector>
 
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/loader.hpp"
+#include "core/graph/include/sssp.hpp"
 #include "core/perf/include/perf.hpp"
 #include "mpi/vavilov_v_bellman_ford/include/ops_mpi.hpp"
 
@@ -111,3 +116,108 @@ TEST(vavilov_v_bellman_ford_mpi, test_pipeline_run) {
     ASSERT_EQ(distances, expected_distances);
   }
 }
+
+TEST(vavilov_v_bellman_ford_mpi, test_benchmark_graphs) {
+  boost::mpi::environment env;
+  boost::mpi::communicator world;
+
+  // 2^14 vertices of each benchmark topology, handed over as edge lists,
+  // checked against the sequential Dijkstra and reported in TEPS
+  for (auto& graph : ppc::core::graph::benchmark_graphs<int>(14, 8, 1, 100, 2024)) {
+    const int source = 0;
+    std::vector<int> distances(graph.vertices);
+
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      taskDataPar->inputs_count.emplace_back(graph.vertices);
+      taskDataPar->inputs_count.emplace_back(graph.edges.size());
+      taskDataPar->inputs_count.emplace_back(source);
+      taskDataPar->inputs_count.emplace_back(static_cast<uint32_t>(ppc::core::graph::GraphFormat::kEdgeList));
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(graph.edges.data()));
+      taskDataPar->outputs_count.emplace_back(distances.size());
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(distances.data()));
+    }
+
+    vavilov_v_bellman_ford_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+    ASSERT_EQ(testMpiTaskParallel.validation(), true);
+    ASSERT_TRUE(testMpiTaskParallel.pre_processing());
+    world.barrier();
+    const boost::mpi::timer timer;
+    ASSERT_TRUE(testMpiTaskParallel.run());
+    const double seconds = timer.elapsed();
+    testMpiTaskParallel.post_processing();
+
+    if (world.rank() == 0) {
+      const auto csr = graph.csr();
+      const auto expected = ppc::core::graph::dijkstra(csr.view(), source);
+      EXPECT_EQ(distances, expected) << graph.name;
+      const long long edges =
+          ppc::core::graph::traversed_edges(csr.view(), expected, ppc::core::graph::unreachable<int>());
+      ppc::core::graph::print_teps(std::cout, "vavilov_v_bellman_ford_mpi", graph.name, edges, seconds);
+    }
+  }
+}
+
+TEST(vavilov_v_bellman_ford_mpi, test_batch_of_sources) {
+  boost::mpi::environment env;
+  boost::mpi::communicator world;
+
+  // eight queries on one partitioned R-MAT graph: one batched run against
+  // eight single-source runs, each task partitioned before the clock starts
+  auto graph = ppc::core::graph::benchmark_graphs<int>(14, 8, 1, 100, 2024)[0];
+  std::vector<int> sources = {0, 1, 2, 3, 5, 8, 13, 21};
+  const int lanes = static_cast<int>(sources.size());
+  const auto format = static_cast<uint32_t>(ppc::core::graph::GraphFormat::kEdgeList);
+
+  std::vector<int> batched(lanes * graph.vertices);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs_count = {static_cast<uint32_t>(graph.vertices), static_cast<uint32_t>(graph.edges.size()), 0,
+                                 format, static_cast<uint32_t>(lanes)};
+    taskDataPar->inputs = {reinterpret_cast<uint8_t*>(graph.edges.data()), reinterpret_cast<uint8_t*>(sources.data())};
+    taskDataPar->outputs_count.emplace_back(batched.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(batched.data()));
+  }
+  vavilov_v_bellman_ford_mpi::TestMPITaskParallel batch(taskDataPar);
+  ASSERT_TRUE(batch.validation());
+  ASSERT_TRUE(batch.pre_processing());
+  world.barrier();
+  const boost::mpi::timer batch_timer;
+  ASSERT_TRUE(batch.run());
+  const double batch_seconds = batch_timer.elapsed();
+  batch.post_processing();
+
+  double single_seconds = 0.0;
+  std::vector<int> single(lanes * graph.vertices);
+  for (int k = 0; k < lanes; k++) {
+    std::shared_ptr<ppc::core::TaskData> taskDataOne = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      taskDataOne->inputs_count = {static_cast<uint32_t>(graph.vertices), static_cast<uint32_t>(graph.edges.size()),
+                                   static_cast<uint32_t>(sources[k]), format};
+      taskDataOne->inputs.emplace_back(reinterpret_cast<uint8_t*>(graph.edges.data()));
+      taskDataOne->outputs_count.emplace_back(graph.vertices);
+      taskDataOne->outputs.emplace_back(reinterpret_cast<uint8_t*>(single.data() + k * graph.vertices));
+    }
+    vavilov_v_bellman_ford_mpi::TestMPITaskParallel one(taskDataOne);
+    ASSERT_TRUE(one.validation());
+    ASSERT_TRUE(one.pre_processing());
+    world.barrier();
+    const boost::mpi::timer one_timer;
+    ASSERT_TRUE(one.run());
+    single_seconds += one_timer.elapsed();
+    one.post_processing();
+  }
+
+  if (world.rank() == 0) {
+    EXPECT_EQ(batched, single);
+    const auto csr = graph.csr();
+    long long edges = 0;
+    for (int k = 0; k < lanes; k++) {
+      const std::vector<int> dist(single.begin() + k * graph.vertices, single.begin() + (k + 1) * graph.vertices);
+      edges += ppc::core::graph::traversed_edges(csr.view(), dist, ppc::core::graph::unreachable<int>());
+    }
+    ppc::core::graph::print_teps(std::cout, "vavilov_v_bellman_ford_mpi batch of 8", graph.name, edges, batch_seconds);
+    ppc::core::graph::print_teps(std::cout, "vavilov_v_bellman_ford_mpi 8 single runs", graph.name, edges,
+                                 single_seconds);
+  }
+}
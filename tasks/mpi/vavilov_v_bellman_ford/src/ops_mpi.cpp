@@ -1,5 +1,7 @@
 #include "mpi/vavilov_v_bellman_ford/include/ops_mpi.hpp"
 
+#include "core/graph/include/loader.hpp"
+
 void vavilov_v_bellman_ford_mpi::TestMPITaskSequential::CRS(const int* matrix) {
   row_offsets_.push_back(0);
   for (int i = 0; i < vertices_; ++i) {
@@ -71,32 +73,43 @@ bool vavilov_v_bellman_ford_mpi::TestMPITaskSequential::post_processing() {
   return true;
 }
 
-void vavilov_v_bellman_ford_mpi::TestMPITaskParallel::CRS(const int* matrix) {
-  row_offsets_.push_back(0);
-  for (int i = 0; i < vertices_; ++i) {
-    for (int j = 0; j < vertices_; ++j) {
-      if (matrix[i * vertices_ + j] != 0) {
-        weights_.push_back(matrix[i * vertices_ + j]);
-        col_indices_.push_back(j);
-      }
-    }
-    row_offsets_.push_back(weights_.size());
-  }
-};
-
 bool vavilov_v_bellman_ford_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  vertices_ = taskData->inputs_count[0];
-  edges_count_ = taskData->inputs_count[1];
-  source_ = taskData->inputs_count[2];
-
-  auto* matrix = reinterpret_cast<int*>(taskData->inputs[0]);
 
-  CRS(matrix);
-
-  distances_.resize(vertices_, INT_MAX);
-  distances_[source_] = 0;
+  // root reads the graph and the sources, then the graph is partitioned once:
+  // root hands every rank its rows, or every rank reads them from an edge file
+  bool loaded = true;
+  if (world.rank() == 0) {
+    vertices_ = taskData->inputs_count[0];
+    edges_count_ = taskData->inputs_count[1];
+    source_ = taskData->inputs_count[2];
+
+    const auto format = static_cast<ppc::core::graph::GraphFormat>(
+        taskData->inputs_count.size() > 3 ? taskData->inputs_count[3] : 0);
+    if (taskData->inputs_count.size() > 4) {
+      const auto* sources = reinterpret_cast<const int*>(taskData->inputs[ppc::core::graph::format_inputs(format)]);
+      sources_.assign(sources, sources + taskData->inputs_count[4]);
+    } else {
+      sources_.assign(1, source_);
+    }
+    from_file_ = format == ppc::core::graph::GraphFormat::kEdgeFile;
+    if (from_file_) {
+      graph_path_ = reinterpret_cast<const char*>(taskData->inputs[0]);
+    } else {
+      loaded = ppc::core::graph::load_graph(format, taskData->inputs, vertices_, edges_count_, graph_);
+    }
+  }
+  boost::mpi::broadcast(world, loaded, 0);
+  if (!loaded) return false;
 
+  boost::mpi::broadcast(world, vertices_, 0);
+  boost::mpi::broadcast(world, sources_, 0);
+  boost::mpi::broadcast(world, from_file_, 0);
+  if (from_file_) {
+    boost::mpi::broadcast(world, graph_path_, 0);
+    return session_.load(graph_path_) && session_.vertices() == vertices_;
+  }
+  session_.scatter(graph_.view(), 0);
   return true;
 }
 
@@ -104,7 +117,19 @@ bool vavilov_v_bellman_ford_mpi::TestMPITaskParallel::validation() {
   internal_order_test();
 
   if (world.rank() == 0) {
-    return (!taskData->inputs.empty());
+    if (taskData->inputs_count.size() < 3 || taskData->outputs.empty()) return false;
+    const uint32_t format = taskData->inputs_count.size() > 3 ? taskData->inputs_count[3] : 0;
+    if (!ppc::core::graph::known_format(format)) return false;
+    const size_t graph_inputs = ppc::core::graph::format_inputs(static_cast<ppc::core::graph::GraphFormat>(format));
+    if (taskData->inputs_count.size() > 4) {
+      // the sources follow the graph and must all be vertices
+      if (taskData->inputs.size() <= graph_inputs || taskData->inputs[graph_inputs] == nullptr) return false;
+      const auto* sources = reinterpret_cast<const int*>(taskData->inputs[graph_inputs]);
+      return std::all_of(sources, sources + taskData->inputs_count[4], [&](int s) {
+        return s >= 0 && static_cast<uint32_t>(s) < taskData->inputs_count[0];
+      });
+    }
+    return taskData->inputs.size() >= graph_inputs && taskData->inputs_count[2] < taskData->inputs_count[0];
   }
   return true;
 }
@@ -112,58 +137,14 @@ bool vavilov_v_bellman_ford_mpi::TestMPITaskParallel::validation() {
 bool vavilov_v_bellman_ford_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  boost::mpi::broadcast(world, vertices_, 0);
-  boost::mpi::broadcast(world, row_offsets_, 0);
-  boost::mpi::broadcast(world, col_indices_, 0);
-  boost::mpi::broadcast(world, weights_, 0);
-
-  if (distances_.empty()) {
-    distances_.resize(vertices_, INT_MAX);
-  }
-  boost::mpi::broadcast(world, distances_, 0);
-
-  int local_start = world.rank() * (vertices_ / world.size()) + std::min(world.rank(), vertices_ % world.size());
-  int local_end = local_start + (vertices_ / world.size()) + (world.rank() < vertices_ % world.size() ? 1 : 0);
-
-  for (int i = 0; i < vertices_ - 1; ++i) {
-    std::vector<int> local_distances = distances_;
-    bool local_changed = false;
-
-    for (int u = local_start; u < local_end; ++u) {
-      for (int j = row_offsets_[u]; j < row_offsets_[u + 1]; ++j) {
-        int v = col_indices_[j];
-        int weight = weights_[j];
-        if (distances_[u] != INT_MAX && distances_[u] + weight < local_distances[v]) {
-          local_distances[v] = distances_[u] + weight;
-          local_changed = true;
-        }
-      }
-    }
-
-    boost::mpi::all_reduce(world, local_distances.data(), vertices_, distances_.data(), [](int a, int b) {
-      if (a == INT_MAX) return b;
-      if (b == INT_MAX) return a;
-      return std::min(a, b);
-    });
-
-    bool global_changed = boost::mpi::all_reduce(world, local_changed, std::logical_or<>());
-    if (!global_changed) break;
-  }
-
-  bool has_negative_cycle = false;
-  for (int u = local_start; u < local_end; ++u) {
-    for (int j = row_offsets_[u]; j < row_offsets_[u + 1]; ++j) {
-      int v = col_indices_[j];
-      int weight = weights_[j];
-      if (distances_[u] != INT_MAX && distances_[u] + weight < distances_[v]) {
-        has_negative_cycle = true;
-        break;
-      }
-    }
-  }
-
-  has_negative_cycle = boost::mpi::all_reduce(world, has_negative_cycle, std::logical_or<>());
-  return !has_negative_cycle;
+  // every rank relaxes only the rows of its own block of vertices, for all
+  // the sources in each sweep, and hears about the lanes that changed in
+  // other blocks
+  std::vector<int> owned;
+  const bool no_negative_cycle =
+      ppc::core::graph::multi_source_paths(world, session_.local(), session_.bounds(), sources_, owned);
+  distances_ = ppc::core::graph::by_source(session_.gather(owned, sources_.size(), 0), sources_.size());
+  return no_negative_cycle;
 }
 
 bool vavilov_v_bellman_ford_mpi::TestMPITaskParallel::post_processing() {
@@ -10,22 +10,14 @@
 #include <utility>
 #include <vector>
 
+#include "core/geometry/include/hull_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vladimirova_j_jarvis_method_mpi {
 
-struct Point {
-  int x, y;
-  Point() {
-    x = 0;
-    y = 0;
-  }
-  Point(int _x, int _y) {
-    x = _x;
-    y = _y;
-  }
-  bool operator==(const Point& other) const { return (x == other.x) && (y == other.y); }
-};
+// Hull of the dark pixels as (row, col) pairs, from the leftmost pixel of
+// the bottom row and clockwise on the screen.
+std::vector<int> screenOrder(std::vector<ppc::core::geometry::Point<int>> hull);
 
 class TestMPITaskSequential : public ppc::core::Task {
  public:
@@ -36,7 +28,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<Point> input_;
+  ppc::core::geometry::PointSet<int> input_;
   std::vector<int> res_;
   size_t col = 0, row = 0;
 };
@@ -50,8 +42,8 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
-  std::vector<Point> local_input_;
+  ppc::core::geometry::PointSet<int> input_;
+  ppc::core::geometry::PointSet<int> local_input_;
   std::vector<int> res_;
   size_t col = 0, row = 0;
   boost::mpi::communicator world;
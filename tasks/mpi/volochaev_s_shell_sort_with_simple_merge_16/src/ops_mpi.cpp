@@ -7,10 +7,8 @@
 #include <thread>
 #include <vector>
 
-namespace volochaev_s_shell_sort_with_simple_merge_16_mpi {
-void sort(std::vector<int>& v);
-std::vector<int> merge(const std::vector<int>& left, const std::vector<int>& right);
-}  // namespace volochaev_s_shell_sort_with_simple_merge_16_mpi
+#include "core/sort/include/batcher_mpi.hpp"
+#include "core/sort/include/shell.hpp"
 
 bool volochaev_s_shell_sort_with_simple_merge_16_mpi::Lab3_16_seq::pre_processing() {
   internal_order_test();
@@ -33,21 +31,7 @@ bool volochaev_s_shell_sort_with_simple_merge_16_mpi::Lab3_16_seq::validation()
 bool volochaev_s_shell_sort_with_simple_merge_16_mpi::Lab3_16_seq::run() {
   internal_order_test();
 
-  int n = size_;
-  int gap = n / 2;
-
-  while (gap > 0) {
-    for (int i = gap; i < n; ++i) {
-      int temp = mas[i];
-      int j = i;
-      while (j >= gap && mas[j - gap] > temp) {
-        mas[j] = mas[j - gap];
-        j -= gap;
-      }
-      mas[j] = temp;
-    }
-    gap /= 2;
-  }
+  ppc::core::sort::shell_sort(mas);
 
   return true;
 }
@@ -84,66 +68,15 @@ bool volochaev_s_shell_sort_with_simple_merge_16_mpi::Lab3_16_mpi::validation()
   return true;
 }
 
-void volochaev_s_shell_sort_with_simple_merge_16_mpi::sort(std::vector<int>& v) {
-  int n = v.size();
-  int gap = n / 2;
-
-  while (gap > 0) {
-    for (int i = gap; i < n; ++i) {
-      int temp = v[i];
-      int j = i;
-      while (j >= gap && v[j - gap] > temp) {
-        v[j] = v[j - gap];
-        j -= gap;
-      }
-      v[j] = temp;
-    }
-    gap /= 2;
-  }
-}
-
-std::vector<int> volochaev_s_shell_sort_with_simple_merge_16_mpi::merge(const std::vector<int>& left,
-                                                                        const std::vector<int>& right) {
-  std::vector<int> res;
-  res.reserve(left.size() + right.size());
-  std::merge(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(res));
-
-  return res;
-}
-
 bool volochaev_s_shell_sort_with_simple_merge_16_mpi::Lab3_16_mpi::run() {
   internal_order_test();
 
-  broadcast(world, size_, 0);
-  std::vector<int> sizes;
-
-  if (world.rank() == 0) {
-    int delta = size_ / world.size();
-    int ost = size_ % world.size();
-
-    sizes.resize(world.size(), delta);
-    for (int i = 0; i < ost; ++i) {
-      ++sizes[i];
-    }
-  }
-
-  broadcast(world, sizes, 0);
-
-  local_input.resize(sizes[world.rank()]);
-  scatterv(world, mas.data(), sizes, local_input.data(), 0);
-
-  sort(local_input);
-
+  local_input = ppc::core::sort::scatter_even(world, mas, 0);
+  ppc::core::sort::batcher_sort(world, local_input, std::less<>(),
+                                [](std::vector<int>& v) { ppc::core::sort::shell_sort(v); });
+  std::vector<int> sorted = ppc::core::sort::gather_sorted(world, local_input, 0);
   if (world.rank() == 0) {
-    mas = local_input;
-    std::vector<int> data;
-
-    for (int i = 1; i < world.size(); ++i) {
-      world.recv(i, 0, data);
-      mas = merge(mas, data);
-    }
-  } else {
-    world.send(0, 0, local_input);
+    mas = std::move(sorted);
   }
 
   return true;
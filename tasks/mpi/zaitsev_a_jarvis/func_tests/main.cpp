@@ -36,6 +36,40 @@ TEST(zaitsev_a_jarvis_mpi_test, validation_fails_on_incorrect_input) {
   }
 }
 
+TEST(zaitsev_a_jarvis_mpi_test, wraps_hull_with_every_point_as_vertex) {
+  boost::mpi::communicator world;
+
+  // a parabola, listed out of order: every point is a vertex
+  const int half = 500;
+  std::vector<zaitsev_a_jarvis_seq::Point<double>> points;
+  for (int x = -half; x <= half; x++) points.push_back({double((x + half) * 7919 % (2 * half + 1) - half), 0});
+  for (auto &p : points) p.y = p.x * p.x;
+  std::vector<zaitsev_a_jarvis_seq::Point<double>> expected;
+  for (int x = 0; x <= half; x++) expected.push_back({double(x), double(x * x)});
+  for (int x = -half; x < 0; x++) expected.push_back({double(x), double(x * x)});
+
+  std::vector<zaitsev_a_jarvis_seq::Point<double>> out(points.size(), {0, 0});
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(points.data()));
+    taskData->inputs_count.emplace_back(points.size());
+
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+  }
+
+  zaitsev_a_jarvis_mpi::Jarvis<double> task(taskData);
+  ASSERT_TRUE(task.validation());
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+
+  if (world.rank() == 0) {
+    out.resize(taskData->outputs_count[0]);
+    EXPECT_EQ(out, expected);
+  }
+}
+
 TEST_P(zaitsev_a_jarvis_mpi_test, returns_correct_convex_hull) {
   const auto &[points, expected] = GetParam();
 
@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/geometry/include/hull_mpi.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/zaitsev_a_jarvis/include/point.hpp"
 
@@ -38,6 +39,7 @@ class Jarvis : public ppc::core::Task {
 
     auto* tmp_ptr = reinterpret_cast<mine_seq::Point<T>*>(taskData->inputs[0]);
     set.assign(tmp_ptr, tmp_ptr + length);
+    points = mine_seq::to_point_set(set);
 
     convex_hull.clear();
 
@@ -47,53 +49,10 @@ class Jarvis : public ppc::core::Task {
   bool run() override {
     internal_order_test();
 
-    boost::mpi::broadcast(world, set, root);
-
-    if (set.size() < 3) {
-      if (world.rank() == root) convex_hull = set;
-      return true;
-    }
-
-    boost::mpi::broadcast(world, length, root);
-
-    shift = (world.rank() == 0) ? length / world.size() + length % world.size() : length / world.size();
-
-    unsigned int st_pos = world.rank() > root ? world.rank() * shift + length % world.size() : world.rank() * shift;
-    unsigned int end_pos = st_pos + shift;
-
-    unsigned int prev;
-    unsigned int next;
-    unsigned int start;
-
-    if (world.rank() == root) {
-      start = 0;
-      for (unsigned int i = 1; i < length; i++)
-        if (set[i].y < set[start].y || (set[i].y == set[start].y && set[i].x < set[start].x)) start = i;
-    }
-    boost::mpi::broadcast(world, start, root);
-    prev = start;
-    do {
-      if (world.rank() == root) convex_hull.push_back(set[prev]);
-      next = (prev + 1) % length;
-
-      for (unsigned int supposed = st_pos; supposed < end_pos; supposed++) {
-        if (orientation(set[prev], set[supposed], set[next]) == 2) next = supposed;
-        if (prev != supposed && set[next].between(set[prev], set[supposed])) next = supposed;
-      }
-
-      std::vector<T> most_counterclock_wise(world.size(), 0);
-
-      boost::mpi::gather<T>(world, next, most_counterclock_wise.data(), root);
-
-      if (world.rank() == root) {
-        for (auto supposed : most_counterclock_wise) {
-          if (orientation(set[prev], set[supposed], set[next]) == 2) next = supposed;
-          if ((int)prev != supposed && set[next].between(set[prev], set[supposed])) next = supposed;
-        }
-        prev = next;
-      }
-      boost::mpi::broadcast(world, prev, root);
-    } while (prev != start);
+    // Chan's gift wrapping over all ranks (chan_hull() in hull_mpi.hpp)
+    const auto local = ppc::core::geometry::scatter_points(world, points, root);
+    auto hull = ppc::core::geometry::chan_hull(world, local);
+    if (world.rank() == root) convex_hull = set.size() < 3 ? set : mine_seq::from_lowest(std::move(hull));
     return true;
   };
 
@@ -111,8 +70,8 @@ class Jarvis : public ppc::core::Task {
  private:
   int root = 0;
   unsigned int length;
-  unsigned int shift;
   std::vector<mine_seq::Point<T>> set;
+  ppc::core::geometry::PointSet<T> points;
   std::vector<mine_seq::Point<T>> convex_hull;
   const boost::mpi::communicator world;
 };
@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/graph/include/session_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace zinoviev_a_bellman_ford_mpi {
@@ -50,10 +51,10 @@ class BellmanFordMPIMPI : public ppc::core::Task {
   std::vector<int> row_ptr;
   std::vector<int> shortest_paths;
   boost::mpi::communicator world;
+  // the graph split by rows in pre_processing, resident for every run
+  ppc::core::graph::GraphSession<int> session{world};
   static constexpr int INF = std::numeric_limits<int>::max();
 
-  bool Iteration(std::vector<int>& paths);
-  bool check_negative_cycle();
   void toCRS(const int* input_matrix);
 };
 
@@ -7,10 +7,14 @@
 #include <boost/serialization/vector.hpp>
 #include <vector>
 
+#include "core/graph/include/bellman_ford_mpi.hpp"
+
 namespace zinoviev_a_bellman_ford_mpi {
 
 void BellmanFordMPIMPI::toCRS(const int* input_matrix) {
-  row_ptr.push_back(0);
+  values.clear();
+  columns.clear();
+  row_ptr.assign(1, 0);
   for (size_t i = 0; i < V; ++i) {
     for (size_t j = 0; j < V; ++j) {
       if (input_matrix[i * V + j] != 0) {
@@ -31,17 +35,11 @@ bool BellmanFordMPIMPI::pre_processing() {
 
     toCRS(input_matrix);
   }
-  boost::mpi::broadcast(world, V, 0);
-  boost::mpi::broadcast(world, values, 0);
-  boost::mpi::broadcast(world, columns, 0);
-  boost::mpi::broadcast(world, row_ptr, 0);
-
-  shortest_paths.resize(V, INF);
-  shortest_paths[0] = 0;
-
-  // Broadcast paths to all ranks
-  boost::mpi::broadcast(world, shortest_paths, 0);
 
+  // the graph is split by rows once; runs only relax and exchange distances
+  const int vertices = static_cast<int>(V);
+  session.scatter({vertices, vertices, row_ptr.data(), columns.data(), values.data()}, 0);
+  V = session.vertices();
   return true;
 }
 
@@ -54,90 +52,19 @@ bool BellmanFordMPIMPI::validation() {
   return true;
 }
 
-bool BellmanFordMPIMPI::Iteration(std::vector<int>& paths) {
-  bool changed = false;
-  std::vector<int> start_paths = paths;
-  int rank = world.rank();
-  int size = world.size();
-
-  int local_size = V / size;
-  int remainder = V % size;
-  int start = rank * local_size + std::min(rank, remainder);
-  int end = start + local_size + (rank < remainder ? 1 : 0);
-
-  for (int i = start; i < end; i++) {
-    for (int j = row_ptr[i]; j < row_ptr[i + 1]; j++) {
-      int v = columns[j];
-      int weight = values[j];
-      if (start_paths[i] != INF && start_paths[i] + weight < start_paths[v]) {
-        start_paths[v] = start_paths[i] + weight;
-      }
-    }
-  }
-
-  std::vector<int> reduced_paths(V, INF);
-  boost::mpi::reduce(
-      world, start_paths.data(), V, reduced_paths.data(),
-      [](int a, int b) {
-        if (a == zinoviev_a_bellman_ford_mpi::BellmanFordMPIMPI::INF) return b;
-        if (b == zinoviev_a_bellman_ford_mpi::BellmanFordMPIMPI::INF) return a;
-        return std::min(a, b);
-      },
-      0);
-
-  // Broadcast the reduced paths to all ranks
-  boost::mpi::broadcast(world, reduced_paths, 0);
-
-  if (world.rank() == 0) {
-    for (size_t i = 0; i < V; i++) {
-      if (paths[i] != reduced_paths[i]) {
-        changed = true;
-        break;
-      }
-    }
-    paths = reduced_paths;
-  }
-
-  boost::mpi::broadcast(world, paths.data(), paths.size(), 0);
-  boost::mpi::broadcast(world, changed, 0);
-
-  return changed;
-}
-
-bool BellmanFordMPIMPI::check_negative_cycle() {
-  for (size_t i = 0; i < V; ++i) {
-    for (int j = row_ptr[i]; j < row_ptr[i + 1]; ++j) {
-      int v = columns[j];
-      int weight = values[j];
-      if (shortest_paths[i] != INF && shortest_paths[i] + weight < shortest_paths[v]) {
-        return true;
-      }
-    }
-  }
-  return false;
-}
-
 bool BellmanFordMPIMPI::run() {
   internal_order_test();
 
-  bool changed = false;
-  for (size_t i = 0; i < V - 1; ++i) {
-    changed = Iteration(shortest_paths);
-    boost::mpi::broadcast(world, shortest_paths, 0);
-
-    if (!changed) break;
-  }
+  // only changed distances cross ranks
+  std::vector<int> owned;
+  const bool no_negative_cycle = ppc::core::graph::bellman_ford(world, session.local(), session.bounds(), 0, owned);
+  shortest_paths = session.gather(owned, 1, 0);
 
   if (world.rank() == 0) {
     for (size_t i = 0; i < V; ++i) {
       if (shortest_paths[i] == INF) shortest_paths[i] = 0;
     }
-  }
-
-  boost::mpi::broadcast(world, shortest_paths, 0);
-
-  if (world.rank() == 0) {
-    return !check_negative_cycle();
+    return no_negative_cycle;
   }
 
   return true;
@@ -2,19 +2,15 @@
 
 #include <vector>
 
+#include "core/geometry/include/hull.hpp"
 #include "core/task/include/task.hpp"
 
 namespace beskhmelnova_k_jarvis_march_seq {
 
+// Strict convex hull of the points, counter-clockwise from the leftmost
+// point (the lowest of those), as coordinate arrays.
 template <typename DataType>
-DataType crossProduct(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                      const std::vector<DataType>& p3);
-
-template <typename DataType>
-bool isLeftAngle(const std::vector<DataType>& p1, const std::vector<DataType>& p2, const std::vector<DataType>& p3);
-
-template <typename DataType>
-void jarvisMarch(int& num_points, std::vector<std::vector<DataType>>& input, std::vector<DataType>& res_x,
+void jarvisMarch(const ppc::core::geometry::PointSet<DataType>& points, std::vector<DataType>& res_x,
                  std::vector<DataType>& res_y);
 
 template <typename DataType>
@@ -27,8 +23,7 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  int num_points{};
-  std::vector<std::vector<DataType>> input;
+  ppc::core::geometry::PointSet<DataType> input;
   std::vector<DataType> res_x;
   std::vector<DataType> res_y;
 };
@@ -5,62 +5,26 @@
 using namespace std::chrono_literals;
 
 template <typename DataType>
-DataType beskhmelnova_k_jarvis_march_seq::crossProduct(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                                                       const std::vector<DataType>& p3) {
-  return ((p2[1] - p1[1]) * (p3[2] - p1[2]) - (p3[1] - p1[1]) * (p2[2] - p1[2]));
-}
-
-template <typename DataType>
-bool beskhmelnova_k_jarvis_march_seq::isLeftAngle(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                                                  const std::vector<DataType>& p3) {
-  return cross_product(p1, p2, p3) > 0;
-}
-
-template <typename DataType>
-void beskhmelnova_k_jarvis_march_seq::jarvisMarch(int& num_points, std::vector<std::vector<DataType>>& input,
+void beskhmelnova_k_jarvis_march_seq::jarvisMarch(const ppc::core::geometry::PointSet<DataType>& points,
                                                   std::vector<DataType>& res_x, std::vector<DataType>& res_y) {
-  int leftmost_index = 0;
-  for (int i = 1; i < num_points; i++)
-    if (input[i][1] < input[leftmost_index][1] ||
-        (input[i][1] == input[leftmost_index][1] && input[i][2] < input[leftmost_index][2]))
-      leftmost_index = i;
-  std::swap(input[0], input[leftmost_index]);
-  std::vector<std::vector<DataType>> hull;
-  int current = 0;
-  do {
-    hull.push_back(input[current]);
-    int next = (current + 1) % num_points;
-    for (int i = 0; i < num_points; ++i) {
-      auto cross_product =
-          beskhmelnova_k_jarvis_march_seq::crossProduct<DataType>(input[current], input[next], input[i]);
-      if (cross_product < 0 || (cross_product == 0 &&
-                                std::hypot(input[i][1] - input[current][1], input[i][2] - input[current][2]) >
-                                    std::hypot(input[next][1] - input[current][1], input[next][2] - input[current][2])))
-        next = i;
-    }
-    current = next;
-  } while (current != 0);
-  num_points = static_cast<int>(hull.size());
-  res_x.resize(num_points);
-  res_y.resize(num_points);
-  for (int i = 0; i < num_points; ++i) {
-    res_x[i] = hull[i][1];
-    res_y[i] = hull[i][2];
+  // the hull begins at the leftmost point, the lowest of ties, as res_x and res_y should
+  const auto hull = ppc::core::geometry::chan_hull(points);
+  res_x.resize(hull.size());
+  res_y.resize(hull.size());
+  for (size_t i = 0; i < hull.size(); ++i) {
+    res_x[i] = hull[i].x;
+    res_y[i] = hull[i].y;
   }
-  input = hull;
 }
 
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_seq::TestTaskSequential<DataType>::pre_processing() {
   internal_order_test();
-  num_points = (int)taskData->inputs_count[0];
-  input = std::vector<std::vector<DataType>>(num_points, std::vector<DataType>(3, 0));
+  const auto num_points = taskData->inputs_count[0];
   auto* ptr_x = reinterpret_cast<DataType*>(taskData->inputs[0]);
   auto* ptr_y = reinterpret_cast<DataType*>(taskData->inputs[1]);
-  for (int i = 0; i < num_points; i++) {
-    input[i][1] = ptr_x[i];
-    input[i][2] = ptr_y[i];
-  }
+  input.x.assign(ptr_x, ptr_x + num_points);
+  input.y.assign(ptr_y, ptr_y + num_points);
   return true;
 }
 
@@ -73,17 +37,17 @@ bool beskhmelnova_k_jarvis_march_seq::TestTaskSequential<DataType>::validation()
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_seq::TestTaskSequential<DataType>::run() {
   internal_order_test();
-  jarvisMarch(num_points, input, res_x, res_y);
+  jarvisMarch(input, res_x, res_y);
   return true;
 }
 
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_seq::TestTaskSequential<DataType>::post_processing() {
   internal_order_test();
-  reinterpret_cast<int*>(taskData->outputs[0])[0] = num_points;
-  for (int i = 0; i < num_points; i++) {
-    reinterpret_cast<DataType*>(taskData->outputs[1])[i] = input[i][1];
-    reinterpret_cast<DataType*>(taskData->outputs[2])[i] = input[i][2];
+  reinterpret_cast<int*>(taskData->outputs[0])[0] = static_cast<int>(res_x.size());
+  for (size_t i = 0; i < res_x.size(); i++) {
+    reinterpret_cast<DataType*>(taskData->outputs[1])[i] = res_x[i];
+    reinterpret_cast<DataType*>(taskData->outputs[2])[i] = res_y[i];
   }
   return true;
 }
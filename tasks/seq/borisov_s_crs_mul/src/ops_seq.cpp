@@ -1,6 +1,9 @@
 #include "seq/borisov_s_crs_mul/include/ops_seq.hpp"
 
 #include <algorithm>
+#include <utility>
+
+#include "core/sparse/include/sparse.hpp"
 
 using namespace std::chrono_literals;
 
@@ -58,38 +61,13 @@ bool CrsMatrixMulTask::pre_processing() {
 bool CrsMatrixMulTask::run() {
   internal_order_test();
 
-  std::vector<double> temp(C_ncols_, 0.0);
-
-  for (int i = 0; i < C_nrows_; ++i) {
-    std::fill(temp.begin(), temp.end(), 0.0);
-
-    int startA = A_row_ptr_[i];
-    int endA = A_row_ptr_[i + 1];
-
-    for (int posA = startA; posA < endA; ++posA) {
-      double a_val = A_values_[posA];
-      int a_col = A_col_index_[posA];
-
-      int startB = B_row_ptr_[a_col];
-      int endB = B_row_ptr_[a_col + 1];
-
-      for (int posB = startB; posB < endB; ++posB) {
-        int b_col = B_col_index_[posB];
-        double b_val = B_values_[posB];
-        temp[b_col] += a_val * b_val;
-      }
-    }
-
-    C_row_ptr_[i] = static_cast<int>(C_values_.size());
-    for (int col = 0; col < C_ncols_; ++col) {
-      if (temp[col] != 0.0) {
-        C_values_.push_back(temp[col]);
-        C_col_index_.push_back(col);
-      }
-    }
-  }
+  ppc::core::sparse::CSRView<double> a{A_nrows_, A_ncols_, A_row_ptr_.data(), A_col_index_.data(), A_values_.data()};
+  ppc::core::sparse::CSRView<double> b{B_nrows_, B_ncols_, B_row_ptr_.data(), B_col_index_.data(), B_values_.data()};
+  auto c = ppc::core::sparse::multiply(a, b);
 
-  C_row_ptr_[C_nrows_] = static_cast<int>(C_values_.size());
+  C_values_ = std::move(c.values);
+  C_col_index_ = std::move(c.col_idx);
+  C_row_ptr_ = std::move(c.row_ptr);
   C_nnz_ = static_cast<int>(C_values_.size());
 
   return true;
@@ -0,0 +1,136 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "seq/boruvka_mst/include/ops_seq.hpp"
+
+namespace {
+
+using Graph = boruvka_mst_seq::BoruvkaSequential::SparseGraphCRS;
+
+struct Result {
+  double weight = 0.0;
+  std::vector<int> edges;
+};
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(Graph& graph, double& weight, std::vector<int>& edges) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&graph));
+  taskData->inputs_count.emplace_back(sizeof(Graph));
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(&weight));
+  taskData->outputs_count.emplace_back(1);
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(edges.data()));
+  taskData->outputs_count.emplace_back(edges.size());
+  return taskData;
+}
+
+Result run_task(Graph& graph) {
+  Result result;
+  result.edges.resize(2 * static_cast<size_t>(graph.num_vertices - 1));
+  boruvka_mst_seq::BoruvkaSequential task(make_task_data(graph, result.weight, result.edges));
+  EXPECT_TRUE(task.validation());
+  EXPECT_TRUE(task.pre_processing());
+  EXPECT_TRUE(task.run());
+  EXPECT_TRUE(task.post_processing());
+  return result;
+}
+
+// Kruskal's algorithm with the task's tie-breaking, as the task writes it.
+Result kruskal(const Graph& graph) {
+  using Edge = ppc::core::graph::Edge<double>;
+  std::vector<Edge> edges;
+  for (int v = 0; v < graph.num_vertices; v++) {
+    for (int e = graph.row_ptr[v]; e < graph.row_ptr[v + 1]; e++) {
+      const int u = graph.col_indices[e];
+      if (u != v) edges.push_back({std::min(u, v), std::max(u, v), graph.values[e]});
+    }
+  }
+  std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+    return std::tie(a.weight, a.source, a.target) < std::tie(b.weight, b.source, b.target);
+  });
+  std::vector<int> parent(graph.num_vertices);
+  std::iota(parent.begin(), parent.end(), 0);
+  const auto root = [&](int x) {
+    while (parent[x] != x) x = parent[x] = parent[parent[x]];
+    return x;
+  };
+  std::vector<std::pair<int, int>> tree;
+  Result result;
+  for (const auto& e : edges) {
+    const int a = root(e.source);
+    const int b = root(e.target);
+    if (a == b) continue;
+    parent[a] = b;
+    result.weight += e.weight;
+    tree.emplace_back(e.source, e.target);
+  }
+  std::sort(tree.begin(), tree.end());
+  result.edges.assign(2 * static_cast<size_t>(graph.num_vertices - 1), -1);
+  for (size_t i = 0; i < tree.size(); i++) {
+    result.edges[2 * i] = tree[i].first;
+    result.edges[2 * i + 1] = tree[i].second;
+  }
+  return result;
+}
+
+Graph to_graph(const ppc::core::sparse::CSR<double>& csr) { return {csr.rows, csr.row_ptr, csr.col_idx, csr.values}; }
+
+}  // namespace
+
+TEST(boruvka_mst_seq, small_graph) {
+  // the square 0 1 2 3 with the diagonal 0 - 2, every edge stored both ways
+  Graph graph{4, {0, 3, 5, 8, 10}, {1, 2, 3, 0, 2, 0, 1, 3, 0, 2}, {1, 3, 4, 1, 2, 3, 2, 5, 4, 5}};
+  const auto result = run_task(graph);
+  EXPECT_DOUBLE_EQ(result.weight, 7.0);
+  EXPECT_EQ(result.edges, (std::vector<int>{0, 1, 0, 3, 1, 2}));
+}
+
+TEST(boruvka_mst_seq, forest_of_a_disconnected_graph) {
+  // 0 - 1 and 2 - 3 stored one way, 4 alone
+  Graph graph{5, {0, 1, 1, 2, 2, 2}, {1, 3}, {2.5, -1.0}};
+  const auto result = run_task(graph);
+  EXPECT_DOUBLE_EQ(result.weight, 1.5);
+  EXPECT_EQ(result.edges, (std::vector<int>{0, 1, 2, 3, -1, -1, -1, -1}));
+}
+
+TEST(boruvka_mst_seq, matches_kruskal_on_benchmark_graphs) {
+  for (const auto& benchmark : ppc::core::graph::benchmark_graphs<double>(11, 6, 0.0, 1.0, 31)) {
+    auto graph = to_graph(benchmark.csr());
+    const auto result = run_task(graph);
+    const auto expected = kruskal(graph);
+    EXPECT_NEAR(result.weight, expected.weight, 1e-9 * benchmark.vertices) << benchmark.name;
+    EXPECT_EQ(result.edges, expected.edges) << benchmark.name;
+  }
+}
+
+TEST(boruvka_mst_seq, single_vertex) {
+  Graph graph{1, {0, 1}, {0}, {3.0}};
+  const auto result = run_task(graph);
+  EXPECT_DOUBLE_EQ(result.weight, 0.0);
+  EXPECT_TRUE(result.edges.empty());
+}
+
+TEST(boruvka_mst_seq, validation_rejects_bad_graphs) {
+  double weight = 0.0;
+  std::vector<int> edges(2);
+  Graph stray{2, {0, 1, 1}, {2}, {1.0}};
+  boruvka_mst_seq::BoruvkaSequential stray_head(make_task_data(stray, weight, edges));
+  EXPECT_FALSE(stray_head.validation());
+
+  Graph graph{2, {0, 1, 1}, {1}, {1.0}};
+  std::vector<int> small(1);
+  boruvka_mst_seq::BoruvkaSequential no_room(make_task_data(graph, weight, small));
+  EXPECT_FALSE(no_room.validation());
+
+  Graph empty{0, {0}, {}, {}};
+  std::vector<int> none;
+  boruvka_mst_seq::BoruvkaSequential no_vertices(make_task_data(empty, weight, none));
+  EXPECT_FALSE(no_vertices.validation());
+}
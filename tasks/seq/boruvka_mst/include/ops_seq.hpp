@@ -0,0 +1,40 @@
+// Copyright 2024 Nesterov Alexander
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/mst.hpp"
+#include "core/task/include/task.hpp"
+
+namespace boruvka_mst_seq {
+
+// Minimum spanning forest of an undirected graph by Boruvka's algorithm.
+// inputs[0] points to a SparseGraphCRS, the layout of
+// gusev_n_dijkstras_algorithm, in which an edge may be stored either way or
+// both; outputs[0] receives the forest's weight as a double and outputs[1],
+// outputs_count[1] = 2 * (num_vertices - 1) ints, its edges as sorted
+// (source, target) pairs with source < target, then -1 for the pairs a
+// forest of several trees leaves over.
+class BoruvkaSequential : public ppc::core::Task {
+ public:
+  explicit BoruvkaSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  struct SparseGraphCRS {
+    int num_vertices;
+    std::vector<int> row_ptr;
+    std::vector<int> col_indices;
+    std::vector<double> values;
+  };
+
+ private:
+  const SparseGraphCRS* graph_{};
+  ppc::core::graph::SpanningForest<double> forest_;
+};
+
+}  // namespace boruvka_mst_seq
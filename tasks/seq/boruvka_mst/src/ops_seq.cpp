@@ -0,0 +1,53 @@
+// Copyright 2024 Nesterov Alexander
+#include "seq/boruvka_mst/include/ops_seq.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+#include "core/graph/include/loader.hpp"
+
+bool boruvka_mst_seq::BoruvkaSequential::pre_processing() {
+  internal_order_test();
+  graph_ = reinterpret_cast<const SparseGraphCRS*>(taskData->inputs[0]);
+  return true;
+}
+
+bool boruvka_mst_seq::BoruvkaSequential::validation() {
+  internal_order_test();
+  if (taskData->inputs.size() != 1 || taskData->inputs[0] == nullptr || taskData->outputs.size() != 2 ||
+      taskData->outputs_count.size() != 2) {
+    return false;
+  }
+  const auto* graph = reinterpret_cast<const SparseGraphCRS*>(taskData->inputs[0]);
+  const int n = graph->num_vertices;
+  return n > 0 && graph->row_ptr.size() == static_cast<size_t>(n) + 1 &&
+         graph->values.size() == graph->col_indices.size() &&
+         ppc::core::graph::well_formed(n, graph->row_ptr.data(), graph->col_indices.data(),
+                                       graph->col_indices.size()) &&
+         taskData->outputs_count[0] == 1 && taskData->outputs_count[1] == 2 * static_cast<size_t>(n - 1);
+}
+
+bool boruvka_mst_seq::BoruvkaSequential::run() {
+  internal_order_test();
+  const int n = graph_->num_vertices;
+  const ppc::core::graph::GraphView<double> view{n, n, graph_->row_ptr.data(), graph_->col_indices.data(),
+                                                 graph_->values.data()};
+  forest_ = ppc::core::graph::boruvka(view);
+  return true;
+}
+
+bool boruvka_mst_seq::BoruvkaSequential::post_processing() {
+  internal_order_test();
+  auto& edges = forest_.edges;
+  std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) {
+    return std::tie(a.source, a.target) < std::tie(b.source, b.target);
+  });
+  *reinterpret_cast<double*>(taskData->outputs[0]) = forest_.weight;
+  auto* out = reinterpret_cast<int*>(taskData->outputs[1]);
+  std::fill(out, out + taskData->outputs_count[1], -1);
+  for (const auto& e : edges) {
+    *out++ = e.source;
+    *out++ = e.target;
+  }
+  return true;
+}
@@ -2,6 +2,8 @@
 
 #include <thread>
 
+#include "core/linalg/include/gemm.hpp"
+
 bool budazhapova_e_matrix_mult_seq::MatrixMultSequential::pre_processing() {
   internal_order_test();
 
@@ -23,12 +25,7 @@ bool budazhapova_e_matrix_mult_seq::MatrixMultSequential::validation() {
 
 bool budazhapova_e_matrix_mult_seq::MatrixMultSequential::run() {
   internal_order_test();
-  for (int i = 0; i < rows; i++) {
-    res[i] = 0;
-    for (int j = 0; j < columns; j++) {
-      res[i] += A[j + columns * i] * b[j];
-    }
-  }
+  ppc::core::linalg::gemv(rows, columns, A.data(), columns, b.data(), res.data());
   return true;
 }
 
@@ -8,13 +8,10 @@
 #include <utility>
 #include <vector>
 
+#include "core/image/include/runs.hpp"
 #include "core/task/include/task.hpp"
 
 namespace chistov_a_convex_hull_image_seq {
-struct Point {
-  int x, y;
-};
-
 class ConvexHullSEQ : public ppc::core::Task {
  public:
   explicit ConvexHullSEQ(std::shared_ptr<ppc::core::TaskData> taskData) : Task(std::move(taskData)) {}
@@ -26,7 +23,7 @@ class ConvexHullSEQ : public ppc::core::Task {
 
  private:
   std::vector<int> image;
-  std::vector<std::vector<Point>> components;
+  std::vector<ppc::core::geometry::PointSet<int>> components;
   int width{};
   int height{};
   int size{};
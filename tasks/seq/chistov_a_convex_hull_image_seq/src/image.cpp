@@ -7,7 +7,7 @@
 #include <vector>
 
 namespace chistov_a_convex_hull_image_seq {
-std::vector<int> setPoints(const std::vector<Point>& points, int width, int height) {
+std::vector<int> setPoints(const std::vector<ppc::core::geometry::Point<int>>& points, int width, int height) {
   std::vector<int> image(width * height, 0);
   if (points.size() < 2) return image;
 
@@ -44,102 +44,14 @@ std::vector<int> setPoints(const std::vector<Point>& points, int width, int heig
   return image;
 }
 
-int cross(const Point& p1, const Point& p2, const Point& p3) {
-  return (p2.x - p1.x) * (p3.y - p1.y) - (p2.y - p1.y) * (p3.x - p1.x);
-}
-
-void labelingFirstPass(std::vector<int>& labeled_image, int width, int height) {
-  int mark = 2;
-
-  for (int i = 0; i < height; ++i) {
-    for (int j = 0; j < width; ++j) {
-      int current = labeled_image[i * width + j];
-      int left = (j == 0) ? 0 : labeled_image[i * width + (j - 1)];
-      int upper = (i == 0) ? 0 : labeled_image[(i - 1) * width + j];
-
-      if (current == 0) continue;
-
-      if (left == 0 && upper == 0) {
-        labeled_image[i * width + j] = mark++;
-      } else {
-        labeled_image[i * width + j] = std::max(left, upper);
-      }
-    }
-  }
-}
-
-void labelingSecondPass(std::vector<int>& labeled_image, int width, int height) {
-  for (int i = height - 1; i >= 0; --i) {
-    for (int j = width - 1; j >= 0; --j) {
-      int current = labeled_image[i * width + j];
-      int right = (j == width - 1) ? 0 : labeled_image[i * width + (j + 1)];
-      int lower = (i == height - 1) ? 0 : labeled_image[(i + 1) * width + j];
-
-      if (current == 0 || (right == 0 && lower == 0)) continue;
-
-      labeled_image[i * width + j] = std::max(right, lower);
-    }
-  }
-}
-
-std::vector<std::vector<Point>> processLabeledImage(const std::vector<int>& labeled_image, int width, int height) {
-  std::vector<int> component_indices;
-  std::vector<std::vector<Point>> components;
-
-  for (int i = 0; i < height; i++) {
-    for (int j = 0; j < width; j++) {
-      if (labeled_image[i * width + j] == 0) continue;
-
-      int component_label = labeled_image[i * width + j];
-
-      if (static_cast<size_t>(component_label) < component_indices.size() && component_indices[component_label] != -1) {
-        components[component_indices[component_label]].push_back(Point{j, i});
-      } else {
-        component_indices.resize(std::max(component_indices.size(), static_cast<size_t>(component_label + 1)), -1);
-        component_indices[component_label] = components.size();
-        components.push_back({Point{j, i}});
-      }
-    }
-  }
-  return components;
-}
-
-std::vector<std::vector<Point>> labeling(const std::vector<int>& image, int width, int height) {
-  std::vector<int> labeled_image(width * height);
-
-  std::copy(image.begin(), image.end(), labeled_image.begin());
-  labelingFirstPass(labeled_image, width, height);
-  labelingSecondPass(labeled_image, width, height);
-  return processLabeledImage(labeled_image, width, height);
-}
-
-std::vector<Point> graham(std::vector<Point> points) {
-  std::vector<Point> hull;
-
-  if (points.empty()) {
-    return hull;
-  }
-
-  Point min = *std::min_element(points.begin(), points.end(),
-                                [](const Point& a, const Point& b) { return a.x == b.x ? a.y < b.y : a.x < b.x; });
-
-  std::sort(points.begin(), points.end(), [min](const Point& p1, const Point& p2) {
-    if (cross(min, p1, p2) != 0) return cross(min, p1, p2) > 0;
-
-    return (p1.x - min.x) * (p1.x - min.x) + (p1.y - min.y) * (p1.y - min.y) <
-           (p2.x - min.x) * (p2.x - min.x) + (p2.y - min.y) * (p2.y - min.y);
-  });
-
-  hull.push_back(min);
-
-  for (size_t i = 1; i < points.size(); ++i) {
-    while (hull.size() > 1 && cross(hull[hull.size() - 2], hull[hull.size() - 1], points[i]) <= 0) {
-      hull.pop_back();
-    }
-    hull.push_back(points[i]);
-  }
-
-  return hull;
+// Hull candidates of every 4-connected component: the image is run-length
+// encoded and labeled by runs, and each component only keeps the two end
+// pixels of each of its rows.
+std::vector<ppc::core::geometry::PointSet<int>> labeling(const std::vector<int>& image, int width, int height) {
+  const auto runs = ppc::core::image::encode_runs(image.data(), height, width, [](int pixel) { return pixel == 1; });
+  std::vector<int> labels;
+  const int count = ppc::core::image::label_runs(runs, ppc::core::image::Connectivity::kFour, labels);
+  return ppc::core::image::row_extremes(runs, labels, count);
 }
 
 bool ConvexHullSEQ::validation() {
@@ -172,9 +84,9 @@ bool ConvexHullSEQ::pre_processing() {
 bool ConvexHullSEQ::run() {
   internal_order_test();
 
-  std::vector<Point> points;
+  std::vector<ppc::core::geometry::Point<int>> points;
   for (const auto& component : components) {
-    auto hull = graham(component);
+    auto hull = ppc::core::geometry::convex_hull(component);
     points.insert(points.end(), hull.begin(), hull.end());
   }
 
@@ -2,9 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <vector>
 
+#include "core/sort/include/radix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace durynichev_d_radix_batcher_seq {
@@ -18,57 +21,9 @@ void radixSortDouble(RandomIt begin, RandomIt end, Compare comp = Compare{}) {
     return;
   }
 
-  constexpr size_t elemSize = sizeof(ValueType);
-  constexpr size_t bitCount = elemSize * 8;
-  constexpr size_t bucketCount = 256;
-
-  auto toUint64Key = [](ValueType val) {
-    static_assert(sizeof(ValueType) == sizeof(uint64_t), "Expected 64-bit floating-point type.");
-    uint64_t u;
-    memcpy(&u, &val, sizeof(uint64_t));
-
-    if (u & (1ULL << (bitCount - 1))) {
-      u = ~u;
-    } else {
-      u |= (1ULL << (bitCount - 1));
-    }
-    return u;
-  };
-
-  auto getByte = [](uint64_t key, size_t byteIndex) -> uint8_t {
-    return static_cast<uint8_t>((key >> (byteIndex * 8)) & 0xFF);
-  };
-
-  auto length = static_cast<size_t>(std::distance(begin, end));
-  std::vector<ValueType> temp(length);
-  std::vector<size_t> count(bucketCount, 0);
-
-  for (size_t bytePos = 0; bytePos < elemSize; ++bytePos) {
-    std::fill(count.begin(), count.end(), 0);
-
-    for (auto it = begin; it != end; ++it) {
-      uint64_t key = toUint64Key(*it);
-      ++count[getByte(key, bytePos)];
-    }
-
-    if (comp(ValueType(1), ValueType(0))) {
-      for (size_t i = bucketCount - 1; i > 0; --i) {
-        count[i - 1] += count[i];
-      }
-    } else {
-      for (size_t i = 1; i < bucketCount; ++i) {
-        count[i] += count[i - 1];
-      }
-    }
-
-    for (auto it = end; it != begin;) {
-      --it;
-      uint64_t key = toUint64Key(*it);
-      size_t pos = --count[getByte(key, bytePos)];
-      temp[pos] = *it;
-    }
-
-    std::copy(temp.begin(), temp.end(), begin);
+  ppc::core::sort::radix_sort(std::to_address(begin), std::to_address(begin) + std::distance(begin, end));
+  if (comp(ValueType(1), ValueType(0))) {
+    std::reverse(begin, end);
   }
 }
 
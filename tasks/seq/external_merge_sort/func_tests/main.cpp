@@ -0,0 +1,112 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "seq/external_merge_sort/include/ops_seq.hpp"
+
+namespace {
+
+std::string temp_path(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / ("external_merge_sort_seq_" + name)).string();
+}
+
+void write_ints(const std::string& path, const std::vector<int>& data) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+}
+
+std::vector<int> read_ints(const std::string& path) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  std::vector<int> data(static_cast<size_t>(in.tellg()) / sizeof(int));
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+  return data;
+}
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(std::string& input, size_t& memory_budget, std::string& output) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+  taskData->inputs_count.emplace_back(input.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&memory_budget));
+  taskData->inputs_count.emplace_back(1);
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+  taskData->outputs_count.emplace_back(output.size());
+  return taskData;
+}
+
+void check_sorts(std::vector<int> data, size_t memory_budget) {
+  std::string input = temp_path("in");
+  std::string output = temp_path("out");
+  write_ints(input, data);
+
+  external_merge_sort_seq::ExternalSortSequential task(make_task_data(input, memory_budget, output));
+  ASSERT_TRUE(task.validation());
+  ASSERT_TRUE(task.pre_processing());
+  ASSERT_TRUE(task.run());
+  ASSERT_TRUE(task.post_processing());
+
+  std::sort(data.begin(), data.end());
+  EXPECT_EQ(read_ints(output), data);
+  std::filesystem::remove(input);
+  std::filesystem::remove(output);
+}
+
+std::vector<int> random_ints(size_t n, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  std::vector<int> v(n);
+  for (auto& x : v) x = dist(gen);
+  return v;
+}
+
+}  // namespace
+
+TEST(external_merge_sort_seq, sorts_random_file_in_many_runs) { check_sorts(random_ints(50000, 1000000, 1), 1024); }
+
+TEST(external_merge_sort_seq, sorts_when_budget_holds_whole_file) {
+  check_sorts(random_ints(1000, 1000000, 2), 1 << 20);
+}
+
+TEST(external_merge_sort_seq, sorts_duplicates_and_reversed_input) {
+  check_sorts(random_ints(20000, 5, 3), 512);
+  std::vector<int> reversed(10000);
+  for (size_t i = 0; i < reversed.size(); i++) reversed[i] = static_cast<int>(reversed.size() - i);
+  check_sorts(reversed, 4096);
+}
+
+TEST(external_merge_sort_seq, sorts_empty_and_single_element_files) {
+  check_sorts({}, 1024);
+  check_sorts({42}, 1024);
+}
+
+TEST(external_merge_sort_seq, fails_on_missing_input) {
+  std::string input = temp_path("missing");
+  std::string output = temp_path("missing_out");
+  size_t memory_budget = 1024;
+  external_merge_sort_seq::ExternalSortSequential task(make_task_data(input, memory_budget, output));
+  ASSERT_TRUE(task.validation());
+  ASSERT_TRUE(task.pre_processing());
+  EXPECT_FALSE(task.run());
+}
+
+TEST(external_merge_sort_seq, validation_rejects_bad_task_data) {
+  std::string input = temp_path("in");
+  std::string output = temp_path("out");
+  size_t memory_budget = 1;
+  external_merge_sort_seq::ExternalSortSequential small_budget(make_task_data(input, memory_budget, output));
+  EXPECT_FALSE(small_budget.validation());
+
+  memory_budget = 1024;
+  auto taskData = make_task_data(input, memory_budget, output);
+  taskData->outputs_count[0] = 0;
+  external_merge_sort_seq::ExternalSortSequential no_output(taskData);
+  EXPECT_FALSE(no_output.validation());
+}
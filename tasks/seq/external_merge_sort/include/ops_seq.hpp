@@ -0,0 +1,29 @@
+// Copyright 2024 Nesterov Alexander
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "core/task/include/task.hpp"
+
+namespace external_merge_sort_seq {
+
+// Sorts a file of ints that need not fit in memory. inputs[0] holds the
+// input path (inputs_count[0] chars), inputs[1] a size_t memory budget in
+// bytes; outputs[0] holds the path the sorted ints are written to.
+class ExternalSortSequential : public ppc::core::Task {
+ public:
+  explicit ExternalSortSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  std::string input_path_, output_path_;
+  size_t memory_budget_{};
+};
+
+}  // namespace external_merge_sort_seq
@@ -0,0 +1,30 @@
+// Copyright 2024 Nesterov Alexander
+#include "seq/external_merge_sort/include/ops_seq.hpp"
+
+#include "core/sort/include/external.hpp"
+
+bool external_merge_sort_seq::ExternalSortSequential::pre_processing() {
+  internal_order_test();
+  input_path_.assign(reinterpret_cast<const char*>(taskData->inputs[0]), taskData->inputs_count[0]);
+  memory_budget_ = *reinterpret_cast<const size_t*>(taskData->inputs[1]);
+  output_path_.assign(reinterpret_cast<const char*>(taskData->outputs[0]), taskData->outputs_count[0]);
+  return true;
+}
+
+bool external_merge_sort_seq::ExternalSortSequential::validation() {
+  internal_order_test();
+  return taskData->inputs.size() == 2 && taskData->inputs_count.size() == 2 && taskData->inputs_count[0] > 0 &&
+         taskData->inputs_count[1] == 1 && taskData->outputs.size() == 1 && taskData->outputs_count.size() == 1 &&
+         taskData->outputs_count[0] > 0 && *reinterpret_cast<const size_t*>(taskData->inputs[1]) >= sizeof(int);
+}
+
+bool external_merge_sort_seq::ExternalSortSequential::run() {
+  internal_order_test();
+  return ppc::core::sort::external_sort<int>(input_path_, output_path_, memory_budget_);
+}
+
+bool external_merge_sort_seq::ExternalSortSequential::post_processing() {
+  internal_order_test();
+  // the sorted ints are already in the output file
+  return true;
+}
@@ -1,7 +1,6 @@
 // Filateva Elizaveta Radix Sort
 
 #include <iostream>
-#include <list>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -3,21 +3,15 @@
 
 #include <thread>
 
+#include "core/linalg/include/gemm.hpp"
+
 using namespace std::chrono_literals;
 
 std::vector<int> frolova_e_matrix_multiplication_seq::Multiplication(size_t M, size_t N, size_t K,
                                                                      const std::vector<int>& A,
                                                                      const std::vector<int>& B) {
   std::vector<int> C(M * N);
-
-  for (size_t i = 0; i < M; ++i) {
-    for (size_t j = 0; j < N; ++j) {
-      C[i * N + j] = 0;
-      for (size_t k = 0; k < K; ++k) {
-        C[i * N + j] += A[i * K + k] * B[k * N + j];
-      }
-    }
-  }
+  ppc::core::linalg::gemm(static_cast<int>(M), static_cast<int>(N), static_cast<int>(K), A.data(), B.data(), C.data());
   return C;
 }
 
@@ -0,0 +1,116 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/coloring.hpp"
+#include "seq/graph_coloring/include/ops_seq.hpp"
+
+namespace {
+
+using Graph = graph_coloring_seq::ColoringSequential::SparseGraphCRS;
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(Graph& graph, std::vector<int>& colors) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&graph));
+  taskData->inputs_count.emplace_back(sizeof(Graph));
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(colors.data()));
+  taskData->outputs_count.emplace_back(colors.size());
+  return taskData;
+}
+
+std::vector<int> run_task(Graph& graph) {
+  std::vector<int> colors(graph.num_vertices, -2);
+  graph_coloring_seq::ColoringSequential task(make_task_data(graph, colors));
+  EXPECT_TRUE(task.validation());
+  EXPECT_TRUE(task.pre_processing());
+  EXPECT_TRUE(task.run());
+  EXPECT_TRUE(task.post_processing());
+  return colors;
+}
+
+ppc::core::graph::GraphView<double> view_of(const Graph& graph) {
+  return {graph.num_vertices, graph.num_vertices, graph.row_ptr.data(), graph.col_indices.data(),
+          graph.values.data()};
+}
+
+int max_degree(const Graph& graph) {
+  int degree = 0;
+  for (int v = 0; v < graph.num_vertices; v++) degree = std::max(degree, graph.row_ptr[v + 1] - graph.row_ptr[v]);
+  return degree;
+}
+
+Graph to_graph(const ppc::core::sparse::CSR<double>& csr) { return {csr.rows, csr.row_ptr, csr.col_idx, csr.values}; }
+
+}  // namespace
+
+TEST(graph_coloring_seq, triangle_with_a_tail) {
+  // the triangle 0 1 2 and the path 2 - 3 - 4, every edge stored both ways
+  Graph graph{5, {0, 2, 4, 7, 9, 10}, {1, 2, 0, 2, 0, 1, 3, 2, 4, 3}, {}};
+  const auto colors = run_task(graph);
+  EXPECT_TRUE(ppc::core::graph::proper_coloring(view_of(graph), colors));
+  EXPECT_EQ(*std::max_element(colors.begin(), colors.end()), 2);
+}
+
+TEST(graph_coloring_seq, clique_takes_a_color_a_vertex) {
+  const int n = 6;
+  Graph graph{n, {0}, {}, {}};
+  for (int v = 0; v < n; v++) {
+    for (int u = 0; u < n; u++) {
+      if (u != v) graph.col_indices.push_back(u);
+    }
+    graph.row_ptr.push_back(static_cast<int>(graph.col_indices.size()));
+  }
+  auto colors = run_task(graph);
+  std::sort(colors.begin(), colors.end());
+  EXPECT_EQ(colors, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST(graph_coloring_seq, isolated_vertices_and_self_loops_take_color_zero) {
+  Graph graph{3, {0, 1, 1, 2}, {0, 2}, {1.0, 1.0}};
+  EXPECT_EQ(run_task(graph), (std::vector<int>{0, 0, 0}));
+}
+
+TEST(graph_coloring_seq, proper_and_deterministic_on_benchmark_graphs) {
+  for (const auto& benchmark : ppc::core::graph::benchmark_graphs<double>(11, 6, 1.0, 1.0, 17)) {
+    auto graph = to_graph(benchmark.csr());
+    const auto colors = run_task(graph);
+    EXPECT_TRUE(ppc::core::graph::proper_coloring(view_of(graph), colors)) << benchmark.name;
+    EXPECT_LE(*std::max_element(colors.begin(), colors.end()), max_degree(graph)) << benchmark.name;
+    EXPECT_EQ(colors, ppc::core::graph::jones_plassmann(view_of(graph), graph_coloring_seq::ColoringSequential::kSeed))
+        << benchmark.name;
+  }
+}
+
+TEST(graph_coloring_seq, validation_rejects_bad_graphs) {
+  std::vector<int> colors(2);
+  Graph stray{2, {0, 1, 1}, {2}, {}};
+  graph_coloring_seq::ColoringSequential stray_head(make_task_data(stray, colors));
+  EXPECT_FALSE(stray_head.validation());
+
+  Graph graph{2, {0, 1, 2}, {1, 0}, {}};
+  std::vector<int> small(1);
+  graph_coloring_seq::ColoringSequential no_room(make_task_data(graph, small));
+  EXPECT_FALSE(no_room.validation());
+
+  Graph empty{0, {0}, {}, {}};
+  std::vector<int> none;
+  graph_coloring_seq::ColoringSequential no_vertices(make_task_data(empty, none));
+  EXPECT_FALSE(no_vertices.validation());
+}
+
+TEST(graph_coloring_seq, validation_rejects_one_way_edges) {
+  // 0 -> 1 without 1 -> 0: both ends could be colored in one round
+  std::vector<int> colors(2);
+  Graph one_way{2, {0, 1, 1}, {1}, {1.0}};
+  graph_coloring_seq::ColoringSequential task(make_task_data(one_way, colors));
+  EXPECT_FALSE(task.validation());
+
+  Graph both_ways{2, {0, 1, 2}, {1, 0}, {1.0, 1.0}};
+  graph_coloring_seq::ColoringSequential symmetric(make_task_data(both_ways, colors));
+  EXPECT_TRUE(symmetric.validation());
+}
@@ -0,0 +1,43 @@
+// Copyright 2024 Nesterov Alexander
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace graph_coloring_seq {
+
+// Vertex coloring of an undirected graph by Jones-Plassmann with Luby's
+// random priorities, the independent sets a Gauss-Seidel sweep can update
+// at once. inputs[0] points to a SparseGraphCRS, the layout of
+// gusev_n_dijkstras_algorithm, with every edge stored both ways; the values
+// are ignored. outputs[0] receives outputs_count[0] = num_vertices ints,
+// the color of every vertex, 0, 1, ... with no edge between two vertices of
+// one color.
+class ColoringSequential : public ppc::core::Task {
+ public:
+  explicit ColoringSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  struct SparseGraphCRS {
+    int num_vertices;
+    std::vector<int> row_ptr;
+    std::vector<int> col_indices;
+    std::vector<double> values;
+  };
+
+  // The priorities are drawn from it, so the colors are the same run to run.
+  static constexpr std::uint64_t kSeed = 1;
+
+ private:
+  const SparseGraphCRS* graph_{};
+  std::vector<int> colors_;
+};
+
+}  // namespace graph_coloring_seq
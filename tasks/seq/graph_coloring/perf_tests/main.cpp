@@ -0,0 +1,91 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/coloring.hpp"
+#include "core/perf/include/perf.hpp"
+#include "seq/graph_coloring/include/ops_seq.hpp"
+
+namespace {
+
+using Graph = graph_coloring_seq::ColoringSequential::SparseGraphCRS;
+
+Graph to_graph(const ppc::core::sparse::CSR<double>& csr) { return {csr.rows, csr.row_ptr, csr.col_idx, csr.values}; }
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(Graph& graph, std::vector<int>& colors) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&graph));
+  taskData->inputs_count.emplace_back(sizeof(Graph));
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(colors.data()));
+  taskData->outputs_count.emplace_back(colors.size());
+  return taskData;
+}
+
+ppc::core::graph::GraphView<double> view_of(const Graph& graph) {
+  return {graph.num_vertices, graph.num_vertices, graph.row_ptr.data(), graph.col_indices.data(),
+          graph.values.data()};
+}
+
+double seconds_since(std::chrono::high_resolution_clock::time_point t0) {
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - t0);
+  return static_cast<double>(duration.count()) * 1e-9;
+}
+
+template <typename Run>
+void run_perf(Run run) {
+  // the R-MAT graph of the benchmarks, 2^17 vertices
+  auto graph = to_graph(ppc::core::graph::benchmark_graphs<double>(17, 8, 1.0, 1.0, 2024)[0].csr());
+  std::vector<int> colors(graph.num_vertices);
+
+  // Create Task
+  auto task = std::make_shared<graph_coloring_seq::ColoringSequential>(make_task_data(graph, colors));
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perfAttr->current_timer = [&] { return seconds_since(t0); };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  run(*perfAnalyzer, perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+  EXPECT_TRUE(ppc::core::graph::proper_coloring(view_of(graph), colors));
+}
+
+}  // namespace
+
+TEST(graph_coloring_seq_perf_test, test_pipeline_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.pipeline_run(attr, results); });
+}
+
+TEST(graph_coloring_seq_perf_test, test_task_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.task_run(attr, results); });
+}
+
+TEST(graph_coloring_seq_perf_test, test_benchmark_graphs) {
+  // every benchmark topology at 2^16 vertices, reported in edges per second
+  for (const auto& benchmark : ppc::core::graph::benchmark_graphs<double>(16, 8, 1.0, 1.0, 2024)) {
+    auto graph = to_graph(benchmark.csr());
+    std::vector<int> colors(graph.num_vertices);
+    graph_coloring_seq::ColoringSequential task(make_task_data(graph, colors));
+    ASSERT_TRUE(task.validation());
+    ASSERT_TRUE(task.pre_processing());
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(task.run());
+    const double seconds = seconds_since(t0);
+    ASSERT_TRUE(task.post_processing());
+    EXPECT_TRUE(ppc::core::graph::proper_coloring(view_of(graph), colors)) << benchmark.name;
+    ppc::core::graph::print_teps(std::cout, "graph_coloring_seq", benchmark.name,
+                                 static_cast<long long>(benchmark.edges.size()), seconds);
+  }
+}
@@ -0,0 +1,43 @@
+// Copyright 2024 Nesterov Alexander
+#include "seq/graph_coloring/include/ops_seq.hpp"
+
+#include <algorithm>
+
+#include "core/graph/include/coloring.hpp"
+#include "core/graph/include/loader.hpp"
+
+bool graph_coloring_seq::ColoringSequential::pre_processing() {
+  internal_order_test();
+  graph_ = reinterpret_cast<const SparseGraphCRS*>(taskData->inputs[0]);
+  return true;
+}
+
+bool graph_coloring_seq::ColoringSequential::validation() {
+  internal_order_test();
+  if (taskData->inputs.size() != 1 || taskData->inputs[0] == nullptr || taskData->outputs.size() != 1 ||
+      taskData->outputs_count.size() != 1) {
+    return false;
+  }
+  const auto* graph = reinterpret_cast<const SparseGraphCRS*>(taskData->inputs[0]);
+  const int n = graph->num_vertices;
+  return n > 0 && graph->row_ptr.size() == static_cast<size_t>(n) + 1 &&
+         ppc::core::graph::well_formed(n, graph->row_ptr.data(), graph->col_indices.data(),
+                                       graph->col_indices.size()) &&
+         ppc::core::graph::symmetric(n, graph->row_ptr.data(), graph->col_indices.data()) &&
+         taskData->outputs_count[0] == static_cast<size_t>(n);
+}
+
+bool graph_coloring_seq::ColoringSequential::run() {
+  internal_order_test();
+  const int n = graph_->num_vertices;
+  const ppc::core::graph::GraphView<double> view{n, n, graph_->row_ptr.data(), graph_->col_indices.data(),
+                                                 graph_->values.data()};
+  colors_ = ppc::core::graph::jones_plassmann(view, kSeed);
+  return true;
+}
+
+bool graph_coloring_seq::ColoringSequential::post_processing() {
+  internal_order_test();
+  std::copy(colors_.begin(), colors_.end(), reinterpret_cast<int*>(taskData->outputs[0]));
+  return true;
+}
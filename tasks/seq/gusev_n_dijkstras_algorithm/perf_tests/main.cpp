@@ -2,9 +2,16 @@
 #define _USE_MATH_DEFINES
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
 #include <random>
 #include <vector>
 
+#include "core/graph/include/benchmark.hpp"
+#include "core/graph/include/bfs.hpp"
+#include "core/graph/include/sssp.hpp"
 #include "core/perf/include/perf.hpp"
 #include "seq/gusev_n_dijkstras_algorithm/include/ops_seq.hpp"
 
@@ -102,3 +109,42 @@ TEST(gusev_n_dijkstras_algorithm_seq, test_task_run) {
   perfAnalyzer->task_run(perfAttr, perfResults);
   ppc::core::Perf::print_perf_statistic(perfResults);
 }
+
+TEST(gusev_n_dijkstras_algorithm_seq, test_benchmark_graphs) {
+  using Clock = std::chrono::high_resolution_clock;
+  // 2^13 vertices of each benchmark topology, checked against the queue
+  // Dijkstra and reported in TEPS next to a direction-optimizing BFS
+  for (const auto& graph : ppc::core::graph::benchmark_graphs<double>(13, 8, 0.1, 10.0, 2024)) {
+    const auto csr = graph.csr();
+    gusev_n_dijkstras_algorithm_seq::DijkstrasAlgorithmSequential::SparseGraphCRS task_graph{
+        graph.vertices, csr.row_ptr, csr.col_idx, csr.values};
+
+    std::vector<double> distances(graph.vertices);
+
+    std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(&task_graph));
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(distances.data()));
+
+    gusev_n_dijkstras_algorithm_seq::DijkstrasAlgorithmSequential testTask(taskData);
+    ASSERT_TRUE(testTask.validation());
+    ASSERT_TRUE(testTask.pre_processing());
+    const auto t0 = Clock::now();
+    ASSERT_TRUE(testTask.run());
+    const std::chrono::duration<double> seconds = Clock::now() - t0;
+    ASSERT_TRUE(testTask.post_processing());
+
+    const auto expected = ppc::core::graph::dijkstra(csr.view(), 0);
+    EXPECT_TRUE(std::equal(distances.begin(), distances.end(), expected.begin(), [](double a, double b) {
+      return a == b || std::abs(a - b) <= 1e-9 * std::abs(b);
+    })) << graph.name;
+    const long long edges =
+        ppc::core::graph::traversed_edges(csr.view(), expected, ppc::core::graph::unreachable<double>());
+    ppc::core::graph::print_teps(std::cout, "gusev_n_dijkstras_algorithm_seq", graph.name, edges, seconds.count());
+
+    const auto t1 = Clock::now();
+    const auto levels = ppc::core::graph::bfs(csr.view(), 0);
+    const std::chrono::duration<double> bfs_seconds = Clock::now() - t1;
+    ppc::core::graph::print_teps(std::cout, "bfs", graph.name, edges, bfs_seconds.count());
+    EXPECT_EQ(levels, ppc::core::graph::bfs_levels(csr.view(), 0)) << graph.name;
+  }
+}
@@ -1,5 +1,10 @@
 #include "seq/gusev_n_dijkstras_algorithm/include/ops_seq.hpp"
 
+#include <algorithm>
+#include <vector>
+
+#include "core/graph/include/sssp.hpp"
+
 bool gusev_n_dijkstras_algorithm_seq::DijkstrasAlgorithmSequential::pre_processing() {
   internal_order_test();
   return true;
@@ -22,42 +27,12 @@ bool gusev_n_dijkstras_algorithm_seq::DijkstrasAlgorithmSequential::run() {
   auto* graph = reinterpret_cast<SparseGraphCRS*>(taskData->inputs[0]);
   auto* output = reinterpret_cast<double*>(taskData->outputs[0]);
 
-  int num_vertices = graph->num_vertices;
-  int source_vertex = 0;
-
-  std::vector<double> distances(num_vertices, std::numeric_limits<double>::infinity());
-  std::vector<bool> visited(num_vertices, false);
-
-  distances[source_vertex] = 0.0;
-
-  for (int count = 0; count < num_vertices - 1; ++count) {
-    double min_distance = std::numeric_limits<double>::infinity();
-    int current_vertex = -1;
-
-    for (int v = 0; v < num_vertices; ++v) {
-      if (!visited[v] && distances[v] < min_distance) {
-        min_distance = distances[v];
-        current_vertex = v;
-      }
-    }
-
-    if (current_vertex == -1) break;
-
-    visited[current_vertex] = true;
-
-    for (int j = graph->row_ptr[current_vertex]; j < graph->row_ptr[current_vertex + 1]; ++j) {
-      int neighbor = graph->col_indices[j];
-      double weight = graph->values[j];
-
-      if (!visited[neighbor]) {
-        double new_distance = distances[current_vertex] + weight;
+  const int num_vertices = graph->num_vertices;
+  const int source_vertex = 0;
 
-        if (new_distance < distances[neighbor]) {
-          distances[neighbor] = new_distance;
-        }
-      }
-    }
-  }
+  const ppc::core::graph::GraphView<double> view{num_vertices, num_vertices, graph->row_ptr.data(),
+                                                 graph->col_indices.data(), graph->values.data()};
+  const std::vector<double> distances = ppc::core::graph::dijkstra(view, source_vertex);
 
   std::copy(distances.begin(), distances.end(), output);
   return true;
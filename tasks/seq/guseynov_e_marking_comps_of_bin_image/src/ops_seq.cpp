@@ -1,78 +1,8 @@
 #include "seq/guseynov_e_marking_comps_of_bin_image/include/ops_seq.hpp"
 
 #include <algorithm>
-#include <map>
-#include <queue>
-#include <set>
 
-// Finding the parent label(min label in object)
-int findParent(std::map<int, std::set<int>>& parent, int labl) {
-  auto srch = parent.find(labl);
-  if (srch != parent.end()) {
-    return *srch->second.begin();
-  }
-
-  return labl;
-}
-
-// Fixing all connections in table after first pass
-void fixTable(std::map<int, std::set<int>>& parent) {
-  for (auto& pair : parent) {
-    for (auto value : pair.second) {
-      parent[value].insert(pair.second.begin(), pair.second.end());
-    }
-  }
-}
-
-// Making all labels on labeled image in right order
-void fixLabels(std::vector<int>& labeled_image, int rows, int cols) {
-  std::map<int, int> labels_equivalence;
-  int min_label = 2;
-  for (int x = 0; x < rows; x++) {
-    for (int y = 0; y < cols; y++) {
-      int position = x * cols + y;
-      if (labeled_image[position] > 1) {
-        int final_label;
-        auto srch_label = labels_equivalence.find(labeled_image[position]);
-        if (srch_label == labels_equivalence.end()) {
-          final_label = min_label;
-          labels_equivalence[labeled_image[position]] = min_label++;
-        } else {
-          final_label = srch_label->second;
-        }
-
-        labeled_image[position] = final_label;
-      }
-    }
-  }
-}
-
-// Connect all related labels
-void unite(std::map<int, std::set<int>>& parent, int new_label, int neighbour_label) {
-  if (new_label == neighbour_label) {
-    return;
-  }
-
-  auto srch1 = parent.find(new_label);
-  auto srch2 = parent.find(neighbour_label);
-
-  if (srch1 == parent.end() && srch2 == parent.end()) {
-    parent[new_label].insert(neighbour_label);
-    parent[new_label].insert(new_label);
-    parent[neighbour_label].insert(new_label);
-    parent[neighbour_label].insert(neighbour_label);
-  } else if (srch1 != parent.end() && srch2 == parent.end()) {
-    parent[new_label].insert(neighbour_label);
-    parent[neighbour_label] = parent[new_label];
-  } else if (srch1 == parent.end() && srch2 != parent.end()) {
-    parent[neighbour_label].insert(new_label);
-    parent[new_label] = parent[neighbour_label];
-  } else {
-    std::set<int> tmp_set = parent[new_label];
-    parent[new_label].insert(parent[neighbour_label].begin(), parent[neighbour_label].end());
-    parent[neighbour_label].insert(parent[new_label].begin(), parent[new_label].end());
-  }
-}
+#include "core/image/include/labeling.hpp"
 
 bool guseynov_e_marking_comps_of_bin_image_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
@@ -110,53 +40,12 @@ bool guseynov_e_marking_comps_of_bin_image_seq::TestTaskSequential::validation()
 bool guseynov_e_marking_comps_of_bin_image_seq::TestTaskSequential::run() {
   internal_order_test();
 
-  int current_label = 2;
-  std::map<int, std::set<int>> parent;
-  // Displacements for neighbours
-  int dx[] = {-1, 0, -1};
-  int dy[] = {0, -1, 1};
-
-  for (int x = 0; x < rows; x++) {
-    for (int y = 0; y < columns; y++) {
-      int position = x * columns + y;
-      if (image_[position] == 0) {
-        std::vector<int> neighbours;
-
-        for (int i = 0; i < 3; i++) {
-          int nx = x + dx[i];
-          int ny = y + dy[i];
-          int tmp_pos = nx * columns + ny;
-          if (nx >= 0 && nx < rows && ny >= 0 && ny < columns && (labeled_image[tmp_pos] > 1)) {
-            neighbours.push_back(labeled_image[tmp_pos]);
-          }
-        }
-
-        if (neighbours.empty()) {
-          labeled_image[position] = current_label;
-          current_label++;
-        } else {
-          int min_label = *min_element(neighbours.begin(), neighbours.end());
-          labeled_image[position] = min_label;
-
-          for (int label : neighbours) {
-            unite(parent, min_label, label);
-          }
-        }
-      }
-    }
-  }
-  fixTable(parent);
-  for (int x = 0; x < rows; x++) {
-    for (int y = 0; y < columns; y++) {
-      int position = x * columns + y;
-      if (labeled_image[position] > 1) {
-        int find_label = findParent(parent, labeled_image[position]);
-
-        labeled_image[position] = find_label;
-      }
-    }
-  }
-  fixLabels(labeled_image, rows, columns);
+  // objects are the 0 pixels, touching by sides and the up-right/down-left
+  // corners; background is labeled 1 and objects 2, 3, ... in raster order
+  ppc::core::image::label_components(
+      image_.data(), rows, columns, [](int pixel) { return pixel == 0; }, ppc::core::image::Connectivity::kSix,
+      labeled_image.data());
+  for (auto& label : labeled_image) label++;
   return true;
 }
 
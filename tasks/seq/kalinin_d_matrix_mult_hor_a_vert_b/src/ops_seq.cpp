@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <thread>
 
+#include "core/linalg/include/gemm.hpp"
+
 using namespace std::chrono_literals;
 
 bool kalinin_d_matrix_mult_hor_a_vert_b_seq::MultHorAVertBTaskSequential::pre_processing() {
@@ -35,13 +37,7 @@ bool kalinin_d_matrix_mult_hor_a_vert_b_seq::MultHorAVertBTaskSequential::valida
 bool kalinin_d_matrix_mult_hor_a_vert_b_seq::MultHorAVertBTaskSequential::run() {
   internal_order_test();
 
-  for (int i = 0; i < rows_A; ++i) {
-    for (int j = 0; j < columns_B; ++j) {
-      for (int k = 0; k < columns_A; ++k) {
-        C[i * columns_B + j] += input_A[i * columns_A + k] * input_B[k * columns_B + j];
-      }
-    }
-  }
+  ppc::core::linalg::gemm(rows_A, columns_B, columns_A, input_A, input_B, C.data(), true);
 
   return true;
 }
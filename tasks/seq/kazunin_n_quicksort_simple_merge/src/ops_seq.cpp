@@ -1,35 +1,9 @@
 #include "seq/kazunin_n_quicksort_simple_merge/include/ops_seq.hpp"
 
-#include <stack>
+#include "core/sort/include/quicksort.hpp"
 
 namespace kazunin_n_quicksort_simple_merge_seq {
 
-void iterative_quicksort(std::vector<int>& data) {
-  std::stack<std::pair<int, int>> stack;
-  stack.emplace(0, data.size() - 1);
-
-  while (!stack.empty()) {
-    auto [low, high] = stack.top();
-    stack.pop();
-
-    if (low < high) {
-      int pivot = data[high];
-      int i = low - 1;
-
-      for (int j = low; j < high; ++j) {
-        if (data[j] < pivot) {
-          std::swap(data[++i], data[j]);
-        }
-      }
-      std::swap(data[i + 1], data[high]);
-      int p = i + 1;
-
-      stack.emplace(low, p - 1);
-      stack.emplace(p + 1, high);
-    }
-  }
-}
-
 bool QuicksortSimpleMergeSeq::validation() {
   internal_order_test();
 
@@ -50,7 +24,7 @@ bool QuicksortSimpleMergeSeq::pre_processing() {
 bool QuicksortSimpleMergeSeq::run() {
   internal_order_test();
 
-  iterative_quicksort(input_vector);
+  ppc::core::sort::quicksort(input_vector);
 
   return true;
 }
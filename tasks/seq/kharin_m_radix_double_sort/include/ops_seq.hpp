@@ -24,9 +24,6 @@ class RadixSortSequential : public ppc::core::Task {
  private:
   std::vector<double> data;
   int n = 0;
-
-  static void radix_sort_doubles(std::vector<double>& data);
-  static void radix_sort_uint64(std::vector<uint64_t>& keys);
 };
 
 }  // namespace kharin_m_radix_double_sort
\ No newline at end of file
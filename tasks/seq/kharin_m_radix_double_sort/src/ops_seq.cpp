@@ -1,7 +1,6 @@
 #include "seq/kharin_m_radix_double_sort/include/ops_seq.hpp"
 
-#include <cmath>
-#include <queue>
+#include "core/sort/include/radix.hpp"
 
 using namespace kharin_m_radix_double_sort;
 
@@ -34,7 +33,7 @@ bool RadixSortSequential::run() {
   internal_order_test();
 
   // Поразрядная сортировка
-  radix_sort_doubles(data);
+  ppc::core::sort::radix_sort(data);
   return true;
 }
 
@@ -46,53 +45,3 @@ bool RadixSortSequential::post_processing() {
   std::copy(data.begin(), data.end(), out);
   return true;
 }
-
-void RadixSortSequential::radix_sort_doubles(std::vector<double>& data_) {
-  size_t n_ = data_.size();
-  std::vector<uint64_t> keys(n_);
-  for (size_t i = 0; i < n_; ++i) {
-    uint64_t u;
-    std::memcpy(&u, &data_[i], sizeof(double));
-    // Перевод для сохранения порядка
-    if ((u & 0x8000000000000000ULL) != 0) {
-      u = ~u;
-    } else {
-      u |= 0x8000000000000000ULL;
-    }
-    keys[i] = u;
-  }
-
-  radix_sort_uint64(keys);
-
-  for (size_t i = 0; i < n_; ++i) {
-    uint64_t u = keys[i];
-    if ((u & 0x8000000000000000ULL) != 0) {
-      u &= ~0x8000000000000000ULL;
-    } else {
-      u = ~u;
-    }
-    std::memcpy(&data_[i], &u, sizeof(double));
-  }
-}
-
-void RadixSortSequential::radix_sort_uint64(std::vector<uint64_t>& keys) {
-  const int BITS = 64;
-  const int RADIX = 256;
-  std::vector<uint64_t> temp(keys.size());
-
-  for (int shift = 0; shift < BITS; shift += 8) {
-    size_t count[RADIX + 1] = {0};
-    for (size_t i = 0; i < keys.size(); ++i) {
-      uint8_t byte = (keys[i] >> shift) & 0xFF;
-      ++count[byte + 1];
-    }
-    for (int i = 0; i < RADIX; ++i) {
-      count[i + 1] += count[i];
-    }
-    for (size_t i = 0; i < keys.size(); ++i) {
-      uint8_t byte = (keys[i] >> shift) & 0xFF;
-      temp[count[byte]++] = keys[i];
-    }
-    keys.swap(temp);
-  }
-}
\ No newline at end of file
@@ -4,27 +4,7 @@
 #include <algorithm>
 #include <thread>
 
-int partition(std::vector<int>& arr, int low, int high) {
-  int pivot = arr[high];
-  int i = (low - 1);
-
-  for (int j = low; j < high; j++) {
-    if (arr[j] <= pivot) {
-      i++;
-      std::swap(arr[i], arr[j]);
-    }
-  }
-  std::swap(arr[i + 1], arr[high]);
-  return (i + 1);
-}
-
-void quickSort(std::vector<int>& arr, int low, int high) {
-  if (low < high) {
-    int pi = partition(arr, low, high);
-    quickSort(arr, low, pi - 1);
-    quickSort(arr, pi + 1, high);
-  }
-}
+#include "core/sort/include/quicksort.hpp"
 
 bool kolodkin_g_hoar_merge_sort_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
@@ -45,7 +25,7 @@ bool kolodkin_g_hoar_merge_sort_seq::TestTaskSequential::validation() {
 
 bool kolodkin_g_hoar_merge_sort_seq::TestTaskSequential::run() {
   internal_order_test();
-  quickSort(output_, 0, output_.size() - 1);
+  ppc::core::sort::quicksort(output_);
   return true;
 }
 
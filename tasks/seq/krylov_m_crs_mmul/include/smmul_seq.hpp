@@ -30,7 +30,7 @@ class TaskCommon : public ppc::core::Task {
     internal_order_test();
 
     input = {*reinterpret_cast<CRSMatrix<T>*>(taskData->inputs[0]),
-             reinterpret_cast<CRSMatrix<T>*>(taskData->inputs[1])->transpose()};
+             *reinterpret_cast<CRSMatrix<T>*>(taskData->inputs[1])};
 
     return true;
   }
@@ -58,32 +58,7 @@ class TaskSequential : public TaskCommon<T> {
     this->internal_order_test();
 
     const auto& [lhs, rhs] = this->input;
-
-    const auto [rows, cols] = std::make_pair(lhs.rows(), rhs.rows());  // rhs was transposed
-    this->res = decltype(this->res)(rows, cols);
-
-    for (size_t row = 0; row < rows; row++) {
-      for (size_t col = 0; col < cols; col++) {
-        auto [il, ir] = std::make_pair(lhs.row_pointers[row], rhs.row_pointers[col]);
-        T sum{};
-        while (il < lhs.row_pointers[row + 1] && ir < rhs.row_pointers[col + 1]) {
-          if (lhs.col_indices[il] < rhs.col_indices[ir]) {
-            il++;
-          } else if (lhs.col_indices[il] > rhs.col_indices[ir]) {
-            ir++;
-          } else {  // ==
-            sum += lhs.data[il] * rhs.data[ir];
-            il++;
-            ir++;
-          }
-        }
-        if (sum != 0) {
-          this->res.data.push_back(sum);
-          this->res.col_indices.push_back(col);
-        }
-      }
-      this->res.row_pointers[row + 1] = this->res.data.size();
-    }
+    this->res = CRSMatrix<T>(ppc::core::sparse::multiply(lhs.view(), rhs.view()));
 
     return true;
   }
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace krylov_m_matmul_strip_ha_vb_seq {
@@ -70,7 +71,7 @@ class TaskSequential : public ppc::core::Task {
     input_.second.read(reinterpret_cast<T*>(taskData->inputs[1]));
 
     res_.rows = input_.first.rows;
-    res_.cols = input_.second.rows;
+    res_.cols = input_.second.cols;
     res_.data.resize(res_.rows * res_.cols);
 
     return true;
@@ -81,14 +82,8 @@ class TaskSequential : public ppc::core::Task {
 
     const auto& [lhs, rhs] = input_;
 
-    for (size_t i = 0; i < lhs.rows; i++) {
-      for (size_t j = 0; j < rhs.cols; j++) {
-        res_.at(i, j) = 0;
-        for (size_t k = 0; k < rhs.rows; k++) {
-          res_.at(i, j) += lhs.at(i, k) * rhs.at(k, j);
-        }
-      }
-    }
+    ppc::core::linalg::gemm(static_cast<int>(lhs.rows), static_cast<int>(rhs.cols), static_cast<int>(rhs.rows),
+                            lhs.data.data(), rhs.data.data(), res_.data.data());
 
     return true;
   }
@@ -3,12 +3,11 @@
 #include <cstring>
 #include <vector>
 
+#include "core/geometry/include/hull.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kurakin_m_graham_scan_seq {
 
-bool isLeftAngle(std::vector<double>& p1, std::vector<double>& p2, std::vector<double>& p3);
-
 class TestTaskSequential : public ppc::core::Task {
  public:
   explicit TestTaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
@@ -18,8 +17,8 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  int count_point{};
-  std::vector<std::vector<double>> input_;
+  ppc::core::geometry::PointSet<double> input_;
+  std::vector<ppc::core::geometry::Point<double>> hull_;
 };
 
 }  // namespace kurakin_m_graham_scan_seq
\ No newline at end of file
@@ -2,17 +2,14 @@
 #pragma once
 
 #include <limits>
-#include <stack>
 #include <string>
 #include <vector>
 
+#include "core/sort/include/quicksort.hpp"
 #include "core/task/include/task.hpp"
 
 namespace matyunina_a_batcher_qsort_seq {
 
-template <typename T>
-void quickSort(std::vector<T>& data);
-
 template <typename T>
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -52,7 +49,7 @@ bool matyunina_a_batcher_qsort_seq::TestTaskSequential<T>::run() {
     return true;
   }
 
-  quickSort(data_);
+  ppc::core::sort::quicksort(data_);
 
   return true;
 }
@@ -65,46 +62,3 @@ bool matyunina_a_batcher_qsort_seq::TestTaskSequential<T>::post_processing() {
 
   return true;
 }
-
-template <typename T>
-void matyunina_a_batcher_qsort_seq::quickSort(std::vector<T>& data) {
-  if (data.empty()) return;
-
-  std::stack<std::pair<uint32_t, uint32_t>> stack;
-  stack.emplace(0, data.size() - 1);
-
-  uint32_t low;
-  uint32_t high;
-  T pivot;
-  uint32_t i;
-  std::pair<uint32_t, uint32_t> range;
-  while (!stack.empty()) {
-    range = stack.top();
-    stack.pop();
-
-    low = range.first;
-    high = range.second;
-
-    if (low < high) {
-      pivot = data[high];
-      i = low;
-
-      for (uint32_t j = low; j < high; j++) {
-        if (data[j] <= pivot) {
-          if (i != j) {
-            std::swap(data[i], data[j]);
-          }
-          i++;
-        }
-      }
-      std::swap(data[i], data[high]);
-
-      if (i > 0 && low < i - 1) {
-        stack.emplace(low, i - 1);
-      }
-      if (i + 1 < high) {
-        stack.emplace(i + 1, high);
-      }
-    }
-  }
-}
@@ -5,6 +5,8 @@
 #include <thread>
 #include <utility>
 
+#include "core/sort/include/quicksort.hpp"
+
 using namespace std::chrono_literals;
 
 bool mironov_a_quick_sort_seq::QuickSortSequential::pre_processing() {
@@ -23,29 +25,11 @@ bool mironov_a_quick_sort_seq::QuickSortSequential::validation() {
   return (taskData->inputs_count[0] > 0) && (taskData->outputs_count[0] == taskData->inputs_count[0]);
 }
 
-static void quickSort(std::vector<int>& arr, int start, int end) {
-  if (start >= end) return;
-
-  int pivot = arr[(start + end) / 2];
-  int left = start;
-  int right = end;
-
-  while (left <= right) {
-    while (arr[left] < pivot) left++;
-    while (arr[right] > pivot) right--;
-
-    if (left <= right) std::swap(arr[left++], arr[right--]);
-  }
-
-  quickSort(arr, start, right);
-  quickSort(arr, left, end);
-}
-
 bool mironov_a_quick_sort_seq::QuickSortSequential::run() {
   internal_order_test();
 
   result_ = input_;
-  quickSort(result_, 0, result_.size() - 1);
+  ppc::core::sort::quicksort(result_);
   return true;
 }
 
@@ -4,21 +4,11 @@
 #include <random>
 #include <thread>
 
+#include "core/sort/include/shell.hpp"
+
 std::vector<int> muhina_m_shell_sort_seq::shellSort(const std::vector<int>& vect) {
   std::vector<int> sortedVec = vect;
-  int n = sortedVec.size();
-  int gap;
-  for (gap = 1; gap < n / 3; gap = gap * 3 + 1);
-  for (; gap > 0; gap = (gap - 1) / 3) {
-    for (int i = gap; i < n; i++) {
-      int temp = sortedVec[i];
-      int j;
-      for (j = i; j >= gap && sortedVec[j - gap] > temp; j -= gap) {
-        sortedVec[j] = sortedVec[j - gap];
-      }
-      sortedVec[j] = temp;
-    }
-  }
+  ppc::core::sort::shell_sort(sortedVec);
   return sortedVec;
 }
 
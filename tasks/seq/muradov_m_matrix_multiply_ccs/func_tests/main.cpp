@@ -235,3 +235,9 @@ TEST(muradov_m_matrix_multiply_ccs_seq, Large100x50And50x100) {
   auto B_ = muradov_m_matrix_multiply_ccs_seq::gen_rand_matrix(50, 100, 5);
   muradov_m_matrix_multiply_ccs_seq::func_test_template(A_, B_);
 }
+
+TEST(muradov_m_matrix_multiply_ccs_seq, CancellingProductsAreDropped) {
+  std::vector<std::vector<double>> A_ = {{1, 1, 0}, {2, 0, 0}, {0, 0, 0}};
+  std::vector<std::vector<double>> B_ = {{1, 0}, {-1, 3}, {0, 0}};
+  muradov_m_matrix_multiply_ccs_seq::func_test_template(A_, B_);
+}
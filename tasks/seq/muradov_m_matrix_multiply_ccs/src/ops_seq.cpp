@@ -1,5 +1,9 @@
 #include "seq/muradov_m_matrix_multiply_ccs/include/ops_seq.hpp"
 
+#include <utility>
+
+#include "core/sparse/include/sparse.hpp"
+
 bool muradov_m_matrix_multiply_ccs_seq::MatrixMultiplyCCS::validation() {
   internal_order_test();
 
@@ -43,18 +47,19 @@ bool muradov_m_matrix_multiply_ccs_seq::MatrixMultiplyCCS::pre_processing() {
   int B_col_ptr_size = taskData->inputs_count[9];
   B_col_ptr.assign(B_col_ptr_ptr, B_col_ptr_ptr + B_col_ptr_size);
 
-  transpose_CCS(A_val, A_row_ind, A_col_ptr, rows_A, cols_A, At_val, At_row_ind, At_col_ptr);
-
-  rows_At = cols_A;
-  cols_At = rows_A;
-
   return true;
 }
 
 bool muradov_m_matrix_multiply_ccs_seq::MatrixMultiplyCCS::run() {
   internal_order_test();
 
-  multiply_CCS(At_val, At_row_ind, At_col_ptr, rows_At, B_val, B_row_ind, B_col_ptr, cols_B, res_val, res_ind, res_ptr);
+  ppc::core::sparse::CSCView<double> a{rows_A, cols_A, A_col_ptr.data(), A_row_ind.data(), A_val.data()};
+  ppc::core::sparse::CSCView<double> b{rows_B, cols_B, B_col_ptr.data(), B_row_ind.data(), B_val.data()};
+  auto c = ppc::core::sparse::multiply(a, b);
+
+  res_val = std::move(c.values);
+  res_ind = std::move(c.row_idx);
+  res_ptr = std::move(c.col_ptr);
 
   return true;
 }
@@ -0,0 +1,79 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "seq/order_statistics/include/ops_seq.hpp"
+
+namespace {
+
+std::vector<int> random_ints(size_t n, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  std::vector<int> v(n);
+  for (auto& x : v) x = dist(gen);
+  return v;
+}
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(std::vector<int>& in, std::vector<double>& qs,
+                                                    std::vector<int>& quantiles, std::vector<int>& top) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(qs.data()));
+  taskData->inputs_count.emplace_back(qs.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(quantiles.data()));
+  taskData->outputs_count.emplace_back(quantiles.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(top.data()));
+  taskData->outputs_count.emplace_back(top.size());
+  return taskData;
+}
+
+void check(std::vector<int> in, std::vector<double> qs, size_t k) {
+  std::vector<int> quantiles(qs.size());
+  std::vector<int> top(k);
+  order_statistics_seq::OrderStatisticsSequential task(make_task_data(in, qs, quantiles, top));
+  ASSERT_TRUE(task.validation());
+  ASSERT_TRUE(task.pre_processing());
+  ASSERT_TRUE(task.run());
+  ASSERT_TRUE(task.post_processing());
+
+  std::sort(in.begin(), in.end());
+  for (size_t i = 0; i < qs.size(); i++) {
+    EXPECT_EQ(quantiles[i], in[static_cast<size_t>(qs[i] * static_cast<double>(in.size() - 1))]);
+  }
+  EXPECT_EQ(top, std::vector<int>(in.rbegin(), in.rbegin() + static_cast<std::ptrdiff_t>(k)));
+}
+
+}  // namespace
+
+TEST(order_statistics_seq, median_and_p99) { check(random_ints(100001, 1000000, 1), {0.5, 0.99}, 10); }
+
+TEST(order_statistics_seq, extremes_and_whole_top) { check(random_ints(1000, 100, 2), {0.0, 1.0}, 1000); }
+
+TEST(order_statistics_seq, duplicates) { check(random_ints(50000, 3, 3), {0.1, 0.5, 0.9, 0.5}, 100); }
+
+TEST(order_statistics_seq, single_element_without_top) { check({7}, {0.0, 0.5, 1.0}, 0); }
+
+TEST(order_statistics_seq, validation_rejects_bad_queries) {
+  std::vector<int> in = {1, 2, 3};
+  std::vector<double> qs = {1.5};
+  std::vector<int> quantiles(1);
+  std::vector<int> top(2);
+  order_statistics_seq::OrderStatisticsSequential out_of_range(make_task_data(in, qs, quantiles, top));
+  EXPECT_FALSE(out_of_range.validation());
+
+  qs = {0.5};
+  std::vector<int> too_many(4);
+  order_statistics_seq::OrderStatisticsSequential too_large_k(make_task_data(in, qs, quantiles, too_many));
+  EXPECT_FALSE(too_large_k.validation());
+
+  std::vector<int> empty;
+  order_statistics_seq::OrderStatisticsSequential no_input(make_task_data(empty, qs, quantiles, top));
+  EXPECT_FALSE(no_input.validation());
+}
@@ -0,0 +1,30 @@
+// Copyright 2024 Nesterov Alexander
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace order_statistics_seq {
+
+// Quantiles and top-k of a vector of ints without sorting it. inputs[0]
+// holds the n > 0 values, inputs[1] the quantiles q in [0, 1] as doubles;
+// outputs[0] receives the value of rank floor(q (n - 1)) for each q, and
+// outputs[1] the outputs_count[1] <= n largest values, largest first.
+class OrderStatisticsSequential : public ppc::core::Task {
+ public:
+  explicit OrderStatisticsSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  std::vector<int> input_, quantiles_, top_;
+  std::vector<double> qs_;
+  size_t k_{};
+};
+
+}  // namespace order_statistics_seq
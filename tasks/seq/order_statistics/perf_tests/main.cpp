@@ -0,0 +1,71 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "seq/order_statistics/include/ops_seq.hpp"
+
+namespace {
+
+template <typename Run>
+void run_perf(Run run) {
+  const size_t count = 1 << 24;
+  std::mt19937 gen(1);
+  std::vector<int> in(count);
+  for (auto& x : in) x = static_cast<int>(gen());
+  std::vector<double> qs = {0.5, 0.9, 0.99, 0.999};
+  std::vector<int> quantiles(qs.size());
+  std::vector<int> top(100);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskDataSeq->inputs_count.emplace_back(in.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(qs.data()));
+  taskDataSeq->inputs_count.emplace_back(qs.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(quantiles.data()));
+  taskDataSeq->outputs_count.emplace_back(quantiles.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(top.data()));
+  taskDataSeq->outputs_count.emplace_back(top.size());
+
+  // Create Task
+  auto task = std::make_shared<order_statistics_seq::OrderStatisticsSequential>(taskDataSeq);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perfAttr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  run(*perfAnalyzer, perfAttr, perfResults);
+  ppc::core::Perf::print_perf_statistic(perfResults);
+
+  std::sort(in.begin(), in.end());
+  EXPECT_EQ(quantiles[0], in[(count - 1) / 2]);
+  EXPECT_EQ(top[0], in.back());
+}
+
+}  // namespace
+
+TEST(order_statistics_seq_perf_test, test_pipeline_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.pipeline_run(attr, results); });
+}
+
+TEST(order_statistics_seq_perf_test, test_task_run) {
+  run_perf([](ppc::core::Perf& perf, const auto& attr, const auto& results) { perf.task_run(attr, results); });
+}
@@ -0,0 +1,43 @@
+// Copyright 2024 Nesterov Alexander
+#include "seq/order_statistics/include/ops_seq.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "core/sort/include/select.hpp"
+
+bool order_statistics_seq::OrderStatisticsSequential::pre_processing() {
+  internal_order_test();
+  const auto* input = reinterpret_cast<const int*>(taskData->inputs[0]);
+  input_.assign(input, input + taskData->inputs_count[0]);
+  const auto* qs = reinterpret_cast<const double*>(taskData->inputs[1]);
+  qs_.assign(qs, qs + taskData->inputs_count[1]);
+  k_ = taskData->outputs_count[1];
+  return true;
+}
+
+bool order_statistics_seq::OrderStatisticsSequential::validation() {
+  internal_order_test();
+  if (taskData->inputs.size() != 2 || taskData->inputs_count.size() != 2 || taskData->outputs.size() != 2 ||
+      taskData->outputs_count.size() != 2) {
+    return false;
+  }
+  const auto* qs = reinterpret_cast<const double*>(taskData->inputs[1]);
+  return taskData->inputs_count[0] > 0 && taskData->outputs_count[0] == taskData->inputs_count[1] &&
+         taskData->outputs_count[1] <= taskData->inputs_count[0] &&
+         std::all_of(qs, qs + taskData->inputs_count[1], [](double q) { return q >= 0.0 && q <= 1.0; });
+}
+
+bool order_statistics_seq::OrderStatisticsSequential::run() {
+  internal_order_test();
+  top_ = ppc::core::sort::top_k(input_, k_, std::greater<>());
+  quantiles_ = ppc::core::sort::quantiles(input_, qs_);
+  return true;
+}
+
+bool order_statistics_seq::OrderStatisticsSequential::post_processing() {
+  internal_order_test();
+  std::copy(quantiles_.begin(), quantiles_.end(), reinterpret_cast<int*>(taskData->outputs[0]));
+  std::copy(top_.begin(), top_.end(), reinterpret_cast<int*>(taskData->outputs[1]));
+  return true;
+}
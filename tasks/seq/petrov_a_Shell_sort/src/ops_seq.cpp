@@ -4,6 +4,8 @@
 #include <iostream>
 #include <limits>
 
+#include "core/sort/include/shell.hpp"
+
 namespace petrov_a_Shell_sort_seq {
 
 bool TestTaskSequential::pre_processing() {
@@ -26,18 +28,7 @@ bool TestTaskSequential::validation() {
 }
 
 bool TestTaskSequential::run() {
-  int n = data_.size();
-
-  for (int gap = n / 2; gap > 0; gap /= 2) {
-    for (int i = gap; i < n; ++i) {
-      int temp = data_[i];
-      int j;
-      for (j = i; j >= gap && data_[j - gap] > temp; j -= gap) {
-        data_[j] = data_[j - gap];
-      }
-      data_[j] = temp;
-    }
-  }
+  ppc::core::sort::shell_sort(data_);
 
   return true;
 }
@@ -60,6 +60,56 @@ void make_test(size_t n) {
   }
 }
 
+void make_band_test(size_t n, size_t kl, size_t ku) {
+  size_t ld = kl + ku + 1;
+  std::vector<double> band(ld * n, 0.0);
+  std::vector<double> rhs(n, 0.0);
+  std::vector<double> exp_results(n);
+  std::vector<size_t> params = {n, kl, ku};
+  std::vector<double> global_result(n);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> dist(-100.0, 100.0);
+  for (size_t i = 0; i < n; ++i) {
+    exp_results[i] = dist(gen);
+  }
+  for (size_t j = 0; j < n; ++j) {
+    size_t first = j > ku ? j - ku : 0;
+    size_t last = std::min(n - 1, j + kl);
+    for (size_t i = first; i <= last; ++i) {
+      double value = dist(gen);
+      if (i == j) {
+        value += (value < 0 ? -100.0 : 100.0) * static_cast<double>(ld);
+      }
+      band[j * ld + ku + i - j] = value;
+      rhs[i] += value * exp_results[j];
+    }
+  }
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(band.data()));
+  taskDataSeq->inputs_count.emplace_back(band.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(rhs.data()));
+  taskDataSeq->inputs_count.emplace_back(rhs.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(params.data()));
+  taskDataSeq->inputs_count.emplace_back(params.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+  taskDataSeq->outputs_count.emplace_back(global_result.size());
+
+  auto taskSequential = std::make_shared<polikanov_v_gauss_band_columns_seq::GaussBandStorageSequential>(taskDataSeq);
+  ASSERT_TRUE(taskSequential->validation());
+  taskSequential->pre_processing();
+  ASSERT_TRUE(taskSequential->run());
+  // a second run solves the same system again
+  ASSERT_TRUE(taskSequential->run());
+  taskSequential->post_processing();
+
+  for (size_t i = 0; i < n; i++) {
+    EXPECT_NEAR(global_result[i], exp_results[i], 0.01);
+  }
+}
+
 }  // namespace polikanov_v_gauss_band_columns_seq
 
 TEST(polikanov_v_gauss_band_columns_seq, test_random_with_matrix_size_2) {
@@ -125,3 +175,74 @@ TEST(polikanov_v_gauss_band_columns_seq, test_random_with_matrix_size_110) {
 TEST(polikanov_v_gauss_band_columns_seq, test_random_with_matrix_size_200) {
   polikanov_v_gauss_band_columns_seq::make_test(200);
 }
+
+TEST(polikanov_v_gauss_band_columns_seq, test_band_storage_tridiagonal_size_100) {
+  polikanov_v_gauss_band_columns_seq::make_band_test(100, 1, 1);
+}
+
+TEST(polikanov_v_gauss_band_columns_seq, test_band_storage_asymmetric_size_300) {
+  polikanov_v_gauss_band_columns_seq::make_band_test(300, 4, 2);
+}
+
+TEST(polikanov_v_gauss_band_columns_seq, test_band_storage_matches_dense) {
+  size_t n = 6;
+  size_t kl = 2;
+  size_t ku = 1;
+  std::vector<double> dense(n * n, 0.0);
+  std::vector<double> augmented(n * (n + 1), 0.0);
+  std::vector<double> rhs(n);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = (i > kl ? i - kl : 0); j <= std::min(n - 1, i + ku); ++j) {
+      dense[i * n + j] = (i == j) ? 0.5 : static_cast<double>(i + 2 * j + 1);
+    }
+    rhs[i] = static_cast<double>(i) - 2.0;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    std::copy(dense.begin() + i * n, dense.begin() + (i + 1) * n, augmented.begin() + i * (n + 1));
+    augmented[i * (n + 1) + n] = rhs[i];
+  }
+
+  auto banded = polikanov_v_gauss_band_columns_seq::BandMatrix::from_dense(dense, n, kl, ku);
+  ASSERT_TRUE(banded.factorize());
+  std::vector<double> band_result = rhs;
+  banded.solve(band_result);
+
+  std::vector<double> dense_result(n);
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(augmented.data()));
+  taskDataSeq->inputs_count.emplace_back(augmented.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+  taskDataSeq->inputs_count.emplace_back(1);
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(dense_result.data()));
+  taskDataSeq->outputs_count.emplace_back(dense_result.size());
+
+  polikanov_v_gauss_band_columns_seq::GaussBandColumnsSequential taskSequential(taskDataSeq);
+  ASSERT_TRUE(taskSequential.validation());
+  taskSequential.pre_processing();
+  taskSequential.run();
+  taskSequential.post_processing();
+
+  for (size_t i = 0; i < n; i++) {
+    EXPECT_NEAR(band_result[i], dense_result[i], 1e-9);
+  }
+}
+
+TEST(polikanov_v_gauss_band_columns_seq, test_band_storage_wrong_params) {
+  std::vector<double> band(12, 1.0);
+  std::vector<double> rhs(4, 1.0);
+  std::vector<size_t> params = {4, 4, 0};
+  std::vector<double> global_result(4);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(band.data()));
+  taskDataSeq->inputs_count.emplace_back(band.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(rhs.data()));
+  taskDataSeq->inputs_count.emplace_back(rhs.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(params.data()));
+  taskDataSeq->inputs_count.emplace_back(params.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+  taskDataSeq->outputs_count.emplace_back(global_result.size());
+
+  polikanov_v_gauss_band_columns_seq::GaussBandStorageSequential taskSequential(taskDataSeq);
+  EXPECT_FALSE(taskSequential.validation());
+}
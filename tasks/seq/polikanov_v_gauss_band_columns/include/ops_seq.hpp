@@ -2,9 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <vector>
 
+#include "core/linalg/include/band.hpp"
 #include "core/task/include/task.hpp"
 
 namespace polikanov_v_gauss_band_columns_seq {
@@ -308,6 +311,8 @@ class Matrix {
   size_t get_size() const { return data->size(); }
 };
 
+using ppc::core::linalg::BandMatrix;
+
 class GaussBandColumnsSequential : public ppc::core::Task {
  public:
   explicit GaussBandColumnsSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
@@ -322,4 +327,21 @@ class GaussBandColumnsSequential : public ppc::core::Task {
   std::vector<double> answers;
 };
 
+// Banded solver fed with the compact LAPACK band array instead of a dense
+// augmented matrix: O(n * (kl + ku)) memory and O(n * kl * (kl + ku)) time.
+// inputs: band ((kl + ku + 1) * n), b (n), {n, kl, ku}; outputs: x (n)
+class GaussBandStorageSequential : public ppc::core::Task {
+ public:
+  explicit GaussBandStorageSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  BandMatrix band;
+  std::vector<double> rhs;
+  std::vector<double> answers;
+};
+
 }  // namespace polikanov_v_gauss_band_columns_seq
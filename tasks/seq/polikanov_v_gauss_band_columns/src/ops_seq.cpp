@@ -145,3 +145,51 @@ bool polikanov_v_gauss_band_columns_seq::GaussBandColumnsSequential::post_proces
 
   return true;
 }
+
+bool polikanov_v_gauss_band_columns_seq::GaussBandStorageSequential::validation() {
+  internal_order_test();
+
+  if (taskData->inputs.size() != 3 || taskData->inputs_count[2] != 3 || taskData->outputs.empty()) {
+    return false;
+  }
+  auto* params = reinterpret_cast<size_t*>(taskData->inputs[2]);
+  size_t n = params[0];
+  size_t kl = params[1];
+  size_t ku = params[2];
+  return n >= 1 && kl < n && ku < n && taskData->inputs_count[0] == (kl + ku + 1) * n &&
+         taskData->inputs_count[1] == n && taskData->outputs_count[0] == n;
+}
+
+bool polikanov_v_gauss_band_columns_seq::GaussBandStorageSequential::pre_processing() {
+  internal_order_test();
+
+  auto* params = reinterpret_cast<size_t*>(taskData->inputs[2]);
+  band = BandMatrix::from_compact(reinterpret_cast<double*>(taskData->inputs[0]), params[0], params[1], params[2]);
+  auto* rhs_data = reinterpret_cast<double*>(taskData->inputs[1]);
+  rhs.assign(rhs_data, rhs_data + params[0]);
+
+  return true;
+}
+
+bool polikanov_v_gauss_band_columns_seq::GaussBandStorageSequential::run() {
+  internal_order_test();
+
+  // factor a copy, so that every run starts from the input matrix
+  BandMatrix factors = band;
+  if (!factors.factorize()) {
+    return false;
+  }
+  answers = rhs;
+  factors.solve(answers);
+
+  return true;
+}
+
+bool polikanov_v_gauss_band_columns_seq::GaussBandStorageSequential::post_processing() {
+  internal_order_test();
+
+  auto* output_data = reinterpret_cast<double*>(taskData->outputs[0]);
+  std::copy(answers.begin(), answers.end(), output_data);
+
+  return true;
+}
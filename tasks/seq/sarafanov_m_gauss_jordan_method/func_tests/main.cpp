@@ -53,3 +53,85 @@ TEST(sarafanov_m_gauss_jordan_method_seq, five_simple_matrix_at_1_iter) {
   EXPECT_FALSE(taskSequential.run());
   taskSequential.post_processing();
 }
+
+TEST(sarafanov_m_gauss_jordan_method_seq, multi_rhs_three_simple_matrix) {
+  std::vector<double> a = {1, 2, 1, 4, 8, 3, 2, 5, 9};
+  std::vector<double> b = {10, 4, 20, 15, 30, 16};
+  int n = 3;
+  std::vector<double> output_result(b.size());
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+  taskDataSeq->inputs_count.emplace_back(a.size());
+
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+  taskDataSeq->inputs_count.emplace_back(1);
+
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  taskDataSeq->inputs_count.emplace_back(b.size());
+
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(output_result.data()));
+  taskDataSeq->outputs_count.emplace_back(output_result.size());
+
+  sarafanov_m_gauss_jordan_method_seq::GaussJordanMultiRHSSequential taskSequential(taskDataSeq);
+  ASSERT_TRUE(taskSequential.validation());
+  ASSERT_TRUE(taskSequential.pre_processing());
+  ASSERT_TRUE(taskSequential.run());
+  ASSERT_TRUE(taskSequential.post_processing());
+
+  std::vector<double> expected_result = {250, 1, -130, 1, 20, 1};
+  for (size_t i = 0; i < expected_result.size(); i++) {
+    EXPECT_NEAR(output_result[i], expected_result[i], 1e-9);
+  }
+}
+
+TEST(sarafanov_m_gauss_jordan_method_seq, multi_rhs_inverse) {
+  std::vector<double> a = {0, 1, 2, 0};
+  int n = 2;
+  std::vector<double> output_result(n * n);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+  taskDataSeq->inputs_count.emplace_back(a.size());
+
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+  taskDataSeq->inputs_count.emplace_back(1);
+
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(output_result.data()));
+  taskDataSeq->outputs_count.emplace_back(output_result.size());
+
+  sarafanov_m_gauss_jordan_method_seq::GaussJordanMultiRHSSequential taskSequential(taskDataSeq);
+  ASSERT_TRUE(taskSequential.validation());
+  taskSequential.pre_processing();
+  taskSequential.run();
+  taskSequential.post_processing();
+
+  std::vector<double> expected_result = {0, 0.5, 1, 0};
+  ASSERT_EQ(output_result, expected_result);
+}
+
+TEST(sarafanov_m_gauss_jordan_method_seq, multi_rhs_wrong_output_size) {
+  std::vector<double> a = {1, 2, 3, 4};
+  std::vector<double> b = {1, 2, 3, 4};
+  int n = 2;
+  std::vector<double> output_result(n);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+  taskDataSeq->inputs_count.emplace_back(a.size());
+
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+  taskDataSeq->inputs_count.emplace_back(1);
+
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  taskDataSeq->inputs_count.emplace_back(b.size());
+
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(output_result.data()));
+  taskDataSeq->outputs_count.emplace_back(output_result.size());
+
+  sarafanov_m_gauss_jordan_method_seq::GaussJordanMultiRHSSequential taskSequential(taskDataSeq);
+  ASSERT_FALSE(taskSequential.validation());
+}
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/gauss_jordan.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sarafanov_m_gauss_jordan_method_seq {
@@ -27,4 +28,22 @@ class GaussJordanMethodSequential : public ppc::core::Task {
   int n;
 };
 
+// Factors A once in pre_processing and solves a whole n x k block of
+// right-hand sides per run (A^-1 when no block is given).
+// inputs: A (n * n), n, optional B (n * k); outputs: X (n * k)
+class GaussJordanMultiRHSSequential : public ppc::core::Task {
+ public:
+  explicit GaussJordanMultiRHSSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int n = 0;
+  int k = 0;
+  std::vector<double> rhs;
+  ppc::core::linalg::GaussJordanSolver solver;
+};
+
 }  // namespace sarafanov_m_gauss_jordan_method_seq
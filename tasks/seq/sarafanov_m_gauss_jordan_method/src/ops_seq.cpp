@@ -116,3 +116,60 @@ bool sarafanov_m_gauss_jordan_method_seq::GaussJordanMethodSequential::post_proc
 
   return true;
 }
+
+bool sarafanov_m_gauss_jordan_method_seq::GaussJordanMultiRHSSequential::validation() {
+  internal_order_test();
+  if (taskData->inputs.size() < 2 || taskData->outputs.empty()) {
+    return false;
+  }
+  int n_val = *reinterpret_cast<int*>(taskData->inputs[1]);
+  if (n_val <= 0 || static_cast<uint32_t>(n_val * n_val) != taskData->inputs_count[0]) {
+    return false;
+  }
+  uint32_t rhs_size = static_cast<uint32_t>(n_val * n_val);
+  if (taskData->inputs.size() > 2) {
+    rhs_size = taskData->inputs_count[2];
+    if (rhs_size == 0 || rhs_size % n_val != 0) {
+      return false;
+    }
+  }
+  return taskData->outputs_count[0] == rhs_size;
+}
+
+bool sarafanov_m_gauss_jordan_method_seq::GaussJordanMultiRHSSequential::pre_processing() {
+  internal_order_test();
+
+  n = *reinterpret_cast<int*>(taskData->inputs[1]);
+  k = taskData->inputs.size() > 2 ? static_cast<int>(taskData->inputs_count[2]) / n : n;
+
+  return solver.factor(reinterpret_cast<double*>(taskData->inputs[0]), n);
+}
+
+bool sarafanov_m_gauss_jordan_method_seq::GaussJordanMultiRHSSequential::run() {
+  internal_order_test();
+
+  if (!solver.factored()) {
+    return false;
+  }
+  if (taskData->inputs.size() > 2) {
+    auto* rhs_data = reinterpret_cast<double*>(taskData->inputs[2]);
+    rhs.assign(rhs_data, rhs_data + taskData->inputs_count[2]);
+    solver.solve(rhs, k);
+  } else {
+    rhs = solver.inverse();
+  }
+
+  return true;
+}
+
+bool sarafanov_m_gauss_jordan_method_seq::GaussJordanMultiRHSSequential::post_processing() {
+  internal_order_test();
+
+  if (!solver.factored()) {
+    return false;
+  }
+  auto* output_data = reinterpret_cast<double*>(taskData->outputs[0]);
+  std::copy(rhs.begin(), rhs.end(), output_data);
+
+  return true;
+}
@@ -138,3 +138,79 @@ TEST(shkurinskaya_e_gauss_jordan_seq, Test_Gauss_Overdetermined_System) {
 
   ASSERT_FALSE(gaussTaskSequential.validation());
 }
+
+TEST(shkurinskaya_e_gauss_jordan_seq, Test_Multi_RHS_3x3) {
+  int n = 3;
+  std::vector<double> a = {1, 2, 1, 4, 8, 3, 2, 5, 9};
+  std::vector<double> b = {10, 4, 20, 15, 30, 16};
+  std::vector<double> expected_output = {250, 1, -130, 1, 20, 1};
+  std::vector<double> out(b.size(), 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(&n));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+  taskDataSeq->inputs_count.emplace_back(n);
+  taskDataSeq->inputs_count.emplace_back(a.size());
+  taskDataSeq->inputs_count.emplace_back(b.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  shkurinskaya_e_gauss_jordan_seq::MultiRHSTaskSequential gaussTaskSequential(taskDataSeq);
+
+  ASSERT_TRUE(gaussTaskSequential.validation());
+  ASSERT_TRUE(gaussTaskSequential.pre_processing());
+  ASSERT_TRUE(gaussTaskSequential.run());
+  ASSERT_TRUE(gaussTaskSequential.post_processing());
+
+  for (size_t i = 0; i < out.size(); ++i) {
+    ASSERT_NEAR(out[i], expected_output[i], 1e-9);
+  }
+}
+
+TEST(shkurinskaya_e_gauss_jordan_seq, Test_Multi_RHS_Inverse) {
+  int n = 2;
+  std::vector<double> a = {2, 3, 4, 1};
+  std::vector<double> expected_output = {-0.1, 0.3, 0.4, -0.2};
+  std::vector<double> out(n * n, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(&n));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  taskDataSeq->inputs_count.emplace_back(n);
+  taskDataSeq->inputs_count.emplace_back(a.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  shkurinskaya_e_gauss_jordan_seq::MultiRHSTaskSequential gaussTaskSequential(taskDataSeq);
+
+  ASSERT_TRUE(gaussTaskSequential.validation());
+  gaussTaskSequential.pre_processing();
+  gaussTaskSequential.run();
+  gaussTaskSequential.post_processing();
+
+  for (int i = 0; i < n * n; ++i) {
+    ASSERT_NEAR(out[i], expected_output[i], 1e-9);
+  }
+}
+
+TEST(shkurinskaya_e_gauss_jordan_seq, Test_Multi_RHS_Singular) {
+  int n = 2;
+  std::vector<double> a = {1, 2, 2, 4};
+  std::vector<double> out(n * n, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(&n));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  taskDataSeq->inputs_count.emplace_back(n);
+  taskDataSeq->inputs_count.emplace_back(a.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  shkurinskaya_e_gauss_jordan_seq::MultiRHSTaskSequential gaussTaskSequential(taskDataSeq);
+
+  ASSERT_TRUE(gaussTaskSequential.validation());
+  EXPECT_FALSE(gaussTaskSequential.pre_processing());
+  EXPECT_FALSE(gaussTaskSequential.run());
+  EXPECT_FALSE(gaussTaskSequential.post_processing());
+}
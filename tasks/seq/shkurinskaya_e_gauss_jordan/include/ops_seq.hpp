@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/linalg/include/gauss_jordan.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shkurinskaya_e_gauss_jordan_seq {
@@ -22,4 +23,22 @@ class TestTaskSequential : public ppc::core::Task {
   std::vector<double> solution;
 };
 
+// Gauss-Jordan factorization of A reused for a block of k right-hand sides
+// (A^-1 when no block is given); repeated runs only replay the elimination.
+// inputs: n, A (n * n), optional B (n * k); outputs: X (n * k)
+class MultiRHSTaskSequential : public ppc::core::Task {
+ public:
+  explicit MultiRHSTaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  int n = 0;
+  int k = 0;
+  std::vector<double> rhs;
+  ppc::core::linalg::GaussJordanSolver solver;
+};
+
 }  // namespace shkurinskaya_e_gauss_jordan_seq
@@ -89,3 +89,49 @@ bool shkurinskaya_e_gauss_jordan_seq::TestTaskSequential::post_processing() {
   }
   return true;
 }
+
+bool shkurinskaya_e_gauss_jordan_seq::MultiRHSTaskSequential::validation() {
+  internal_order_test();
+  if (taskData->inputs.size() < 2 || taskData->outputs.empty()) {
+    std::cout << "Validation failed: matrix or output is missing!" << std::endl;
+    return false;
+  }
+  int numRows = taskData->inputs_count[0];
+  if (numRows <= 0 || taskData->inputs_count[1] != static_cast<uint32_t>(numRows * numRows)) {
+    std::cout << "Validation failed: matrix size mismatch!" << std::endl;
+    return false;
+  }
+  uint32_t rhsSize = taskData->inputs.size() > 2 ? taskData->inputs_count[2] : taskData->inputs_count[1];
+  if (rhsSize == 0 || rhsSize % numRows != 0 || taskData->outputs_count[0] != rhsSize) {
+    std::cout << "Validation failed: right-hand side size mismatch!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool shkurinskaya_e_gauss_jordan_seq::MultiRHSTaskSequential::pre_processing() {
+  internal_order_test();
+  n = *reinterpret_cast<int*>(taskData->inputs[0]);
+  k = taskData->inputs.size() > 2 ? static_cast<int>(taskData->inputs_count[2]) / n : n;
+  return solver.factor(reinterpret_cast<double*>(taskData->inputs[1]), n);
+}
+
+bool shkurinskaya_e_gauss_jordan_seq::MultiRHSTaskSequential::run() {
+  internal_order_test();
+  if (!solver.factored()) return false;
+  if (taskData->inputs.size() > 2) {
+    rhs = std::vector<double>(reinterpret_cast<double*>(taskData->inputs[2]),
+                              reinterpret_cast<double*>(taskData->inputs[2]) + n * k);
+    solver.solve(rhs, k);
+  } else {
+    rhs = solver.inverse();
+  }
+  return true;
+}
+
+bool shkurinskaya_e_gauss_jordan_seq::MultiRHSTaskSequential::post_processing() {
+  internal_order_test();
+  if (!solver.factored()) return false;
+  std::copy(rhs.begin(), rhs.end(), reinterpret_cast<double*>(taskData->outputs[0]));
+  return true;
+}
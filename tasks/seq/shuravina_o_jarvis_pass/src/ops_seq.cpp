@@ -1,7 +1,28 @@
 #include "seq/shuravina_o_jarvis_pass/include/ops_seq.hpp"
 
+#include "core/geometry/include/hull.hpp"
+
 namespace shuravina_o_jarvis_pass {
 
+namespace {
+
+template <typename It>
+ppc::core::geometry::PointSet<int> toPointSet(It first, It last) {
+  ppc::core::geometry::PointSet<int> set;
+  set.reserve(last - first);
+  for (It it = first; it != last; ++it) set.push_back(it->x, it->y);
+  return set;
+}
+
+std::vector<Point> fromHull(const std::vector<ppc::core::geometry::Point<int>>& hull) {
+  std::vector<Point> res;
+  res.reserve(hull.size());
+  for (const auto& p : hull) res.emplace_back(p.x, p.y);
+  return res;
+}
+
+}  // namespace
+
 void JarvisPassSeq::run() { hull_ = jarvis_march(points_); }
 
 std::vector<Point> JarvisPassSeq::get_hull() const { return hull_; }
@@ -11,34 +32,7 @@ bool JarvisPassSeq::validation() const { return points_.size() >= 3; }
 std::vector<Point> jarvis_march(const std::vector<Point>& points) {
   int n = points.size();
   if (n < 3) return points;
-
-  std::vector<Point> hull;
-
-  int l = 0;
-  for (int i = 1; i < n; i++) {
-    if (points[i] < points[l]) {
-      l = i;
-    }
-  }
-
-  int p = l;
-  int q;
-  do {
-    hull.push_back(points[p]);
-    q = (p + 1) % n;
-
-    for (int i = 0; i < n; i++) {
-      if ((points[i].y - points[p].y) * (points[q].x - points[i].x) -
-              (points[i].x - points[p].x) * (points[q].y - points[i].y) <
-          0) {
-        q = i;
-      }
-    }
-
-    p = q;
-  } while (p != l);
-
-  return hull;
+  return fromHull(ppc::core::geometry::convex_hull(toPointSet(points.begin(), points.end())));
 }
 
-}  // namespace shuravina_o_jarvis_pass
\ No newline at end of file
+}  // namespace shuravina_o_jarvis_pass
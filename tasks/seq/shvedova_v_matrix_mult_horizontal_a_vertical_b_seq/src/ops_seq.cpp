@@ -2,6 +2,8 @@
 
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+
 bool shvedova_v_matrix_mult_horizontal_a_vertical_b_seq::MatrixMultiplicationTaskSequential::pre_processing() {
   internal_order_test();
 
@@ -48,15 +50,8 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_seq::MatrixMultiplicationTas
 bool shvedova_v_matrix_mult_horizontal_a_vertical_b_seq::MatrixMultiplicationTaskSequential::run() {
   internal_order_test();
 
-  for (size_t i = 0; i < row_a; ++i) {
-    for (size_t j = 0; j < col_b; ++j) {
-      int sum = 0;
-      for (size_t k = 0; k < col_a; ++k) {
-        sum += matrix_a[i * col_a + k] * matrix_b[k * col_b + j];
-      }
-      matrix_c[i * col_b + j] = sum;
-    }
-  }
+  ppc::core::linalg::gemm(static_cast<int>(row_a), static_cast<int>(col_b), static_cast<int>(col_a), matrix_a.data(),
+                          matrix_b.data(), matrix_c.data());
 
   return true;
 }
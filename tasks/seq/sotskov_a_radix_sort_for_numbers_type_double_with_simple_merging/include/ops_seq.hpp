@@ -20,6 +20,5 @@ class TestTaskSequential : public ppc::core::Task {
 };
 
 void radixSortWithSignHandling(std::vector<double>& data);
-void radixSort(std::vector<double>& data, int num_bits, int radix);
 
 }  // namespace sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_seq
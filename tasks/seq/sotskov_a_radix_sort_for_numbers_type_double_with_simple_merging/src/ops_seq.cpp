@@ -1,5 +1,7 @@
 #include "seq/sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging/include/ops_seq.hpp"
 
+#include "core/sort/include/radix.hpp"
+
 bool sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
   auto* input_ptr = reinterpret_cast<double*>(taskData->inputs[0]);
@@ -31,52 +33,5 @@ bool sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_seq::TestT
 
 void sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_seq::radixSortWithSignHandling(
     std::vector<double>& data) {
-  const int num_bits = sizeof(double) * 8;
-  const int radix = 2;
-
-  std::vector<double> positives;
-  std::vector<double> negatives;
-
-  for (double num : data) {
-    if (num < 0) {
-      negatives.push_back(-num);
-    } else {
-      positives.push_back(num);
-    }
-  }
-
-  radixSort(positives, num_bits, radix);
-  radixSort(negatives, num_bits, radix);
-
-  for (double& num : negatives) {
-    num = -num;
-  }
-
-  data.clear();
-  data.insert(data.end(), negatives.rbegin(), negatives.rend());
-  data.insert(data.end(), positives.begin(), positives.end());
-}
-
-void sotskov_a_radix_sort_for_numbers_type_double_with_simple_merging_seq::radixSort(std::vector<double>& data,
-                                                                                     int num_bits, int radix) {
-  std::vector<std::vector<double>> buckets(radix);
-  std::vector<double> output(data.size());
-
-  for (int exp = 0; exp < num_bits; ++exp) {
-    for (auto& num : data) {
-      uint64_t bits = *reinterpret_cast<uint64_t*>(&num);
-      int digit = (bits >> exp) & 1;
-      buckets[digit].push_back(num);
-    }
-
-    int index = 0;
-    for (int i = 0; i < radix; ++i) {
-      for (auto& num : buckets[i]) {
-        output[index++] = num;
-      }
-      buckets[i].clear();
-    }
-
-    data = output;
-  }
+  ppc::core::sort::radix_sort(data);
 }
@@ -3,20 +3,14 @@
 
 #include <vector>
 
+#include "core/geometry/include/hull.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vladimirova_j_jarvis_method_seq {
-struct Point {
-  int x, y;
-  Point() {
-    x = 0;
-    y = 0;
-  }
-  Point(int _x, int _y) {
-    x = _x;
-    y = _y;
-  }
-};
+
+// Hull of the dark pixels as (row, col) pairs, from the leftmost pixel of
+// the bottom row and clockwise on the screen.
+std::vector<int> jarvisMethod(const ppc::core::geometry::PointSet<int>& points);
 
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -27,7 +21,7 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<Point> input_;
+  ppc::core::geometry::PointSet<int> input_;
   std::vector<int> res_;
   size_t col = 0, row = 0;
 };
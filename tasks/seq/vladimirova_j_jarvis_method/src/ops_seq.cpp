@@ -1,54 +1,33 @@
 #include "seq/vladimirova_j_jarvis_method/include/ops_seq.hpp"
 
-#include <cmath>
+#include <algorithm>
 #include <thread>
 
 using namespace std::chrono_literals;
 
-namespace vladimirova_j_jarvis_method_seq {
-size_t FindMinAngle(vladimirova_j_jarvis_method_seq::Point* A, vladimirova_j_jarvis_method_seq::Point* B,
-                    std::vector<vladimirova_j_jarvis_method_seq::Point> vec) {
-  size_t min_angle_point = vec.size() + 1;
-  double min_angle = 550;
-  int reg_x = A->x - (B->x);
-  int reg_y = -(A->y - B->y);  // y идет вниз
-  for (size_t i = 0; i < vec.size(); i++) {
-    vladimirova_j_jarvis_method_seq::Point* C = &vec[i];
-    if (C->x < 0) continue;
-    if ((A->x == C->x) && (A->y == C->y)) continue;
-    if ((B->x == C->x) && (B->y == C->y)) continue;
-    int tmp_x = (C->x - B->x);
-    int tmp_y = -(C->y - B->y);
-    if (reg_x * tmp_y - reg_y * tmp_x <= 0) {
-      double BA_length = sqrt(reg_x * reg_x + reg_y * reg_y);
-      double BC_length = sqrt(tmp_x * tmp_x + tmp_y * tmp_y);
-      double length = BA_length * BC_length;
-      double angle = tmp_x * reg_x + tmp_y * reg_y;
-      if (length == 0)
-        angle = 0;
-      else
-        angle = angle / (length);
-      if (angle < min_angle) {
-        min_angle = angle;
-        min_angle_point = i;
-      }
-    }
-  }
-
-  return min_angle_point;
+std::vector<int> vladimirova_j_jarvis_method_seq::jarvisMethod(const ppc::core::geometry::PointSet<int>& points) {
+  auto hull = ppc::core::geometry::convex_hull(points);
+  // rows grow downwards, so the counterclockwise hull turns the other way
+  // on the screen
+  std::reverse(hull.begin(), hull.end());
+  ppc::core::geometry::start_at(hull,
+                                [](const auto& a, const auto& b) { return a.y > b.y || (a.y == b.y && a.x < b.x); });
+  std::vector<int> res;
+  res.reserve(2 * hull.size());
+  for (const auto& p : hull) res.insert(res.end(), {p.y, p.x});
+  return res;
 }
-}  // namespace vladimirova_j_jarvis_method_seq
 
 bool vladimirova_j_jarvis_method_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
   // Init value for input and output
-  input_ = std::vector<vladimirova_j_jarvis_method_seq::Point>();
+  input_ = ppc::core::geometry::PointSet<int>();
   col = (size_t)taskData->inputs_count[1];
   row = (size_t)taskData->inputs_count[0];
   auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
   for (size_t i = 0; i < col * row; i++) {
     if (tmp_ptr[i] != 255) {
-      input_.emplace_back((int)(i % col), (int)(i / col));
+      input_.push_back((int)(i % col), (int)(i / col));
     }
   }
   res_.clear();
@@ -84,36 +63,7 @@ bool vladimirova_j_jarvis_method_seq::TestTaskSequential::validation() {
 
 bool vladimirova_j_jarvis_method_seq::TestTaskSequential::run() {
   internal_order_test();
-  // поиск нижней левой точки
-  // x0 y0 x1 y1  x2 y2
-  vladimirova_j_jarvis_method_seq::Point* A = &input_[input_.size() - 1];
-  // последн¤¤ точка итак сама¤ нижн¤¤, надо найти самую правую
-
-  for (size_t i = input_.size() - 1; i >= 0; i--) {  // y1
-    if (A->y != input_[i].y) break;
-    A = &input_[i];
-  }
-  vladimirova_j_jarvis_method_seq::Point* first = A;
-  // работа
-  // vladimirova_j_jarvis_method_seq::Point tmp = vladimirova_j_jarvis_method_seq::Point((int)row, (int)col);
-  vladimirova_j_jarvis_method_seq::Point tmp = vladimirova_j_jarvis_method_seq::Point(-1, A->y);
-  // vladimirova_j_jarvis_method_seq::Point * B = &tmp;
-  vladimirova_j_jarvis_method_seq::Point* B = A;
-  A = &tmp;
-  res_ = std::vector<int>();
-  do {
-    size_t i = vladimirova_j_jarvis_method_seq::FindMinAngle(A, B, input_);
-    if (A != first) {
-      A->x = -1;
-      A->y = -1;
-    }
-    A = B;
-    res_.push_back(A->y);
-    res_.push_back(A->x);
-    B = &input_[i];
-
-  } while (B != first);
-
+  res_ = jarvisMethod(input_);
   return true;
 }
 
@@ -3,6 +3,8 @@
 #include <functional>
 #include <thread>
 
+#include "core/sort/include/shell.hpp"
+
 using namespace std::chrono_literals;
 
 bool volochaev_s_shell_sort_with_simple_merge_16_seq::Lab3_16::pre_processing() {
@@ -26,21 +28,7 @@ bool volochaev_s_shell_sort_with_simple_merge_16_seq::Lab3_16::validation() {
 bool volochaev_s_shell_sort_with_simple_merge_16_seq::Lab3_16::run() {
   internal_order_test();
 
-  int n = size_;
-  int gap = n / 2;
-
-  while (gap > 0) {
-    for (int i = gap; i < n; ++i) {
-      int temp = mas[i];
-      int j = i;
-      while (j >= gap && mas[j - gap] > temp) {
-        mas[j] = mas[j - gap];
-        j -= gap;
-      }
-      mas[j] = temp;
-    }
-    gap /= 2;
-  }
+  ppc::core::sort::shell_sort(mas, mas + size_);
 
   return true;
 }
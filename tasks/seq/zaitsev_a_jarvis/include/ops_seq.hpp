@@ -40,25 +40,7 @@ class Jarvis : public ppc::core::Task {
       return true;
     }
 
-    unsigned int start = 0;
-    for (unsigned int i = 1; i < length; i++)
-      if (set[i].y < set[start].y || (set[i].y == set[start].y && set[i].x < set[start].x)) start = i;
-
-    unsigned int prev = start;
-    unsigned int next;
-
-    do {
-      convex_hull.push_back(set[prev]);
-      next = (prev + 1) % length;
-
-      for (unsigned int supposed = 0; supposed < length; supposed++) {
-        if (orientation(set[prev], set[supposed], set[next]) == 2) next = supposed;
-        if (prev != supposed && set[next].between(set[prev], set[supposed])) next = supposed;
-      }
-
-      prev = next;
-
-    } while (prev != start);
+    convex_hull = from_lowest(ppc::core::geometry::chan_hull(to_point_set(set)));
 
     return true;
   };
@@ -2,6 +2,9 @@
 
 #include <algorithm>
 #include <iostream>
+#include <vector>
+
+#include "core/geometry/include/hull.hpp"
 
 #define UNUSED(x) (void)(x)
 
@@ -46,4 +49,26 @@ int orientation(zaitsev_a_jarvis_seq::Point<T> p, zaitsev_a_jarvis_seq::Point<T>
   if (vp == 0) return 0;
   return (vp > 0) ? 1 : 2;
 }
+
+// The set as coordinate arrays for the hull engine.
+template <typename T>
+ppc::core::geometry::PointSet<T> to_point_set(const std::vector<zaitsev_a_jarvis_seq::Point<T>>& set) {
+  ppc::core::geometry::PointSet<T> points;
+  points.reserve(set.size());
+  for (const auto& p : set) points.push_back(p.x, p.y);
+  return points;
+}
+
+// A hull from the engine, counter-clockwise from its lowest point (the
+// leftmost of those), which is where the gift wrapping starts.
+template <typename T>
+std::vector<zaitsev_a_jarvis_seq::Point<T>> from_lowest(std::vector<ppc::core::geometry::Point<T>> hull) {
+  ppc::core::geometry::start_at(hull, [](const auto& a, const auto& b) {
+    return a.y < b.y || (a.y == b.y && a.x < b.x);
+  });
+  std::vector<zaitsev_a_jarvis_seq::Point<T>> result;
+  result.reserve(hull.size());
+  for (const auto& p : hull) result.push_back({p.x, p.y});
+  return result;
+}
 }  // namespace zaitsev_a_jarvis_seq
\ No newline at end of file